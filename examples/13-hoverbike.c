@@ -10,11 +10,13 @@ int main() {
     Object* hoverbike;
     Material* mat0;
     Material* mat1;
+    Text* text;
 
     /* Setup */
     wzInitWiz3D();
     wzSetScreen(800, 600, FALSE, TRUE);
     wzSetScreenTitle("Hoverbike");
+    text = wzCreateText(TEXT);
 
     /* Create and position viewer */
     viewer = wzCreateViewer();
@@ -55,10 +57,11 @@ int main() {
         /* Draw UI */
         wzSetup2D();
         wzSetDrawColor(wzGetRGB(240, 240, 240));
-        wzDrawText(TEXT, (wzGetScreenWidth() - wzGetTextWidth(TEXT)) / 2, 8);
+        wzDrawTextObject(text, (wzGetScreenWidth() - wzGetTextObjectWidth(text)) / 2, 8);
         wzRefreshScreen();
     }
 
     /* Shutdown */
+    wzDeleteText(text);
     wzShutdownWiz3D();
 }
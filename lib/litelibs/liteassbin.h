@@ -10,6 +10,8 @@ No warranty implied. Use as you wish and at your own risk
 #ifndef LITE_ASSBIN_H
 #define LITE_ASSBIN_H
 
+#include <stddef.h>
+
 #ifdef LITE_ASSBIN_USE_GFX
 #include "litegfx.h"
 #endif
@@ -69,7 +71,7 @@ typedef struct
 typedef struct
 {
   unsigned short  num_indices;
-  void* indices; /* unsigned short if num_indices <= 65536, otherwise unsigned int */
+  const void* indices; /* unsigned short if num_vertices < 65536, otherwise unsigned int */
 } lassbin_face_t;
 
 /* mesh */
@@ -81,13 +83,13 @@ typedef struct
   int num_bones;
   int material_index;
   int components;
-  float* positions;
-  float* normals;
-  float* tangents;
-  float* bitangents;
-  float* colors[LASSBIN_MAX_COLOR_SETS];
-  int    numuvs[LASSBIN_MAX_TEXCOORD_SETS];
-  float* texcoords[LASSBIN_MAX_TEXCOORD_SETS];
+  const float* positions; /* arrays point into the source buffer when it is suitably aligned */
+  const float* normals;
+  const float* tangents;
+  const float* bitangents;
+  const float* colors[LASSBIN_MAX_COLOR_SETS];
+  int          numuvs[LASSBIN_MAX_TEXCOORD_SETS];
+  const float* texcoords[LASSBIN_MAX_TEXCOORD_SETS]; /* 3 components per vertex */
   lassbin_face_t* faces;
 } lassbin_mesh_t;
 
@@ -112,10 +114,10 @@ typedef struct
 /* texture */
 typedef struct
 {
-  int            width;
-  int            height;
-  char           format_hint[4];
-  unsigned char* data;
+  int                  width;
+  int                  height;
+  char                 format_hint[4];
+  const unsigned char* data; /* points into the source buffer */
 } lassbin_texture_t;
 
 /* scene */
@@ -131,11 +133,17 @@ typedef struct
   lassbin_mesh_t* meshes;
   lassbin_material_t* materials;
   lassbin_texture_t* textures;
+  void** allocations; /* blocks owned by the scene, released by lassbin_free */
+  int num_allocations;
+  char* inflated; /* inflated body of a compressed file, returned to the pool by lassbin_free */
+  size_t inflated_capacity;
 } lassbin_scene_t;
 
+/* the scene references the data in mem, so it must be kept alive until lassbin_free is called */
 lassbin_scene_t* lassbin_load(const char* filename);
-lassbin_scene_t* lassbin_loadmem(const char* mem);
+lassbin_scene_t* lassbin_loadmem(const char* mem, size_t size);
 void lassbin_free(lassbin_scene_t* scene);
+void lassbin_freepool(); /* releases the buffer kept for inflating compressed files */
 const char* lassbin_matname(const lassbin_material_t* material);
 int lassbin_matnumtextures(const lassbin_material_t* material, int type);
 const char* lassbin_mattexturename(const lassbin_material_t* material, int type, int index);
@@ -149,9 +157,11 @@ float lassbin_matshinpercent(const lassbin_material_t* material);
 /*const char* lassbin_matblend(const lassbin_material_t* material);*/
 unsigned int lassbin_texturesize(const lassbin_texture_t* texture);
 
+int lassbin_numindices(const lassbin_mesh_t* mesh);
+int lassbin_getindices(const lassbin_mesh_t* mesh, unsigned short* out_indices); /* fails if the mesh needs 32 bit indices */
+
 #ifdef LITE_ASSBIN_USE_GFX
-lvert_t* lassbin_getvertices(const lassbin_mesh_t* mesh);
-unsigned short* lassbin_getindices(const lassbin_mesh_t* mesh, int* num_indices);
+void lassbin_getvertices(const lassbin_mesh_t* mesh, lvert_t* out_vertices);
 #endif
 
 #ifdef __cplusplus
@@ -208,20 +218,39 @@ extern "C" {
 typedef struct
 {
   const char* data;
+  size_t size;
   size_t offset;
+  int error; /* set when a read goes past the end of the data */
 } lassbin_stream_t;
 
 
-static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream);
+static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream, lassbin_scene_t* scene);
 static int _lassbin_load_node(lassbin_stream_t* stream);
-static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_mesh_t* mesh);
+static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_scene_t* scene, lassbin_mesh_t* mesh);
 static int _lassbin_load_material(lassbin_stream_t* stream, lassbin_material_t* material);
 static int _lassbin_load_matproperty(lassbin_stream_t* stream, lassbin_matproperty_t* prop);
 static int _lassbin_load_texture(lassbin_stream_t* stream, lassbin_texture_t* texture);
 static void _lassbin_load_string(lassbin_stream_t* stream, char* out, int len);
 static void _lassbin_skip(lassbin_stream_t* stream);
-static void _lassbin_init_stream(lassbin_stream_t* stream, const char* data);
+static void _lassbin_init_stream(lassbin_stream_t* stream, const char* data, size_t size);
+static int _lassbin_check_stream(lassbin_stream_t* stream, size_t size);
+static int _lassbin_check_count(lassbin_stream_t* stream, int count, size_t elem_size);
 static void _lassbin_read_stream(lassbin_stream_t* stream, void* buffer, size_t size);
+static const void* _lassbin_view_stream(lassbin_stream_t* stream, lassbin_scene_t* scene, size_t size, size_t align);
+static void _lassbin_add_allocation(lassbin_scene_t* scene, void* block);
+#ifdef LITE_ASSBIN_USE_STBI
+static lassbin_scene_t* _lassbin_load_compressed(lassbin_stream_t* stream);
+#endif
+static char* _lassbin_acquire_pool(size_t size, size_t* out_capacity);
+static void _lassbin_release_pool(char* buffer, size_t capacity);
+
+/* compressed files are inflated with the zlib decoder of stb_image */
+#ifdef LITE_ASSBIN_USE_STBI
+int stbi_zlib_decode_buffer(char* obuffer, int olen, const char* ibuffer, int ilen);
+#endif
+
+static char* _lassbin_pool = 0;
+static size_t _lassbin_pool_capacity = 0;
 
 lassbin_scene_t* lassbin_load(const char* filename)
 {
@@ -240,71 +269,110 @@ lassbin_scene_t* lassbin_load(const char* filename)
   fread(buffer, size, 1, fhandle);
   fclose(fhandle);
 
-  /* load scene */
-  scene = lassbin_loadmem(buffer);
-  free(buffer);
+  /* load scene, which keeps referencing the buffer unless it was inflated */
+  scene = lassbin_loadmem(buffer, size);
+  if (scene && !scene->inflated) _lassbin_add_allocation(scene, buffer);
+  else free(buffer);
 
   return scene;
 }
 
-lassbin_scene_t* lassbin_loadmem(const char* mem)
+lassbin_scene_t* lassbin_loadmem(const char* mem, size_t size)
 {
   lassbin_stream_t stream;
   lassbin_header_t header;
   lassbin_scene_t* scene;
 
   /* init stream */
-  _lassbin_init_stream(&stream, mem);
+  _lassbin_init_stream(&stream, mem, size);
 
   /* read header and compare tag */
   _lassbin_read_stream(&stream, &header, sizeof(header));
-  if (strncmp(header.magic_id, "ASSIMP.binary", 13) != 0 || header.dump_format != 0 || header.compressed != 0)
+  if (stream.error || strncmp(header.magic_id, "ASSIMP.binary", 13) != 0 || header.dump_format != 0)
   {
     return 0;
   }
 
+  /* inflate compressed body */
+  if (header.compressed != 0)
+  {
+#ifdef LITE_ASSBIN_USE_STBI
+    return _lassbin_load_compressed(&stream);
+#else
+    return 0;
+#endif
+  }
+
   /* read scene */
-  return _lassbin_load_scene(&stream);
+  scene = (lassbin_scene_t*)calloc(1, sizeof(lassbin_scene_t));
+  return _lassbin_load_scene(&stream, scene);
 }
 
 void lassbin_free(lassbin_scene_t* scene)
 {
   int i, j;
 
-  for (i = 0; i < scene->num_meshes; ++i)
+  for (i = 0; i < scene->num_meshes && scene->meshes; ++i)
   {
-    free(scene->meshes[i].positions);
-    free(scene->meshes[i].normals);
-    free(scene->meshes[i].tangents);
-    free(scene->meshes[i].bitangents);
-    for (j = 0; j < LASSBIN_MAX_COLOR_SETS; ++j)
-    {
-      free(scene->meshes[i].colors[j]);
-    }
-    for (j = 0; j < LASSBIN_MAX_TEXCOORD_SETS; ++j)
-    {
-      free(scene->meshes[i].texcoords[j]);
-    }
     free(scene->meshes[i].faces);
   }
-  for (i = 0; i < scene->num_materials; ++i)
+  for (i = 0; i < scene->num_materials && scene->materials; ++i)
   {
-    for (j = 0; j < scene->materials[i].num_properties; ++j)
+    for (j = 0; j < scene->materials[i].num_properties && scene->materials[i].properties; ++j)
     {
       free(scene->materials[i].properties[j].data);
     }
     free(scene->materials[i].properties);
   }
-  for (i = 0; i < scene->num_textures; ++i)
+  for (i = 0; i < scene->num_allocations; ++i)
   {
-    free(scene->textures[i].data);
+    free(scene->allocations[i]);
   }
   free(scene->meshes);
   free(scene->materials);
   free(scene->textures);
+  free(scene->allocations);
+  if (scene->inflated) _lassbin_release_pool(scene->inflated, scene->inflated_capacity);
   free(scene);
 }
 
+void lassbin_freepool()
+{
+  free(_lassbin_pool);
+  _lassbin_pool = 0;
+  _lassbin_pool_capacity = 0;
+}
+
+int lassbin_numindices(const lassbin_mesh_t* mesh)
+{
+  int num_indices;
+  int f;
+
+  num_indices = 0;
+  for (f = 0; f < mesh->num_faces; ++f)
+  {
+    num_indices += mesh->faces[f].num_indices;
+  }
+
+  return num_indices;
+}
+
+int lassbin_getindices(const lassbin_mesh_t* mesh, unsigned short* out_indices)
+{
+  int f;
+
+  /* if number of vertices >= 65536, can't load the indices */
+  if (mesh->num_vertices >= (1<<16)) return 0;
+
+  for (f = 0; f < mesh->num_faces; ++f)
+  {
+    memcpy(out_indices, mesh->faces[f].indices, mesh->faces[f].num_indices * sizeof(unsigned short));
+    out_indices += mesh->faces[f].num_indices;
+  }
+
+  return 1;
+}
+
 const char* lassbin_matname(const lassbin_material_t* material)
 {
   int i;
@@ -529,19 +597,30 @@ static void _lassbin_printid(int magic_id)
 }
 */
 
-static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream)
+static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream, lassbin_scene_t* scene)
 {
   lassbin_chunk_header_t header;
-  lassbin_scene_t* scene;
   int i;
 
   /* read header */
   _lassbin_read_stream(stream, &header, sizeof(header));
-  if (header.magic_id != LASSBIN_CHUNK_AISCENE) return 0;
+  if (stream->error || header.magic_id != LASSBIN_CHUNK_AISCENE)
+  {
+    lassbin_free(scene);
+    return 0;
+  }
 
-  /* read scene */
-  scene = (lassbin_scene_t*)calloc(1, sizeof(lassbin_scene_t));
+  /* read scene (every mesh, material, animation and texture takes at least a chunk header) */
   _lassbin_read_stream(stream, scene, LASSBIN_SCENE_FIXED_SIZE);
+  if (!_lassbin_check_count(stream, scene->num_meshes, sizeof(header))
+      || !_lassbin_check_count(stream, scene->num_materials, sizeof(header))
+      || !_lassbin_check_count(stream, scene->num_animations, sizeof(header))
+      || !_lassbin_check_count(stream, scene->num_textures, sizeof(header)))
+  {
+    scene->num_meshes = scene->num_materials = scene->num_textures = 0;
+    lassbin_free(scene);
+    return 0;
+  }
 
   /* skip root node */
   _lassbin_skip(stream);
@@ -555,7 +634,7 @@ static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream)
   scene->meshes = (lassbin_mesh_t*)calloc(scene->num_meshes, sizeof(lassbin_mesh_t));
   for (i = 0; i < scene->num_meshes; ++i)
   {
-    if (!_lassbin_load_mesh(stream, &scene->meshes[i]))
+    if (!_lassbin_load_mesh(stream, scene, &scene->meshes[i]))
     {
       lassbin_free(scene);
       return 0;
@@ -573,6 +652,16 @@ static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream)
     }
   }
 
+  /* make sure that all meshes reference a valid material */
+  for (i = 0; i < scene->num_meshes; ++i)
+  {
+    if (scene->meshes[i].material_index < 0 || scene->meshes[i].material_index >= scene->num_materials)
+    {
+      lassbin_free(scene);
+      return 0;
+    }
+  }
+
   /* skip animations */
   for (i = 0; i < scene->num_animations; ++i)
   {
@@ -596,6 +685,12 @@ static lassbin_scene_t* _lassbin_load_scene(lassbin_stream_t* stream)
   /* load cameras */
   /* ... */
 
+  if (stream->error)
+  {
+    lassbin_free(scene);
+    return 0;
+  }
+
   return scene;
 }
 
@@ -608,7 +703,7 @@ static int _lassbin_load_node(lassbin_stream_t* stream)
 
   /* read header */
   _lassbin_read_stream(stream, &header, sizeof(header));
-  if (header.magic_id != LASSBIN_CHUNK_AINODE) return 0;
+  if (stream->error || header.magic_id != LASSBIN_CHUNK_AINODE) return 0;
 
   /* get end position of chunk, to skip metadata if present at end */
   end = stream->offset + header.length;
@@ -617,54 +712,62 @@ static int _lassbin_load_node(lassbin_stream_t* stream)
   memset(&node, 0, sizeof(lassbin_node_t));
   _lassbin_load_string(stream, node.name, sizeof(node.name));
   _lassbin_read_stream(stream, &node.transform, LASSBIN_NODE_FIXED_SIZE);
+  if (!_lassbin_check_count(stream, node.num_meshes, sizeof(int))) return 0;
   node.mesh_indices = (int*)malloc(node.num_meshes * sizeof(int));
 
   /* load mesh indices */
   _lassbin_read_stream(stream, node.mesh_indices, node.num_meshes * sizeof(int));
+  free(node.mesh_indices);
 
   /* load children */
-  for (i = 0; i < node.num_children; ++i) _lassbin_load_node(stream);
+  for (i = 0; i < node.num_children && !stream->error; ++i) _lassbin_load_node(stream);
 
   /* skip metadata (if exported with "export" instead of "dump") */
+  if (!_lassbin_check_stream(stream, end - stream->offset)) return 0;
   stream->offset = end;
 
-  return 1;
+  return !stream->error;
 }
 
-static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_mesh_t* mesh)
+static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_scene_t* scene, lassbin_mesh_t* mesh)
 {
   lassbin_chunk_header_t header;
+  size_t array_size;
+  size_t index_size;
   int i;
 
   /* read header */
   _lassbin_read_stream(stream, &header, sizeof(header));
-  if (header.magic_id != LASSBIN_CHUNK_AIMESH) return 0;
+  if (stream->error || header.magic_id != LASSBIN_CHUNK_AIMESH) return 0;
 
   /* read mesh */
   memset(mesh, 0, sizeof(lassbin_mesh_t));
   _lassbin_read_stream(stream, mesh, LASSBIN_MESH_FIXED_SIZE);
+  if (!_lassbin_check_count(stream, mesh->num_vertices, 3 * sizeof(float))
+      || !_lassbin_check_count(stream, mesh->num_faces, sizeof(unsigned short)))
+  {
+    mesh->num_faces = 0;
+    return 0;
+  }
+  array_size = mesh->num_vertices * 3 * sizeof(float);
 
   /* read positions */
   if (mesh->components & LASSBIN_MESH_HAS_POSITIONS)
   {
-    mesh->positions = (float*)malloc(mesh->num_vertices * 3 * sizeof(float));
-    _lassbin_read_stream(stream, mesh->positions, mesh->num_vertices * 3 * sizeof(float));
+    mesh->positions = (const float*)_lassbin_view_stream(stream, scene, array_size, sizeof(float));
   }
 
   /* read normals */
-  if (mesh->components & LASSBIN_MESH_HAS_POSITIONS)
+  if (mesh->components & LASSBIN_MESH_HAS_NORMALS)
   {
-    mesh->normals = (float*)malloc(mesh->num_vertices * 3 * sizeof(float));
-    _lassbin_read_stream(stream, mesh->normals, mesh->num_vertices * 3 * sizeof(float));
+    mesh->normals = (const float*)_lassbin_view_stream(stream, scene, array_size, sizeof(float));
   }
 
   /* read tangents and bitangents */
   if (mesh->components & LASSBIN_MESH_HAS_TANGENTS_AND_BITANGENTS)
   {
-    mesh->tangents = (float*)malloc(mesh->num_vertices * 3 * sizeof(float));
-    mesh->bitangents = (float*)malloc(mesh->num_vertices * 3 * sizeof(float));
-    _lassbin_read_stream(stream, mesh->tangents, mesh->num_vertices * 3 * sizeof(float));
-    _lassbin_read_stream(stream, mesh->bitangents, mesh->num_vertices * 3 * sizeof(float));
+    mesh->tangents = (const float*)_lassbin_view_stream(stream, scene, array_size, sizeof(float));
+    mesh->bitangents = (const float*)_lassbin_view_stream(stream, scene, array_size, sizeof(float));
   }
 
   /* read color sets */
@@ -672,8 +775,7 @@ static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_mesh_t* mesh)
   {
     if (mesh->components & LASSBIN_MESH_HAS_COLOR(i))
     {
-      mesh->colors[i] = (float*)malloc(mesh->num_vertices * 4 * sizeof(float));
-      _lassbin_read_stream(stream, mesh->colors[i], mesh->num_vertices * 4 * sizeof(float));
+      mesh->colors[i] = (const float*)_lassbin_view_stream(stream, scene, mesh->num_vertices * 4 * sizeof(float), sizeof(float));
     }
   }
 
@@ -682,20 +784,33 @@ static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_mesh_t* mesh)
   {
     if (mesh->components & LASSBIN_MESH_HAS_TEXCOORD(i))
     {
-      mesh->texcoords[i] = (float*)malloc(mesh->num_vertices * 4 * sizeof(float));
       _lassbin_read_stream(stream, &mesh->numuvs[i], sizeof(int));
-      _lassbin_read_stream(stream, mesh->texcoords[i], mesh->num_vertices * 3 * sizeof(float));
+      mesh->texcoords[i] = (const float*)_lassbin_view_stream(stream, scene, array_size, sizeof(float));
     }
   }
 
   /* read faces */
+  if (stream->error) return 0;
+  index_size = (mesh->num_vertices < (1<<16)) ? sizeof(unsigned short) : sizeof(unsigned int);
   mesh->faces = (lassbin_face_t*)malloc(mesh->num_faces * sizeof(lassbin_face_t));
-  for (i = 0; i < mesh->num_faces; ++i)
+  for (i = 0; i < mesh->num_faces && !stream->error; ++i)
   {
-    int index_size = (mesh->num_vertices < (1u<<16)) ? sizeof(unsigned short) : sizeof(unsigned int);
     _lassbin_read_stream(stream, &mesh->faces[i].num_indices, sizeof(unsigned short));
-    mesh->faces[i].indices = malloc(mesh->faces[i].num_indices * index_size);
-    _lassbin_read_stream(stream, mesh->faces[i].indices, mesh->faces[i].num_indices * index_size);
+    mesh->faces[i].indices = _lassbin_view_stream(stream, scene, mesh->faces[i].num_indices * index_size, index_size);
+  }
+
+  /* make sure that faces reference existing vertices */
+  if (index_size == sizeof(unsigned short))
+  {
+    int f;
+    for (f = 0; f < mesh->num_faces && !stream->error; ++f)
+    {
+      const unsigned short* indices = (const unsigned short*)mesh->faces[f].indices;
+      for (i = 0; i < mesh->faces[f].num_indices; ++i)
+      {
+        if (indices[i] >= mesh->num_vertices) return 0;
+      }
+    }
   }
 
   /* skip bones (unsupported yet) */
@@ -704,7 +819,7 @@ static int _lassbin_load_mesh(lassbin_stream_t* stream, lassbin_mesh_t* mesh)
     _lassbin_skip(stream);
   }
 
-  return 1;
+  return !stream->error;
 }
 
 static int _lassbin_load_material(lassbin_stream_t* stream, lassbin_material_t* material)
@@ -714,11 +829,16 @@ static int _lassbin_load_material(lassbin_stream_t* stream, lassbin_material_t*
 
   /* read header */
   _lassbin_read_stream(stream, &header, sizeof(header));
-  if (header.magic_id != LASSBIN_CHUNK_AIMATERIAL) return 0;
+  if (stream->error || header.magic_id != LASSBIN_CHUNK_AIMATERIAL) return 0;
 
   /* read material */
   memset(material, 0, sizeof(lassbin_material_t));
   _lassbin_read_stream(stream, material, LASSBIN_MATERIAL_FIXED_SIZE);
+  if (!_lassbin_check_count(stream, material->num_properties, sizeof(header)))
+  {
+    material->num_properties = 0;
+    return 0;
+  }
 
   /* read properties */
   material->properties = (lassbin_matproperty_t*)calloc(material->num_properties, sizeof(lassbin_matproperty_t));
@@ -739,33 +859,43 @@ static int _lassbin_load_matproperty(lassbin_stream_t* stream, lassbin_matproper
 
   /* read header */
   _lassbin_read_stream(stream, &header, sizeof(header));
-  if (header.magic_id != LASSBIN_CHUNK_AIMATERIALPROPERTY) return 0;
+  if (stream->error || header.magic_id != LASSBIN_CHUNK_AIMATERIALPROPERTY) return 0;
 
-  /* read data */
+  /* read data (padded, so that float and string properties can always be read safely) */
   _lassbin_load_string(stream, prop->key, sizeof(prop->key));
   _lassbin_read_stream(stream, &prop->semantic, LASSBIN_MATPROPERTY_FIXED_SIZE);
-  prop->data = (char*)malloc(prop->data_length);
+  if (!_lassbin_check_count(stream, prop->data_length, 1))
+  {
+    prop->data_length = 0;
+    return 0;
+  }
+  prop->data = (char*)calloc(1, prop->data_length + 16);
   _lassbin_read_stream(stream, prop->data, prop->data_length);
 
-  return 1;
+  return !stream->error;
 }
 
 static int _lassbin_load_texture(lassbin_stream_t* stream, lassbin_texture_t* texture)
 {
   lassbin_chunk_header_t header;
-  int i;
 
   /* read header */
   _lassbin_read_stream(stream, &header, sizeof(header));
-  if (header.magic_id != LASSBIN_CHUNK_AITEXTURE) return 0;
+  if (stream->error || header.magic_id != LASSBIN_CHUNK_AITEXTURE) return 0;
 
   /* read texture */
   memset(texture, 0, sizeof(lassbin_texture_t));
   _lassbin_read_stream(stream, texture, LASSBIN_TEXTURE_FIXED_SIZE);
+  if (texture->width < 0 || texture->height < 0
+      || (texture->height != 0 && !_lassbin_check_count(stream, texture->width, (size_t)texture->height * 4)))
+  {
+    return 0;
+  }
 
-  /* read data */
-  texture->data = (unsigned char*)malloc(lassbin_texturesize(texture));
-  _lassbin_read_stream(stream, texture->data, lassbin_texturesize(texture) * sizeof(unsigned char));
+  /* reference data */
+  if (!_lassbin_check_stream(stream, lassbin_texturesize(texture))) return 0;
+  texture->data = (const unsigned char*)(stream->data + stream->offset);
+  stream->offset += lassbin_texturesize(texture);
 
   return 1;
 }
@@ -774,16 +904,13 @@ static int _lassbin_load_texture(lassbin_stream_t* stream, lassbin_texture_t* te
 
 static void _lassbin_load_string(lassbin_stream_t* stream, char* out, int len)
 {
-  char* str;
   int length;
   _lassbin_read_stream(stream, &length, sizeof(length));
-  if (length > 0)
+  if (length > 0 && _lassbin_check_stream(stream, length))
   {
-    str = (char*)malloc(length);
-    _lassbin_read_stream(stream, str, length);
-    strncpy(out, str, length < len ? length : len);
-    out[len-1] = 0;
-    free(str);
+    strncpy(out, stream->data + stream->offset, length < len ? length : len);
+    out[length < len ? length : len - 1] = 0;
+    stream->offset += length;
   }
   else
   {
@@ -795,117 +922,227 @@ static void _lassbin_skip(lassbin_stream_t* stream)
 {
   lassbin_chunk_header_t header;
   _lassbin_read_stream(stream, &header, sizeof(header));
-  stream->offset += header.length;
+  if (!stream->error && header.length >= 0 && _lassbin_check_stream(stream, header.length))
+  {
+    stream->offset += header.length;
+  }
+  else
+  {
+    stream->error = 1;
+  }
 }
 
-static void _lassbin_init_stream(lassbin_stream_t* stream, const char* data)
+static void _lassbin_init_stream(lassbin_stream_t* stream, const char* data, size_t size)
 {
   stream->data = data;
+  stream->size = size;
   stream->offset = 0;
+  stream->error = 0;
+}
+
+static int _lassbin_check_stream(lassbin_stream_t* stream, size_t size)
+{
+  if (stream->error || size > stream->size - stream->offset)
+  {
+    stream->error = 1;
+    return 0;
+  }
+  return 1;
+}
+
+static int _lassbin_check_count(lassbin_stream_t* stream, int count, size_t elem_size)
+{
+  if (stream->error || count < 0 || (size_t)count > (stream->size - stream->offset) / elem_size)
+  {
+    stream->error = 1;
+    return 0;
+  }
+  return 1;
 }
 
 static void _lassbin_read_stream(lassbin_stream_t* stream, void* buffer, size_t size)
 {
-  memcpy(buffer, stream->data + stream->offset, size);
+  if (_lassbin_check_stream(stream, size))
+  {
+    memcpy(buffer, stream->data + stream->offset, size);
+    stream->offset += size;
+  }
+  else
+  {
+    memset(buffer, 0, size);
+  }
+}
+
+static const void* _lassbin_view_stream(lassbin_stream_t* stream, lassbin_scene_t* scene, size_t size, size_t align)
+{
+  const char* view;
+  void* copy;
+
+  if (!_lassbin_check_stream(stream, size)) return 0;
+  view = stream->data + stream->offset;
   stream->offset += size;
+
+  /* reference the data in place if it is aligned, otherwise copy it */
+  if ((size_t)view % align == 0) return view;
+  copy = malloc(size);
+  memcpy(copy, view, size);
+  _lassbin_add_allocation(scene, copy);
+  return copy;
+}
+
+static void _lassbin_add_allocation(lassbin_scene_t* scene, void* block)
+{
+  /* grow in powers of two */
+  if ((scene->num_allocations & (scene->num_allocations - 1)) == 0)
+  {
+    scene->allocations = (void**)realloc(scene->allocations, (scene->num_allocations ? scene->num_allocations * 2 : 1) * sizeof(void*));
+  }
+  scene->allocations[scene->num_allocations++] = block;
+}
+
+#ifdef LITE_ASSBIN_USE_STBI
+static lassbin_scene_t* _lassbin_load_compressed(lassbin_stream_t* stream)
+{
+  unsigned int uncompressed_size;
+  size_t compressed_size;
+  lassbin_stream_t body;
+  lassbin_scene_t* scene;
+
+  /* the header is followed by the uncompressed size and a zlib stream */
+  _lassbin_read_stream(stream, &uncompressed_size, sizeof(uncompressed_size));
+  compressed_size = stream->size - stream->offset;
+  if (stream->error || uncompressed_size == 0 || uncompressed_size > 0x7fffffff || compressed_size > 0x7fffffff)
+  {
+    return 0;
+  }
+
+  /* deflate cannot expand data more than 1032 times, so a bigger size is corrupt and must not be allocated */
+  if (uncompressed_size / 1032 > compressed_size)
+  {
+    return 0;
+  }
+
+  /* inflate straight into the buffer that the scene will reference */
+  scene = (lassbin_scene_t*)calloc(1, sizeof(lassbin_scene_t));
+  scene->inflated = _lassbin_acquire_pool(uncompressed_size, &scene->inflated_capacity);
+  if (stbi_zlib_decode_buffer(scene->inflated, (int)uncompressed_size, stream->data + stream->offset, (int)compressed_size) != (int)uncompressed_size)
+  {
+    lassbin_free(scene);
+    return 0;
+  }
+
+  /* read scene */
+  _lassbin_init_stream(&body, scene->inflated, uncompressed_size);
+  return _lassbin_load_scene(&body, scene);
+}
+#endif
+
+static char* _lassbin_acquire_pool(size_t size, size_t* out_capacity)
+{
+  char* buffer;
+
+  /* reuse the pooled buffer if it is big enough */
+  if (_lassbin_pool && _lassbin_pool_capacity >= size)
+  {
+    buffer = _lassbin_pool;
+    *out_capacity = _lassbin_pool_capacity;
+    _lassbin_pool = 0;
+    _lassbin_pool_capacity = 0;
+    return buffer;
+  }
+
+  *out_capacity = size;
+  return (char*)malloc(size);
+}
+
+static void _lassbin_release_pool(char* buffer, size_t capacity)
+{
+  /* keep the biggest buffer for the next compressed file */
+  if (capacity > _lassbin_pool_capacity)
+  {
+    free(_lassbin_pool);
+    _lassbin_pool = buffer;
+    _lassbin_pool_capacity = capacity;
+  }
+  else
+  {
+    free(buffer);
+  }
 }
 
 #ifdef LITE_ASSBIN_USE_GFX
 
-lvert_t* lassbin_getvertices(const lassbin_mesh_t* mesh)
+void lassbin_getvertices(const lassbin_mesh_t* mesh, lvert_t* out_vertices)
 {
-  lvert_t* verts;
+  const float* colors = 0;
+  const float* texcoords[2] = {0, 0};
+  int num_texcoords = 0;
   int v, i;
 
-  /* create buffer */
-  verts = (lvert_t*)malloc(mesh->num_vertices * sizeof(lvert_t));
+  /* pick the first color set and the first two texcoord sets */
+  for (i = 0; i < LASSBIN_MAX_COLOR_SETS && !colors; ++i)
+  {
+    if (mesh->components & LASSBIN_MESH_HAS_COLOR(i)) colors = mesh->colors[i];
+  }
+  for (i = 0; i < LASSBIN_MAX_TEXCOORD_SETS && num_texcoords < 2; ++i)
+  {
+    if (mesh->components & LASSBIN_MESH_HAS_TEXCOORD(i)) texcoords[num_texcoords++] = mesh->texcoords[i];
+  }
 
+  /* fill all vertices in a single pass */
   for (v = 0; v < mesh->num_vertices; ++v)
   {
-    float x = 0, y = 0, z = 0;
-    float nx = 0, ny = 0, nz = -1;
-    float tu[2] = {0, 0};
-    float tv[2] = {0, 0};
-    float r = 1, g = 1, b = 1, a = 1;
-    int current_uv = 0;
+    lvert_t* vert = &out_vertices[v];
 
-    if (mesh->components & LASSBIN_MESH_HAS_POSITIONS)
+    if (mesh->positions)
     {
-      x = mesh->positions[v*3];
-      y = mesh->positions[v*3+1];
-      z = mesh->positions[v*3+2];
+      memcpy(vert->pos, &mesh->positions[v*3], 3 * sizeof(float));
     }
-
-    if (mesh->components & LASSBIN_MESH_HAS_NORMALS)
+    else
     {
-      nx = mesh->normals[v*3];
-      ny = mesh->normals[v*3+1];
-      nz = mesh->normals[v*3+2];
+      vert->pos[0] = vert->pos[1] = vert->pos[2] = 0;
     }
 
-    for (i = 0; i < LASSBIN_MAX_COLOR_SETS; ++i)
+    if (mesh->normals)
     {
-      if (mesh->components & LASSBIN_MESH_HAS_COLOR(i))
-      {
-        r = mesh->colors[i][v*4];
-        g = mesh->colors[i][v*4+1];
-        b = mesh->colors[i][v*4+2];
-        a = mesh->colors[i][v*4+3];
-        break;
-      }
+      memcpy(vert->nor, &mesh->normals[v*3], 3 * sizeof(float));
     }
-
-    for (i = 0; i < LASSBIN_MAX_TEXCOORD_SETS; ++i)
+    else
     {
-      if (mesh->components & LASSBIN_MESH_HAS_TEXCOORD(i))
-      {
-        tu[current_uv] = mesh->texcoords[i][v*3];
-        tv[current_uv] = mesh->texcoords[i][v*3+1];
-        ++current_uv;
-        if (current_uv == 2) break;
-      }
+      vert->nor[0] = 0;
+      vert->nor[1] = 0;
+      vert->nor[2] = -1;
     }
 
-    verts[v] = lvert(x, y, z, nx, ny, nz, tu[0], tv[0], r, g, b, a);
-    verts[v].tex2[0] = tu[1];
-    verts[v].tex2[1] = tv[1];
-  }
-
-  return verts;
-}
-
-unsigned short* lassbin_getindices(const lassbin_mesh_t* mesh, int* num_indices)
-{
-  unsigned short* indices;
-  int index_size;
-  int f, i;
-
-  /* get total number of indices */
-  *num_indices = 0;
-  for (f = 0; f < mesh->num_faces; ++f)
-  {
-    *num_indices += mesh->faces[f].num_indices;
-  }
-
-  /* if number of vertices >= 65536, can't load the indices */
-  if (mesh->num_vertices >= (1u<<16)) return 0;
+    if (texcoords[0])
+    {
+      vert->tex[0] = texcoords[0][v*3];
+      vert->tex[1] = texcoords[0][v*3+1];
+    }
+    else
+    {
+      vert->tex[0] = vert->tex[1] = 0;
+    }
 
-  /* create buffer */
-  indices = (unsigned short*)malloc(*num_indices * sizeof(unsigned short));
+    if (texcoords[1])
+    {
+      vert->tex2[0] = texcoords[1][v*3];
+      vert->tex2[1] = texcoords[1][v*3+1];
+    }
+    else
+    {
+      vert->tex2[0] = vert->tex2[1] = 0;
+    }
 
-  /* add indices */
-  i = 0;
-  for (f = 0; f < mesh->num_faces; ++f)
-  {
-    int i2;
-    for (i2 = 0; i2 < mesh->faces[f].num_indices; ++i2)
+    if (colors)
     {
-      indices[i] = ((unsigned short*)mesh->faces[f].indices)[i2];
-      ++i;
+      memcpy(vert->col, &colors[v*4], 4 * sizeof(float));
+    }
+    else
+    {
+      vert->col[0] = vert->col[1] = vert->col[2] = vert->col[3] = 1;
     }
   }
-
-  return indices;
 }
 
 #endif /* LITE_ASSBIN_USE_GFX */
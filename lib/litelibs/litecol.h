@@ -17,6 +17,23 @@ int lcol_boxsphere(float minx1, float miny1, float minz1, float maxx1, float max
 int lcol_spheresphere(float sx1, float sy1, float sz1, float sqrad1, float sx2, float sy2, float sz2, float sqrad2);
 int lcol_pointinbox(float x, float y, float z, float minx, float miny, float minz, float maxx, float maxy, float maxz);
 
+/* triangles are given as an array with the nine coordinates of their vertices */
+int lcol_boxtri(float minx, float miny, float minz, float maxx, float maxy, float maxz, const float* tri);
+int lcol_spheretri(float sx, float sy, float sz, float sqrad, const float* tri);
+
+/* returns the fraction of the movement before the box touches the triangle, storing the normal of the contact, or 1 if it does not touch it. a box which already overlaps the triangle is not stopped */
+float lcol_sweepboxtri(float minx, float miny, float minz, float maxx, float maxy, float maxz, float dx, float dy, float dz, const float* tri, float* normal);
+
+/* returns the fraction of the movement before the sphere touches the box, storing the normal of the contact, or 1 if it does not touch it. a sphere which already overlaps the box is not stopped */
+float lcol_sweepspherebox(float sx, float sy, float sz, float radius, float dx, float dy, float dz, float minx, float miny, float minz, float maxx, float maxy, float maxz, float* normal);
+
+/* returns the fraction of the movement before the sphere touches the triangle, storing the normal of the contact, or 1 if it does not touch it. a sphere which already overlaps the triangle is not stopped */
+float lcol_sweepspheretri(float sx, float sy, float sz, float radius, float dx, float dy, float dz, const float* tri, float* normal);
+
+/* batch versions that test against count boxes stored as separate arrays of coordinates. return index of the first colliding box, or -1 */
+int lcol_boxbox_soa(const float* minx1, const float* miny1, const float* minz1, const float* maxx1, const float* maxy1, const float* maxz1, int count, float minx2, float miny2, float minz2, float maxx2, float maxy2, float maxz2);
+int lcol_boxsphere_soa(const float* minx1, const float* miny1, const float* minz1, const float* maxx1, const float* maxy1, const float* maxz1, int count, float sx, float sy, float sz, float sqrad);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -31,6 +48,17 @@ int lcol_pointinbox(float x, float y, float z, float minx, float miny, float min
 
 #ifdef LITE_COL_IMPLEMENTATION
 
+#if defined(__AVX__)
+#define LCOL_AVX
+#include <immintrin.h>
+#endif
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define LCOL_SSE
+#include <xmmintrin.h>
+#endif
+
+#include <math.h>
+
 #define _min(A, B)       (A < B ? A : B)
 #define _max(A, B)       (A > B ? A : B)
 #define _clamp(A, B, C)  _min(_max(A, B), C)
@@ -105,6 +133,480 @@ int lcol_pointinbox(float x, float y, float z, float minx, float miny, float min
   return _inrange(x, minx, maxx) && _inrange(y, miny, maxy) && _inrange(z, minz, maxz);
 }
 
+#define _lcol_dot(A, B) (A[0]*B[0] + A[1]*B[1] + A[2]*B[2])
+#define _lcol_abs(A) ((A) < 0 ? -(A) : (A))
+
+static int _lcol_triaxes(const float* tri, float* axes);
+static void _lcol_project(const float* center, const float* half, const float* tri, const float* axis, float* c, float* r, float* trimin, float* trimax);
+static float _lcol_raysphere(const float* origin, const float* delta, const float* center, float radius);
+static void _lcol_closesttri(const float* p, const float* tri, float* closest);
+static float _lcol_raycylinder(const float* origin, const float* delta, const float* from, const float* to, float radius);
+
+int lcol_boxtri(float minx, float miny, float minz, float maxx, float maxy, float maxz, const float* tri)
+{
+  float center[3], half[3], axes[39];
+  int count, i;
+
+  center[0] = (minx + maxx) * 0.5f; center[1] = (miny + maxy) * 0.5f; center[2] = (minz + maxz) * 0.5f;
+  half[0] = (maxx - minx) * 0.5f; half[1] = (maxy - miny) * 0.5f; half[2] = (maxz - minz) * 0.5f;
+
+  /* they collide if none of the axes separates them */
+  count = _lcol_triaxes(tri, axes);
+  for (i = 0; i < count; ++i)
+  {
+    float c, r, trimin, trimax;
+    _lcol_project(center, half, tri, &axes[i*3], &c, &r, &trimin, &trimax);
+    if (c + r <= trimin || c - r >= trimax) return 0;
+  }
+  return 1;
+}
+
+int lcol_spheretri(float sx, float sy, float sz, float sqrad, const float* tri)
+{
+  float p[3], closest[3];
+
+  p[0] = sx; p[1] = sy; p[2] = sz;
+  _lcol_closesttri(p, tri, closest);
+  return lcol_spheresphere(sx, sy, sz, sqrad, closest[0], closest[1], closest[2], 0);
+}
+
+float lcol_sweepboxtri(float minx, float miny, float minz, float maxx, float maxy, float maxz, float dx, float dy, float dz, const float* tri, float* normal)
+{
+  float center[3], half[3], delta[3], axes[39];
+  float enter = -1e30f, exit = 1e30f;
+  int count, i, axis = -1;
+
+  center[0] = (minx + maxx) * 0.5f; center[1] = (miny + maxy) * 0.5f; center[2] = (minz + maxz) * 0.5f;
+  half[0] = (maxx - minx) * 0.5f; half[1] = (maxy - miny) * 0.5f; half[2] = (maxz - minz) * 0.5f;
+  delta[0] = dx; delta[1] = dy; delta[2] = dz;
+
+  /* they touch when the box has entered the range of the triangle in all the axes */
+  count = _lcol_triaxes(tri, axes);
+  for (i = 0; i < count; ++i)
+  {
+    float c, r, trimin, trimax, d, t0, t1;
+    _lcol_project(center, half, tri, &axes[i*3], &c, &r, &trimin, &trimax);
+    d = _lcol_dot(delta, (&axes[i*3]));
+    if (d == 0)
+    {
+      if (c + r <= trimin || c - r >= trimax) return 1;
+      continue;
+    }
+    t0 = ((d > 0) ? trimin - (c + r) : trimax - (c - r)) / d;
+    t1 = ((d > 0) ? trimax - (c - r) : trimin - (c + r)) / d;
+    if (t0 > enter)
+    {
+      enter = t0;
+      axis = i;
+    }
+    exit = _min(exit, t1);
+  }
+  if (axis == -1 || enter >= exit || enter >= 1 || exit <= 0 || enter < 0) return 1;
+
+  /* the normal opposes the movement */
+  {
+    const float* n = &axes[axis*3];
+    float scale = 1.0f / (float)sqrt(_lcol_dot(n, n));
+    if (_lcol_dot(delta, n) > 0) scale = -scale;
+    normal[0] = n[0] * scale;
+    normal[1] = n[1] * scale;
+    normal[2] = n[2] * scale;
+  }
+  return enter;
+}
+
+float lcol_sweepspherebox(float sx, float sy, float sz, float radius, float dx, float dy, float dz, float minx, float miny, float minz, float maxx, float maxy, float maxz, float* normal)
+{
+  float origin[3], delta[3], min[3], max[3], p[3], len;
+  float time = 1;
+  int a, i;
+
+  origin[0] = sx; origin[1] = sy; origin[2] = sz;
+  delta[0] = dx; delta[1] = dy; delta[2] = dz;
+  min[0] = minx; min[1] = miny; min[2] = minz;
+  max[0] = maxx; max[1] = maxy; max[2] = maxz;
+  if (lcol_boxsphere(minx, miny, minz, maxx, maxy, maxz, sx, sy, sz, radius * radius)) return 1;
+
+  /* the center hits the box grown by the radius, which is made of the box grown along each axis, a cylinder around each edge and a sphere on each corner */
+  for (a = 0; a < 3; ++a)
+  {
+    float enter = 0, exit = 1;
+    for (i = 0; i < 3 && enter <= exit; ++i)
+    {
+      float lo = min[i] - ((i == a) ? radius : 0), hi = max[i] + ((i == a) ? radius : 0);
+      if (delta[i] == 0)
+      {
+        if (origin[i] < lo || origin[i] > hi) enter = 2;
+        continue;
+      }
+      enter = _max(enter, ((delta[i] > 0 ? lo : hi) - origin[i]) / delta[i]);
+      exit = _min(exit, ((delta[i] > 0 ? hi : lo) - origin[i]) / delta[i]);
+    }
+    if (enter <= exit && enter < time) time = enter;
+  }
+  for (i = 0; i < 8; ++i)
+  {
+    float corner[3], t;
+    corner[0] = (i & 1) ? maxx : minx; corner[1] = (i & 2) ? maxy : miny; corner[2] = (i & 4) ? maxz : minz;
+    t = _lcol_raysphere(origin, delta, corner, radius);
+    time = _min(time, t);
+    for (a = 0; a < 3; ++a)
+    {
+      /* the edge along each axis that starts at this corner */
+      float to[3];
+      if (corner[a] == max[a]) continue;
+      to[0] = corner[0]; to[1] = corner[1]; to[2] = corner[2];
+      to[a] = max[a];
+      t = _lcol_raycylinder(origin, delta, corner, to, radius);
+      time = _min(time, t);
+    }
+  }
+  if (time >= 1) return 1;
+
+  /* the normal goes from the closest point of the box to the center at the contact */
+  for (i = 0; i < 3; ++i)
+  {
+    p[i] = origin[i] + delta[i] * time;
+    normal[i] = p[i] - _clamp(p[i], min[i], max[i]);
+  }
+  len = (float)sqrt(_lcol_dot(normal, normal));
+  if (len == 0) return 1;
+  normal[0] /= len; normal[1] /= len; normal[2] /= len;
+  return time;
+}
+
+float lcol_sweepspheretri(float sx, float sy, float sz, float radius, float dx, float dy, float dz, const float* tri, float* normal)
+{
+  float origin[3], delta[3], ab[3], ac[3], n[3], p[3], closest[3], dist, dn, len;
+  float time = 1;
+  int i;
+
+  origin[0] = sx; origin[1] = sy; origin[2] = sz;
+  delta[0] = dx; delta[1] = dy; delta[2] = dz;
+  if (lcol_spheretri(sx, sy, sz, radius * radius, tri)) return 1;
+
+  /* the center hits the plane of the triangle moved by the radius towards the sphere, at a point over the triangle */
+  for (i = 0; i < 3; ++i)
+  {
+    ab[i] = tri[3+i] - tri[i];
+    ac[i] = tri[6+i] - tri[i];
+    p[i] = origin[i] - tri[i];
+  }
+  n[0] = ab[1]*ac[2] - ab[2]*ac[1];
+  n[1] = ab[2]*ac[0] - ab[0]*ac[2];
+  n[2] = ab[0]*ac[1] - ab[1]*ac[0];
+  len = (float)sqrt(_lcol_dot(n, n));
+  if (len > 0)
+  {
+    dist = _lcol_dot(p, n) / len;
+    dn = _lcol_dot(delta, n) / len;
+    if (dist < 0)
+    {
+      dist = -dist;
+      dn = -dn;
+    }
+    if (dist >= radius && dist - radius < -dn)
+    {
+      float t = (dist - radius) / -dn;
+      for (i = 0; i < 3; ++i) p[i] = origin[i] + delta[i] * t;
+      _lcol_closesttri(p, tri, closest);
+      for (i = 0; i < 3; ++i) closest[i] -= p[i];
+      if (_lcol_dot(closest, closest) <= radius * radius * 1.0001f) time = t;
+    }
+  }
+
+  /* or the cylinder around an edge or the sphere on a vertex */
+  for (i = 0; i < 3; ++i)
+  {
+    const float* from = &tri[i*3];
+    const float* to = &tri[((i + 1) % 3) * 3];
+    time = _min(time, _lcol_raysphere(origin, delta, from, radius));
+    time = _min(time, _lcol_raycylinder(origin, delta, from, to, radius));
+  }
+  if (time >= 1) return 1;
+
+  /* the normal goes from the closest point of the triangle to the center at the contact */
+  for (i = 0; i < 3; ++i) p[i] = origin[i] + delta[i] * time;
+  _lcol_closesttri(p, tri, closest);
+  for (i = 0; i < 3; ++i) normal[i] = p[i] - closest[i];
+  len = (float)sqrt(_lcol_dot(normal, normal));
+  if (len == 0) return 1;
+  normal[0] /= len; normal[1] /= len; normal[2] /= len;
+  return time;
+}
+
+/* gets the axes that can separate an axis aligned box and the triangle: the ones of the box, the normal of the triangle and the cross products of their edges. returns the number of axes, skipping degenerate ones */
+static int _lcol_triaxes(const float* tri, float* axes)
+{
+  float edges[9], n[3];
+  int count = 0, e, a;
+
+  for (e = 0; e < 3; ++e)
+  {
+    const float* from = &tri[e*3];
+    const float* to = &tri[((e+1) % 3) * 3];
+    edges[e*3] = to[0] - from[0];
+    edges[e*3+1] = to[1] - from[1];
+    edges[e*3+2] = to[2] - from[2];
+  }
+  for (a = 0; a < 3; ++a)
+  {
+    axes[count*3] = (a == 0) ? 1.0f : 0.0f;
+    axes[count*3+1] = (a == 1) ? 1.0f : 0.0f;
+    axes[count*3+2] = (a == 2) ? 1.0f : 0.0f;
+    ++count;
+  }
+  n[0] = edges[1]*edges[5] - edges[2]*edges[4];
+  n[1] = edges[2]*edges[3] - edges[0]*edges[5];
+  n[2] = edges[0]*edges[4] - edges[1]*edges[3];
+  if (_lcol_dot(n, n) > 0)
+  {
+    axes[count*3] = n[0]; axes[count*3+1] = n[1]; axes[count*3+2] = n[2];
+    ++count;
+  }
+  for (e = 0; e < 3; ++e)
+  {
+    const float* edge = &edges[e*3];
+    float sqedge = _lcol_dot(edge, edge);
+    for (a = 0; a < 3; ++a)
+    {
+      /* cross product of the box axis and the edge */
+      float* axis = &axes[count*3];
+      axis[0] = (a == 0) ? 0 : (a == 1) ? edge[2] : -edge[1];
+      axis[1] = (a == 0) ? -edge[2] : (a == 1) ? 0 : edge[0];
+      axis[2] = (a == 0) ? edge[1] : (a == 1) ? -edge[0] : 0;
+      if (_lcol_dot(axis, axis) > sqedge * 0.000001f) ++count;
+    }
+  }
+  return count;
+}
+
+static void _lcol_project(const float* center, const float* half, const float* tri, const float* axis, float* c, float* r, float* trimin, float* trimax)
+{
+  float p1, p2;
+
+  *c = _lcol_dot(center, axis);
+  *r = half[0]*_lcol_abs(axis[0]) + half[1]*_lcol_abs(axis[1]) + half[2]*_lcol_abs(axis[2]);
+  *trimin = *trimax = _lcol_dot(tri, axis);
+  p1 = _lcol_dot((&tri[3]), axis);
+  p2 = _lcol_dot((&tri[6]), axis);
+  *trimin = _min(_min(*trimin, p1), p2);
+  *trimax = _max(_max(*trimax, p1), p2);
+}
+
+/* finds the closest point of the triangle to the given one */
+static void _lcol_closesttri(const float* p, const float* tri, float* closest)
+{
+  float ab[3], ac[3], ap[3];
+  float d1, d2, d3, d4, d5, d6, va, vb, vc, v, w;
+  int i;
+
+  /* check the regions of the triangle one by one */
+  for (i = 0; i < 3; ++i)
+  {
+    ab[i] = tri[3+i] - tri[i];
+    ac[i] = tri[6+i] - tri[i];
+  }
+  ap[0] = p[0] - tri[0]; ap[1] = p[1] - tri[1]; ap[2] = p[2] - tri[2];
+  d1 = _lcol_dot(ab, ap);
+  d2 = _lcol_dot(ac, ap);
+  ap[0] = p[0] - tri[3]; ap[1] = p[1] - tri[4]; ap[2] = p[2] - tri[5];
+  d3 = _lcol_dot(ab, ap);
+  d4 = _lcol_dot(ac, ap);
+  ap[0] = p[0] - tri[6]; ap[1] = p[1] - tri[7]; ap[2] = p[2] - tri[8];
+  d5 = _lcol_dot(ab, ap);
+  d6 = _lcol_dot(ac, ap);
+  vc = d1*d4 - d3*d2;
+  vb = d5*d2 - d1*d6;
+  va = d3*d6 - d5*d4;
+  if (d1 <= 0 && d2 <= 0)
+  {
+    v = 0; w = 0; /* first vertex */
+  }
+  else if (d3 >= 0 && d4 <= d3)
+  {
+    v = 1; w = 0; /* second vertex */
+  }
+  else if (d6 >= 0 && d5 <= d6)
+  {
+    v = 0; w = 1; /* third vertex */
+  }
+  else if (vc <= 0 && d1 >= 0 && d3 <= 0)
+  {
+    v = d1 / (d1 - d3); w = 0; /* first edge */
+  }
+  else if (vb <= 0 && d2 >= 0 && d6 <= 0)
+  {
+    v = 0; w = d2 / (d2 - d6); /* third edge */
+  }
+  else if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+  {
+    w = (d4 - d3) / ((d4 - d3) + (d5 - d6)); v = 1 - w; /* second edge */
+  }
+  else
+  {
+    v = vb / (va + vb + vc); w = vc / (va + vb + vc); /* face */
+  }
+  for (i = 0; i < 3; ++i) closest[i] = tri[i] + ab[i]*v + ac[i]*w;
+}
+
+/* fraction of the movement at which the point enters the sphere, or 1 */
+static float _lcol_raysphere(const float* origin, const float* delta, const float* center, float radius)
+{
+  float m[3], a, b, c, disc, t;
+
+  m[0] = origin[0] - center[0]; m[1] = origin[1] - center[1]; m[2] = origin[2] - center[2];
+  a = _lcol_dot(delta, delta);
+  b = _lcol_dot(m, delta);
+  c = _lcol_dot(m, m) - radius * radius;
+  if (a == 0 || b >= 0) return 1;
+  disc = b*b - a*c;
+  if (disc < 0) return 1;
+  t = (-b - (float)sqrt(disc)) / a;
+  return (t >= 0 && t < 1) ? t : 1;
+}
+
+/* fraction of the movement at which the point enters the cylinder around the segment, without its caps, or 1 */
+static float _lcol_raycylinder(const float* origin, const float* delta, const float* from, const float* to, float radius)
+{
+  float e[3], m[3], ee, md, nd, a, b, c, disc, t, s;
+
+  e[0] = to[0] - from[0]; e[1] = to[1] - from[1]; e[2] = to[2] - from[2];
+  m[0] = origin[0] - from[0]; m[1] = origin[1] - from[1]; m[2] = origin[2] - from[2];
+  ee = _lcol_dot(e, e);
+  md = _lcol_dot(m, e);
+  nd = _lcol_dot(delta, e);
+  a = ee * _lcol_dot(delta, delta) - nd*nd;
+  b = ee * _lcol_dot(m, delta) - nd*md;
+  c = ee * (_lcol_dot(m, m) - radius * radius) - md*md;
+  if (ee == 0 || a <= 0 || b >= 0) return 1; /* moving parallel to the segment or away from it */
+  disc = b*b - a*c;
+  if (disc < 0) return 1;
+  t = (-b - (float)sqrt(disc)) / a;
+  if (t < 0 || t >= 1) return 1;
+  s = md + t*nd;
+  return (s >= 0 && s <= ee) ? t : 1;
+}
+
+#ifdef LCOL_AVX
+#define _inrange8(V, A, B) _mm256_and_ps(_mm256_cmp_ps(V, A, _CMP_GT_OQ), _mm256_cmp_ps(V, B, _CMP_LT_OQ))
+#define _pointinbox8(X, Y, Z, MINX, MINY, MINZ, MAXX, MAXY, MAXZ) _mm256_and_ps(_mm256_and_ps(_inrange8(X, MINX, MAXX), _inrange8(Y, MINY, MAXY)), _inrange8(Z, MINZ, MAXZ))
+#endif
+
+#ifdef LCOL_SSE
+#define _inrange4(V, A, B) _mm_and_ps(_mm_cmpgt_ps(V, A), _mm_cmplt_ps(V, B))
+#define _pointinbox4(X, Y, Z, MINX, MINY, MINZ, MAXX, MAXY, MAXZ) _mm_and_ps(_mm_and_ps(_inrange4(X, MINX, MAXX), _inrange4(Y, MINY, MAXY)), _inrange4(Z, MINZ, MAXZ))
+#endif
+
+static int _lcol_firstbit(int mask)
+{
+  int i = 0;
+  while (!(mask & (1 << i))) ++i;
+  return i;
+}
+
+int lcol_boxbox_soa(const float* minx1, const float* miny1, const float* minz1, const float* maxx1, const float* maxy1, const float* maxz1, int count, float minx2, float miny2, float minz2, float maxx2, float maxy2, float maxz2)
+{
+  int i = 0;
+
+  /* same tests as lcol_boxbox, on several boxes at once */
+#ifdef LCOL_AVX
+  {
+    __m256 qminx = _mm256_set1_ps(minx2), qminy = _mm256_set1_ps(miny2), qminz = _mm256_set1_ps(minz2);
+    __m256 qmaxx = _mm256_set1_ps(maxx2), qmaxy = _mm256_set1_ps(maxy2), qmaxz = _mm256_set1_ps(maxz2);
+    for (; i + 8 <= count; i += 8)
+    {
+      __m256 bminx = _mm256_loadu_ps(minx1 + i), bminy = _mm256_loadu_ps(miny1 + i), bminz = _mm256_loadu_ps(minz1 + i);
+      __m256 bmaxx = _mm256_loadu_ps(maxx1 + i), bmaxy = _mm256_loadu_ps(maxy1 + i), bmaxz = _mm256_loadu_ps(maxz1 + i);
+      __m256 hit = _mm256_or_ps(
+        _mm256_or_ps(
+          _pointinbox8(bminx, bminy, bminz, qminx, qminy, qminz, qmaxx, qmaxy, qmaxz),
+          _pointinbox8(bmaxx, bmaxy, bmaxz, qminx, qminy, qminz, qmaxx, qmaxy, qmaxz)),
+        _mm256_or_ps(
+          _pointinbox8(qminx, qminy, qminz, bminx, bminy, bminz, bmaxx, bmaxy, bmaxz),
+          _pointinbox8(qmaxx, qmaxy, qmaxz, bminx, bminy, bminz, bmaxx, bmaxy, bmaxz)));
+      int mask = _mm256_movemask_ps(hit);
+      if (mask) return i + _lcol_firstbit(mask);
+    }
+  }
+#endif
+#ifdef LCOL_SSE
+  {
+    __m128 qminx = _mm_set1_ps(minx2), qminy = _mm_set1_ps(miny2), qminz = _mm_set1_ps(minz2);
+    __m128 qmaxx = _mm_set1_ps(maxx2), qmaxy = _mm_set1_ps(maxy2), qmaxz = _mm_set1_ps(maxz2);
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 bminx = _mm_loadu_ps(minx1 + i), bminy = _mm_loadu_ps(miny1 + i), bminz = _mm_loadu_ps(minz1 + i);
+      __m128 bmaxx = _mm_loadu_ps(maxx1 + i), bmaxy = _mm_loadu_ps(maxy1 + i), bmaxz = _mm_loadu_ps(maxz1 + i);
+      __m128 hit = _mm_or_ps(
+        _mm_or_ps(
+          _pointinbox4(bminx, bminy, bminz, qminx, qminy, qminz, qmaxx, qmaxy, qmaxz),
+          _pointinbox4(bmaxx, bmaxy, bmaxz, qminx, qminy, qminz, qmaxx, qmaxy, qmaxz)),
+        _mm_or_ps(
+          _pointinbox4(qminx, qminy, qminz, bminx, bminy, bminz, bmaxx, bmaxy, bmaxz),
+          _pointinbox4(qmaxx, qmaxy, qmaxz, bminx, bminy, bminz, bmaxx, bmaxy, bmaxz)));
+      int mask = _mm_movemask_ps(hit);
+      if (mask) return i + _lcol_firstbit(mask);
+    }
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    if (lcol_boxbox(minx1[i], miny1[i], minz1[i], maxx1[i], maxy1[i], maxz1[i], minx2, miny2, minz2, maxx2, maxy2, maxz2)) return i;
+  }
+  return -1;
+}
+
+int lcol_boxsphere_soa(const float* minx1, const float* miny1, const float* minz1, const float* maxx1, const float* maxy1, const float* maxz1, int count, float sx, float sy, float sz, float sqrad)
+{
+  int i = 0;
+
+  /* same tests as lcol_boxsphere, on several boxes at once */
+#ifdef LCOL_AVX
+  {
+    __m256 x = _mm256_set1_ps(sx), y = _mm256_set1_ps(sy), z = _mm256_set1_ps(sz), r = _mm256_set1_ps(sqrad);
+    for (; i + 8 <= count; i += 8)
+    {
+      __m256 bminx = _mm256_loadu_ps(minx1 + i), bminy = _mm256_loadu_ps(miny1 + i), bminz = _mm256_loadu_ps(minz1 + i);
+      __m256 bmaxx = _mm256_loadu_ps(maxx1 + i), bmaxy = _mm256_loadu_ps(maxy1 + i), bmaxz = _mm256_loadu_ps(maxz1 + i);
+      __m256 vx = _mm256_sub_ps(_mm256_min_ps(_mm256_max_ps(x, bminx), bmaxx), x);
+      __m256 vy = _mm256_sub_ps(_mm256_min_ps(_mm256_max_ps(y, bminy), bmaxy), y);
+      __m256 vz = _mm256_sub_ps(_mm256_min_ps(_mm256_max_ps(z, bminz), bmaxz), z);
+      __m256 sqlength = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz));
+      __m256 hit = _mm256_or_ps(
+        _pointinbox8(x, y, z, bminx, bminy, bminz, bmaxx, bmaxy, bmaxz),
+        _mm256_cmp_ps(sqlength, r, _CMP_LT_OQ));
+      int mask = _mm256_movemask_ps(hit);
+      if (mask) return i + _lcol_firstbit(mask);
+    }
+  }
+#endif
+#ifdef LCOL_SSE
+  {
+    __m128 x = _mm_set1_ps(sx), y = _mm_set1_ps(sy), z = _mm_set1_ps(sz), r = _mm_set1_ps(sqrad);
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128 bminx = _mm_loadu_ps(minx1 + i), bminy = _mm_loadu_ps(miny1 + i), bminz = _mm_loadu_ps(minz1 + i);
+      __m128 bmaxx = _mm_loadu_ps(maxx1 + i), bmaxy = _mm_loadu_ps(maxy1 + i), bmaxz = _mm_loadu_ps(maxz1 + i);
+      __m128 vx = _mm_sub_ps(_mm_min_ps(_mm_max_ps(x, bminx), bmaxx), x);
+      __m128 vy = _mm_sub_ps(_mm_min_ps(_mm_max_ps(y, bminy), bmaxy), y);
+      __m128 vz = _mm_sub_ps(_mm_min_ps(_mm_max_ps(z, bminz), bmaxz), z);
+      __m128 sqlength = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+      __m128 hit = _mm_or_ps(
+        _pointinbox4(x, y, z, bminx, bminy, bminz, bmaxx, bmaxy, bmaxz),
+        _mm_cmplt_ps(sqlength, r));
+      int mask = _mm_movemask_ps(hit);
+      if (mask) return i + _lcol_firstbit(mask);
+    }
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    if (lcol_boxsphere(minx1[i], miny1[i], minz1[i], maxx1[i], maxy1[i], maxz1[i], sx, sy, sz, sqrad)) return i;
+  }
+  return -1;
+}
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
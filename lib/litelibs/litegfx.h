@@ -12,6 +12,8 @@ No warranty implied. Use as you wish and at your own risk
 #ifndef LITE_GFX_H
 #define LITE_GFX_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -36,6 +38,7 @@ void lgfx_setresolution(int width, int height);
 void lgfx_setprojection(const float* m);
 void lgfx_setmodelview(const float* m);
 void lgfx_setblend(lblend_t mode);
+void lgfx_setalphatest(float threshold); /* fragments with a lower alpha are discarded. 0 disables it */
 void lgfx_setcolor(float r, float g, float b, float a);
 void lgfx_setemissive(float r, float g, float b);
 void lgfx_setspecular(float r, float g, float b);
@@ -55,6 +58,10 @@ void lgfx_drawrect(float x, float y, float width, float height);
 void lgfx_drawoval(float x, float y, float width, float height);
 int lgfx_multitexture_supported();
 int lgfx_mipmapping_supported();
+int lgfx_compression_supported(); /* S3TC (BC1 to BC3) compressed textures */
+int lgfx_pbo_supported(); /* texture uploads are staged through pixel buffer objects */
+void lgfx_getuploadstats(size_t* out_bytes, double* out_stall_time); /* since last reset. stall time is in seconds */
+void lgfx_resetuploadstats();
 
 /* texture */
 
@@ -65,18 +72,46 @@ typedef enum
   F_MIPMAP
 } ltexfilter_t;
 
+typedef enum
+{
+  C_BC1,
+  C_BC2,
+  C_BC3
+} ltexcompression_t;
+
+typedef enum
+{
+  TF_RGBA8,
+  TF_A8,
+  TF_L8,
+  TF_LA8,
+  TF_RGB565,
+  TF_RGBA4444
+} ltexformat_t;
+
 typedef struct
 {
   int glid;
   int width;
   int height;
   int filter;
+  int format;
 } ltex_t;
 
-ltex_t* ltex_alloc(int width, int height, int filter);
+ltex_t* ltex_alloc(int width, int height, int filter, int format);
 void ltex_free(ltex_t* tex);
-void ltex_setpixels(const ltex_t* tex, const unsigned char* pixels);
-void ltex_getpixels(const ltex_t* tex, unsigned char* out_pixels);
+int ltex_pixelsize(int format); /* in bytes */
+void ltex_fromrgba(int format, const unsigned char* rgba, int count, unsigned char* out_pixels); /* converts count pixels to the given format */
+void ltex_torgba(int format, const unsigned char* pixels, int count, unsigned char* out_rgba); /* converts count pixels from the given format, as gl samples them */
+void ltex_setpixels(const ltex_t* tex, const unsigned char* pixels); /* pixels are in the format of the texture */
+void ltex_getpixels(const ltex_t* tex, unsigned char* out_pixels); /* returns rgba pixels for all formats */
+void ltex_setregion(const ltex_t* tex, int x, int y, int width, int height, const unsigned char* pixels, int row_length); /* pixels points to the first pixel of the region. does not generate mipmaps */
+void ltex_genmipmaps(const ltex_t* tex);
+void ltex_setlevel(const ltex_t* tex, int level, int width, int height, const unsigned char* pixels); /* does not generate mipmaps */
+void ltex_setcompressedlevel(const ltex_t* tex, int level, int compression, int width, int height, const unsigned char* data, int size);
+void ltex_setnumlevels(const ltex_t* tex, int num_levels); /* number of levels uploaded with ltex_setlevel or ltex_setcompressedlevel */
+void ltex_setbaselevel(const ltex_t* tex, int level); /* finest level used for sampling. levels above it do not need to be uploaded */
+void ltex_freelevel(const ltex_t* tex, int level); /* frees the memory of a level above the base level */
 void ltex_draw(const ltex_t* tex, float x, float y);
 void ltex_drawrot(const ltex_t* tex, float x, float y, float angle, float pivotx, float pivoty);
 void ltex_drawrotsized(const ltex_t* tex, float x, float y, float angle, float pivotx, float pivoty, float width, float height, float u0, float v0, float u1, float v1);
@@ -134,15 +169,32 @@ void lvert_drawindexed(const lvert_t* vertices, const unsigned short* indices, u
 #include <Windows.h>
 #include <GL/gl.h>
 #include <GL/glext.h>
+#else
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#endif
+#include <sys/time.h>
 #endif
 #include <GL/gl.h>
 #endif
+#ifdef __APPLE__
+#include <sys/time.h>
+#endif
 
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
 #define OVALPOINTS 64
+#define PBO_RING 4 /* number of staging buffers used in turn */
+#define PBO_MINSIZE 65536 /* smaller uploads are copied directly */
+
+/* these are defined here because some headers do not include the s3tc extension */
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -154,8 +206,152 @@ extern "C"
 static PFNGLACTIVETEXTUREPROC glActiveTexture = NULL;
 static PFNGLCLIENTACTIVETEXTUREPROC glClientActiveTexture = NULL;
 static PFNGLGENERATEMIPMAPPROC glGenerateMipmap = NULL;
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D = NULL;
+static PFNGLGENBUFFERSPROC glGenBuffers = NULL;
+static PFNGLBINDBUFFERPROC glBindBuffer = NULL;
+static PFNGLBUFFERDATAPROC glBufferData = NULL;
+static PFNGLMAPBUFFERPROC glMapBuffer = NULL;
+static PFNGLUNMAPBUFFERPROC glUnmapBuffer = NULL;
+static PFNGLFENCESYNCPROC glFenceSync = NULL;
+static PFNGLCLIENTWAITSYNCPROC glClientWaitSync = NULL;
+static PFNGLDELETESYNCPROC glDeleteSync = NULL;
+#endif
+
+static int _lgfx_s3tc_supported = 0;
+
+/* staging ring for texture uploads. without fences, buffers are orphaned before reusing them */
+#ifdef GL_PIXEL_UNPACK_BUFFER
+static GLuint _lgfx_pbos[PBO_RING];
+static size_t _lgfx_pbo_sizes[PBO_RING];
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+static GLsync _lgfx_pbo_fences[PBO_RING];
+#endif
+static int _lgfx_pbo_next = 0;
+static int _lgfx_pbo_bound = -1;
+#endif
+static int _lgfx_pbo_supported = 0;
+static int _lgfx_sync_supported = 0;
+static size_t _lgfx_upload_bytes = 0;
+static double _lgfx_upload_stall = 0;
+
+static int _lgfx_glversion(int major, int minor)
+{
+  const char* version;
+  int ver_major, ver_minor;
+
+  version = (const char*)glGetString(GL_VERSION);
+  if (!version) return 0;
+  ver_major = atoi(version);
+  ver_minor = strchr(version, '.') ? atoi(strchr(version, '.') + 1) : 0;
+  return ver_major > major || (ver_major == major && ver_minor >= minor);
+}
+
+static int _lgfx_hasextension(const char* name)
+{
+  const char* extensions;
+
+  extensions = (const char*)glGetString(GL_EXTENSIONS);
+  return extensions != NULL && strstr(extensions, name) != NULL;
+}
+
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+static double _lgfx_time()
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec / 1000000.0;
+#endif
+}
+#endif
+
+/* returns the pointer to pass to gl for the upload. large uploads are copied into the next
+   buffer of the ring, which stays bound until _lgfx_endupload, so gl can return without waiting for the transfer */
+static const unsigned char* _lgfx_beginupload(const unsigned char* pixels, int width, int height, int row_length, int pixel_size)
+{
+#ifdef GL_PIXEL_UNPACK_BUFFER
+  size_t size;
+  unsigned char* buffer;
+  int slot, y;
+#endif
+
+  if (!pixels) return NULL;
+  _lgfx_upload_bytes += (size_t)width * height * pixel_size;
+
+#ifdef GL_PIXEL_UNPACK_BUFFER
+  size = (size_t)width * height * pixel_size;
+  if (_lgfx_pbo_supported && size >= PBO_MINSIZE)
+  {
+    slot = _lgfx_pbo_next;
+    _lgfx_pbo_next = (_lgfx_pbo_next + 1) % PBO_RING;
+
+    /* wait until gl has finished reading the previous upload in this buffer */
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+    if (_lgfx_pbo_fences[slot])
+    {
+      if (glClientWaitSync(_lgfx_pbo_fences[slot], 0, 0) == GL_TIMEOUT_EXPIRED)
+      {
+        double start = _lgfx_time();
+        glClientWaitSync(_lgfx_pbo_fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        _lgfx_upload_stall += _lgfx_time() - start;
+      }
+      glDeleteSync(_lgfx_pbo_fences[slot]);
+      _lgfx_pbo_fences[slot] = 0;
+    }
+#endif
+
+    /* grow buffer, or orphan its storage if we cannot know if gl is still reading it */
+    if (_lgfx_pbos[slot] == 0) glGenBuffers(1, &_lgfx_pbos[slot]);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _lgfx_pbos[slot]);
+    if (size > _lgfx_pbo_sizes[slot] || !_lgfx_sync_supported)
+    {
+      if (size > _lgfx_pbo_sizes[slot]) _lgfx_pbo_sizes[slot] = size;
+      glBufferData(GL_PIXEL_UNPACK_BUFFER, _lgfx_pbo_sizes[slot], NULL, GL_STREAM_DRAW);
+    }
+
+    /* copy rows tightly packed */
+    buffer = (unsigned char*)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+    if (buffer)
+    {
+      for (y = 0; y < height; ++y)
+      {
+        memcpy(buffer + (size_t)y * width * pixel_size, pixels + (size_t)y * row_length * pixel_size, (size_t)width * pixel_size);
+      }
+      if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+      {
+        _lgfx_pbo_bound = slot;
+        return NULL; /* offset in the bound buffer */
+      }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  }
 #endif
 
+  /* direct upload */
+  if (row_length != width) glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+  return pixels;
+}
+
+static void _lgfx_endupload()
+{
+#ifdef GL_PIXEL_UNPACK_BUFFER
+  if (_lgfx_pbo_bound != -1)
+  {
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+    if (_lgfx_sync_supported) _lgfx_pbo_fences[_lgfx_pbo_bound] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    _lgfx_pbo_bound = -1;
+  }
+#endif
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
 /* setup */
 
 void lgfx_init()
@@ -165,6 +361,42 @@ void lgfx_init()
   glActiveTexture = (PFNGLACTIVETEXTUREPROC)wglGetProcAddress("glActiveTexture");
   glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)wglGetProcAddress("glClientActiveTexture");
   glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)wglGetProcAddress("glGenerateMipmap");
+  glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)wglGetProcAddress("glCompressedTexImage2D");
+  glGenBuffers = (PFNGLGENBUFFERSPROC)wglGetProcAddress("glGenBuffers");
+  glBindBuffer = (PFNGLBINDBUFFERPROC)wglGetProcAddress("glBindBuffer");
+  glBufferData = (PFNGLBUFFERDATAPROC)wglGetProcAddress("glBufferData");
+  glMapBuffer = (PFNGLMAPBUFFERPROC)wglGetProcAddress("glMapBuffer");
+  glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)wglGetProcAddress("glUnmapBuffer");
+  glFenceSync = (PFNGLFENCESYNCPROC)wglGetProcAddress("glFenceSync");
+  glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)wglGetProcAddress("glClientWaitSync");
+  glDeleteSync = (PFNGLDELETESYNCPROC)wglGetProcAddress("glDeleteSync");
+#endif
+
+  /* rows of compact formats are not padded */
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  /* check extensions once the context exists */
+  _lgfx_s3tc_supported = _lgfx_hasextension("GL_EXT_texture_compression_s3tc");
+
+  /* buffers from a previous context are gone with it */
+#ifdef GL_PIXEL_UNPACK_BUFFER
+  memset(_lgfx_pbos, 0, sizeof(_lgfx_pbos));
+  memset(_lgfx_pbo_sizes, 0, sizeof(_lgfx_pbo_sizes));
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+  memset(_lgfx_pbo_fences, 0, sizeof(_lgfx_pbo_fences));
+#endif
+  _lgfx_pbo_next = 0;
+  _lgfx_pbo_bound = -1;
+  _lgfx_pbo_supported = _lgfx_glversion(2, 1) || _lgfx_hasextension("GL_ARB_pixel_buffer_object");
+#ifdef _WIN32
+  _lgfx_pbo_supported = _lgfx_pbo_supported && glGenBuffers != NULL && glMapBuffer != NULL;
+#endif
+#endif
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+  _lgfx_sync_supported = _lgfx_glversion(3, 2) || _lgfx_hasextension("GL_ARB_sync");
+#ifdef _WIN32
+  _lgfx_sync_supported = _lgfx_sync_supported && glFenceSync != NULL && glClientWaitSync != NULL;
+#endif
 #endif
 }
 
@@ -294,6 +526,19 @@ void lgfx_setblend(lblend_t mode)
   }
 }
 
+void lgfx_setalphatest(float threshold)
+{
+  if (threshold > 0)
+  {
+    glEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GEQUAL, threshold);
+  }
+  else
+  {
+    glDisable(GL_ALPHA_TEST);
+  }
+}
+
 void lgfx_setcolor(float r, float g, float b, float a)
 {
   glColor4f(r, g, b, a);
@@ -472,12 +717,77 @@ int lgfx_multitexture_supported() {
 }
 
 int lgfx_mipmapping_supported() {
+#ifdef _WIN32
   return glGenerateMipmap != NULL;
+#else
+  return 1;
+#endif
+}
+
+int lgfx_compression_supported() {
+#ifdef _WIN32
+  return glCompressedTexImage2D != NULL && _lgfx_s3tc_supported;
+#else
+  return _lgfx_s3tc_supported;
+#endif
+}
+
+int lgfx_pbo_supported() {
+  return _lgfx_pbo_supported;
+}
+
+void lgfx_getuploadstats(size_t* out_bytes, double* out_stall_time)
+{
+  *out_bytes = _lgfx_upload_bytes;
+  *out_stall_time = _lgfx_upload_stall;
+}
+
+void lgfx_resetuploadstats()
+{
+  _lgfx_upload_bytes = 0;
+  _lgfx_upload_stall = 0;
 }
 
 /* texture */
 
-ltex_t* ltex_alloc(int width, int height, int filter)
+static void _lgfx_glformat(int format, GLint* out_internal, GLenum* out_format, GLenum* out_type)
+{
+  switch (format)
+  {
+    case TF_A8:
+      *out_internal = GL_ALPHA8;
+      *out_format = GL_ALPHA;
+      *out_type = GL_UNSIGNED_BYTE;
+      break;
+    case TF_L8:
+      *out_internal = GL_LUMINANCE8;
+      *out_format = GL_LUMINANCE;
+      *out_type = GL_UNSIGNED_BYTE;
+      break;
+    case TF_LA8:
+      *out_internal = GL_LUMINANCE8_ALPHA8;
+      *out_format = GL_LUMINANCE_ALPHA;
+      *out_type = GL_UNSIGNED_BYTE;
+      break;
+    case TF_RGB565:
+      *out_internal = GL_RGB5;
+      *out_format = GL_RGB;
+      *out_type = GL_UNSIGNED_SHORT_5_6_5;
+      break;
+    case TF_RGBA4444:
+      *out_internal = GL_RGBA4;
+      *out_format = GL_RGBA;
+      *out_type = GL_UNSIGNED_SHORT_4_4_4_4;
+      break;
+    default:
+      *out_internal = GL_RGBA;
+      *out_format = GL_RGBA;
+      *out_type = GL_UNSIGNED_BYTE;
+      break;
+  }
+}
+
+ltex_t* ltex_alloc(int width, int height, int filter, int format)
 {
   GLuint gltex;
   GLint minfilter, magfilter;
@@ -514,6 +824,7 @@ ltex_t* ltex_alloc(int width, int height, int filter)
   tex->width = width;
   tex->height = height;
   tex->filter = filter;
+  tex->format = format;
 
   return tex;
 }
@@ -524,19 +835,207 @@ void ltex_free(ltex_t* tex)
   free(tex);
 }
 
+int ltex_pixelsize(int format)
+{
+  switch (format)
+  {
+    case TF_A8:
+    case TF_L8:
+      return 1;
+    case TF_LA8:
+    case TF_RGB565:
+    case TF_RGBA4444:
+      return 2;
+    default:
+      return 4;
+  }
+}
+
+void ltex_fromrgba(int format, const unsigned char* rgba, int count, unsigned char* out_pixels)
+{
+  unsigned short packed;
+  int i;
+
+  for (i = 0; i < count; ++i, rgba += 4)
+  {
+    switch (format)
+    {
+      case TF_A8:
+        out_pixels[i] = rgba[3];
+        break;
+      case TF_L8:
+        out_pixels[i] = (unsigned char)((rgba[0] * 77 + rgba[1] * 150 + rgba[2] * 29) >> 8);
+        break;
+      case TF_LA8:
+        out_pixels[i*2] = (unsigned char)((rgba[0] * 77 + rgba[1] * 150 + rgba[2] * 29) >> 8);
+        out_pixels[i*2 + 1] = rgba[3];
+        break;
+      case TF_RGB565:
+        packed = (unsigned short)(((rgba[0] >> 3) << 11) | ((rgba[1] >> 2) << 5) | (rgba[2] >> 3));
+        memcpy(&out_pixels[i*2], &packed, 2); /* packed formats are in native byte order */
+        break;
+      case TF_RGBA4444:
+        packed = (unsigned short)(((rgba[0] >> 4) << 12) | ((rgba[1] >> 4) << 8) | ((rgba[2] >> 4) << 4) | (rgba[3] >> 4));
+        memcpy(&out_pixels[i*2], &packed, 2);
+        break;
+      default:
+        memcpy(&out_pixels[i*4], rgba, 4);
+        break;
+    }
+  }
+}
+
+void ltex_torgba(int format, const unsigned char* pixels, int count, unsigned char* out_rgba)
+{
+  unsigned short packed;
+  int i;
+
+  for (i = 0; i < count; ++i, out_rgba += 4)
+  {
+    switch (format)
+    {
+      case TF_A8:
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = 0;
+        out_rgba[3] = pixels[i];
+        break;
+      case TF_L8:
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = pixels[i];
+        out_rgba[3] = 255;
+        break;
+      case TF_LA8:
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = pixels[i*2];
+        out_rgba[3] = pixels[i*2 + 1];
+        break;
+      case TF_RGB565:
+        memcpy(&packed, &pixels[i*2], 2);
+        out_rgba[0] = (unsigned char)((((packed >> 11) & 31) * 255 + 15) / 31);
+        out_rgba[1] = (unsigned char)((((packed >> 5) & 63) * 255 + 31) / 63);
+        out_rgba[2] = (unsigned char)(((packed & 31) * 255 + 15) / 31);
+        out_rgba[3] = 255;
+        break;
+      case TF_RGBA4444:
+        memcpy(&packed, &pixels[i*2], 2);
+        out_rgba[0] = (unsigned char)(((packed >> 12) & 15) * 17);
+        out_rgba[1] = (unsigned char)(((packed >> 8) & 15) * 17);
+        out_rgba[2] = (unsigned char)(((packed >> 4) & 15) * 17);
+        out_rgba[3] = (unsigned char)((packed & 15) * 17);
+        break;
+      default:
+        memcpy(out_rgba, &pixels[i*4], 4);
+        break;
+    }
+  }
+}
+
 void ltex_setpixels(const ltex_t* tex, const unsigned char* pixels)
 {
+  const unsigned char* data;
+  GLint internal;
+  GLenum format, type;
+
+  _lgfx_glformat(tex->format, &internal, &format, &type);
   glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex->width, tex->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  data = _lgfx_beginupload(pixels, tex->width, tex->height, tex->width, ltex_pixelsize(tex->format));
+  glTexImage2D(GL_TEXTURE_2D, 0, internal, tex->width, tex->height, 0, format, type, data);
+  _lgfx_endupload();
   if (tex->filter == F_MIPMAP) glGenerateMipmap(GL_TEXTURE_2D);
   glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 void ltex_getpixels(const ltex_t* tex, unsigned char* out_pixels)
 {
+  int i;
+
   glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
   glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, out_pixels);
   glBindTexture(GL_TEXTURE_2D, 0);
+
+  /* gl returns luminance in the red channel only */
+  if (tex->format == TF_L8 || tex->format == TF_LA8)
+  {
+    for (i = 0; i < tex->width * tex->height; ++i)
+    {
+      out_pixels[i*4 + 1] = out_pixels[i*4 + 2] = out_pixels[i*4];
+    }
+  }
+}
+
+void ltex_setregion(const ltex_t* tex, int x, int y, int width, int height, const unsigned char* pixels, int row_length)
+{
+  const unsigned char* data;
+  GLint internal;
+  GLenum format, type;
+
+  _lgfx_glformat(tex->format, &internal, &format, &type);
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  data = _lgfx_beginupload(pixels, width, height, row_length, ltex_pixelsize(tex->format));
+  glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, type, data);
+  _lgfx_endupload();
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void ltex_genmipmaps(const ltex_t* tex)
+{
+  if (tex->filter != F_MIPMAP) return;
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  glGenerateMipmap(GL_TEXTURE_2D);
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void ltex_setlevel(const ltex_t* tex, int level, int width, int height, const unsigned char* pixels)
+{
+  const unsigned char* data;
+  GLint internal;
+  GLenum format, type;
+
+  _lgfx_glformat(tex->format, &internal, &format, &type);
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  data = _lgfx_beginupload(pixels, width, height, width, ltex_pixelsize(tex->format));
+  glTexImage2D(GL_TEXTURE_2D, level, internal, width, height, 0, format, type, data);
+  _lgfx_endupload();
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void ltex_setcompressedlevel(const ltex_t* tex, int level, int compression, int width, int height, const unsigned char* data, int size)
+{
+  GLenum format;
+
+  switch (compression)
+  {
+    case C_BC1: format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+    case C_BC2: format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+    default: format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+  }
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  glCompressedTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, size, data);
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void ltex_setnumlevels(const ltex_t* tex, int num_levels)
+{
+  /* limit the mipmap chain so textures with a partial chain are complete */
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, num_levels - 1);
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void ltex_setbaselevel(const ltex_t* tex, int level)
+{
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level);
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void ltex_freelevel(const ltex_t* tex, int level)
+{
+  GLint internal;
+  GLenum format, type;
+
+  /* redefining the level as empty releases its storage */
+  _lgfx_glformat(tex->format, &internal, &format, &type);
+  glBindTexture(GL_TEXTURE_2D, (GLuint)tex->glid);
+  glTexImage2D(GL_TEXTURE_2D, level, internal, 0, 0, 0, format, type, NULL);
+  glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 void ltex_draw(const ltex_t* tex, float x, float y)
@@ -0,0 +1,911 @@
+/*
+LiteGLB
+Public domain glTF 2.0 binary (.glb) model loader
+It does not support animations, skins or node transforms
+Can be used with LiteGFX
+Created by Javier San Juan Cervera
+No warranty implied. Use as you wish and at your own risk
+*/
+
+#ifndef LITE_GLB_H
+#define LITE_GLB_H
+
+#include <stddef.h>
+
+#ifdef LITE_GLB_USE_GFX
+#include "litegfx.h"
+#endif
+
+#define LGLB_ALPHA_OPAQUE 0
+#define LGLB_ALPHA_MASK 1
+#define LGLB_ALPHA_BLEND 2
+
+#define LGLB_MODE_TRIANGLES 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* buffer view (only views into the binary chunk are supported) */
+typedef struct
+{
+  size_t byte_offset;
+  size_t byte_length;
+  int    byte_stride; /* 0 if tightly packed */
+} lglb_bufferview_t;
+
+/* accessor */
+typedef struct
+{
+  int    buffer_view; /* -1 if the accessor has no data (reads as zeros) */
+  size_t byte_offset;
+  int    component_type; /* 5120 byte, 5121 ubyte, 5122 short, 5123 ushort, 5125 uint, 5126 float */
+  int    normalized;
+  int    num_components;
+  int    count;
+} lglb_accessor_t;
+
+/* primitive (every field is an accessor index or -1, except material and mode) */
+typedef struct
+{
+  int position;
+  int normal;
+  int texcoords[2];
+  int color;
+  int indices;
+  int material; /* -1 for the default material */
+  int mode;     /* one of the glTF primitive modes, LGLB_MODE_TRIANGLES is the only one that lglb_getindices supports */
+} lglb_primitive_t;
+
+/* mesh */
+typedef struct
+{
+  int               num_primitives;
+  lglb_primitive_t* primitives;
+} lglb_mesh_t;
+
+/* material */
+typedef struct
+{
+  float base_color[4];
+  int   base_color_texture; /* index in textures array, or -1 */
+  int   base_color_texcoord;
+  float emissive[3];
+  int   alpha_mode; /* one of LGLB_ALPHA_* macros */
+  float alpha_cutoff;
+  int   double_sided;
+} lglb_material_t;
+
+/* image (either stored in a buffer view or referenced by uri) */
+typedef struct
+{
+  int  buffer_view; /* -1 if the image is stored in an external file */
+  char uri[256];
+} lglb_image_t;
+
+/* scene */
+typedef struct
+{
+  int                num_buffer_views;
+  int                num_accessors;
+  int                num_meshes;
+  int                num_materials;
+  int                num_textures;
+  int                num_images;
+  lglb_bufferview_t* buffer_views;
+  lglb_accessor_t*   accessors;
+  lglb_mesh_t*       meshes;
+  lglb_material_t*   materials;
+  int*               textures; /* index in images array, or -1 */
+  lglb_image_t*      images;
+  const char*        bin; /* binary chunk, points into the source buffer */
+  size_t             bin_size;
+  char*              owned; /* file buffer when loaded with lglb_load */
+} lglb_scene_t;
+
+/* the scene references the binary chunk in mem, so it must be kept alive until lglb_free is called */
+lglb_scene_t* lglb_load(const char* filename);
+lglb_scene_t* lglb_loadmem(const char* mem, size_t size);
+void lglb_free(lglb_scene_t* scene);
+const char* lglb_bufferviewdata(const lglb_scene_t* scene, int buffer_view, size_t* out_size);
+int lglb_numvertices(const lglb_scene_t* scene, const lglb_primitive_t* primitive);
+int lglb_numindices(const lglb_scene_t* scene, const lglb_primitive_t* primitive);
+int lglb_getindices(const lglb_scene_t* scene, const lglb_primitive_t* primitive, unsigned short* out_indices); /* fails if an index does not fit in 16 bits */
+int lglb_readfloats(const lglb_scene_t* scene, int accessor, int num_components, float* out, size_t out_stride); /* out_stride in bytes */
+
+#ifdef LITE_GLB_USE_GFX
+void lglb_getvertices(const lglb_scene_t* scene, const lglb_primitive_t* primitive, lvert_t* out_vertices);
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LITE_GLB_H */
+
+
+
+/* IMPLEMENTATION */
+
+
+
+#ifdef LITE_GLB_IMPLEMENTATION
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LGLB_MAGIC      0x46546C67 /* "glTF" */
+#define LGLB_CHUNK_JSON 0x4E4F534A
+#define LGLB_CHUNK_BIN  0x004E4942
+
+#define LGLB_JSON_OBJECT    0
+#define LGLB_JSON_ARRAY     1
+#define LGLB_JSON_STRING    2
+#define LGLB_JSON_PRIMITIVE 3
+
+#define LGLB_JSON_MAX_DEPTH 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* json token. objects store keys and values as consecutive tokens */
+typedef struct
+{
+  int    type; /* one of LGLB_JSON_* macros */
+  size_t start;
+  size_t end;
+  int    size; /* number of members or elements */
+  int    next; /* index of the token that follows this one and its children */
+} lglb_token_t;
+
+typedef struct
+{
+  const char*   text;
+  size_t        length;
+  size_t        pos;
+  lglb_token_t* tokens;
+  int           num_tokens;
+} lglb_json_t;
+
+
+static int _lglb_parse_json(lglb_json_t* json, const char* text, size_t length);
+static int _lglb_parse_value(lglb_json_t* json, int depth);
+static int _lglb_add_token(lglb_json_t* json, int type, size_t start);
+static void _lglb_skip_spaces(lglb_json_t* json);
+static int _lglb_is_space(char c);
+static int _lglb_find(const lglb_json_t* json, int object, const char* key);
+static int _lglb_element(const lglb_json_t* json, int array, int index);
+static int _lglb_size(const lglb_json_t* json, int token, int type);
+static int _lglb_equals(const lglb_json_t* json, int token, const char* str);
+static int _lglb_int(const lglb_json_t* json, int token, int def);
+static float _lglb_float(const lglb_json_t* json, int token, float def);
+static double _lglb_double(const lglb_json_t* json, int token, double def);
+static void _lglb_string(const lglb_json_t* json, int token, char* out, int len);
+static void _lglb_floats(const lglb_json_t* json, int token, float* out, int count);
+static int _lglb_load_json(lglb_scene_t* scene, const lglb_json_t* json);
+static int _lglb_load_accessor(lglb_scene_t* scene, const lglb_json_t* json, int token, lglb_accessor_t* accessor);
+static int _lglb_load_primitive(lglb_scene_t* scene, const lglb_json_t* json, int token, lglb_primitive_t* primitive);
+static void _lglb_load_material(const lglb_json_t* json, int token, lglb_material_t* material);
+static int _lglb_component_size(int component_type);
+static float _lglb_component(const unsigned char* data, int component_type, int normalized);
+static unsigned int _lglb_index(const unsigned char* data, int component_type);
+static const unsigned char* _lglb_accessor_data(const lglb_scene_t* scene, const lglb_accessor_t* accessor, size_t* out_stride);
+static unsigned int _lglb_read_uint(const char* mem);
+
+
+lglb_scene_t* lglb_load(const char* filename)
+{
+  FILE *fhandle;
+  long size;
+  char* buffer;
+  lglb_scene_t* scene;
+
+  /* read file */
+  fhandle = fopen(filename, "rb");
+  if (!fhandle) return 0;
+  fseek(fhandle, 0, SEEK_END);
+  size = ftell(fhandle);
+  fseek(fhandle, 0, SEEK_SET);
+  buffer = (char*)malloc(size);
+  fread(buffer, size, 1, fhandle);
+  fclose(fhandle);
+
+  /* load scene, which keeps referencing the buffer */
+  scene = lglb_loadmem(buffer, size);
+  if (scene) scene->owned = buffer;
+  else free(buffer);
+
+  return scene;
+}
+
+lglb_scene_t* lglb_loadmem(const char* mem, size_t size)
+{
+  size_t json_length;
+  size_t offset;
+  lglb_json_t json;
+  lglb_scene_t* scene;
+
+  /* check header and json chunk */
+  if (size < 20 || _lglb_read_uint(mem) != LGLB_MAGIC || _lglb_read_uint(mem + 4) != 2) return 0;
+  if (_lglb_read_uint(mem + 8) < size) size = _lglb_read_uint(mem + 8);
+  json_length = _lglb_read_uint(mem + 12);
+  if (size < 20 || _lglb_read_uint(mem + 16) != LGLB_CHUNK_JSON || json_length > size - 20) return 0;
+
+  /* parse json */
+  if (!_lglb_parse_json(&json, mem + 20, json_length))
+  {
+    free(json.tokens);
+    return 0;
+  }
+
+  /* find binary chunk (chunks are padded to 4 bytes) */
+  scene = (lglb_scene_t*)calloc(1, sizeof(lglb_scene_t));
+  offset = 20 + ((json_length + 3) & ~(size_t)3);
+  if (offset <= size && size - offset >= 8 && _lglb_read_uint(mem + offset + 4) == LGLB_CHUNK_BIN)
+  {
+    scene->bin = mem + offset + 8;
+    scene->bin_size = _lglb_read_uint(mem + offset);
+    if (scene->bin_size > size - offset - 8) scene->bin_size = size - offset - 8;
+  }
+
+  /* read scene */
+  if (!_lglb_load_json(scene, &json))
+  {
+    free(json.tokens);
+    lglb_free(scene);
+    return 0;
+  }
+
+  free(json.tokens);
+  return scene;
+}
+
+void lglb_free(lglb_scene_t* scene)
+{
+  int i;
+
+  for (i = 0; i < scene->num_meshes && scene->meshes; ++i)
+  {
+    free(scene->meshes[i].primitives);
+  }
+  free(scene->buffer_views);
+  free(scene->accessors);
+  free(scene->meshes);
+  free(scene->materials);
+  free(scene->textures);
+  free(scene->images);
+  free(scene->owned);
+  free(scene);
+}
+
+const char* lglb_bufferviewdata(const lglb_scene_t* scene, int buffer_view, size_t* out_size)
+{
+  if (buffer_view < 0 || buffer_view >= scene->num_buffer_views) return 0;
+  if (out_size) *out_size = scene->buffer_views[buffer_view].byte_length;
+  return scene->bin + scene->buffer_views[buffer_view].byte_offset;
+}
+
+int lglb_numvertices(const lglb_scene_t* scene, const lglb_primitive_t* primitive)
+{
+  return (primitive->position >= 0) ? scene->accessors[primitive->position].count : 0;
+}
+
+int lglb_numindices(const lglb_scene_t* scene, const lglb_primitive_t* primitive)
+{
+  return (primitive->indices >= 0) ? scene->accessors[primitive->indices].count : lglb_numvertices(scene, primitive);
+}
+
+int lglb_getindices(const lglb_scene_t* scene, const lglb_primitive_t* primitive, unsigned short* out_indices)
+{
+  const lglb_accessor_t* accessor;
+  const unsigned char* data;
+  size_t stride;
+  unsigned int num_vertices;
+  unsigned int index;
+  int i;
+
+  if (primitive->mode != LGLB_MODE_TRIANGLES) return 0;
+  num_vertices = (unsigned int)lglb_numvertices(scene, primitive);
+
+  /* non indexed primitives use the vertices in order */
+  if (primitive->indices < 0)
+  {
+    if (num_vertices > 65536) return 0;
+    for (i = 0; i < (int)num_vertices; ++i) out_indices[i] = (unsigned short)i;
+    return 1;
+  }
+
+  /* read indices, copying them as a block if they are already 16 bit */
+  accessor = &scene->accessors[primitive->indices];
+  data = _lglb_accessor_data(scene, accessor, &stride);
+  if (!data || accessor->num_components != 1) return 0;
+  if (accessor->component_type == 5123 && stride == sizeof(unsigned short))
+  {
+    memcpy(out_indices, data, accessor->count * sizeof(unsigned short));
+    for (i = 0; i < accessor->count; ++i)
+    {
+      if (out_indices[i] >= num_vertices) return 0;
+    }
+  }
+  else
+  {
+    for (i = 0; i < accessor->count; ++i)
+    {
+      index = _lglb_index(data + i * stride, accessor->component_type);
+      if (index >= num_vertices || index > 65535) return 0;
+      out_indices[i] = (unsigned short)index;
+    }
+  }
+
+  return 1;
+}
+
+int lglb_readfloats(const lglb_scene_t* scene, int accessor, int num_components, float* out, size_t out_stride)
+{
+  const lglb_accessor_t* acc;
+  const unsigned char* data;
+  size_t stride;
+  size_t comp_size;
+  int i, c;
+
+  if (accessor < 0 || accessor >= scene->num_accessors) return 0;
+  acc = &scene->accessors[accessor];
+  data = _lglb_accessor_data(scene, acc, &stride);
+  comp_size = _lglb_component_size(acc->component_type);
+
+  for (i = 0; i < acc->count; ++i)
+  {
+    float* dst = (float*)((char*)out + i * out_stride);
+    const unsigned char* src = data ? data + i * stride : 0;
+
+    /* float data with enough components is copied directly */
+    if (src && acc->component_type == 5126 && acc->num_components >= num_components)
+    {
+      memcpy(dst, src, num_components * sizeof(float));
+      continue;
+    }
+
+    /* convert components, filling missing ones like glTF does (w defaults to one) */
+    for (c = 0; c < num_components; ++c)
+    {
+      if (src && c < acc->num_components) dst[c] = _lglb_component(src + c * comp_size, acc->component_type, acc->normalized);
+      else dst[c] = (c == 3) ? 1.0f : 0.0f;
+    }
+  }
+
+  return 1;
+}
+
+static int _lglb_parse_json(lglb_json_t* json, const char* text, size_t length)
+{
+  json->text = text;
+  json->length = length;
+  json->pos = 0;
+  json->tokens = 0;
+  json->num_tokens = 0;
+  if (_lglb_parse_value(json, 0) != 0) return 0;
+  return json->tokens[0].type == LGLB_JSON_OBJECT;
+}
+
+static int _lglb_parse_value(lglb_json_t* json, int depth)
+{
+  int token;
+  char c;
+
+  _lglb_skip_spaces(json);
+  if (json->pos >= json->length || depth > LGLB_JSON_MAX_DEPTH) return -1;
+  c = json->text[json->pos];
+
+  if (c == '{' || c == '[')
+  {
+    /* object or array */
+    token = _lglb_add_token(json, (c == '{') ? LGLB_JSON_OBJECT : LGLB_JSON_ARRAY, json->pos);
+    ++json->pos;
+    _lglb_skip_spaces(json);
+    if (json->pos < json->length && json->text[json->pos] == ((c == '{') ? '}' : ']'))
+    {
+      ++json->pos;
+    }
+    else
+    {
+      for (;;)
+      {
+        if (c == '{')
+        {
+          /* key must be a string followed by a colon */
+          _lglb_skip_spaces(json);
+          if (json->pos >= json->length || json->text[json->pos] != '"') return -1;
+          if (_lglb_parse_value(json, depth + 1) < 0) return -1;
+          _lglb_skip_spaces(json);
+          if (json->pos >= json->length || json->text[json->pos] != ':') return -1;
+          ++json->pos;
+        }
+        if (_lglb_parse_value(json, depth + 1) < 0) return -1;
+        ++json->tokens[token].size;
+        _lglb_skip_spaces(json);
+        if (json->pos >= json->length) return -1;
+        if (json->text[json->pos] == ',')
+        {
+          ++json->pos;
+        }
+        else if (json->text[json->pos] == ((c == '{') ? '}' : ']'))
+        {
+          ++json->pos;
+          break;
+        }
+        else
+        {
+          return -1;
+        }
+      }
+    }
+  }
+  else if (c == '"')
+  {
+    /* string (start and end exclude the quotes) */
+    token = _lglb_add_token(json, LGLB_JSON_STRING, json->pos + 1);
+    for (++json->pos; json->pos < json->length && json->text[json->pos] != '"'; ++json->pos)
+    {
+      if (json->text[json->pos] == '\\') ++json->pos;
+    }
+    if (json->pos >= json->length) return -1;
+    json->tokens[token].end = json->pos++;
+    json->tokens[token].next = json->num_tokens;
+    return token;
+  }
+  else
+  {
+    /* number, true, false or null */
+    token = _lglb_add_token(json, LGLB_JSON_PRIMITIVE, json->pos);
+    while (json->pos < json->length && !_lglb_is_space(json->text[json->pos]) && json->text[json->pos] != ',' && json->text[json->pos] != ']' && json->text[json->pos] != '}') ++json->pos;
+    if (json->pos == json->tokens[token].start) return -1;
+  }
+
+  json->tokens[token].end = json->pos;
+  json->tokens[token].next = json->num_tokens;
+  return token;
+}
+
+static int _lglb_add_token(lglb_json_t* json, int type, size_t start)
+{
+  lglb_token_t* token;
+
+  /* grow in powers of two */
+  if ((json->num_tokens & (json->num_tokens - 1)) == 0)
+  {
+    json->tokens = (lglb_token_t*)realloc(json->tokens, (json->num_tokens ? json->num_tokens * 2 : 1) * sizeof(lglb_token_t));
+  }
+  token = &json->tokens[json->num_tokens];
+  token->type = type;
+  token->start = start;
+  token->end = start;
+  token->size = 0;
+  token->next = json->num_tokens + 1;
+  return json->num_tokens++;
+}
+
+static void _lglb_skip_spaces(lglb_json_t* json)
+{
+  while (json->pos < json->length && _lglb_is_space(json->text[json->pos])) ++json->pos;
+}
+
+static int _lglb_is_space(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static int _lglb_find(const lglb_json_t* json, int object, const char* key)
+{
+  int token;
+  int i;
+
+  if (object < 0 || json->tokens[object].type != LGLB_JSON_OBJECT) return -1;
+  token = object + 1;
+  for (i = 0; i < json->tokens[object].size; ++i)
+  {
+    if (_lglb_equals(json, token, key)) return token + 1;
+    token = json->tokens[token + 1].next;
+  }
+  return -1;
+}
+
+static int _lglb_element(const lglb_json_t* json, int array, int index)
+{
+  int token;
+  int i;
+
+  if (array < 0 || json->tokens[array].type != LGLB_JSON_ARRAY || index >= json->tokens[array].size) return -1;
+  token = array + 1;
+  for (i = 0; i < index; ++i) token = json->tokens[token].next;
+  return token;
+}
+
+static int _lglb_size(const lglb_json_t* json, int token, int type)
+{
+  return (token >= 0 && json->tokens[token].type == type) ? json->tokens[token].size : 0;
+}
+
+static int _lglb_equals(const lglb_json_t* json, int token, const char* str)
+{
+  size_t length;
+
+  if (token < 0 || json->tokens[token].type != LGLB_JSON_STRING) return 0;
+  length = json->tokens[token].end - json->tokens[token].start;
+  return strlen(str) == length && strncmp(json->text + json->tokens[token].start, str, length) == 0;
+}
+
+static int _lglb_int(const lglb_json_t* json, int token, int def)
+{
+  double value;
+
+  /* parsed as double, since offsets and sizes above 2^24 do not fit exactly in a float */
+  value = _lglb_double(json, token, def);
+  return (value >= -2147483647.0 && value <= 2147483647.0) ? (int)value : def;
+}
+
+static float _lglb_float(const lglb_json_t* json, int token, float def)
+{
+  return (float)_lglb_double(json, token, def);
+}
+
+static double _lglb_double(const lglb_json_t* json, int token, double def)
+{
+  char buffer[64];
+  size_t length;
+
+  if (token < 0 || json->tokens[token].type != LGLB_JSON_PRIMITIVE) return def;
+  length = json->tokens[token].end - json->tokens[token].start;
+  if (length >= sizeof(buffer)) return def;
+  memcpy(buffer, json->text + json->tokens[token].start, length);
+  buffer[length] = 0;
+  if (strcmp(buffer, "true") == 0) return 1;
+  if (strcmp(buffer, "false") == 0) return 0;
+  return strtod(buffer, NULL);
+}
+
+static void _lglb_string(const lglb_json_t* json, int token, char* out, int len)
+{
+  size_t i;
+  int o;
+
+  o = 0;
+  if (token >= 0 && json->tokens[token].type == LGLB_JSON_STRING)
+  {
+    for (i = json->tokens[token].start; i < json->tokens[token].end && o < len - 1; ++i)
+    {
+      /* only simple escapes are needed for uris */
+      if (json->text[i] == '\\' && i + 1 < json->tokens[token].end) ++i;
+      out[o++] = json->text[i];
+    }
+  }
+  out[o] = 0;
+}
+
+static void _lglb_floats(const lglb_json_t* json, int token, float* out, int count)
+{
+  int i;
+
+  for (i = 0; i < count && i < _lglb_size(json, token, LGLB_JSON_ARRAY); ++i)
+  {
+    out[i] = _lglb_float(json, _lglb_element(json, token, i), out[i]);
+  }
+}
+
+static int _lglb_load_json(lglb_scene_t* scene, const lglb_json_t* json)
+{
+  int views, accessors, meshes, materials, textures, images;
+  int token;
+  int i, j;
+
+  views = _lglb_find(json, 0, "bufferViews");
+  accessors = _lglb_find(json, 0, "accessors");
+  meshes = _lglb_find(json, 0, "meshes");
+  materials = _lglb_find(json, 0, "materials");
+  textures = _lglb_find(json, 0, "textures");
+  images = _lglb_find(json, 0, "images");
+
+  scene->num_buffer_views = _lglb_size(json, views, LGLB_JSON_ARRAY);
+  scene->num_accessors = _lglb_size(json, accessors, LGLB_JSON_ARRAY);
+  scene->num_meshes = _lglb_size(json, meshes, LGLB_JSON_ARRAY);
+  scene->num_materials = _lglb_size(json, materials, LGLB_JSON_ARRAY);
+  scene->num_textures = _lglb_size(json, textures, LGLB_JSON_ARRAY);
+  scene->num_images = _lglb_size(json, images, LGLB_JSON_ARRAY);
+  scene->buffer_views = (lglb_bufferview_t*)calloc(scene->num_buffer_views + 1, sizeof(lglb_bufferview_t));
+  scene->accessors = (lglb_accessor_t*)calloc(scene->num_accessors + 1, sizeof(lglb_accessor_t));
+  scene->meshes = (lglb_mesh_t*)calloc(scene->num_meshes + 1, sizeof(lglb_mesh_t));
+  scene->materials = (lglb_material_t*)calloc(scene->num_materials + 1, sizeof(lglb_material_t));
+  scene->textures = (int*)calloc(scene->num_textures + 1, sizeof(int));
+  scene->images = (lglb_image_t*)calloc(scene->num_images + 1, sizeof(lglb_image_t));
+
+  /* read buffer views, which must be inside the binary chunk */
+  for (i = 0, token = (views >= 0) ? views + 1 : -1; i < scene->num_buffer_views; ++i, token = json->tokens[token].next)
+  {
+    lglb_bufferview_t* view = &scene->buffer_views[i];
+    int offset = _lglb_int(json, _lglb_find(json, token, "byteOffset"), 0);
+    int length = _lglb_int(json, _lglb_find(json, token, "byteLength"), -1);
+    view->byte_stride = _lglb_int(json, _lglb_find(json, token, "byteStride"), 0);
+    if (_lglb_int(json, _lglb_find(json, token, "buffer"), 0) != 0 || offset < 0 || length < 0 || view->byte_stride < 0 || view->byte_stride > 252) return 0;
+    if ((size_t)offset > scene->bin_size || (size_t)length > scene->bin_size - offset) return 0;
+    view->byte_offset = offset;
+    view->byte_length = length;
+  }
+
+  /* read accessors */
+  for (i = 0, token = (accessors >= 0) ? accessors + 1 : -1; i < scene->num_accessors; ++i, token = json->tokens[token].next)
+  {
+    if (!_lglb_load_accessor(scene, json, token, &scene->accessors[i])) return 0;
+  }
+
+  /* read meshes */
+  for (i = 0, token = (meshes >= 0) ? meshes + 1 : -1; i < scene->num_meshes; ++i, token = json->tokens[token].next)
+  {
+    int primitives = _lglb_find(json, token, "primitives");
+    int primitive;
+    scene->meshes[i].num_primitives = _lglb_size(json, primitives, LGLB_JSON_ARRAY);
+    scene->meshes[i].primitives = (lglb_primitive_t*)calloc(scene->meshes[i].num_primitives + 1, sizeof(lglb_primitive_t));
+    for (j = 0, primitive = primitives + 1; j < scene->meshes[i].num_primitives; ++j, primitive = json->tokens[primitive].next)
+    {
+      if (!_lglb_load_primitive(scene, json, primitive, &scene->meshes[i].primitives[j])) return 0;
+    }
+  }
+
+  /* read materials */
+  for (i = 0, token = (materials >= 0) ? materials + 1 : -1; i < scene->num_materials; ++i, token = json->tokens[token].next)
+  {
+    _lglb_load_material(json, token, &scene->materials[i]);
+    if (scene->materials[i].base_color_texture >= scene->num_textures) scene->materials[i].base_color_texture = -1;
+  }
+
+  /* read textures */
+  for (i = 0, token = (textures >= 0) ? textures + 1 : -1; i < scene->num_textures; ++i, token = json->tokens[token].next)
+  {
+    scene->textures[i] = _lglb_int(json, _lglb_find(json, token, "source"), -1);
+    if (scene->textures[i] < -1 || scene->textures[i] >= scene->num_images) scene->textures[i] = -1;
+  }
+
+  /* read images */
+  for (i = 0, token = (images >= 0) ? images + 1 : -1; i < scene->num_images; ++i, token = json->tokens[token].next)
+  {
+    scene->images[i].buffer_view = _lglb_int(json, _lglb_find(json, token, "bufferView"), -1);
+    if (scene->images[i].buffer_view < -1 || scene->images[i].buffer_view >= scene->num_buffer_views) return 0;
+    _lglb_string(json, _lglb_find(json, token, "uri"), scene->images[i].uri, sizeof(scene->images[i].uri));
+  }
+
+  return 1;
+}
+
+static int _lglb_load_accessor(lglb_scene_t* scene, const lglb_json_t* json, int token, lglb_accessor_t* accessor)
+{
+  int type;
+  int offset;
+  size_t elem_size;
+  size_t stride;
+  const lglb_bufferview_t* view;
+
+  accessor->buffer_view = _lglb_int(json, _lglb_find(json, token, "bufferView"), -1);
+  offset = _lglb_int(json, _lglb_find(json, token, "byteOffset"), 0);
+  accessor->component_type = _lglb_int(json, _lglb_find(json, token, "componentType"), 0);
+  accessor->normalized = _lglb_int(json, _lglb_find(json, token, "normalized"), 0);
+  accessor->count = _lglb_int(json, _lglb_find(json, token, "count"), -1);
+
+  /* get number of components */
+  type = _lglb_find(json, token, "type");
+  if (_lglb_equals(json, type, "SCALAR")) accessor->num_components = 1;
+  else if (_lglb_equals(json, type, "VEC2")) accessor->num_components = 2;
+  else if (_lglb_equals(json, type, "VEC3")) accessor->num_components = 3;
+  else if (_lglb_equals(json, type, "VEC4")) accessor->num_components = 4;
+  else if (_lglb_equals(json, type, "MAT2")) accessor->num_components = 4;
+  else if (_lglb_equals(json, type, "MAT3")) accessor->num_components = 9;
+  else if (_lglb_equals(json, type, "MAT4")) accessor->num_components = 16;
+  else return 0;
+
+  /* check that all elements are inside the buffer view */
+  if (_lglb_component_size(accessor->component_type) == 0 || accessor->count < 0 || offset < 0) return 0;
+  if (accessor->buffer_view < -1 || accessor->buffer_view >= scene->num_buffer_views) return 0;
+  accessor->byte_offset = offset;
+  if (accessor->buffer_view == -1 || accessor->count == 0) return 1;
+  view = &scene->buffer_views[accessor->buffer_view];
+  elem_size = _lglb_component_size(accessor->component_type) * accessor->num_components;
+  stride = view->byte_stride ? (size_t)view->byte_stride : elem_size;
+  if (accessor->byte_offset > view->byte_length || elem_size > view->byte_length - accessor->byte_offset) return 0;
+  return (size_t)(accessor->count - 1) <= (view->byte_length - accessor->byte_offset - elem_size) / stride;
+}
+
+static int _lglb_load_primitive(lglb_scene_t* scene, const lglb_json_t* json, int token, lglb_primitive_t* primitive)
+{
+  int attributes;
+  int* fields[6];
+  int count;
+  int i;
+
+  attributes = _lglb_find(json, token, "attributes");
+  primitive->position = _lglb_int(json, _lglb_find(json, attributes, "POSITION"), -1);
+  primitive->normal = _lglb_int(json, _lglb_find(json, attributes, "NORMAL"), -1);
+  primitive->texcoords[0] = _lglb_int(json, _lglb_find(json, attributes, "TEXCOORD_0"), -1);
+  primitive->texcoords[1] = _lglb_int(json, _lglb_find(json, attributes, "TEXCOORD_1"), -1);
+  primitive->color = _lglb_int(json, _lglb_find(json, attributes, "COLOR_0"), -1);
+  primitive->indices = _lglb_int(json, _lglb_find(json, token, "indices"), -1);
+  primitive->material = _lglb_int(json, _lglb_find(json, token, "material"), -1);
+  primitive->mode = _lglb_int(json, _lglb_find(json, token, "mode"), LGLB_MODE_TRIANGLES);
+  if (primitive->material < -1 || primitive->material >= scene->num_materials) return 0;
+
+  /* check accessor indices, and that every attribute has one element per vertex */
+  fields[0] = &primitive->position;
+  fields[1] = &primitive->normal;
+  fields[2] = &primitive->texcoords[0];
+  fields[3] = &primitive->texcoords[1];
+  fields[4] = &primitive->color;
+  fields[5] = &primitive->indices;
+  count = (primitive->position >= 0 && primitive->position < scene->num_accessors) ? scene->accessors[primitive->position].count : 0;
+  for (i = 0; i < 6; ++i)
+  {
+    if (*fields[i] < -1 || *fields[i] >= scene->num_accessors) return 0;
+    if (i < 5 && *fields[i] >= 0 && scene->accessors[*fields[i]].count != count) return 0;
+  }
+
+  return 1;
+}
+
+static void _lglb_load_material(const lglb_json_t* json, int token, lglb_material_t* material)
+{
+  int pbr;
+  int texture;
+  int alpha_mode;
+
+  material->base_color[0] = material->base_color[1] = material->base_color[2] = material->base_color[3] = 1;
+  material->emissive[0] = material->emissive[1] = material->emissive[2] = 0;
+
+  /* read base color */
+  pbr = _lglb_find(json, token, "pbrMetallicRoughness");
+  texture = _lglb_find(json, pbr, "baseColorTexture");
+  _lglb_floats(json, _lglb_find(json, pbr, "baseColorFactor"), material->base_color, 4);
+  material->base_color_texture = _lglb_int(json, _lglb_find(json, texture, "index"), -1);
+  material->base_color_texcoord = _lglb_int(json, _lglb_find(json, texture, "texCoord"), 0);
+  if (material->base_color_texture < -1) material->base_color_texture = -1;
+
+  /* read emissive, alpha mode and culling */
+  _lglb_floats(json, _lglb_find(json, token, "emissiveFactor"), material->emissive, 3);
+  alpha_mode = _lglb_find(json, token, "alphaMode");
+  if (_lglb_equals(json, alpha_mode, "BLEND")) material->alpha_mode = LGLB_ALPHA_BLEND;
+  else if (_lglb_equals(json, alpha_mode, "MASK")) material->alpha_mode = LGLB_ALPHA_MASK;
+  else material->alpha_mode = LGLB_ALPHA_OPAQUE;
+  material->alpha_cutoff = _lglb_float(json, _lglb_find(json, token, "alphaCutoff"), 0.5f);
+  material->double_sided = _lglb_int(json, _lglb_find(json, token, "doubleSided"), 0);
+}
+
+static int _lglb_component_size(int component_type)
+{
+  switch (component_type)
+  {
+    case 5120: case 5121: return 1;
+    case 5122: case 5123: return 2;
+    case 5125: case 5126: return 4;
+    default: return 0;
+  }
+}
+
+static float _lglb_component(const unsigned char* data, int component_type, int normalized)
+{
+  signed char b;
+  short s;
+  unsigned short us;
+  unsigned int ui;
+  float f;
+
+  switch (component_type)
+  {
+    case 5120:
+      b = (signed char)data[0];
+      return normalized ? ((b > -127) ? b / 127.0f : -1.0f) : b;
+    case 5121:
+      return normalized ? data[0] / 255.0f : data[0];
+    case 5122:
+      memcpy(&s, data, sizeof(s));
+      return normalized ? ((s > -32767) ? s / 32767.0f : -1.0f) : s;
+    case 5123:
+      memcpy(&us, data, sizeof(us));
+      return normalized ? us / 65535.0f : us;
+    case 5125:
+      memcpy(&ui, data, sizeof(ui));
+      return (float)ui;
+    default:
+      memcpy(&f, data, sizeof(f));
+      return f;
+  }
+}
+
+static unsigned int _lglb_index(const unsigned char* data, int component_type)
+{
+  unsigned short us;
+  unsigned int ui;
+
+  switch (component_type)
+  {
+    case 5121:
+      return data[0];
+    case 5123:
+      memcpy(&us, data, sizeof(us));
+      return us;
+    case 5125:
+      memcpy(&ui, data, sizeof(ui));
+      return ui;
+    default:
+      return 0xffffffff;
+  }
+}
+
+static const unsigned char* _lglb_accessor_data(const lglb_scene_t* scene, const lglb_accessor_t* accessor, size_t* out_stride)
+{
+  const lglb_bufferview_t* view;
+
+  if (accessor->buffer_view < 0) return 0;
+  view = &scene->buffer_views[accessor->buffer_view];
+  *out_stride = view->byte_stride ? view->byte_stride : _lglb_component_size(accessor->component_type) * accessor->num_components;
+  return (const unsigned char*)scene->bin + view->byte_offset + accessor->byte_offset;
+}
+
+static unsigned int _lglb_read_uint(const char* mem)
+{
+  const unsigned char* bytes = (const unsigned char*)mem;
+  return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
+}
+
+#ifdef LITE_GLB_USE_GFX
+
+void lglb_getvertices(const lglb_scene_t* scene, const lglb_primitive_t* primitive, lvert_t* out_vertices)
+{
+  const int* attribs[5];
+  const size_t offsets[5] = {offsetof(lvert_t, pos), offsetof(lvert_t, nor), offsetof(lvert_t, tex), offsetof(lvert_t, tex2), offsetof(lvert_t, col)};
+  const int sizes[5] = {3, 3, 2, 2, 4};
+  const unsigned char* base;
+  size_t stride;
+  int num_vertices;
+  int interleaved;
+  int v, i;
+
+  num_vertices = lglb_numvertices(scene, primitive);
+  if (num_vertices == 0) return;
+  attribs[0] = &primitive->position;
+  attribs[1] = &primitive->normal;
+  attribs[2] = &primitive->texcoords[0];
+  attribs[3] = &primitive->texcoords[1];
+  attribs[4] = &primitive->color;
+
+  /* if the attributes are float and interleaved exactly like lvert_t, copy them as a single block */
+  base = _lglb_accessor_data(scene, &scene->accessors[primitive->position], &stride);
+  interleaved = base && stride == sizeof(lvert_t);
+  for (i = 0; i < 5 && interleaved; ++i)
+  {
+    const lglb_accessor_t* accessor = (*attribs[i] >= 0) ? &scene->accessors[*attribs[i]] : 0;
+    interleaved = accessor
+      && accessor->buffer_view == scene->accessors[primitive->position].buffer_view
+      && accessor->component_type == 5126
+      && accessor->num_components == sizes[i]
+      && accessor->byte_offset == scene->accessors[primitive->position].byte_offset + offsets[i];
+  }
+  if (interleaved)
+  {
+    memcpy(out_vertices, base, num_vertices * sizeof(lvert_t));
+    return;
+  }
+
+  /* otherwise, read each attribute with a strided copy, setting defaults for the missing ones */
+  for (v = 0; v < num_vertices; ++v)
+  {
+    out_vertices[v] = lvert(0, 0, 0, 0, 0, -1, 0, 0, 1, 1, 1, 1);
+  }
+  for (i = 0; i < 5; ++i)
+  {
+    if (*attribs[i] >= 0) lglb_readfloats(scene, *attribs[i], sizes[i], (float*)((char*)out_vertices + offsets[i]), sizeof(lvert_t));
+  }
+}
+
+#endif /* LITE_GLB_USE_GFX */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LITE_GLB_IMPLEMENTATION */
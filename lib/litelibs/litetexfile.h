@@ -0,0 +1,417 @@
+/*
+LiteTexFile
+Public domain DDS and KTX texture container loader
+It supports 2D textures in RGBA8, BGRA8 and S3TC (BC1 to BC3) formats with their stored mipmaps
+Created by Javier San Juan Cervera
+No warranty implied. Use as you wish and at your own risk
+*/
+
+#ifndef LITE_TEXFILE_H
+#define LITE_TEXFILE_H
+
+#include <stddef.h>
+
+#define LTEXFILE_MAX_LEVELS 16
+
+#define LTEXFILE_RGBA8 0
+#define LTEXFILE_BGRA8 1
+#define LTEXFILE_BC1   2
+#define LTEXFILE_BC2   3
+#define LTEXFILE_BC3   4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* mipmap level */
+typedef struct
+{
+  int                  width;
+  int                  height;
+  const unsigned char* data; /* points into the source buffer */
+  size_t               size;
+} ltexfile_level_t;
+
+/* texture file */
+typedef struct
+{
+  int              format; /* one of LTEXFILE_* macros */
+  int              num_levels;
+  ltexfile_level_t levels[LTEXFILE_MAX_LEVELS];
+} ltexfile_t;
+
+/* the levels reference the data in mem, so it must be kept alive while they are used */
+int ltexfile_loadmem(const unsigned char* mem, size_t size, ltexfile_t* out_file);
+int ltexfile_iscompressed(const ltexfile_t* file);
+void ltexfile_decompress(const ltexfile_t* file, int level, unsigned char* out_rgba); /* out_rgba must hold width*height*4 bytes */
+size_t ltexfile_levelsize(int format, int width, int height);
+void ltexfile_ddsheader(int format, int width, int height, int num_levels, unsigned char out_header[128]); /* levels must follow the header */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LITE_TEXFILE_H */
+
+
+
+/* IMPLEMENTATION */
+
+
+
+#ifdef LITE_TEXFILE_IMPLEMENTATION
+
+#include <string.h>
+
+#define LTEXFILE_DDS_MAGIC       0x20534444 /* "DDS " */
+#define LTEXFILE_DDS_HEADER_SIZE 128
+#define LTEXFILE_DX10_HEADER_SIZE 20
+#define LTEXFILE_DDS_RGB         0x40
+#define LTEXFILE_DDS_FOURCC      0x4
+#define LTEXFILE_DDS_CUBEMAP     0x200
+#define LTEXFILE_DDS_VOLUME      0x200000
+
+#define LTEXFILE_KTX_HEADER_SIZE 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static int _ltexfile_load_dds(const unsigned char* mem, size_t size, ltexfile_t* out_file);
+static int _ltexfile_load_ktx(const unsigned char* mem, size_t size, ltexfile_t* out_file);
+static void _ltexfile_decode_block(const unsigned char* block, int format, unsigned char* out_texels);
+static void _ltexfile_decode_color(const unsigned char* block, int allow_alpha, unsigned char colors[4][4]);
+static unsigned int _ltexfile_read_uint(const unsigned char* mem);
+
+
+int ltexfile_loadmem(const unsigned char* mem, size_t size, ltexfile_t* out_file)
+{
+  static const unsigned char ktx_id[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+  memset(out_file, 0, sizeof(ltexfile_t));
+  if (size >= LTEXFILE_DDS_HEADER_SIZE && _ltexfile_read_uint(mem) == LTEXFILE_DDS_MAGIC)
+  {
+    return _ltexfile_load_dds(mem, size, out_file);
+  }
+  else if (size >= LTEXFILE_KTX_HEADER_SIZE && memcmp(mem, ktx_id, sizeof(ktx_id)) == 0)
+  {
+    return _ltexfile_load_ktx(mem, size, out_file);
+  }
+  return 0;
+}
+
+int ltexfile_iscompressed(const ltexfile_t* file)
+{
+  return file->format >= LTEXFILE_BC1;
+}
+
+void ltexfile_decompress(const ltexfile_t* file, int level, unsigned char* out_rgba)
+{
+  const ltexfile_level_t* lvl;
+  unsigned char texels[16*4];
+  const unsigned char* block;
+  int bx, by, x, y;
+  size_t i;
+
+  lvl = &file->levels[level];
+  if (!ltexfile_iscompressed(file))
+  {
+    /* copy pixels, swapping red and blue if needed */
+    memcpy(out_rgba, lvl->data, lvl->width * lvl->height * 4);
+    if (file->format == LTEXFILE_BGRA8)
+    {
+      for (i = 0; i < (size_t)lvl->width * lvl->height * 4; i += 4)
+      {
+        unsigned char tmp = out_rgba[i];
+        out_rgba[i] = out_rgba[i+2];
+        out_rgba[i+2] = tmp;
+      }
+    }
+    return;
+  }
+
+  /* decode each 4x4 block, clipping it to the level size */
+  block = lvl->data;
+  for (by = 0; by < lvl->height; by += 4)
+  {
+    for (bx = 0; bx < lvl->width; bx += 4)
+    {
+      _ltexfile_decode_block(block, file->format, texels);
+      block += (file->format == LTEXFILE_BC1) ? 8 : 16;
+      for (y = 0; y < 4 && by + y < lvl->height; ++y)
+      {
+        for (x = 0; x < 4 && bx + x < lvl->width; ++x)
+        {
+          memcpy(&out_rgba[((by + y) * lvl->width + bx + x) * 4], &texels[(y*4 + x) * 4], 4);
+        }
+      }
+    }
+  }
+}
+
+void ltexfile_ddsheader(int format, int width, int height, int num_levels, unsigned char out_header[128])
+{
+  static const unsigned int fourccs[] = {0x31545844, 0x33545844, 0x35545844}; /* "DXT1", "DXT3", "DXT5" */
+  unsigned int fields[32];
+  int i;
+
+  memset(fields, 0, sizeof(fields));
+  fields[0] = LTEXFILE_DDS_MAGIC;
+  fields[1] = 124;
+  fields[2] = 0x1 | 0x2 | 0x4 | 0x1000 | ((num_levels > 1) ? 0x20000 : 0); /* caps, height, width, pixel format, mipmap count */
+  fields[3] = (unsigned int)height;
+  fields[4] = (unsigned int)width;
+  fields[5] = (unsigned int)ltexfile_levelsize(format, width, height);
+  fields[7] = (unsigned int)num_levels;
+  fields[19] = 32;
+  if (format >= LTEXFILE_BC1)
+  {
+    fields[20] = LTEXFILE_DDS_FOURCC;
+    fields[21] = fourccs[format - LTEXFILE_BC1];
+  }
+  else
+  {
+    fields[20] = LTEXFILE_DDS_RGB | 0x1; /* alpha pixels */
+    fields[22] = 32;
+    fields[23] = (format == LTEXFILE_RGBA8) ? 0x000000ff : 0x00ff0000;
+    fields[24] = 0x0000ff00;
+    fields[25] = (format == LTEXFILE_RGBA8) ? 0x00ff0000 : 0x000000ff;
+    fields[26] = 0xff000000;
+  }
+  fields[27] = 0x1000 | ((num_levels > 1) ? 0x400008 : 0); /* texture, mipmap and complex */
+
+  /* store in little endian */
+  for (i = 0; i < 32; ++i)
+  {
+    out_header[i*4] = (unsigned char)(fields[i] & 0xff);
+    out_header[i*4 + 1] = (unsigned char)((fields[i] >> 8) & 0xff);
+    out_header[i*4 + 2] = (unsigned char)((fields[i] >> 16) & 0xff);
+    out_header[i*4 + 3] = (unsigned char)((fields[i] >> 24) & 0xff);
+  }
+}
+
+static int _ltexfile_load_dds(const unsigned char* mem, size_t size, ltexfile_t* out_file)
+{
+  unsigned int fourcc, pf_flags, bitcount, rmask, amask;
+  int width, height, num_levels;
+  size_t offset;
+  int i;
+
+  /* cubemaps and volume textures are not supported */
+  if (_ltexfile_read_uint(mem + 4) != 124 || (_ltexfile_read_uint(mem + 112) & (LTEXFILE_DDS_CUBEMAP | LTEXFILE_DDS_VOLUME))) return 0;
+  height = (int)_ltexfile_read_uint(mem + 12);
+  width = (int)_ltexfile_read_uint(mem + 16);
+  num_levels = (int)_ltexfile_read_uint(mem + 28);
+  pf_flags = _ltexfile_read_uint(mem + 80);
+  fourcc = _ltexfile_read_uint(mem + 84);
+  bitcount = _ltexfile_read_uint(mem + 88);
+  rmask = _ltexfile_read_uint(mem + 92);
+  amask = _ltexfile_read_uint(mem + 104);
+  offset = LTEXFILE_DDS_HEADER_SIZE;
+
+  /* get format */
+  if ((pf_flags & LTEXFILE_DDS_FOURCC) && fourcc == 0x31545844) out_file->format = LTEXFILE_BC1; /* "DXT1" */
+  else if ((pf_flags & LTEXFILE_DDS_FOURCC) && fourcc == 0x33545844) out_file->format = LTEXFILE_BC2; /* "DXT3" */
+  else if ((pf_flags & LTEXFILE_DDS_FOURCC) && fourcc == 0x35545844) out_file->format = LTEXFILE_BC3; /* "DXT5" */
+  else if ((pf_flags & LTEXFILE_DDS_FOURCC) && fourcc == 0x30315844) /* "DX10" */
+  {
+    /* only 2D textures which are not cubemaps or arrays */
+    if (size < LTEXFILE_DDS_HEADER_SIZE + LTEXFILE_DX10_HEADER_SIZE) return 0;
+    if (_ltexfile_read_uint(mem + 132) != 3 || (_ltexfile_read_uint(mem + 136) & 0x4) || _ltexfile_read_uint(mem + 140) > 1) return 0;
+    switch (_ltexfile_read_uint(mem + 128))
+    {
+      case 28: case 29: out_file->format = LTEXFILE_RGBA8; break;
+      case 87: case 91: out_file->format = LTEXFILE_BGRA8; break;
+      case 71: case 72: out_file->format = LTEXFILE_BC1; break;
+      case 74: case 75: out_file->format = LTEXFILE_BC2; break;
+      case 77: case 78: out_file->format = LTEXFILE_BC3; break;
+      default: return 0;
+    }
+    offset += LTEXFILE_DX10_HEADER_SIZE;
+  }
+  else if ((pf_flags & LTEXFILE_DDS_RGB) && bitcount == 32 && amask == 0xff000000 && rmask == 0x000000ff) out_file->format = LTEXFILE_RGBA8;
+  else if ((pf_flags & LTEXFILE_DDS_RGB) && bitcount == 32 && amask == 0xff000000 && rmask == 0x00ff0000) out_file->format = LTEXFILE_BGRA8;
+  else return 0;
+
+  /* levels are stored consecutively from the biggest one */
+  if (width <= 0 || height <= 0 || width > 65536 || height > 65536) return 0;
+  if (num_levels <= 0) num_levels = 1;
+  if (num_levels > LTEXFILE_MAX_LEVELS) num_levels = LTEXFILE_MAX_LEVELS;
+  for (i = 0; i < num_levels; ++i)
+  {
+    ltexfile_level_t* level = &out_file->levels[i];
+    level->width = (width >> i) > 0 ? (width >> i) : 1;
+    level->height = (height >> i) > 0 ? (height >> i) : 1;
+    level->size = ltexfile_levelsize(out_file->format, level->width, level->height);
+    if (level->size > size - offset) break;
+    level->data = mem + offset;
+    offset += level->size;
+    out_file->num_levels = i + 1;
+    if (level->width == 1 && level->height == 1) break;
+  }
+
+  return out_file->num_levels > 0;
+}
+
+static int _ltexfile_load_ktx(const unsigned char* mem, size_t size, ltexfile_t* out_file)
+{
+  unsigned int gl_type, gl_format, gl_internal_format;
+  unsigned int kv_size;
+  int width, height, num_levels;
+  size_t offset;
+  int i;
+
+  /* only little endian 2D textures without arrays or faces are supported */
+  if (_ltexfile_read_uint(mem + 12) != 0x04030201) return 0;
+  gl_type = _ltexfile_read_uint(mem + 16);
+  gl_format = _ltexfile_read_uint(mem + 24);
+  gl_internal_format = _ltexfile_read_uint(mem + 28);
+  width = (int)_ltexfile_read_uint(mem + 36);
+  height = (int)_ltexfile_read_uint(mem + 40);
+  if (_ltexfile_read_uint(mem + 44) > 1 || _ltexfile_read_uint(mem + 48) > 1 || _ltexfile_read_uint(mem + 52) != 1) return 0;
+  num_levels = (int)_ltexfile_read_uint(mem + 56);
+  kv_size = _ltexfile_read_uint(mem + 60);
+
+  /* get format */
+  switch (gl_internal_format)
+  {
+    case 0x83F0: case 0x83F1: out_file->format = LTEXFILE_BC1; break; /* GL_COMPRESSED_RGB(A)_S3TC_DXT1_EXT */
+    case 0x83F2: out_file->format = LTEXFILE_BC2; break; /* GL_COMPRESSED_RGBA_S3TC_DXT3_EXT */
+    case 0x83F3: out_file->format = LTEXFILE_BC3; break; /* GL_COMPRESSED_RGBA_S3TC_DXT5_EXT */
+    case 0x1908: case 0x8058: case 0x80E1: /* GL_RGBA, GL_RGBA8, GL_BGRA */
+      if (gl_type != 0x1401) return 0; /* GL_UNSIGNED_BYTE */
+      if (gl_format == 0x1908) out_file->format = LTEXFILE_RGBA8;
+      else if (gl_format == 0x80E1) out_file->format = LTEXFILE_BGRA8;
+      else return 0;
+      break;
+    default:
+      return 0;
+  }
+
+  /* each level is preceded by its size and padded to 4 bytes */
+  if (width <= 0 || height <= 0 || width > 65536 || height > 65536 || kv_size > size - LTEXFILE_KTX_HEADER_SIZE) return 0;
+  if (num_levels <= 0) num_levels = 1;
+  if (num_levels > LTEXFILE_MAX_LEVELS) num_levels = LTEXFILE_MAX_LEVELS;
+  offset = LTEXFILE_KTX_HEADER_SIZE + kv_size;
+  for (i = 0; i < num_levels; ++i)
+  {
+    ltexfile_level_t* level = &out_file->levels[i];
+    if (size - offset < 4) break;
+    level->width = (width >> i) > 0 ? (width >> i) : 1;
+    level->height = (height >> i) > 0 ? (height >> i) : 1;
+    level->size = ltexfile_levelsize(out_file->format, level->width, level->height);
+    if (_ltexfile_read_uint(mem + offset) != level->size || level->size > size - offset - 4) break;
+    level->data = mem + offset + 4;
+    offset += 4 + ((level->size + 3) & ~(size_t)3);
+    out_file->num_levels = i + 1;
+    if (offset > size) break;
+  }
+
+  return out_file->num_levels > 0;
+}
+
+size_t ltexfile_levelsize(int format, int width, int height)
+{
+  switch (format)
+  {
+    case LTEXFILE_BC1:
+      return (size_t)((width + 3) / 4) * ((height + 3) / 4) * 8;
+    case LTEXFILE_BC2:
+    case LTEXFILE_BC3:
+      return (size_t)((width + 3) / 4) * ((height + 3) / 4) * 16;
+    default:
+      return (size_t)width * height * 4;
+  }
+}
+
+static void _ltexfile_decode_block(const unsigned char* block, int format, unsigned char* out_texels)
+{
+  unsigned char colors[4][4];
+  unsigned char alphas[8];
+  unsigned int color_bits;
+  int i;
+
+  /* color part comes after the alpha part in BC2 and BC3 */
+  _ltexfile_decode_color((format == LTEXFILE_BC1) ? block : block + 8, format == LTEXFILE_BC1, colors);
+  color_bits = _ltexfile_read_uint(((format == LTEXFILE_BC1) ? block : block + 8) + 4);
+  for (i = 0; i < 16; ++i)
+  {
+    memcpy(&out_texels[i*4], colors[(color_bits >> (i*2)) & 3], 4);
+  }
+
+  /* explicit alpha */
+  if (format == LTEXFILE_BC2)
+  {
+    for (i = 0; i < 16; ++i)
+    {
+      int a = (block[i/2] >> ((i & 1) * 4)) & 0xf;
+      out_texels[i*4 + 3] = (unsigned char)(a * 17);
+    }
+  }
+
+  /* interpolated alpha */
+  else if (format == LTEXFILE_BC3)
+  {
+    alphas[0] = block[0];
+    alphas[1] = block[1];
+    for (i = 2; i < 8; ++i)
+    {
+      if (alphas[0] > alphas[1]) alphas[i] = (unsigned char)(((8 - i) * alphas[0] + (i - 1) * alphas[1]) / 7);
+      else if (i < 6) alphas[i] = (unsigned char)(((6 - i) * alphas[0] + (i - 1) * alphas[1]) / 5);
+      else alphas[i] = (i == 6) ? 0 : 255;
+    }
+    for (i = 0; i < 16; ++i)
+    {
+      /* indices are 3 bits each, packed in two groups of 24 bits */
+      const unsigned char* bits = block + 2 + (i / 8) * 3;
+      unsigned int packed = bits[0] | (bits[1] << 8) | (bits[2] << 16);
+      out_texels[i*4 + 3] = alphas[(packed >> ((i % 8) * 3)) & 7];
+    }
+  }
+}
+
+static void _ltexfile_decode_color(const unsigned char* block, int allow_alpha, unsigned char colors[4][4])
+{
+  unsigned int c0, c1;
+  int i;
+
+  /* expand the two 565 endpoints */
+  c0 = block[0] | (block[1] << 8);
+  c1 = block[2] | (block[3] << 8);
+  for (i = 0; i < 2; ++i)
+  {
+    unsigned int c = (i == 0) ? c0 : c1;
+    colors[i][0] = (unsigned char)(((c >> 11) & 31) * 255 / 31);
+    colors[i][1] = (unsigned char)(((c >> 5) & 63) * 255 / 63);
+    colors[i][2] = (unsigned char)((c & 31) * 255 / 31);
+    colors[i][3] = 255;
+  }
+
+  /* interpolate the other two, the last one being transparent in BC1 three color mode */
+  for (i = 0; i < 3; ++i)
+  {
+    if (c0 > c1 || !allow_alpha)
+    {
+      colors[2][i] = (unsigned char)((2 * colors[0][i] + colors[1][i]) / 3);
+      colors[3][i] = (unsigned char)((colors[0][i] + 2 * colors[1][i]) / 3);
+    }
+    else
+    {
+      colors[2][i] = (unsigned char)((colors[0][i] + colors[1][i]) / 2);
+      colors[3][i] = 0;
+    }
+  }
+  colors[2][3] = 255;
+  colors[3][3] = (c0 > c1 || !allow_alpha) ? 255 : 0;
+}
+
+static unsigned int _ltexfile_read_uint(const unsigned char* mem)
+{
+  return mem[0] | (mem[1] << 8) | (mem[2] << 16) | ((unsigned int)mem[3] << 24);
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LITE_TEXFILE_IMPLEMENTATION */
@@ -0,0 +1,331 @@
+#include "../lib/stb/stretchy_buffer.h"
+#include "aabbtree.h"
+#include "bvh.h"
+#include "util.h"
+
+#define AABB_MAX_DEPTH 256 /* the tree is kept balanced, so its height grows with the log of the proxies */
+
+typedef struct {
+    lvec3_t min; /* leaves store the fattened box */
+    lvec3_t max;
+    void* data;
+    int parent; /* next free node if the node is not in use */
+    int child1; /* -1 for leaves */
+    int child2;
+    int height; /* 0 for leaves, -1 for free nodes */
+} AABBNode;
+
+struct SAABBTree {
+    AABBNode* nodes;
+    int root;
+    int free_list;
+};
+
+static int _AllocAABBNode(AABBTree* tree);
+static void _FreeAABBNode(AABBTree* tree, int node);
+static void _InsertAABBLeaf(AABBTree* tree, int leaf);
+static void _RemoveAABBLeaf(AABBTree* tree, int leaf);
+static void _RefitAABBNodes(AABBTree* tree, int node);
+static int _BalanceAABBNode(AABBTree* tree, int node);
+static int _RotateAABBNode(AABBTree* tree, int node, int child, int other);
+static void _CombineAABBNodes(AABBNode* node, const AABBNode* a, const AABBNode* b);
+static float _GetAABBArea(lvec3_t min, lvec3_t max);
+static bool_t _AABBOverlaps(lvec3_t min, lvec3_t max, lvec3_t other_min, lvec3_t other_max);
+
+AABBTree* CreateAABBTree() {
+    AABBTree* tree = _Alloc(AABBTree);
+    tree->nodes = NULL;
+    tree->root = -1;
+    tree->free_list = -1;
+    return tree;
+}
+
+void DeleteAABBTree(AABBTree* tree) {
+    sb_free(tree->nodes);
+    free(tree);
+}
+
+int InsertAABBTreeProxy(AABBTree* tree, lvec3_t min, lvec3_t max, float margin, void* data) {
+    int proxy = _AllocAABBNode(tree);
+    tree->nodes[proxy].min = lvec3_sub(min, lvec3(margin, margin, margin));
+    tree->nodes[proxy].max = lvec3_add(max, lvec3(margin, margin, margin));
+    tree->nodes[proxy].data = data;
+    tree->nodes[proxy].height = 0;
+    _InsertAABBLeaf(tree, proxy);
+    return proxy;
+}
+
+void RemoveAABBTreeProxy(AABBTree* tree, int proxy) {
+    _RemoveAABBLeaf(tree, proxy);
+    _FreeAABBNode(tree, proxy);
+}
+
+bool_t MoveAABBTreeProxy(AABBTree* tree, int proxy, lvec3_t min, lvec3_t max, float margin) {
+    AABBNode* node = &tree->nodes[proxy];
+
+    /* proxies only need to be reinserted when they leave their fattened box */
+    if (min.x >= node->min.x && min.y >= node->min.y && min.z >= node->min.z
+            && max.x <= node->max.x && max.y <= node->max.y && max.z <= node->max.z) {
+        return FALSE;
+    }
+
+    _RemoveAABBLeaf(tree, proxy);
+    node->min = lvec3_sub(min, lvec3(margin, margin, margin));
+    node->max = lvec3_add(max, lvec3(margin, margin, margin));
+    _InsertAABBLeaf(tree, proxy);
+    return TRUE;
+}
+
+int QueryAABBTree(const AABBTree* tree, lvec3_t min, lvec3_t max, void*** results) {
+    int stack[AABB_MAX_DEPTH];
+    int top = 0;
+    int count = 0;
+
+    if (tree->root == -1) return 0;
+    stack[top++] = tree->root;
+    while (top > 0) {
+        const AABBNode* node = &tree->nodes[stack[--top]];
+        if (!_AABBOverlaps(node->min, node->max, min, max)) continue;
+        if (node->height == 0) {
+            sb_push(*results, node->data);
+            ++count;
+        } else {
+            stack[top++] = node->child1;
+            stack[top++] = node->child2;
+        }
+    }
+    return count;
+}
+
+int QueryAABBTreeSegment(const AABBTree* tree, lvec3_t origin, lvec3_t delta, void*** results) {
+    int stack[AABB_MAX_DEPTH];
+    int top = 0;
+    int count = 0;
+
+    if (tree->root == -1) return 0;
+    stack[top++] = tree->root;
+    while (top > 0) {
+        const AABBNode* node = &tree->nodes[stack[--top]];
+        if (GetBoxSegmentTime(node->min, node->max, origin, delta) > 1) continue;
+        if (node->height == 0) {
+            sb_push(*results, node->data);
+            ++count;
+        } else {
+            stack[top++] = node->child1;
+            stack[top++] = node->child2;
+        }
+    }
+    return count;
+}
+
+int QueryAABBTreePairs(const AABBTree* tree, void*** results) {
+    int stack[AABB_MAX_DEPTH];
+    int count = 0;
+    int i;
+
+    /* query each leaf against the tree, keeping only pairs where the other leaf comes later */
+    for (i = 0; i < sb_count(tree->nodes); ++i) {
+        const AABBNode* leaf = &tree->nodes[i];
+        int top = 0;
+
+        if (leaf->height != 0) continue;
+        stack[top++] = tree->root;
+        while (top > 0) {
+            int index = stack[--top];
+            const AABBNode* node = &tree->nodes[index];
+            if (!_AABBOverlaps(node->min, node->max, leaf->min, leaf->max)) continue;
+            if (node->height == 0) {
+                if (index > i) {
+                    sb_push(*results, leaf->data);
+                    sb_push(*results, node->data);
+                    ++count;
+                }
+            } else {
+                stack[top++] = node->child1;
+                stack[top++] = node->child2;
+            }
+        }
+    }
+    return count;
+}
+
+static int _AllocAABBNode(AABBTree* tree) {
+    int node;
+
+    if (tree->free_list != -1) {
+        node = tree->free_list;
+        tree->free_list = tree->nodes[node].parent;
+    } else {
+        node = sb_count(tree->nodes);
+        sb_add(tree->nodes, 1);
+    }
+    tree->nodes[node].data = NULL;
+    tree->nodes[node].parent = -1;
+    tree->nodes[node].child1 = -1;
+    tree->nodes[node].child2 = -1;
+    tree->nodes[node].height = 0;
+    return node;
+}
+
+static void _FreeAABBNode(AABBTree* tree, int node) {
+    tree->nodes[node].parent = tree->free_list;
+    tree->nodes[node].height = -1;
+    tree->free_list = node;
+}
+
+static void _InsertAABBLeaf(AABBTree* tree, int leaf) {
+    int sibling, old_parent, new_parent;
+
+    if (tree->root == -1) {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = -1;
+        return;
+    }
+
+    /* find the sibling that increases the surface area of the tree the least */
+    sibling = tree->root;
+    while (tree->nodes[sibling].height > 0) {
+        const AABBNode* node = &tree->nodes[sibling];
+        AABBNode combined;
+        float area, cost, inherited_cost, cost1, cost2;
+        int c;
+
+        area = _GetAABBArea(node->min, node->max);
+        _CombineAABBNodes(&combined, node, &tree->nodes[leaf]);
+        cost = 2 * _GetAABBArea(combined.min, combined.max);
+        inherited_cost = cost - 2 * area;
+        for (c = 0; c < 2; ++c) {
+            const AABBNode* child = &tree->nodes[(c == 0) ? node->child1 : node->child2];
+            float child_cost;
+            _CombineAABBNodes(&combined, child, &tree->nodes[leaf]);
+            child_cost = _GetAABBArea(combined.min, combined.max) + inherited_cost;
+            if (child->height > 0) child_cost -= _GetAABBArea(child->min, child->max);
+            if (c == 0) cost1 = child_cost;
+            else cost2 = child_cost;
+        }
+        if (cost < cost1 && cost < cost2) break;
+        sibling = (cost1 < cost2) ? node->child1 : node->child2;
+    }
+
+    /* create a parent for the sibling and the leaf */
+    old_parent = tree->nodes[sibling].parent;
+    new_parent = _AllocAABBNode(tree);
+    tree->nodes[new_parent].parent = old_parent;
+    tree->nodes[new_parent].child1 = sibling;
+    tree->nodes[new_parent].child2 = leaf;
+    tree->nodes[new_parent].height = tree->nodes[sibling].height + 1;
+    _CombineAABBNodes(&tree->nodes[new_parent], &tree->nodes[sibling], &tree->nodes[leaf]);
+    tree->nodes[sibling].parent = new_parent;
+    tree->nodes[leaf].parent = new_parent;
+    if (old_parent == -1) {
+        tree->root = new_parent;
+    } else if (tree->nodes[old_parent].child1 == sibling) {
+        tree->nodes[old_parent].child1 = new_parent;
+    } else {
+        tree->nodes[old_parent].child2 = new_parent;
+    }
+
+    _RefitAABBNodes(tree, tree->nodes[leaf].parent);
+}
+
+static void _RemoveAABBLeaf(AABBTree* tree, int leaf) {
+    int parent, grandparent, sibling;
+
+    if (leaf == tree->root) {
+        tree->root = -1;
+        return;
+    }
+
+    /* replace the parent with the sibling */
+    parent = tree->nodes[leaf].parent;
+    grandparent = tree->nodes[parent].parent;
+    sibling = (tree->nodes[parent].child1 == leaf) ? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+    tree->nodes[sibling].parent = grandparent;
+    _FreeAABBNode(tree, parent);
+    if (grandparent == -1) {
+        tree->root = sibling;
+    } else {
+        if (tree->nodes[grandparent].child1 == parent) tree->nodes[grandparent].child1 = sibling;
+        else tree->nodes[grandparent].child2 = sibling;
+        _RefitAABBNodes(tree, grandparent);
+    }
+}
+
+static void _RefitAABBNodes(AABBTree* tree, int node) {
+    /* walk up to the root, balancing and fixing boxes and heights */
+    while (node != -1) {
+        AABBNode* n;
+        node = _BalanceAABBNode(tree, node);
+        n = &tree->nodes[node];
+        n->height = 1 + _Max(tree->nodes[n->child1].height, tree->nodes[n->child2].height);
+        _CombineAABBNodes(n, &tree->nodes[n->child1], &tree->nodes[n->child2]);
+        node = n->parent;
+    }
+}
+
+static int _BalanceAABBNode(AABBTree* tree, int node) {
+    const AABBNode* n = &tree->nodes[node];
+    int balance;
+
+    if (n->height < 2) return node;
+    balance = tree->nodes[n->child2].height - tree->nodes[n->child1].height;
+    if (balance > 1) return _RotateAABBNode(tree, node, n->child2, n->child1);
+    if (balance < -1) return _RotateAABBNode(tree, node, n->child1, n->child2);
+    return node;
+}
+
+/* moves the higher child up to the place of the node, and returns the index of the child */
+static int _RotateAABBNode(AABBTree* tree, int node, int child, int other) {
+    AABBNode* a = &tree->nodes[node];
+    AABBNode* c = &tree->nodes[child];
+    int f = c->child1;
+    int g = c->child2;
+    int keep, give;
+
+    /* the child takes the place of the node */
+    c->child1 = node;
+    c->parent = a->parent;
+    a->parent = child;
+    if (c->parent == -1) {
+        tree->root = child;
+    } else if (tree->nodes[c->parent].child1 == node) {
+        tree->nodes[c->parent].child1 = child;
+    } else {
+        tree->nodes[c->parent].child2 = child;
+    }
+
+    /* the highest grandchild stays with the child, and the other one goes to the node */
+    if (tree->nodes[f].height > tree->nodes[g].height) {
+        keep = f;
+        give = g;
+    } else {
+        keep = g;
+        give = f;
+    }
+    c->child2 = keep;
+    if (a->child1 == child) a->child1 = give;
+    else a->child2 = give;
+    tree->nodes[give].parent = node;
+
+    _CombineAABBNodes(a, &tree->nodes[other], &tree->nodes[give]);
+    a->height = 1 + _Max(tree->nodes[other].height, tree->nodes[give].height);
+    _CombineAABBNodes(c, a, &tree->nodes[keep]);
+    c->height = 1 + _Max(a->height, tree->nodes[keep].height);
+    return child;
+}
+
+static void _CombineAABBNodes(AABBNode* node, const AABBNode* a, const AABBNode* b) {
+    node->min = lvec3(_Min(a->min.x, b->min.x), _Min(a->min.y, b->min.y), _Min(a->min.z, b->min.z));
+    node->max = lvec3(_Max(a->max.x, b->max.x), _Max(a->max.y, b->max.y), _Max(a->max.z, b->max.z));
+}
+
+static float _GetAABBArea(lvec3_t min, lvec3_t max) {
+    float w = max.x - min.x, h = max.y - min.y, d = max.z - min.z;
+    return w*h + h*d + d*w;
+}
+
+static bool_t _AABBOverlaps(lvec3_t min, lvec3_t max, lvec3_t other_min, lvec3_t other_max) {
+    return min.x <= other_max.x && max.x >= other_min.x
+        && min.y <= other_max.y && max.y >= other_min.y
+        && min.z <= other_max.z && max.z >= other_min.z;
+}
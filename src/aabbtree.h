@@ -0,0 +1,30 @@
+#ifndef AABBTREE_H_INCLUDED
+#define AABBTREE_H_INCLUDED
+
+#include "../lib/litelibs/litemath3d.h"
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SWIG
+
+typedef struct SAABBTree AABBTree;
+
+AABBTree* CreateAABBTree();
+void DeleteAABBTree(AABBTree* tree);
+int InsertAABBTreeProxy(AABBTree* tree, lvec3_t min, lvec3_t max, float margin, void* data);
+void RemoveAABBTreeProxy(AABBTree* tree, int proxy);
+bool_t MoveAABBTreeProxy(AABBTree* tree, int proxy, lvec3_t min, lvec3_t max, float margin);
+int QueryAABBTree(const AABBTree* tree, lvec3_t min, lvec3_t max, void*** results);
+int QueryAABBTreeSegment(const AABBTree* tree, lvec3_t origin, lvec3_t delta, void*** results);
+int QueryAABBTreePairs(const AABBTree* tree, void*** results);
+
+#endif /* SWIG */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* AABBTREE_H_INCLUDED */
@@ -0,0 +1,267 @@
+#include "../lib/litelibs/litegfx.h"
+#include "../lib/stb/stb_rect_pack.h"
+#include "../lib/stb/stretchy_buffer.h"
+#include "atlas.h"
+#include "material.h"
+#include "material_internal.h"
+#include "mesh.h"
+#include "object.h"
+#include "texture.h"
+#include "util.h"
+#include <string.h>
+
+typedef struct {
+    Texture* texture;
+    int width;
+    int height;
+    int page; /* -1 if it has not been packed */
+    int x, y; /* position in the page, without padding */
+} AtlasEntry;
+
+typedef struct {
+    Mesh* mesh;
+    Object* object; /* first object found with the mesh, to reach the others that share it */
+    int buffer;
+    Texture* texture; /* texture used on the buffer by all the objects */
+    bool_t shared; /* FALSE if objects use different textures on the buffer */
+    Texture* page; /* page the buffer has been remapped to */
+} AtlasBuffer;
+
+static void _AddAtlasEntry(AtlasEntry** entries, Texture* texture, int page_size, int padding);
+static int _FindAtlasEntry(const AtlasEntry* entries, const Texture* texture);
+static void _AddAtlasBuffer(AtlasBuffer** buffers, Object* object, int buffer, Texture* texture);
+static int _FindAtlasBuffer(const AtlasBuffer* buffers, const Mesh* mesh, int buffer);
+static int _PackAtlasEntries(AtlasEntry* entries, int page_size, int padding);
+static Texture* _CreateAtlasPage(const AtlasEntry* entries, int page, int page_size, int padding);
+
+EXPORT int CALL wzBuildTextureAtlas(Texture** textures, int num_textures, Object** objects, int num_objects, int page_size, int padding) {
+    AtlasEntry* entries = NULL;
+    AtlasBuffer* buffers = NULL;
+    Texture** pages = NULL;
+    Texture** replaced = NULL;
+    int num_pages;
+    int i, b;
+
+    if (page_size <= 0 || padding < 0) return 0;
+
+    /* collect the given textures and the ones used by the objects */
+    for (i = 0; i < num_textures; ++i) {
+        _AddAtlasEntry(&entries, textures[i], page_size, padding);
+    }
+    for (i = 0; i < num_objects; ++i) {
+        Object* shared;
+
+        for (b = 0; b < wzGetNumSurfaces(objects[i]); ++b) {
+            _AddAtlasEntry(&entries, wzGetMaterialTexture(wzGetObjectMaterial(objects[i], b)), page_size, padding);
+        }
+
+        /* uvs are remapped on the mesh, so the textures of the clones that were not given must match too */
+        if (_FindAtlasBuffer(buffers, _GetObjectMesh(objects[i]), 0) != -1) continue;
+        shared = objects[i];
+        do {
+            for (b = 0; b < wzGetNumSurfaces(shared); ++b) {
+                _AddAtlasBuffer(&buffers, shared, b, wzGetMaterialTexture(wzGetObjectMaterial(shared, b)));
+            }
+            shared = _GetNextSharedObject(shared);
+        } while (shared != objects[i]);
+    }
+
+    /* pack textures and create pages */
+    num_pages = _PackAtlasEntries(entries, page_size, padding);
+    for (i = 0; i < num_pages; ++i) {
+        sb_push(pages, _CreateAtlasPage(entries, i, page_size, padding));
+    }
+    for (i = 0; i < sb_count(entries); ++i) {
+        if (entries[i].page != -1) {
+            _SetTextureAtlas(
+                entries[i].texture,
+                pages[entries[i].page],
+                entries[i].x / (float)page_size,
+                entries[i].y / (float)page_size,
+                (entries[i].x + entries[i].width) / (float)page_size,
+                (entries[i].y + entries[i].height) / (float)page_size,
+                padding);
+        }
+    }
+
+    /* remap the buffers that use a packed texture without repeating it */
+    for (i = 0; i < sb_count(buffers); ++i) {
+        Material* material;
+        float u0, v0, u1, v1;
+        int entry;
+
+        entry = _FindAtlasEntry(entries, buffers[i].texture);
+        if (!buffers[i].shared || entry == -1 || entries[entry].page == -1) continue;
+        if (!_IsMeshUVRangeUnit(buffers[i].mesh, buffers[i].buffer)) continue;
+        buffers[i].page = _GetTextureAtlas(buffers[i].texture, &u0, &v0, &u1, &v1);
+        _RemapMeshUVs(buffers[i].mesh, buffers[i].buffer, u0, v0, u1, v1);
+
+        /* the mesh keeps the page alive, since its uvs are only valid with it */
+        material = GetMeshMaterial(buffers[i].mesh, buffers[i].buffer);
+        RetainTexture(buffers[i].page);
+        if (material->texture) sb_push(replaced, material->texture);
+        material->texture = buffers[i].page;
+    }
+    for (i = 0; i < sb_count(buffers); ++i) {
+        Object* shared;
+
+        /* object materials are copies of the mesh ones, so every object that shares the mesh is retargeted */
+        if (!buffers[i].page) continue;
+        shared = buffers[i].object;
+        do {
+            wzGetObjectMaterial(shared, buffers[i].buffer)->texture = buffers[i].page;
+            shared = _GetNextSharedObject(shared);
+        } while (shared != buffers[i].object);
+    }
+
+    /* release textures once nothing else is going to access them */
+    for (i = 0; i < sb_count(replaced); ++i) {
+        ReleaseTexture(replaced[i]);
+    }
+
+    sb_free(replaced);
+    sb_free(pages);
+    sb_free(buffers);
+    sb_free(entries);
+    return num_pages;
+}
+
+static void _AddAtlasEntry(AtlasEntry** entries, Texture* texture, int page_size, int padding) {
+    AtlasEntry entry;
+    float u0, v0, u1, v1;
+
+    /* skip textures which are already in an atlas, do not fit in a page or use a compact format */
+    if (!texture || wzGetTextureWidth(texture) <= 0 || wzGetTextureHeight(texture) <= 0) return;
+    if (wzGetTextureFormat(texture) != FORMAT_RGBA8) return;
+    if (_FindAtlasEntry(*entries, texture) != -1) return;
+    if (_GetTextureAtlas(texture, &u0, &v0, &u1, &v1)) return;
+    if (wzGetTextureWidth(texture) + padding*2 > page_size || wzGetTextureHeight(texture) + padding*2 > page_size) return;
+
+    entry.texture = texture;
+    entry.width = wzGetTextureWidth(texture);
+    entry.height = wzGetTextureHeight(texture);
+    entry.page = -1;
+    entry.x = 0;
+    entry.y = 0;
+    sb_push(*entries, entry);
+}
+
+static int _FindAtlasEntry(const AtlasEntry* entries, const Texture* texture) {
+    int i;
+
+    for (i = 0; i < sb_count(entries); ++i) {
+        if (entries[i].texture == texture) return i;
+    }
+    return -1;
+}
+
+static void _AddAtlasBuffer(AtlasBuffer** buffers, Object* object, int buffer, Texture* texture) {
+    AtlasBuffer atlas_buffer;
+    Mesh* mesh = _GetObjectMesh(object);
+    int index;
+
+    /* objects sharing a mesh must use the same texture on the buffer to remap it */
+    index = _FindAtlasBuffer(*buffers, mesh, buffer);
+    if (index != -1) {
+        if ((*buffers)[index].texture != texture) (*buffers)[index].shared = FALSE;
+        return;
+    }
+
+    atlas_buffer.mesh = mesh;
+    atlas_buffer.object = object;
+    atlas_buffer.buffer = buffer;
+    atlas_buffer.texture = texture;
+    atlas_buffer.shared = TRUE;
+    atlas_buffer.page = NULL;
+    sb_push(*buffers, atlas_buffer);
+}
+
+static int _FindAtlasBuffer(const AtlasBuffer* buffers, const Mesh* mesh, int buffer) {
+    int i;
+
+    for (i = 0; i < sb_count(buffers); ++i) {
+        if (buffers[i].mesh == mesh && buffers[i].buffer == buffer) return i;
+    }
+    return -1;
+}
+
+static int _PackAtlasEntries(AtlasEntry* entries, int page_size, int padding) {
+    stbrp_context context;
+    stbrp_node* nodes;
+    stbrp_rect* rects = NULL;
+    int num_pages = 0;
+    int i;
+
+    nodes = _AllocMany(stbrp_node, page_size);
+
+    /* fill pages until all textures have been packed */
+    for (;;) {
+        int num_packed = 0;
+
+        /* get rects of remaining textures */
+        sb_free(rects);
+        rects = NULL;
+        for (i = 0; i < sb_count(entries); ++i) {
+            if (entries[i].page == -1) {
+                stbrp_rect* rect = sb_add(rects, 1);
+                memset(rect, 0, sizeof(stbrp_rect));
+                rect->id = i;
+                rect->w = entries[i].width + padding*2;
+                rect->h = entries[i].height + padding*2;
+            }
+        }
+        if (sb_count(rects) == 0) break;
+
+        /* pack as many as possible in a new page */
+        stbrp_init_target(&context, page_size, page_size, nodes, page_size);
+        stbrp_pack_rects(&context, rects, sb_count(rects));
+        for (i = 0; i < sb_count(rects); ++i) {
+            if (rects[i].was_packed) {
+                entries[rects[i].id].page = num_pages;
+                entries[rects[i].id].x = rects[i].x + padding;
+                entries[rects[i].id].y = rects[i].y + padding;
+                ++num_packed;
+            }
+        }
+        if (num_packed == 0) break;
+        ++num_pages;
+    }
+
+    sb_free(rects);
+    free(nodes);
+    return num_pages;
+}
+
+static Texture* _CreateAtlasPage(const AtlasEntry* entries, int page, int page_size, int padding) {
+    unsigned char* pixels;
+    unsigned char* tex_pixels;
+    Texture* texture;
+    int i, x, y;
+
+    pixels = _AllocMany(unsigned char, page_size * page_size * 4);
+    memset(pixels, 0, page_size * page_size * 4);
+    for (i = 0; i < sb_count(entries); ++i) {
+        if (entries[i].page != page) continue;
+
+        /* copy texture pixels, extending the edges over the padding so filtering does not bleed */
+        tex_pixels = _AllocMany(unsigned char, entries[i].width * entries[i].height * 4);
+        _GetTexturePixels(entries[i].texture, tex_pixels);
+        for (y = -padding; y < entries[i].height + padding; ++y) {
+            int src_y = _Clamp(y, 0, entries[i].height - 1);
+            for (x = -padding; x < entries[i].width + padding; ++x) {
+                int src_x = _Clamp(x, 0, entries[i].width - 1);
+                memcpy(
+                    &pixels[((entries[i].y + y) * page_size + entries[i].x + x) * 4],
+                    &tex_pixels[(src_y * entries[i].width + src_x) * 4],
+                    4);
+            }
+        }
+        free(tex_pixels);
+    }
+
+    /* mipmaps are generated for the page if the texture filter uses them */
+    texture = _CreateTextureFromPixels(page_size, page_size, FORMAT_RGBA8, pixels);
+    free(pixels);
+
+    return texture;
+}
@@ -0,0 +1,16 @@
+#ifndef ATLAS_H_INCLUDED
+#define ATLAS_H_INCLUDED
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+EXPORT int CALL wzBuildTextureAtlas(Texture** textures, int num_textures, Object** objects, int num_objects, int page_size, int padding);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ATLAS_H_INCLUDED */
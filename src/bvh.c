@@ -0,0 +1,168 @@
+#include "../lib/stb/stretchy_buffer.h"
+#include "bvh.h"
+#include "util.h"
+
+#define BVH_BINS 12
+#define BVH_LEAF_SIZE 4
+
+static int _BuildBVHNode(BVHNode** nodes, BVHItem* items, int first, int count, int depth);
+static bool_t _ClipSegment(float origin, float delta, float min, float max, float* enter, float* exit);
+static float _GetAxis(const lvec3_t* v, int axis);
+static float _GetHalfArea(const lvec3_t* min, const lvec3_t* max);
+static void _GrowBounds(lvec3_t* min, lvec3_t* max, const lvec3_t* other_min, const lvec3_t* other_max);
+
+/* builds the hierarchy with the surface area heuristic, sorting items in the order of the leaves */
+void BuildBVH(BVHNode** nodes, BVHItem* items, int count) {
+    if (*nodes) stb__sbn(*nodes) = 0;
+    if (count > 0) _BuildBVHNode(nodes, items, 0, count, 0);
+}
+
+/* returns the fraction of the segment where it enters the box, 0 if it starts inside, or 2 if it does not reach it */
+float GetBoxSegmentTime(lvec3_t min, lvec3_t max, lvec3_t origin, lvec3_t delta) {
+    float enter = 0, exit = 1;
+    if (_ClipSegment(origin.x, delta.x, min.x, max.x, &enter, &exit)
+            && _ClipSegment(origin.y, delta.y, min.y, max.y, &enter, &exit)
+            && _ClipSegment(origin.z, delta.z, min.z, max.z, &enter, &exit)) {
+        return enter;
+    }
+    return 2;
+}
+
+static int _BuildBVHNode(BVHNode** nodes, BVHItem* items, int first, int count, int depth) {
+    lvec3_t bin_min[BVH_BINS], bin_max[BVH_BINS];
+    int bin_count[BVH_BINS];
+    float right_cost[BVH_BINS];
+    lvec3_t min, max, cmin, cmax;
+    float cost, best_cost, scale;
+    int index, axis, best_bin, mid, i;
+
+    /* get bounds of the items and of their centers */
+    min = items[first].min;
+    max = items[first].max;
+    cmin = cmax = lvec3_mul(lvec3_add(min, max), lvec3(0.5f, 0.5f, 0.5f));
+    for (i = first + 1; i < first + count; ++i) {
+        lvec3_t center = lvec3_mul(lvec3_add(items[i].min, items[i].max), lvec3(0.5f, 0.5f, 0.5f));
+        _GrowBounds(&min, &max, &items[i].min, &items[i].max);
+        _GrowBounds(&cmin, &cmax, &center, &center);
+    }
+
+    index = sb_count((*nodes));
+    sb_add((*nodes), 1);
+    (*nodes)[index].min = min;
+    (*nodes)[index].max = max;
+    (*nodes)[index].first = first;
+    (*nodes)[index].count = count;
+
+    /* split along the axis where centers are most spread */
+    axis = 0;
+    if (cmax.y - cmin.y > _GetAxis(&cmax, axis) - _GetAxis(&cmin, axis)) axis = 1;
+    if (cmax.z - cmin.z > _GetAxis(&cmax, axis) - _GetAxis(&cmin, axis)) axis = 2;
+    if (count <= BVH_LEAF_SIZE || depth >= BVH_MAX_DEPTH - 1 || _GetAxis(&cmax, axis) <= _GetAxis(&cmin, axis)) return index;
+
+    /* distribute items in bins by their center */
+    scale = BVH_BINS / (_GetAxis(&cmax, axis) - _GetAxis(&cmin, axis));
+    for (i = 0; i < BVH_BINS; ++i) bin_count[i] = 0;
+    for (i = first; i < first + count; ++i) {
+        float center = (_GetAxis(&items[i].min, axis) + _GetAxis(&items[i].max, axis)) * 0.5f;
+        int bin = _Min((int)((center - _GetAxis(&cmin, axis)) * scale), BVH_BINS - 1);
+        if (bin_count[bin] == 0) {
+            bin_min[bin] = items[i].min;
+            bin_max[bin] = items[i].max;
+        } else {
+            _GrowBounds(&bin_min[bin], &bin_max[bin], &items[i].min, &items[i].max);
+        }
+        ++bin_count[bin];
+    }
+
+    /* find the split with the lowest surface area heuristic cost, sweeping from the right and then from the left */
+    {
+        lvec3_t smin, smax;
+        int num = 0;
+        for (i = BVH_BINS - 1; i > 0; --i) {
+            if (bin_count[i] > 0) {
+                if (num == 0) { smin = bin_min[i]; smax = bin_max[i]; }
+                else _GrowBounds(&smin, &smax, &bin_min[i], &bin_max[i]);
+                num += bin_count[i];
+            }
+            right_cost[i] = (num > 0) ? _GetHalfArea(&smin, &smax) * num : 0;
+        }
+        best_cost = (float)count * _GetHalfArea(&min, &max);
+        best_bin = -1;
+        num = 0;
+        for (i = 0; i < BVH_BINS - 1; ++i) {
+            if (bin_count[i] > 0) {
+                if (num == 0) { smin = bin_min[i]; smax = bin_max[i]; }
+                else _GrowBounds(&smin, &smax, &bin_min[i], &bin_max[i]);
+                num += bin_count[i];
+            }
+            if (num == 0 || num == count) continue;
+            cost = _GetHalfArea(&smin, &smax) * num + right_cost[i + 1];
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_bin = i;
+            }
+        }
+    }
+
+    /* keep big leaves only when splitting does not pay off */
+    if (best_bin == -1) {
+        if (count <= BVH_LEAF_SIZE * 4) return index;
+        best_bin = BVH_BINS / 2 - 1;
+    }
+
+    /* partition items */
+    mid = first;
+    for (i = first; i < first + count; ++i) {
+        float center = (_GetAxis(&items[i].min, axis) + _GetAxis(&items[i].max, axis)) * 0.5f;
+        int bin = _Min((int)((center - _GetAxis(&cmin, axis)) * scale), BVH_BINS - 1);
+        if (bin <= best_bin) {
+            BVHItem tmp = items[i];
+            items[i] = items[mid];
+            items[mid] = tmp;
+            ++mid;
+        }
+    }
+    if (mid == first || mid == first + count) mid = first + count / 2;
+
+    /* nodes may be reallocated while building the children */
+    _BuildBVHNode(nodes, items, first, mid - first, depth + 1);
+    i = _BuildBVHNode(nodes, items, mid, first + count - mid, depth + 1);
+    (*nodes)[index].first = i;
+    (*nodes)[index].count = 0;
+    return index;
+}
+
+/* narrows the range of the segment to the part between two planes of an axis */
+static bool_t _ClipSegment(float origin, float delta, float min, float max, float* enter, float* exit) {
+    float t0, t1;
+
+    if (delta == 0) return origin >= min && origin <= max;
+    t0 = (min - origin) / delta;
+    t1 = (max - origin) / delta;
+    if (t0 > t1) {
+        float tmp = t0;
+        t0 = t1;
+        t1 = tmp;
+    }
+    *enter = _Max(*enter, t0);
+    *exit = _Min(*exit, t1);
+    return *enter <= *exit;
+}
+
+static float _GetAxis(const lvec3_t* v, int axis) {
+    return (axis == 0) ? v->x : (axis == 1) ? v->y : v->z;
+}
+
+static float _GetHalfArea(const lvec3_t* min, const lvec3_t* max) {
+    float w = max->x - min->x, h = max->y - min->y, d = max->z - min->z;
+    return w*h + h*d + d*w;
+}
+
+static void _GrowBounds(lvec3_t* min, lvec3_t* max, const lvec3_t* other_min, const lvec3_t* other_max) {
+    min->x = _Min(min->x, other_min->x);
+    min->y = _Min(min->y, other_min->y);
+    min->z = _Min(min->z, other_min->z);
+    max->x = _Max(max->x, other_max->x);
+    max->y = _Max(max->y, other_max->y);
+    max->z = _Max(max->z, other_max->z);
+}
@@ -0,0 +1,37 @@
+#ifndef BVH_H_INCLUDED
+#define BVH_H_INCLUDED
+
+#include "../lib/litelibs/litemath3d.h"
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SWIG
+
+#define BVH_MAX_DEPTH 32
+
+typedef struct {
+    lvec3_t min;
+    lvec3_t max;
+    int first; /* first item of a leaf, or second child of an inner node (the first child follows the node) */
+    int count; /* number of items of a leaf, 0 for inner nodes */
+} BVHNode;
+
+typedef struct {
+    lvec3_t min;
+    lvec3_t max;
+    int index; /* position of the item in the array of the caller */
+} BVHItem;
+
+void BuildBVH(BVHNode** nodes, BVHItem* items, int count);
+float GetBoxSegmentTime(lvec3_t min, lvec3_t max, lvec3_t origin, lvec3_t delta);
+
+#endif /* SWIG */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* BVH_H_INCLUDED */
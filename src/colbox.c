@@ -1,49 +1,287 @@
 #include "../lib/litelibs/litecol.h"
 #include "../lib/litelibs/litemath3d.h"
 #include "../lib/stb/stretchy_buffer.h"
+#include "bvh.h"
 #include "colbox.h"
+#include "util.h"
+
+#define BVH_MAX_PENDING 64 /* boxes added after the hierarchy was built that are tested without it */
 
 typedef struct {
     lvec3_t min;
     lvec3_t max;
-} Colbox;
+    lvec3_t center;
+    float sq_radius;
+    bool_t sphere;
+} ColboxQuery;
+
+typedef struct {
+    lvec3_t min; /* box at the start of the movement, or bounds of the sphere */
+    lvec3_t max;
+    lvec3_t center; /* only for spheres */
+    float radius;
+    bool_t sphere;
+    lvec3_t delta;
+    float time; /* fraction of the movement before the first contact */
+    float normal[3]; /* of the contact, zero if none */
+} ColboxSweep;
+
+/* boxes are stored as separate arrays of coordinates so several of them can be tested at once. they are sorted by the hierarchy up to _colbox_numbuilt */
+static float* _colbox_minx = NULL;
+static float* _colbox_miny = NULL;
+static float* _colbox_minz = NULL;
+static float* _colbox_maxx = NULL;
+static float* _colbox_maxy = NULL;
+static float* _colbox_maxz = NULL;
+static BVHNode* _colbox_nodes = NULL; /* flattened hierarchy, in depth first order */
+static int _colbox_numbuilt = 0; /* number of boxes in the hierarchy */
 
-static Colbox* _colboxes = NULL; /* array of boxes */
+static void _BuildColboxTree();
+static bool_t _CheckColboxes(const ColboxQuery* query);
+static bool_t _QueryTouchesBoxes(const ColboxQuery* query, int first, int count);
+static bool_t _QueryTouchesNode(const ColboxQuery* query, const BVHNode* node);
+static float _SweepColboxes(ColboxSweep* sweep, float* normal);
+static void _SweepBoxes(ColboxSweep* sweep, int first, int count);
+static float _GetSweepTime(const ColboxSweep* sweep, const lvec3_t* min, const lvec3_t* max, bool_t inside_hits, int* axis);
+static float _GetAxis(const lvec3_t* v, int axis);
 
 EXPORT void CALL wzAddColbox(float minx, float miny, float minz, float maxx, float maxy, float maxz) {
-    Colbox box;
-    box.min = lvec3(minx, miny, minz);
-    box.max = lvec3(maxx, maxy, maxz);
-    sb_push(_colboxes, box);
+    sb_push(_colbox_minx, minx);
+    sb_push(_colbox_miny, miny);
+    sb_push(_colbox_minz, minz);
+    sb_push(_colbox_maxx, maxx);
+    sb_push(_colbox_maxy, maxy);
+    sb_push(_colbox_maxz, maxz);
 }
 
 EXPORT void CALL wzClearColboxes() {
-    sb_free(_colboxes);
-    _colboxes = NULL;
+    sb_free(_colbox_minx);
+    sb_free(_colbox_miny);
+    sb_free(_colbox_minz);
+    sb_free(_colbox_maxx);
+    sb_free(_colbox_maxy);
+    sb_free(_colbox_maxz);
+    sb_free(_colbox_nodes);
+    _colbox_minx = _colbox_miny = _colbox_minz = NULL;
+    _colbox_maxx = _colbox_maxy = _colbox_maxz = NULL;
+    _colbox_nodes = NULL;
+    _colbox_numbuilt = 0;
 }
 
 bool_t _CheckBoxCol(float minx, float miny, float minz, float maxx, float maxy, float maxz) {
+    ColboxQuery query;
+    query.min = lvec3(minx, miny, minz);
+    query.max = lvec3(maxx, maxy, maxz);
+    query.sphere = FALSE;
+    return _CheckColboxes(&query);
+}
+
+bool_t _CheckSphereCol(float x, float y, float z, float sq_radius) {
+    ColboxQuery query;
+    query.center = lvec3(x, y, z);
+    query.sq_radius = sq_radius;
+    query.sphere = TRUE;
+    return _CheckColboxes(&query);
+}
+
+float _SweepBoxCol(float minx, float miny, float minz, float maxx, float maxy, float maxz, float dx, float dy, float dz, float* normal) {
+    ColboxSweep sweep;
+    sweep.min = lvec3(minx, miny, minz);
+    sweep.max = lvec3(maxx, maxy, maxz);
+    sweep.sphere = FALSE;
+    sweep.delta = lvec3(dx, dy, dz);
+    return _SweepColboxes(&sweep, normal);
+}
+
+float _SweepSphereCol(float x, float y, float z, float radius, float dx, float dy, float dz, float* normal) {
+    ColboxSweep sweep;
+    sweep.center = lvec3(x, y, z);
+    sweep.radius = radius;
+    sweep.min = lvec3_sub(sweep.center, lvec3(radius, radius, radius));
+    sweep.max = lvec3_add(sweep.center, lvec3(radius, radius, radius));
+    sweep.sphere = TRUE;
+    sweep.delta = lvec3(dx, dy, dz);
+    return _SweepColboxes(&sweep, normal);
+}
+
+static void _BuildColboxTree() {
+    BVHItem* items;
+    float* coords;
     int i;
 
-    for (i = 0; i < sb_count(_colboxes); ++i) {
-        if (lcol_boxbox(
-            _colboxes[i].min.x, _colboxes[i].min.y, _colboxes[i].min.z,
-            _colboxes[i].max.x, _colboxes[i].max.y, _colboxes[i].max.z,
-            minx, miny, minz, maxx, maxy, maxz
-        )) return TRUE;
+    _colbox_numbuilt = sb_count(_colbox_minx);
+    items = _AllocMany(BVHItem, _colbox_numbuilt);
+    for (i = 0; i < _colbox_numbuilt; ++i) {
+        items[i].min = lvec3(_colbox_minx[i], _colbox_miny[i], _colbox_minz[i]);
+        items[i].max = lvec3(_colbox_maxx[i], _colbox_maxy[i], _colbox_maxz[i]);
+        items[i].index = i;
+    }
+    BuildBVH(&_colbox_nodes, items, _colbox_numbuilt);
+
+    /* store the boxes back in the order of the leaves */
+    coords = _AllocMany(float, _colbox_numbuilt * 6);
+    for (i = 0; i < _colbox_numbuilt; ++i) {
+        coords[i*6] = _colbox_minx[i];
+        coords[i*6 + 1] = _colbox_miny[i];
+        coords[i*6 + 2] = _colbox_minz[i];
+        coords[i*6 + 3] = _colbox_maxx[i];
+        coords[i*6 + 4] = _colbox_maxy[i];
+        coords[i*6 + 5] = _colbox_maxz[i];
+    }
+    for (i = 0; i < _colbox_numbuilt; ++i) {
+        const float* box = &coords[items[i].index * 6];
+        _colbox_minx[i] = box[0];
+        _colbox_miny[i] = box[1];
+        _colbox_minz[i] = box[2];
+        _colbox_maxx[i] = box[3];
+        _colbox_maxy[i] = box[4];
+        _colbox_maxz[i] = box[5];
+    }
+    free(coords);
+    free(items);
+}
+
+static bool_t _CheckColboxes(const ColboxQuery* query) {
+    int stack[BVH_MAX_DEPTH];
+    int top = 0;
+
+    /* rebuild the hierarchy once enough boxes have been added since the last time */
+    if (sb_count(_colbox_minx) - _colbox_numbuilt > BVH_MAX_PENDING) _BuildColboxTree();
+
+    /* boxes that are not in the hierarchy yet */
+    if (_QueryTouchesBoxes(query, _colbox_numbuilt, sb_count(_colbox_minx) - _colbox_numbuilt)) return TRUE;
+
+    if (_colbox_numbuilt == 0) return FALSE;
+    stack[top++] = 0;
+    while (top > 0) {
+        int index = stack[--top];
+        const BVHNode* node = &_colbox_nodes[index];
+        if (!_QueryTouchesNode(query, node)) continue;
+        if (node->count > 0) {
+            if (_QueryTouchesBoxes(query, node->first, node->count)) return TRUE;
+        } else {
+            stack[top++] = node->first;
+            stack[top++] = index + 1;
+        }
     }
     return FALSE;
 }
 
-bool_t _CheckSphereCol(float x, float y, float z, float sq_radius) {
+static bool_t _QueryTouchesBoxes(const ColboxQuery* query, int first, int count) {
+    if (count <= 0) return FALSE;
+    if (query->sphere) {
+        return lcol_boxsphere_soa(
+            _colbox_minx + first, _colbox_miny + first, _colbox_minz + first,
+            _colbox_maxx + first, _colbox_maxy + first, _colbox_maxz + first, count,
+            query->center.x, query->center.y, query->center.z, query->sq_radius) != -1;
+    } else {
+        return lcol_boxbox_soa(
+            _colbox_minx + first, _colbox_miny + first, _colbox_minz + first,
+            _colbox_maxx + first, _colbox_maxy + first, _colbox_maxz + first, count,
+            query->min.x, query->min.y, query->min.z, query->max.x, query->max.y, query->max.z) != -1;
+    }
+}
+
+static float _SweepColboxes(ColboxSweep* sweep, float* normal) {
+    int stack[BVH_MAX_DEPTH];
+    int top = 0;
+
+    sweep->time = 1;
+    sweep->normal[0] = sweep->normal[1] = sweep->normal[2] = 0;
+    if (sb_count(_colbox_minx) - _colbox_numbuilt > BVH_MAX_PENDING) _BuildColboxTree();
+    _SweepBoxes(sweep, _colbox_numbuilt, sb_count(_colbox_minx) - _colbox_numbuilt);
+
+    /* visit nodes which can be reached before the closest contact found so far */
+    if (_colbox_numbuilt > 0) stack[top++] = 0;
+    while (top > 0) {
+        int index = stack[--top];
+        const BVHNode* node = &_colbox_nodes[index];
+        int axis;
+        if (_GetSweepTime(sweep, &node->min, &node->max, TRUE, &axis) >= sweep->time) continue;
+        if (node->count > 0) {
+            _SweepBoxes(sweep, node->first, node->count);
+        } else {
+            stack[top++] = node->first;
+            stack[top++] = index + 1;
+        }
+    }
+
+    normal[0] = sweep->normal[0];
+    normal[1] = sweep->normal[1];
+    normal[2] = sweep->normal[2];
+    return sweep->time;
+}
+
+static void _SweepBoxes(ColboxSweep* sweep, int first, int count) {
     int i;
 
-    for (i = 0; i < sb_count(_colboxes); ++i) {
-        if (lcol_boxsphere(
-            _colboxes[i].min.x, _colboxes[i].min.y, _colboxes[i].min.z,
-            _colboxes[i].max.x, _colboxes[i].max.y, _colboxes[i].max.z,
-            x, y, z, sq_radius
-        )) return TRUE;
+    for (i = first; i < first + count; ++i) {
+        lvec3_t min = lvec3(_colbox_minx[i], _colbox_miny[i], _colbox_minz[i]);
+        lvec3_t max = lvec3(_colbox_maxx[i], _colbox_maxy[i], _colbox_maxz[i]);
+        float normal[3];
+        int axis;
+        float time;
+
+        /* spheres are tested exactly once their bounds reach the box before the closest contact */
+        if (sweep->sphere) {
+            if (_GetSweepTime(sweep, &min, &max, TRUE, &axis) >= sweep->time) continue;
+            time = lcol_sweepspherebox(
+                sweep->center.x, sweep->center.y, sweep->center.z, sweep->radius, sweep->delta.x, sweep->delta.y, sweep->delta.z,
+                min.x, min.y, min.z, max.x, max.y, max.z, normal);
+        } else {
+            time = _GetSweepTime(sweep, &min, &max, FALSE, &axis);
+            normal[0] = normal[1] = normal[2] = 0;
+            if (axis != -1) normal[axis] = (_GetAxis(&sweep->delta, axis) > 0) ? -1.0f : 1.0f;
+        }
+        if (time < sweep->time) {
+            sweep->time = time;
+            sweep->normal[0] = normal[0];
+            sweep->normal[1] = normal[1];
+            sweep->normal[2] = normal[2];
+        }
     }
-    return FALSE;
+}
+
+/* returns the fraction of the movement before overlapping the box, or 1. if they overlap at the start, returns 0 if inside_hits or else 1, so objects can get out of boxes */
+static float _GetSweepTime(const ColboxSweep* sweep, const lvec3_t* min, const lvec3_t* max, bool_t inside_hits, int* axis) {
+    float enter = -1e30f, exit = 1e30f;
+    int a;
+
+    *axis = -1;
+    for (a = 0; a < 3; ++a) {
+        float d = _GetAxis(&sweep->delta, a);
+        float lo = _GetAxis(&sweep->min, a), hi = _GetAxis(&sweep->max, a);
+        float box_lo = _GetAxis(min, a), box_hi = _GetAxis(max, a);
+        float t0, t1;
+        if (d == 0) {
+            if (hi <= box_lo || lo >= box_hi) return 1;
+            continue;
+        }
+        t0 = ((d > 0) ? box_lo - hi : box_hi - lo) / d;
+        t1 = ((d > 0) ? box_hi - lo : box_lo - hi) / d;
+        if (t0 > enter) {
+            enter = t0;
+            *axis = a;
+        }
+        exit = _Min(exit, t1);
+    }
+    if (enter >= exit || enter >= 1 || exit <= 0) return 1;
+    if (enter < 0) return inside_hits ? 0 : 1;
+    return enter;
+}
+
+static bool_t _QueryTouchesNode(const ColboxQuery* query, const BVHNode* node) {
+    /* lcol_boxbox only checks the corners, so a node can overlap the query without it reporting so */
+    if (query->sphere) {
+        return lcol_boxsphere(
+            node->min.x, node->min.y, node->min.z, node->max.x, node->max.y, node->max.z,
+            query->center.x, query->center.y, query->center.z, query->sq_radius);
+    }
+    return query->min.x <= node->max.x && query->max.x >= node->min.x
+        && query->min.y <= node->max.y && query->max.y >= node->min.y
+        && query->min.z <= node->max.z && query->max.z >= node->min.z;
+}
+
+static float _GetAxis(const lvec3_t* v, int axis) {
+    return (axis == 0) ? v->x : (axis == 1) ? v->y : v->z;
 }
@@ -13,6 +13,8 @@ EXPORT void CALL wzClearColboxes();
 #ifndef SWIG
 bool_t _CheckBoxCol(float minx, float miny, float minz, float maxx, float maxy, float maxz);
 bool_t _CheckSphereCol(float x, float y, float z, float sq_radius);
+float _SweepBoxCol(float minx, float miny, float minz, float maxx, float maxy, float maxz, float dx, float dy, float dz, float* normal);
+float _SweepSphereCol(float x, float y, float z, float radius, float dx, float dy, float dz, float* normal);
 #endif
 
 #ifdef __cplusplus
@@ -1,2 +1,1743 @@
 #define DEFAULT_FONT "AAEAAAAQAQAABAAARkZUTUe1zzAAAaZsAAAAHEdERUYAJwKkAAGmTAAAAB5PUy8y+Sd3OAAAAYgAAABgY21hcECCP1sAAAcsAAAG5mN2dCBM0lmkAAAZiAAAAjhmcGdtc9MjsAAADhQAAAcFZ2FzcAAYAAkAAaY8AAAAEGdseWb68rCKAAAhAAABaHhoZWFk7wIEnAAAAQwAAAA2aGhlYQtZAlkAAAFEAAAAJGhtdHjEJL9sAAAB6AAABURsb2NhXgQElAAAG8AAAAU+bWF4cAaGBOsAAAFoAAAAIG5hbWXVVir2AAGJeAAACHZwb3N0MppXrgABkfAAABRJcHJlcNmY95QAABUcAAAEagABAAAAAQo98q4ibV8PPPUAHwgAAAAAAMWQ2JAAAAAAxZDYkP/O/ZkE3wapAAAACAACAAAAAAAAAAEAAAap/ZkAAATN/87/7gTfAAEAAAAAAAAAAAAAAAAAAAAEAAEAAAKeASIASACAAAUAAgAQAC8AWgAAAy0DFwADAAEAAwTNAZAABQAIBZoFMwAAAR0FmgUzAAADYQBmAhIIBQIHBAkCAgUCBASgAAKvQAB4+wAAAAAAAAAAMUFTQwBAACD7AgTn/n4CJgapAmdgAACf39cAAAQ6BUUAAAAgAAEEzQB/AAAAAATNAAAEzQAAAgMBFQA2AEIAAAArAfYBVgFQAPgAdAEDAU4B8AByAHwAlACQAIAAZwCAAJcAngCFAI0B8AFgAHQAdAB0AF4ALAAAAKIAcQCiAKIAwgBxAKIAygCwAKIA7QCBAKIAZgCiAGYAogBPAEwAjgAKAAAAJAAkAEkBmgBzAQ4Ahf/7AZIAgACzAIIAigCFAIoAjwC5AI8AdQDsAIYAYwCzAIIAswCKAPIApwC+ALkARQAVAF4AQgCTAOMCEwCnAGwCAwCFADgAngA0AhMAnwFPAB8AzgB/AHQAH//7AUcAdAE4ATIBkgCQAH8B8AB3AR0A4gBrABsAEQALAJkAAAAAAAAAAAAAAAAAAQBxAKIAogCiAKIAygDKAMoAygAbAKIAZgBmAGYAZgBmAJ0AOACOAI4AjgCOACQAogCOAIAAgACAAIAAgACAABQAggCFAIUAhQCFAI8AjwCPAI8AfQCzAIIAggCCAIIAggB0AG4AuQC5ALkAuQBCALkAQgAAAIAAAACAAAAAgABxAIIAcQCCAHEAggBxAIIAogAfABsAigCiAIUAogCFAKIAhQCiAIUAogCFAHEAjwBxAI8AcQCPAHEAjwCiALkAAgA1AMoAjwDKAI8AygCPAMoAjwDKAI8AYgDYALAA1QCiAOwA7ADtAIYA7QCGAO0AVQDtAIYANgCGAKIAswCiALMAogCzAAUAswCzAGYAggBmAIIAZgCCABQAHACiAPIAogDLAKIA8gBPAKcATwCnAE8ApwBPAKcATAC+AEwAZQBMAMgAjgC5AI4AuQCOALkAjgC5AI4AuQCOALkAAAAVACQAQgAkAEkAkwBJAJMASQCTAZAA6gAAAIAAAQAUADgAbgBPAKcATAC+ARsBGwFRAS0CAwF0AbkA/wAdAdsBNwAAAfD/zwAAAAH/zwAA/84AlQAAAKIA4AAMAKIASQCiAGYAygCiAAoAgQCiAIcAZgCjAKIAbABMACQACAAkADEAOwDKACQAgQCvALMAlQCjAIEArAA1AHAArwC4ALMAlwCVAOwAcgCcAFwAvwCCABYAnQCwAFwAlQCjADIAOgBYADUAlQCjAIIAowA1AKIAAADgAHEATwDKAMoAsAAAAEcAAACoABQAnAAAAKIAogDgAAUAogAAAEMAogCiAKj//gCBAKIAZgCiAKIAcQBMABQACAAkAIAAXwBZAFYAAABpAKIAVwBWADQAgACMALkBCQAWAIUAAQCKALkAuQDaAAYAZgC1AIIAtQCzAIIAggBCAEYAXgCwAJoAZgBc//8AagDMAHwARgBFAIUANQEJAJEApwCPAI8AdQAZAFwANQDaAEIAtQDiAPQAAAAVAAAAFQAAABUAJABCAU4BTgFOAKr/9v/2//sBjQGPAV0BjgCxALIAsgC2ALYBUAB1AAAB9gEVAVoBbgDt//sAzAFlACIAUAAtAFsAAAEeABYABAA7AF8AAQAJACUAOQAIAXYACAF2AAgBdgF2AGkADABpABsAdQHwAE4AHQA0AJwA6wBsAHQAdABzAHQAigBzAh4Ay//2Ah4CHv/2Ah7/9gIe//b/9v/2//b/9gFqAh4BagFq//b/9v/2Ah4BagFq//b/9v/2Ah4BagFq//b/9v/2//b/9v/2//b/9v/2//b/9v/2AAAAAAAAAAACZgAAAAAAAAB3AAIBaAFoAAgADwA0AA8AAgBzAKMArgAlACUBbgAbABsAGgE8AKQAZgBhAGYAhAEaAHAAVABUAdsBBQHbAdsA1QElAPoA6gDFAQQA/AERAAAAAwAAAAMAAAAcAAEAAAAABNwAAwABAAAAHAAEBMAAAAC8AIAABgA8AH4BfwGSAf8CGwLHAskC3QN+A4oDjAOhA84EDARPBFwEXwSRHoUe8yAVIB4gIiAmIDAgMyA6IDwgPiBEIH8gpCCnIKwhBSETIRYhIiEmIS4hXiGVIagiAiIGIg8iEiIVIhoiHyIpIisiSCJhImUjAiMQIyElACUCJQwlECUUJRglHCUkJSwlNCU8JWwlgCWEJYgljCWTJaElrCWyJbolvCXEJcslzyXZJeYmPCZAJkImYCZjJmYma/sC//8AAAAgAKABkgH6AhgCxgLJAtgDfgOEA4wDjgOjBAEEDgRRBF4EkB6AHvIgECAXICAgJiAwIDIgOSA8ID4gRCB/IKMgpyCsIQUhEyEWISIhJiEuIVshkCGoIgIiBiIPIhEiFSIZIh4iKSIrIkgiYCJkIwIjECMgJQAlAiUMJRAlFCUYJRwlJCUsJTQlPCVQJYAlhCWIJYwlkCWgJaolsiW6JbwlxCXKJc8l2CXmJjomQCZCJmAmYyZlJmr7Af///+MAAP+u/0f/L/6F/oT+dvyg/dD9z/3O/c39m/2a/Zn9mP1o43rjDuHy4fHh8OHt4eTh4+He4d3h3OHX4Z3heuF44XThHOEP4Q3hAuD/4PjgzOCb4IngMOAt4CXgJOAG4B7gG+AS4BHf9d/e39zfQN8z3yTdRt1F3TzdOd023TPdMN0p3SLdG90U3QHc7tzr3Ojc5dzi3NbcztzJ3MLcwdy63LXcstyq3J7cS9xI3EfcKtwo3CfcJAePAAEAAAC6AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAADAGIAYwBkAGUAZgBnAGgAaQBqAGsAbABtABAAbgBvAHAAcQByAHMAdAB1AHYAdwB4AHkAegB7AHwAfQB+AH8AgACBAIIAgwCEAIUAhgCHAIgAiQCKAIsAjACNAI4AjwCQAJEAkgCTAJQAlQCWAJcAmACZAJoAmwCcAJ0AngCfAKAAoQCiAKMApAClAKYApwCoAKkAqgCrAKwArQCuAK8AsACxALIAswC0ALUAtgC3ALgAuQC6ALsAvAC9AL4AvwDAAMEAwgDDAMQAxQDGAMcAyADJAMoAywDMAM0AzgDPANAA0QDSANMA1ADVANYA1wDYANkA2gDbANwA3QDeAN8A4ADhAOIA4wDkAOUA5gDnAOgA6QDqAOsA7ADtAO4A7wDwAPEA8gDzAPQA9QD2APcA+AD5APoA+wD8AP0A/gD/AQABAQECAQMBBAEFAQYBBwEIAQkBCgELAQwBDQEOAQ8BEAERARIBEwEUARUBFgEXARgBGQEaARsBHAEdAR4BHwEgASEBIgEjASQBJQEmAScBKAEpASoBKwEsAS0BLgEvATABMQEyATMBNAE1ATYBNwE4ATkBOgE7ATwBPQE+AT8ABgIKAAAAAAEAAAEAAAAAAAAAAAAAAAAAAAABAAIAAAAAAAAAAgAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABAAAAAAADAAQABQAGAAcACAAJAAoACwAMAA0ADgAPABAAEQASABMAFAAVABYAFwAYABkAGgAbABwAHQAeAB8AIAAhACIAIwAkACUAJgAnACgAKQAqACsALAAtAC4ALwAwADEAMgAzADQANQA2ADcAOAA5ADoAOwA8AD0APgA/AEAAQQBCAEMARABFAEYARwBIAEkASgBLAEwATQBOAE8AUABRAFIAUwBUAFUAVgBXAFgAWQBaAFsAXABdAF4AXwBgAGEAAACEAIUAhwCJAJEAlgCcAKEAoACiAKQAowClAKcAqQCoAKoAqwCtAKwArgCvALEAswCyALQAtgC1ALoAuQC7ALwCEABwAGMAZABoAhIAdgCfAG4AagIkAHQAaQI+AIYAmAI5AHECQAJBAGYAdQIyAjUCNAGNAjwAawB6AXYApgC4AH8AYgBtAjgBQAI9AjMAbAB7AhMAAwCAAIMAlQESARMCBQIGAg0CDgIJAgoAtwJ/AL8BOAIbAiACFwIYApACkQIRAHcCCwIPAhQAggCKAIEAiwCIAI0AjgCPAIwAkwCUAAAAkgCaAJsAmQDxAUsBUgBvAU4BTwFQAHgBUwFRAUwAAEBFWVhVVFNSUVBPTk1MS0pJSEdGRURDQkFAPz49PDs6OTg3NjUxMC8uLSwoJyYlJCMiIR8YFBEQDw4NCwoJCAcGBQQDAgEALEUjRmAgsCZgsAQmI0hILSxFI0YjYSCwJmGwBCYjSEgtLEUjRmCwIGEgsEZgsAQmI0hILSxFI0YjYbAgYCCwJmGwIGGwBCYjSEgtLEUjRmCwQGEgsGZgsAQmI0hILSxFI0YjYbBAYCCwJmGwQGGwBCYjSEgtLAEQIDwAPC0sIEUjILDNRCMguAFaUVgjILCNRCNZILDtUVgjILBNRCNZILAEJlFYIyCwDUQjWSEhLSwgIEUYaEQgsAFgIEWwRnZoikVgRC0sAbELCkMjQ2UKLSwAsQoLQyNDCy0sALAoI3CxASg+AbAoI3CxAihFOrECAAgNLSwgRbADJUVhZLBQUVhFRBshIVktLEmwDiNELSwgRbAAQ2BELSwBsAZDsAdDZQotLCBpsEBhsACLILEswIqMuBAAYmArDGQjZGFcWLADYVktLIoDRYqKh7ARK7ApI0SwKXrkGC0sRWWwLCNERbArI0QtLEtSWEVEGyEhWS0sS1FYRUQbISFZLSwBsAUlECMgivUAsAFgI+3sLSwBsAUlECMgivUAsAFhI+3sLSwBsAYlEPUA7ewtLEYjRmCKikYjIEaKYIphuP+AYiMgECOKsQwMinBFYCCwAFBYsAFhuP+6ixuwRoxZsBBgaAE6LSwgRbADJUZSS7ATUVtYsAIlRiBoYbADJbADJT8jITgbIRFZLSwgRbADJUZQWLACJUYgaGGwAyWwAyU/IyE4GyERWS0sALAHQ7AGQwstLCEhDGQjZIu4QABiLSwhsIBRWAxkI2SLuCAAYhuyAEAvK1mwAmAtLCGwwFFYDGQjZIu4FVViG7IAgC8rWbACYC0sDGQjZIu4QABiYCMhLSxLU1iKsAQlSWQjRWmwQIthsIBisCBharAOI0QjELAO9hshI4oSESA5L1ktLEtTWCCwAyVJZGkgsAUmsAYlSWQjYbCAYrAgYWqwDiNEsAQmELAO9ooQsA4jRLAO9rAOI0SwDu0birAEJhESIDkjIDkvL1ktLEUjRWAjRWAjRWAjdmgYsIBiIC0ssEgrLSwgRbAAVFiwQEQgRbBAYUQbISFZLSxFsTAvRSNFYWCwAWBpRC0sS1FYsC8jcLAUI0IbISFZLSxLUVggsAMlRWlTWEQbISFZGyEhWS0sRbAUQ7AAYGOwAWBpRC0ssC9FRC0sRSMgRYpgRC0sRSNFYEQtLEsjUVi5ADP/4LE0IBuzMwA0AFlERC0ssBZDWLADJkWKWGRmsB9gG2SwIGBmIFgbIbBAWbABYVkjWGVZsCkjRCMQsCngGyEhISEhWS0ssAJDVFhLUyNLUVpYOBshIVkbISEhIVktLLAWQ1iwBCVFZLAgYGYgWBshsEBZsAFhI1gbZVmwKSNEsAUlsAglCCBYAhsDWbAEJRCwBSUgRrAEJSNCPLAEJbAHJQiwByUQsAYlIEawBCWwAWAjQjwgWAEbAFmwBCUQsAUlsCngsCkgRWVEsAclELAGJbAp4LAFJbAIJQggWAIbA1mwBSWwAyVDSLAEJbAHJQiwBiWwAyWwAWBDSBshWSEhISEhISEtLAKwBCUgIEawBCUjQrAFJQiwAyVFSCEhISEtLAKwAyUgsAQlCLACJUNIISEhLSxFIyBFGCCwAFAgWCNlI1kjaCCwQFBYIbBAWSNYZVmKYEQtLEtTI0tRWlggRYpgRBshIVktLEtUWCBFimBEGyEhWS0sS1MjS1FaWDgbISFZLSywACFLVFg4GyEhWS0ssAJDVFiwRisbISEhIVktLLACQ1RYsEcrGyEhIVktLLACQ1RYsEgrGyEhISFZLSywAkNUWLBJKxshISFZLSwgiggjS1OKS1FaWCM4GyEhWS0sALACJUmwAFNYILBAOBEbIVktLAFGI0ZgI0ZhIyAQIEaKYbj/gGKKsUBAinBFYGg6LSwgiiNJZIojU1g8GyFZLSxLUlh9G3pZLSywEgBLAUtUQi0ssQIAQrEjAYhRsUABiFNaWLkQAAAgiFRYsgIBAkNgQlmxJAGIUVi5IAAAQIhUWLICAgJDYEKxJAGIVFiyAiACQ2BCAEsBS1JYsgIIAkNgQlkbuUAAAICIVFiyAgQCQ2BCWblAAACAY7gBAIhUWLICCAJDYEJZuUAAAQBjuAIAiFRYsgIQAkNgQlm5QAACAGO4BACIVFiyAkACQ2BCWVlZWVktLEUYaCNLUVgjIEUgZLBAUFh8WWiKYFlELSywABawAiWwAiUBsAEjPgCwAiM+sQECBgywCiNlQrALI0IBsAEjPwCwAiM/sQECBgywBiNlQrAHI0KwARYBLSx6ihBFI/UYLQAAAEBkCQME/QH1UCgf8kYoH/FGKh/wRjUfi+6b7qvuA2vvi+8Cu+8BpO8BG+9b72vvAwTsROwCCutG/x/n5CYf5uQ9H+XkHh/j4kYfC+IBQOJGFh/h4EYfu+DL4NvgA0DgMzZG4EYYH7wBFAA+ARIAVQETQAw9A1XfPd1V3j3cVbtBCQEWAAEAVAEWAGQBFgAC/8ABFrMMFkYguAEWsgECALwBFgAQARYAAgEVstw9H7gBEUBjA/8fEN0g3UDdUN2A3bDdBiDcUNyA3LDcBA/cAdAVMx9fyG/If8gDX8Nvw3/DA7/CAcFQJh9wvgEgvjC+wL4DcL6AvgIPvB+8Ai+8P7xvvK+837wFua0mHyC4MLhQuHC4gLgFuP/AQBy4EylGELcBILdQt4C3sLcEgLWwtQIPsz+z77MDuAENQCuqSB+AsJCwArCwwLDQsAMvrz+vAqCtsK0CwK3QrQIvrD+sAp+rAcCq0KoCQQ8BDwAyAQ4AVQAAAQ4AEAEOACABDgBwAQ4ABAAPARBAFQFQnGCccJwDmZYmH5hGJh8wl0CXArj/wLOWFhxGuP/AQCqWDhFGlRv/Hw+Ur5S/lANAlB0xRkCUFhtGQJQMD0YPky+TP5N/k++TBQ+6AQwAbwEMQCACko0mH5FT/x/fkAEwkAEfkC+QAm+Qf5ACAI8QjyCPA7j/wEAgjxgcRiCOMI4CT41fjW+NAzCMAQ+MH4wvjANAjBATRhC/AQsAIAELADABCwAD/8ABC7IXIEa5/8ABC0BQEBRGi4ImH4lKPB+Ihz0fh4Q8H4ZK/x+fhQEQhCCEMIQDMIMBf4IBQIIJDEZzUCYfb0Y1H25GNR8aARhVGTMYVQczA1UGA/8fYFAmH19QJh+5/+ABB7IfJka5/+ABB0AfExxGXlpIH1xGMR9bWkgfWkYxHxMyElUFAQNVBDIDVbgBCLUbPB8PAwG5ARkBGLI1H0C4ARiyFyhGuAEKQCVQJh9SUBsf71H/UQJAUTU4RkBRJShGz1AB30wBTEYdH0tGSB9QuAEbQFoBSkYmH0lGNR9IRjUfR0Y1H69GAd9G70YCgEYBFjIVVREBD1UQMg9VAgEAVQEAAR8fDz8PXw9/DwQPDy8PTw9vD48P3w//Dwc/D38P7w8DbwABTwABoBYBBQG4AZCxVFMrK0u4B/9SS7AJUFuwAYiwJVOwAYiwQFFasAaIsABVWltYsQEBjlmFjY0AQh1LsDJTWLBgHVlLsGRTWLBAHVlLsIBTWLAQHbEWAEJZc3RzdHUrKysrKwFzdHUrKysrcwArK3R0KytzKysrK3MrKysrASsrKwArKysrKysrKysBKysAKwErc3R0cysrKysrKytzACtzdHR0K3VzdHR0KytzcysrK3MrASsrcysrAHN0cysBc3N0AHN0dHN0K3MBcwBzdCtzK3N0AXN0dQArcwF0AHQrc3NzKytzX3MrdHQrKysrASsrdCsrXnMrACsrKwErXnMAc3NzdHMBKysrACtzGF9eAAAFzAXMAH0FRQAVAGAFRQAVAAAAAAAAAAAAAAAAAAAEOgAUAHcAAP/sAAAAAP/sAAAAAP/sAAD+VwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAgAAAAAAAC0AL0AqgCgAMgAtACFAAAAAAAAAIgAfgClAMAAAAAAAAAAAAAAAAAAvwDJAKsAjAC8AJsAjQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAALkAtAB8AAAAAACUAF8AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAGoAG8AeACkAMgAgwCNALsAXgGKAQMAYAB0AIEAuADAAFAEsQTD/kwA6wGyAMMBCQB7ASsClgDJAJYAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJIAqABrAJIAtwBrAJsAAAAAAvIAkgI+AG4CpQNFAIkAoABgAkwAAADDAAABTgCkAVsAXgCAAGkAbwAAAF4AaAAAAAAAAAAAAAAAAAAmA0oAhwB7AAAAdQBoAAAAAAAAAAAAAAWCAjMAC//0AIMAiQCPAJYAaQBxAFsAUgAAAAAAAACyAgMAAACNAx8AuwCuALUAAAAAAIsAAAAAAAAAAAapA3ACvAII/ZkAkQCRAE0ATQBkAGQBgQCfAKj+aP6cAJsBRQFFAJD+9gAXAHoFRQJNAAz/7gWYAosAbgBMAGIARgDoAAAAIgAiACIAIgBKAHQBJgImAvwD/gQaBFIEiAUCBUAFbAWIBaIF0AZSBp4HGAfeCCgIsglaCZQKYAsECyoLbgu+C/gMSAy+Df4OYA7kD3YP0BAUEE4Q0hEWEVwRphIOEjASxhMoE5oT8hSAFPwVrBXkFjwWoBeWGBoYfBjOGPoZKhlSGZoZrhnMGnoa+Bt+HAAcihzqHZgd6B4kHnQe6B8YH64gBCBoIPAhdiHKIlwitCMOI3gkaCTkJXAlsiYyJkwmzCcuJ1gn6iiEKU4p0in6KwIrLiwwLMItEi00LgouFC50LsgvJC+sL8owODB6MIIw1jEWMXIxwDHmMgQyJjKgMrgy0DLoMwAzGjMyM6IztjPOM+Yz/jQYNDA0SDRgNHo09jUONSY1PjVWNW41iDXyNqA2uDbQNug3AjcaN3g4MDhIOF44eDiWOLI4yjmqOb451jnsOgI6Gjo2Okw6ajqOO0A7VjtuO4Q7mjuwO8g8FDzSPOo9AD0YPTI9SD3MPeQ9/D4UPiw+Qj5WPmo+gj6YPrA+xj7ePvA/CD8ePzY/zj/WQHZAjkCkQLxA0kDqQPxBEEEkQTxBVEFsQYJBmkGwQchB2kHsQgJCGkKeQwRDdkOOQ6ZDvkPWQ+5EBEQYRCxERER0RNhFRkVeRXRFiEWcRhBGKEZ4RoxGoEa2Rs5G4kbuRzxHnke2R85H4kf2SA5IJEg+SNpJTklmSXxJlEmqScRJ3kpYSxBLKEs+S1JLZkt+S5ZLrkvES9xL8kwGTBpMMkxITFxMcEyITJ5M8k1kTXxNlE2sTcRN3E30ThhOMk5MTmZOeE6MTqROvE7UTuxPBk8eTzRPTE9eT3ZPjE/QUC5RIFJQUmhSflKWUqxSuFLEUtBS3FMEUy5TRlN+U5ZUFlRUVKxU8lUaVXBViFWqVcpWIFZAVlhWxFd+V5hXoFeoV8hYKlgyWDpYQljkWOxY9FlGWU5ZVlm0WbxZ8Fn4WkhaUFpYWvBa+FtgXB5cOFxSXGhcflyUXKpcxF1mXghekl8wX8RgUmCqYUZhlGGcYkBisGMUY9Rj3GRUZNhlaGXuZkxmnmcwZ9BoRmjwaQppJGk6aVBpZmmAafRqDGqqarJqumrUatxrVmu4bA5sJmw+bIRsjGz0bPxtBG1obXBuJm7yb2BveG/kcEZwTnBWcF5wknCacKJwqnEUcRxxJHFkcbJyAHJmcsJzMnOOdCZ0pnUkdSx1xnY4dl52zHbUd5B4NHiGeJx5GnlyefJ6Knoyel56Znpuep56pns0ezx7iHvcfCR8jnzefU59mH4qfrZ/HH80f8J/2oBggGiAeoCSgJqBFoF4geqCAIIWgkyChoLAgtiC8IMIgx6DOINQg2iDgIOcg7iD1IPog/yEEIQ2hFyEhoS0hOCFJIVwhb6F8IZAhnyGsofUh/CIGohIiHaItojAiOKJNIl8ijKLLIvOjKKNRI3wjn6PPI+wj9SP+JAekEiQepCskOCREJFekaySCJKekwCTNpOOk6iTypQKlLaU0JUUlWiWJpaOlsqXKpeKl7yX4pggmF6YdpiMmKyYyJjmmQKZJplImWyZkJm+meSaCJoymlyakJq4muCbEps8m2abmpvCm+qcHJxMnH6cvJzqnRqdWJ2Inbad9J4knlKekp7Unxafap+An5afrJ/Cn9ihjKSup7qnzqf2qA6oOqhOqGKoeKiOqKKo6KlGqXypsqoMqlyrOqvWrIKs9K10reKuYq60rvCvRq/QsEawqrDMsQKxKLFIsYixyrIisrCzCLNus6K0PAAAAAIAfwAAA4EC7gADAAcAGkAKAwcHCQYABQEGAAAvzS/NAS/NEjkvzTEwMxEhEQMhESF/AwKB/gACAALu/RICbf4UAAAAAgIDAAACyQVEAAMABwApQBUDB5gCAAQQBAIEBAgJAQECBZ0EAgMAPy/tETkvERIBOS9dM+0yMTABIwMzAzUzFQKxlBjExsIBjQO3+rzJyQACARUDTQO2BcwAAwAHACdAFAOWAgIJB5YvBgEABgEGBQAABgIAAD8zMy8yAS9dXe0SOS/tMTABIwMzASMDMwOMjijg/hWNKeADTQJ//YECfwAAAAACADYAAASLBUUAGwAfAPC5AAT/8ECZDRFIBh0WHSYdAwYBFgEmAQMSDw4LBAoTCB0cFQQUCQQBABkEGAUWHx4HBAYXE6wUBawGF6wYGi8DPwMCAxoDGDAGQAZQBgMQGCAYAuAY8BgCFAYYGAYUAwohEREMDAmsAAoBCggEDK8NHQENHAAQrxEZFRFPEQFPEV8R7xEDEUAfIkh/DY8Nnw0DTw1fDQINEQ0RBRcTAwoFAC8zPzMSOTkvL11xK11xETMzEO0yMhEzMxDtMjIBL13tMy8zLxESFzkvLy9dcXERMzMvXS8Q7RDtEO0REhc5ERIXORESFzkREhc5MTBdXSsBAyEVIQMjEyEDIxMjNTMTIzUhEzMDIRMzAzMVIQMhEwOiQwEE/uVYblb+lVRuVMnhQ/EBB1luWAFrWG5Y0/1ARQFqQwNB/sNs/mgBmP5oAZhsAT1sAZj+aAGY/mhs/sMBPQAAAAMAQv9zBH4FxAA5AEQATwEZQMdEPVQ9AmVOAW5HAWU8AWovAXUqhSoCdimGKQJ2IoYiAmUOAXkKiQoCeQmJCQJ5A4kDAnofih8CLG8tLUVLMycGPyQRBwcfdQCFAAIAbwBFEEUgRWBFcEUFEEUgRTBFcEWQRaBFsEUHRUVRDG8LQBIgSI4LAQsLOm8AH0AfAgAfEB/wHwMfMkBzJEoSczM/PyQtLSckJUAgJ0glQBIXSCUlJAZLEXMIAAwQDEAMUAxgDAVADFAMoAywDPAMBQwMCJAHAQcHBQgYAD8zMy9dETMvXXEQ7TI/My8rKxEzMy8ROS8z7TIQ7TIBL11x7TMvXSvtETMvXXHtXRI5LzMzM80yMjIRMy/tXTEwAF1dXV1dXV1dXV1dAV0BFA4CBxUjNS4BJzceAxcRJicmJyYjLgU1ND4CNzUzFR4DFwcuAycRHgUBFB4CFxEOAwE0LgInET4DBH44cq93gNfzIqoLLU1wTQgHBAYDAjFiWEw4H0BynV2AZpFmQBSuCic/WDs6cmdYQST8sChFXTZHYjwbAqQwUGo6QWtNKwF8S4BfOQWhoQe5pyU2W0QpBAHpAgIBAgEMHSc3SWE/UndPKAOCggQsUHVMITBPOSEE/lYOHys6UWwCNjZHLx4OAZ0DITVF/V4/UTQhD/4pBB44UgAABQAA//QEzgVRAAMAFwArAD8AUwDBuQA+/9hADgkOSDgoCQxINCgJDEguuP/YswkOSBa4/9hADgkOSBAoCQxIDCgJDEgGuP/YQBYJDkh5AokCAgIDVgB2AIYAAwABAxABuv/wAAP/wEA6Cg5IHwEvAT8BAwMBAwETMUq0O7UxtHBAgEACQEATVRi0CbUitBNFtiy3T7Y2GSe2DrcdtgQHAgYAGAA/Pz/t9O0/7fTtAS/t9O0REjkvXf307RESOTkvL10rODgRM10RM10xMAArKysrKysrKzMjATMlMh4CFRQOAiMiLgI1ND4CEzQuAiMiDgIVFB4CMzI+AgEyHgIVFA4CIyIuAjU0PgITNC4CIyIOAhUUHgIzMj4C3ZEDpJP8oDpnTS0tTmg8PGlOLC1OasYSIzMhIzYkEhMkNSIgMyQTAgg6Z00tLU5oPDxpTiwtTmrGEiMzISM2JBITJDUiIDMkEwVJCB9NgWNgglAjI0+DYGOBTR/+sEJYNRUWNVdCQFc2Fxc2V/7YH02BY2CCUCMjT4NgY4FNH/6wQlg1FRY1V0JAVzYXFzZXAAADACv/7AShBU0APQBPAF8A9EAYc06DTgJ5UYlRAmVYdViFWANpUwE5JQEguP/oswkOSBy4/+izCQxILrj/8EA9CQxIJRIBBhIWEgJISRkjST4wPgEwOwE7OzFJMGtQAQwUHBRsFAMoS1MUBD4tUDQFBBlwPoA+kD4DPj4wGbj/wEA/EBNIPzABGTAZMGFWSA9ACxdID2AtcC2ALQNlUAEpUAEFUDQtBAowRUtVS2VLA0sUMChTBVtDUR4DN1tRAAoWAD8z7TI/7RIXOV0vEhc5XV1dAS8r7RI5OS8vXSsSOS9dERc5Ehc5XV0Q7TIvXV0Q7RDtMTAAXV0rKytdAV0AXQFdAF0FIi4CJw4DIyIuAjU0PgI3LgM1ND4CMzIeAhUUDgIHHgMXPgE3Fw4BBx4BMzI2NxUOAQE0LgIjIg4CFRQWFz4DAy4BJw4BFRQeAjMyPgIEMClMQzoWHEdWZzttnmYxLU5rPg8bFQwrV4RZRXZWMERyk04fPkRKKio/FJEaVzErYSgaMBUYOP67GC1AJyxJNR4mF0BxVTFKWaFCVV4gQGFBJ0c8MQwVIy8aGTImGDpmilBNfmdRIBxESUwlPm1RLiNEZEBHbFZGITZkYF0uV8Z5K4vlXjYzBwmHCwsESSI4JxYZLkMqQXQrGzI6R/zLZOF0LpVlNFxEJxMeJgAAAAABAfYDTQLWBcwAAwAcQA0DlgACAQICBAUAAAIAAD8zLxESATkvXe0xMAEjAzMCrI0p4ANNAn8AAAEBVv5XA3sFzAAVAChAFhAG8BEPBR8FAgUFFwDwAAsBCxAABhsAPz8BL13tEjkvXTPtMjEwARQeAhcjLgM1ND4CNzMOAwIRKViJYL5ch1krK1mHXL5giVgpAhKK9ObhdnHb5vuQkPnl2XF24eb0AAABAVD+VwN1BcwAFQAkQBMA8AsLFxEF8BAABhAGAgYQAAUbAD8/AS9dM+0yEjkv7TEwARQOAgcjPgM1NC4CJzMeAwN1KliHXMBgilgqKliKYMBch1gqAhSQ++bbcXbh5vSKifTm4XZx2eX5AAABAPgC/APUBcsADgCvQBdbBmsGAgADUANgAwMPCV8JbwkDCwMHCLj/wEBMCxFICAgKDQUEQAsRSAQEAg4OCg0OcAqACgIKBg4ADRANAg0NDxACCgoBCwAMdQyFDAIDCQQIfwuPCwILCAYJDAsFDQVwB4AHkAcDB7j/wLYJDEgHBw0AAD8zLytdMxIXOS9dETMRM10RMxEzMxEzERIBOS9dzTnEXSsBGBBN5DkvKzMREjkvKzMxMF9eXV0AXQElFwUXBwsBJzclNwUDMwKfAQgt/ua5d5acd73+6C0BCwyIBKRnhEn6SAEC/wBI+EmGawEpAAAAAQB0ALQEVwSeAAsASUAlCw4BBAIOBAkBqkAGAAIBCgMCAgwNAg4EBwUOMAcBBwAErQkFswA/M+0yxl0rABgQTeYREgE5L19eXTMa7TLGKwEYEE3mMTABESMRITUhETMRIRUCr5P+WAGokwGoAmD+VAGskgGs/lSSAAAAAAEBA/6VArUBKwADADlAJwkAGQACABAOEUgJAhkCAgIQDhFIAZkClwOaLwBvAH8AAwAAnAGbBAAQ9u0BL13t/e0xMCtdK10BEyEBAQOpAQn+yf6VApb9agABAU4B0AN+AnAAAwAdQA8DAwUAABAAAgAAui8BAQEAL13tAS9dEjkvMTABNSEVAU4CMAHQoKAAAAEB8AAAAtsBKwADABpADAOWAAABAAAEBQGbAAAv7RESATkvXe0xMCERMxEB8OsBK/7VAAABAHL/7ARZBcwAAwA9QByKAQE5AWkBeQEDAQIQAgIFhQMBNgNmA3YDAwMAuP/wtwAAAQADGQEAAD8/AS9dODJdXRI5LzgzXV0xMBcBMwFyAzWy/M8UBeD6IAAAAAMAfP/sBE8FWgATACcAKwB5QFI2IAFGEVYRAkYNVg0CSQdZBwJJA1kDAhAqICoCQCpQKgIAKQEqKSopHgBuQBRQFAIAFAEUFC0ebwAKEAoCCk8oAU8oXygCKCkpIxlzDwcjcwUZAD/tP+0SOS/NXXEBL13tEjkvXXHtEjk5Ly9dXXExMABdXV1dXQEUAg4BIyIuAQI1NBI+ATMyHgESBzQuAiMiDgIVFB4CMzI+AiU1MxUET02FtGZnsoNLS4S0amWxhEy3KE5xSEx0TygpT3JJR3JPK/5Y6wKjw/73pEdHowEKw8wBDJ9AQJ/+9Myf1H40NX7Tn5rSgDg4gNIi+fkAAAAAAQCUAAAEagVFABIAWUA5ABEBEREQbwIICB8BAQ8BPwFPAV8BjwGfAa8BBwEBDhACARACcAKAAgMCAhMUCHMJCQMOBhABcwAYAD/tMj8zMy/tERIBOS9dcTMzL11xMy8Q7TIvXTEwMzUhEQ4DIzUyPgI3MxEhFZ0BtxNgfY5CSo98YBqmAWGRA/0oRzQflCI9VDL7TJEAAAABAJAAAAQ8BVoAJgCHQFx1BoUGAjkgAXQbhBsCdhqGGgJ3FYcVAncWhxYCaQoBaxABWRABBRoBJiYdbh8IPwgCbwi/CAIICAAoEm4TEwBgJHAkgCQDJCTPAAEAABAAAgASEg1zGAcBJHMAGAA/7TI/7TMvAS9dXTMvXREzL+0REjkvXXHtMi8xMABdXV1dXV1dXV1dMzU+BTU0LgIjIg4CByc+AzMyHgIVFA4EByEVkCyQo6WFVCdHYTs2XUYsB7gJQG+iammndT5Wh6ScgCAC03VhpJGEgYVKPFc5Gx48WTsRTIZlOjBdilleoZCCgIFGkgAAAQCA/+wESwVaADsA5kBjdTmFOQJjOQFAOVA5Ang0iDQCbDQBSzRbNAJ0L4QvAgYudi6GLgN3KYcpAmwlAVolAWMSAWQNAVUNAXkIiQgCeQeJBwJ5A4kDAnsCiwICNhoxbj8gXyACICAAbhNAEwEAEwETuP/AQDwVGEgaExoTCj0mbicnC27PCt8K7woDAAoQCgIKNhlzGhoQLCYmI3MsBxBzBUALkAsCQAuQC/ALAwsLBRkAPzMvXXEQ7T/tMy8REjkv7TkBL11d7TMv7RESOTkvLytdcRDtMy9x7RE5MTAAXV1dXV1dXV1dXV1dXV1dXV1dARQOAiMiLgInNx4DMzI2NTQuAisBNTMyPgI1NCYjIgYHJz4DMzIeAhUUDgIHFR4DBEs/ebJ0grR0Ogm6CCtKbUmIm0VneTNmYjNuWzuFg3eTDLULUHueWXepbDMlSW9KUn1UKwFyW5FkNkFriUkROFxCJH55RFo1FpwZN1k/and6bw5dilstOGCBSTdnVkAPBAk8V2oAAAAAAgBnAAAEZQVFAAoADQBVQDVpBnkGiQYDfwkBCQkIAW8NBpACoAICAgIPDG8QBAEEAARzCAUPDB8MLwxvDAQMDAELBgYBGAA/PzMSOS9dMzPtMgEvXe0SOS9dMzPtMjIvXTEwXQERIxEhNQEzETMVCQEhA6m0/XICe8e8/pD+DAH0AT/+wQE/jAN6/IiOA0P9SwAAAAEAgP/sBEsFRQAsAI5AXmkIeQiJCANpB3kHiQcDShdaFwJFE1UTAiJADRFIIiIAbhUlJCEfbyAgCkAVAQAVwBXQFQMVFS4LbvAKAc8K3woCAAoQCgIKJXMgIBpzbygBKCgQJHMhBhBzBQsLBRkAPzMvEO0/7RI5L13tMy/tAS9dXV3tEjkvXXESOS/tMzIyEO0yLysxMABdXV1dARQOAiMiLgInNx4DMzI+AjU0LgIjIg4CByMTIRUhAz4BMzIeAgRLQH67e2+lckMOtgsoRWVIRnJRLCpOcUgtTEE1F7AvAyH9hR0wkGNpqHZAAbxkq3tGNFt6RhUoSzsjK1B1STxnTCsQHCUUAtiR/lclNUBxnAAAAAIAl//sBEgFWgAkADgAq0B9egOKAwJ6AooCAmgDeAOIAwNnI3cjhyMDZyJ3IociA0U3VTcCQzFTMQJKLVotAksnWycCHBssGzwbAxVuFBQAbq8lAUAlAQAlwCXQJQMlJTodL26QCqAKAgAKEArgCvAKBAoqc28gARAgICACICA0GHMPjxUBFRUPBzRzBRkAP+0/My9dEO0SOS9dXe0BL11x7TISOS9dcXHtMi/tMTAAXV1dXV1dXV1dXQEUDgIjIi4CNTQSPgEzMh4CFwcuASMiDgIVPgEzMh4CBzQuAiMiDgIVFB4CMzI+AgRIO3Oqb3u4ej1Fgrt2SH5nThesHHtRSnhULTGyc2Cdbzy3JEhqRjFkUTMoS2pCQWdIJgG+ZKt9Rl2s9ZixARC4Xx5DblAfW1FFhsWBW18+cqBrQ3BQLSFBYkFIgWI5LVJ0AAAAAAEAngAABC0FRQAOADVAEAVuBgYMAG8LCxAADBAMAgy4/8BACxQYSAwADHMNBgUYAD8/7TIBLytdEjkv7RI5L+0xMAEGCgIVIzQaAjchNSEELWCrgky8UIawYf0fA48Euor+2v7P/safngE7ATIBJIWRAAAAAwCF/+wERgVaACkAPQBRALZAfnUohSgCdgyGDAJ4AogCAngIiAgCdx2HHQJ5IokiAngSiBICakYBakABZVABZUoBZTwBZTYBJBAfNG4VH24qFSoVKgoAbkA+AQA+wD7QPgM+PlNIbuAK8AoCzwrfCgIAChAKAgokEBBDczk5TXYahhoCL3MaB3kFiQUCTXMFGQA/7V0/7V0SOS/tOREzAS9dXV3tEjkvXXHtEjk5Ly8Q7RDtEjk5MTAAXV1dXV1dXV1dXV1dXQEUDgIjIi4CNTQ+Ajc1LgM1ND4CMzIeAhUUDgIHFR4DAzQuAiMiDgIVFB4CMzI+AhM0LgIjIg4CFRQeAjMyPgIERjl1tX18tXc5L09lNjtdPyE5cKZtc6lvNiE/XT09aE0r3hs+ZElGYz8cFjpmUFZmNxEjHERzVk9vRSAgRnJRU29EHQF6VJFsPT1rkVNHc1Q0CQQOPlRkNUR9YDk6YH5ENGRUPQwECjVUcQIzL1I8IyM8Ui8lUkUtLkVS/bstWUcsLEhaLztlSiopS2cAAAAAAgCN/+wEPwVaACQAOAClQHd6CIoIAnoHigcCZyB3IIcgA2gaeBqIGgNFN1U3AkUxVTECSi1aLQJLJ1snAhMRIxEzEQMTAG4/JY8lnyWvJQTAJdAlAiUlHToLbgoKL27gHfAdAs8dAQAdEB0CHTRzExhAExZIGBgOKnMiBw5zBXALgAsCCwsFGQA/My9dEO0/7RI5Lysz7QEvXV1d7TMv7RESOS9dce0zMTAAXV1dXV1dXV1dARQCDgEjIi4CJzceATMyPgI3DgMjIi4CNTQ+AjMyEgc0LgIjIg4CFRQeAjMyPgIEP0aEvXdRgmZIFqwcd1tKeFUxARVJXWs4YJtsOz94r2/s8cQlSWtGQWhIJyNGaEUyZ1M1Ar+x/vK3XSFGcE8bW1VEhMSBL0ozG0R6qWVoqXhC/rSwSYNjOy1Tc0ZCc1cyIkNlAAIB8AAAAtsEOgADAAcAJEASBgUDlgAAAQAACQgEmwUPAZsAAC/tP+0REgE5L13tMzIxMCERMxEDETMRAfDr6+sBK/7VAw8BK/7VAAACAWD+lQMSBDoAAwAHAFhAPgkEGQQCBBAOEUgJBhkGAgYQDhFIApYBQBoeSAFAERVIAQEEBZkGlweaAAQQBIAEkASgBAUEBJwFmwgAmwEPAD/tEPbtAS9d7f3tEjkvKyvtMTArXStdAREzEQETIQEB8Ov+hakBCf7JAw8BK/7V+4YClv1qAAAAAQB0AJoEVwSqAAYAd7UAAVIFBAW4AQ1AEAYAFAYABQYBAgFSAwQBBAO4AQ1AKAIBFAIBAwIGCAQAABAAAgABAAQEAgU/Bm8GfwYDBkASFUgGAw8CAQIAL10zLytdMxI5PS8zMwEYL10zEN7UwYcEKxABwYcEKxDEEAHBhwQYK4crxDEwEzUBFQkBFXQD4/ymA1oCO80Bopr+kv6RmQAAAAIAdAFYBFcD7AADAAcATEA3BwIJBAABEAECAQWtHwR/BJ8ErwS/BAUEQBIWSAQArTABUAFgAXABBFABcAGAAbAB0AEFDwEBAQAvXV1x7S8rce0BL10zEM4yMTATNSEVATUhFXQD4/wdA+MDWJSU/gCUlAAAAQB0AJoEVwSqAAYAd7UGAVIBAgG4AQ1AEAAGFAAGAQAFBAFSAwIFAgO4AQ1AKAQFFAQFAwQCBggEAAAQAAIABgUCAgMPBAEEAT8AbwB/AAMAQBIVSAAALytdMi9dMzk9LzMzARgvXcQQzjIQwYcEKxABwYcEKxDEEAHBhwQYK4crxDEwNzUJATUBFXQDWvymA+OamQFvAW6a/l7NAAAAAAIAXgAABDEFWgAnACsAbUBJaQZ5BokGA2kEeQSJBANKG1obAgclFyUCZgB2AIYAAwkrmAooKB4AmAATARMTLR2YHgpADxRICgojKZ0oZiN2I4YjAx0dGJ4jBAA/7TMvXS/tETkvKwEv7RI5L13tEjkvM+0yXTEwAF1dXV0BFA4GByM+BzU0LgIjIg4CByc+AzMyHgIBNTMVBDElPk9STz8nAa8CJz5OUE08JSlNbUREb1IyB7gMSn6wcGyxfkT9j8MD6kVoUkI7O0RTN0NmUUE7O0RTNTdUOR4mR2U+DFqXbD0wXYn7vMnJAAAAAgAs/uUEpQXMAF8AeAE7QJEBRBFEAjU/VT91PwMBPhE+Amw0fDSMNAMXGAsOSGwIfAiMCANsZnxmAkpmWmYCJl0BalMBZUl1SYVJA38/jz8CP0ALDkh+OQEDbyp/Ko8qAwJPKl8qAhcYCw5Iajd6N4o3A2lRAUsPTB9MAkxMVgDTNykv0wpgKApq0ho3QBQYSBA3AS8aPxoCNwoaGgo3A3pBuP/otQ0RSEHTVrj/wEAmFyBIVjJv1hUPBRVj1iEoKBkmASYhDxUfFS8VnxWvFQWQIaAhAiG4/8BAFwkMSEsVISEVSwNGPBANEUg81VsARtVRuAEPAD/tP+0rEhc5Ly8vK11dETNdMy8Q7REzMxDtMgEvK+0rEhc5Ly8vXV0rEO0RMzMQ7TIQ7RE5L10zAF0BXTEwACtdX11fXStdXV1dXV0BXStdXV1dARQOAiMiLgI1PAE+ATUjDgMjIi4CNTQ+BDMyHgIXMzczAw4DFRQWMzI+AjU0LgIjIg4BAhUUHgIzMj4CNxcOAyMiLgECNTQaATYzMh4BEgU0JiMiDgQVFB4CMzI+Ajc+AwSlKU5ySB40JxYBAQYPLjtJKj9WNRcXLEFRYjgqPiscCQUgdGMIDwsGHRQoQS8ZNWWUYHi7f0I7b6JmO2ZZUSZHK2Fvfkl/zI5NVKHploPDgD/+YkY7JUA0KBsOCxssICdHOi4NAwgHBALzkO+sYBAlPCwCCwwKAydHNh9Ba4tKTJaIdVUwGy8/JJf+BSpRST0VNCRQkcl5geCmYIbn/sixmPqzYhkqOiFXJUQ1H3HQASa20QFjAQSSdsj++HZqbSxLZHF3OTxnSys3ZI9XEzQ2MQAAAAIAAAAABMwFRQAHABQAckBCEwIDBQFSAw0DXgQFFAQFAwQUAQAGAVIADQBeBwYUBwYNBBAHAQcHFn8EjwQCBAcBAl8UExNaDQFLDQENBgUDBAASAD8yPzMzXV05LzPtMi8BL10RMy9dEjmHK4crxBDAwBAAwYcFGCuHK8QQwMAxMCEDIQMjATMJAS4DJw4DBwMhBAqK/c2JxAH+2QH1/fENHBcRBAQQFxkNlwHPAX7+ggVF+rsDuiZORjUMDDZGTiX+WQADAKIAAASABUUAFgAhAC4Ad0BPZS0BaiQBZiABewKLAgJ0C4QLlAsDBwsBbxIBSxJbEgISKQ1aF0ANFEgXFwYAWgAiASIiMBwpWgAGEAagBrAGBAYSKF8cHCkbXwcDKV8GEgA/7T/tEjkv7TkBL13tMhI5L13tEjkvK+0ROV1dMTAAXV1dXV1dARQOAiMhESEyHgIVFA4CBx4DATQmKwERMzI+AhM0LgIrAREhMj4CBIBUjrxo/igBnHW4gEMhQ2REVYNYLv7ul5ff4VFySCFRM12CUPwBCkl9WzMBfGeQWyoFRSZPfFY4ZVE7Dgk4V3ECKGtb/mAfOVD92T9YORr+Ihc4XgAAAAABAHH/7AR2BVoAKQCkQC05JwFGHVYdZh0DZhwBNgMBIB8wHwJgH3AfAqAfAR8fIEAdJEggIAoLC7AKAQq4/8BARQkMSAoKK3YAhgACAFswFUAVUBUDABUQFQIVRhpWGgIlXxogIBoEEAogCjAKYApwCgUwCoAK0ArgCgQKCkkQWRACBV8QEwA/7V0zL11xPzMvEO1dAS9dce1dEjkvK10zLxEzLyszL11xcjEwAF1dXV0BFB4CMzI+AjcXDgMjIi4BAjU0Ej4BMzIeAhcHLgMjIg4CATooVINcP2VPOhWfHFJ0m2aNzYdBQITKimWYb00ZqA80SWE8WX9SJgKpg8uMSDBOZjZBRoVpQGW4AQKepgEBr1s3XXlCQS5YRCpEh8cAAAAAAgCiAAAEZQVFAAwAFwBhQEV1AoUCAnoQihACcBeAFwIUFyQXZBcDfw+PDwIbDysPaw8DNAsBNAoBOwMBAFoADaANAg0NGRRaAAYQBgIGE18HAxRfBhIAP+0/7QEvXe0SOS9d7TEwAF1dXV1dXV1dXQEUAg4BIyERITIeAgc0LgIrAREzMhIEZVCY3Yz+jgE3nvOmVcA4cqx1eaLUzgKwqP7/rlkFRU2i+qyHwHk5+/MBCgAAAQCiAAAEYgVFAAsAWkA7B0AKFEgHBwAKAwMACgEKCg0FCVoAABAAAgAIXw8FPwV/BY8FBG8FjwWfBb8F3wUFBQUJBF8BAwlfABIAP+0/7RI5L3Fy7QEvXe0yEjkvXTMvERI5LysxMDMRIRUhESEVIREhFaIDl/0oApz9ZAMBBUWc/lqa/jOcAAEAwgAABD0FRQAJAEdALQICBggICwEFWgAGEAYCBgRfPwF/AY8BAz8BbwGfAQMBQBUpSAEBBQBfBwMFEgA/P+0SOS8rXXLtAS9d7TISOS8SOS8xMAERIRUhESMRIRUBgQKk/Vy/A3sEqf4Snv3jBUWcAAAAAQBx/+wETwVaACkAiEBKCAIBFR4lHnUehR4EVRIBJycKJa8VARUVFBQAWsAl0CUCfyWPJQIAJQElJSs2HXYdhh22HQQdWzAKQApQCgMAChAKAgonXygoIA+4//BADg0RSBhfDxUVDwQgXwUTAD/tPzMvEO0rEjkv7QEvXXHtXRI5L11dXe0yLzMvXRESOS8xMABdXV0lDgMjIi4BAjU0Ej4BMzIeAhcHLgEjIg4CFRASMzI+AjcRITUhBE0kX3SJTobGgkA+gsiJZJdvSxirJotvWn5PI6msMFNDMQ3+2wHfhRg2LR5pugEBmacBAa9aNFl5RThueUWHx4L+9P7qERcZCQFQoAAAAQCiAAAEKgVFAAsAV0A8C1oIHwAvAD8AbwB/AAVvAH8AjwC/AAQAAA0HA1pwBAEABBAEoASwBAQEAl9QBwGgB7AHAgcHCQUDBAASAD8yPzM5L11x7QEvXXHtMhI5L11xM+0xMCERIREjETMRIREzEQNr/fa/vwIKvwJv/ZEFRf3KAjb6uwAAAAEAygAABAEFRQALAFlAOAYGAQ4EBwcAAAkOcAABAARaDwk/CY8JnwkETwlfCX8JjwnPCd8JBhAJAQkJDA0ECF8HEgMLXwADAD/tMj/tMhESATkvXV1x7cRdKxEBMxgvEE3kMi8xMBMhFSERIRUhNSERIcoDN/7EATz8yQE8/sQFRZz785ycBA0AAAAAAQCw/+wD2gVFABUAS7dlEHUQhRADC7j/6EAiDRFIExMIAFoREQgXgAkBCQkACBAIAggTXxQDDl8FCQkFEwA/My8Q7T/tAS9dMy9dERI5L+0SOS8xMAArXQEUDgIjIiYnNx4DMzI2NREhNSED2jNllmKrzCO7Cio6SSloaf7JAfUBpGSjcz6ywB9AXTwdj4oDCZwAAAEAogAABMsFRQALAJdANHQKhAoCRgpWCmYKA2QHdAeEBwONAAFrAHsAAkkAWQACOQoBFAoBASALEUgKAQtyCYIJAgm4/+BALQsPSAgJEAkJAAsQAAsQCwILCw0HA1oABBAEAgQCBwoBdgeGBwIHAQgFAwQAEgA/Mj8zOTldETMRMwEvXe0yETMvXTgzMy84MytdETk5ACsxMF1dAV1dXQBdAV1dIQEHESMRMxEBMwkBA+v+GaO/vwI84f4IAkUCfqn+KwVF/V8Cof3E/PcAAAABAO0AAARMBUUABQAmQBYEBAcDWi8APwACAAAQAAIAAQMDXwASAD/tPwEvXV3tEjkvMTAzETMRIRXtvwKgBUX7V5wAAAEAgQAABEsFRQAsAJm5AB7/6EATDRFIJh42HgIqGA0RSCkqOSoCDLj/8EAZCxFIDRALEUgNDCQkHCxcKgBAGRxIAAAuHrj/8EANChEATB4bXAAcEBwCHLj/wLMoLUgcuP/AQAkYHkgcBhUVHSS4/8BADA4RSCQNDSodAxwAEgA/Mj8zOS8zKxEzETMBLysrXe0yKxI5Lysz7RE5ETMzKysxMF0rXSshETQ2NzY3BgcOAQcDIwMuAycmJxYXHgEVESMRMxMeARcWFzY3PgE3EzMRA6kBAgIBEREOIQ6kiaYGDg8QCBITAQEBAaDtuQkXCwwNDgwLGAm54QNkM2osMzE3NS1kJv5KAbYPKS8xGDc8MDQtaTP8nAVF/hcXTSYsMS8rJU4ZAer6uwAAAAEAogAABCoFRQATAHhAJBJcABgJEUgAgBGQEdAR4BEEPxEBwBHQEQJvEX8RjxEDEREVCrj/6EAtCxFICgdccAgBAAgQCKAIsAgECIwBAXoBAWkBAREBCQODCwF1CwFmCwELAAgSAD8zM11dXT8zM11dXQEvXXHtMisSOS9dXXFxMyvtMTAhARYXHgEVESMRMwEmJy4BNREzEQNE/fgEBAMFqt4CEAUEBAWsBGorLSZZJ/yUBUX7jiguJ2IzA2D6uwAAAAACAGb/7ARmBVoAEQAdAHlAVnYdhh0CNB0BdhmGGQI0GQF5F4kXAjsXAXkTiRMCOxMBVhABRRABRg1WDQJJB1kHAkkDWQMCAFtfEgESQBkcSAASARISHxhbUAoBEAoBChVfDwQbXwUTAD/tP+0BL11x7RI5L10rce0xMABdXV1dXV1dXV1dXV1dARQCDgEjIi4BAjU0Ej4BMzIAAxACIyICERASMzISBGZGhL94f8CAQESCv3z3AQjJnpicnJ6Zo5QCqa3++rFZXrMBBaetAQKsVv6l/qoBDgEH/vn+8v7y/uwBGAACAKIAAARfBUUADgAZAFtAPmYXAXYAhgACSQ9ZD2kPAwBafw+PDwIPQBkcSAAPAQ8PGxQHWgAIEAigCLAIBAgGXxRACRFIFBQHE18JAwcSAD8/7RI5LyvtAS9d7TISOS9dK13tXV0xMABdARQOAiMhESMRITIeAgc0JisBETMyPgIEXzt5tnv+578BzH26fD7ApKT2/lJ5TyYDsVSbeEj9/gVFOmqVXn2B/e0rSmYAAAIAZv59BHEFWgAgACwAi0BiNSx1LIUsAzUodSiFKAM6JnomiiYDOiJ6IooiA2kReRGJEQNKBFoEAkYfVh8CRhxWHAIFWhQLCwBbIV8hASFAGRxIACEBFCEUIS4nW1AZARAZARkkXx4EBSpfFBMIYF8PAQ8AL13tP+0zP+0BL11x7RI5OS8vXStxEO0yLxDtMTAAXV1dXV1dXV0BFA4CBx4BMzI2NxUOASMiLgInLgM1NBI+ATMyAAMQAiMiAhEQEjMyEgRmM2KNWimGZRxAFyZbMVWBYUYbcKhxOESCv3z3AQjJnpicnJ6Zo5QCqZPrrG0WfnIIBYYJDTNfilcLZ7L5nK0BAqxW/qX+qgEOAQf++f7y/vL+7AEYAAAAAgCiAAAEmQVFABEAGwCXuQAa//CzDwBNELj/4EAjDxEATIkBAQsAAQAgDhFIABEQEREBBBABEBADdguGCwILWhK4/8BANhUYSH8SjxICABIBEhIdFgNaAAQQBKAEsAQEBBACXx8WfxYCPxZvFp8W7xYEFhYAFV8FAwQAEgA/Mj/tEjkvXXHtMgEvXe0yEjkvXV0r7V0ROS9dMzIvODMrXV0xMCsAKyEBIxEjESEyHgIVFA4CBwEDNCkBESEyPgIDvf6S7r8B4nizdzsnVIJbAZD4/tD+8AEYU3FFHwI//cEFRTNhilc+e2dMD/2rA83f/iooQ1oAAAABAE//7ARoBVoAPwCwQHk0PQFtLQFLHVsdAmsQAWAMAXQ+hD4CdD0BQD1QPQKGPAFEPFQ8AnY3hjcCdCeEJwIEIXQhhCEDVAsBiQcBegcBiwIBeQIBKlopKQBaABMBExMfQQlafwiPCAIINFoAHxAfAh80EwUvYCQqKiQEDl8FQAlQCQIJCQUTAD8zL10Q7T8zLxDtEjk5AS9d7dZd7RESOS9d7TIv7TEwAF1dXV1dXV1dXV1dXV0BXV1dXV0BFA4CIyIkJzceAzMyPgI1NC4CJy4FNTQ+AjMyHgIXBy4DIyIOAhUUHgIXHgUEaD5/w4bq/vskuQwwVHpVSHdVMEFqhUQyZl5RPSJIfqxkdKNxRBS8CytHZERQbEIdNVt5RTdwZ1lCJgFyVY9oOriuJTdaQSQbOlo/Rlg4IxENHSc1S2VDYIlXKClSeVAhM1A2HCE5Ti08SzEgEg4fKjlSbgAAAQBMAAAEgAVFAAcASkAxBw4BBAIOBAFaDwI/Ao8CnwK/As8CBk8CXwJ/Ao8CzwLfAgYQAgECAggJAARfBQMBEgA/P+0yERIBOS9dXXHtxisBGBBN5jEwAREjESE1IRUCxb7+RQQ0BKn7VwSpnJwAAAEAjv/sBD0FRQAZAF5ARGUVdRWFFQNlD3UPhQ8DAFqAF5AX0BfgF/AXBT8XAcAX0BcCfxePFwIXFxsNWo8KnwqvCgPPCgEAChAKAgoYCwMSXwUTAD/tPzMBL11dce0SOS9dXXFx7TEwAF1dARQOAiMiLgI1ETMRFB4CMzI+AjURMwQ9One1enSuczq/GT1pUFNvRB2+AeqJwns4NXW7hwNt/K1hilgoKFmQZwNGAAAAAQAKAAAEwgVFABAAgkBVDyAOEUgpDzkPAisPAXYDhgMCVANkAwI2A0YDAiQDAQABUg8JD14QABQQEAABAVIDCQNeAgEUAgEDAgkCEBABEBASfwKPAgICDwIDVQkBRAkBCQABEgA/MzNdXT8zAS9dETMvXRI5EADBhwUrhyvEhxgQK4crxDEwAV1dXV1dXSshIwEzAR4BFxYXNjc+ATcBMwLJxv4HyQFAEB0MDg0MDgweEAE+yQVF/HotYSowLy0wKWIvA4YAAAABAAAAAATMBUUAMgFMQBEhCAwATQIYEABNAhgLDABMELj/6LQLDABMGrj/8EAQEBEATDEYEQBNMRgLDABMFLj/8LQLDABMI7j/4EAcCw8ATCIYCw8ATCIQCgBNASALEQBMACAQEQBMALj/4LQNDgBMALj/4LQJCgBMErj/8EAREBEATBIoDQ4ATBIoCQoATBG4/+BAEwsRAEwiCTIJAgIECQEBAVIjKyO4AQdADAkBFAkBIxEBUiIaIrgBB0BICREUCQkRAAFSMSsxXjIAFDIyABIBUhQaFF4TEhQTEhQTKwkaAxMQMgEyMjQTCS8iTyJfIgMiIhoxEwMrGgABJBoBGhEBAxISAD8XM10RMxEzPzMSOS9dMwEvETMvXRIXORAAwYcFK4crxIcYECuHK8SHGBArhyvEAMGHBRgrhyvEAF1fXQErKysrKysrKysrKysrKysxMCsrKyshIwMuAycmJwYHDgMHAyMDMxMeARcWFzY3PgM3EzMTHgMXFhcyPgI3EzMD+tBoBQ4PDwcRERIRBw8PDgVq0NO9bQgLBQUEEBAHDg8OBm2vbQYODw4HEBABBgoMBmi9AYMTNDs/HkZMTUYePzszE/59BUX8vUF8MTkzRUMdPTw3FwGP/nEWODs9HUNGRGZ6NgNDAAABACQAAASpBUUACwDIQFwJCQELBgEJA1kDAikBAQQBAQMCBwABCAsECwYCBwkBCAoFCgYDAgcCCQABBwIBUgEIBwgBXgIHFAICBwUKAVILBAUEC14KBRQKBQsKEAogCgICCgIKAwYACQQIBLj/wEAYChxIBAQNCEALG0gIAAkDBgQBCAQSCgEDAD8zPzMSFzkBLysRMy8rEhc5OTkvL3EQAMGHBSsQAMGHBSsQxIcYECsQAMGHBSsQxBDAwBCHwMAQhwjACMAQhwjACMAxMAFdXQBdXV0JATMJASMJASMJATMCZgFNzf5NAdzN/or+i80B3P5NzQNEAgH9fP0/Aj39wwLBAoQAAAABACQAAASoBUUACACWQGg0BkQGVAYDXAcBOwdLBwIJBxkHKQcDUwUBNAVEBQIDAAUQBSAFAwwFBwgOAQQCDgUvBAEEBgFaDwI/Ao8CnwK/As8CBk8CXwJ/Ao8CBBACAQICCgkGA0AAUABgAAM/AAEAAAEHBAMBEgA/PzMSOS9dXTMzERIBOS9dXXHtOcZdMisBGBBN5jIxMF9eXV9dXV1dXQBdAREjEQEzCQEzAsS8/hzNAXYBdM0CSP24AkgC/f2dAmMAAQBJAAAEgwVFAAkAdUAmiQgBaQgBVwh3CAIpCDkISQgDBAgUCAIIAVIDAgNeBwgUBwgDBwS4/8CzDxRIALj/wEAdCQ5IBAcAAAcEAwsvAT8BTwEDAQcEXwUDAghfARIAP+0yP+0yAS9dEhc5Ly8vKysQAMGHBSuHK8QxMAFdXV1dXSkBNQEhNSEVASEEg/vGAzL9FwPC/M4DYY8EGpyL++IAAAABAZr+VwO9BcwABwAvQBwCBwcJBfJ/AI8AAj8AbwACAAABAAT1AQAF9QAbAD/tP+0BL11dXe0SOS8zMTABESEVIREhFQGaAiP+kQFv/lcHdYv5oYsAAAAAAQBz/+wEWgXMAAMAP0AdiwABegABOQBpAAIAAxADAwWFAgE2AmYCdgIDAgG4//C3AAEBAQIAABkAPz8BL104M11dEjkvODNdXV0xMAUBMwEDpPzPsgM1FAXg+iAAAAAAAQEO/lcDMQXMAAcAKUAXB/JgAgECAgkEAAAwAAIABPUFAAH1ABsAP+0/7QEvXTMSOS9d7TEwATUhESE1IREBDgFv/pECI/5XiwZfi/iLAAABAIUBugRGBUUABgBjQC+FBQF5BIkEAgUEAYwAASkAaQB5AAMAAQMGEAAGEAZwBoAGBAYGCGYCdgKGAgMCA7j/8EAPAAMBAwABEAECAgAAAQQDAD8zMy8yXQEvXTgzXRI5L104EjkzXV0RMzNdXTEwCQIjATMBA6z+t/66mAF6ywF8AboDI/zdA4v8dQAAAAAB//v/JATR/4QAAwAOtAMAALsBAC/tAS8vMTAHNSEVBQTW3GBgAAAAAQGSBLEDOgW0AAUAGkAOdAOEAwKABAEEAQOMAJMAP+0BL81dMTBdASU1MxcVAr7+1MXjBLHmHe8UAAAAAgCA/+wEiAROADIAQQClQD+KJAF6HooeAmk9eT2JPQMlNjU2AhMgCQxIBhcWFwIdCS0JPQkDBS0VLQIAAwEDAzBGGwxPOF84Ajg4FUMmRye4//hALcAnAScnP0cAFQEVOVEbGzMsDyYfJgIvJo8m/yYDJiYhUCwQM1ASAFEHBwwSFgA/MzMv7RDtP+0zL11xERI5L+0BL13tMy9dOO0REjkvXTMz7TIvXTEwAF1dXStdXV1dJTI2NxUOASMiLgInIw4DIyImNTQ+Aj8BNTQuAiMiDgIHJz4DMzIWFREUFiUyPgI9AQcOAxUUFgRNDx4OIkMmM0kuGAMGHERYckqeoE+Ao1TsGzdUODJROiUGvAo3ZJdryMkq/dpTelEovjdvWThZbwQDcAgIGzdRNjRUOyCslmuJTh8BBDtDXjobDydDMxFAa04ru7H+LlBRBj9gdDVZBAEPMFtMUmQAAgCz/+wEQgXMACAANABhQEJ6AooCAkQzVDNkMwNLI1sjayMDOgUBNRwBBR8VH3UfhR8EAEdgIQEhITYrBhRGABOAEwITJlAaHhATAA0VMFAGAxYAPzPtPz8/M+0BL13tMjISOS9d7TEwAF1dXV1dXQEQAiMiJicjFA4CByM+AzURMxEUBgcGBzM+ATMyEgM0LgIjIg4CFRQeAjMyPgIEQsu9dKowAgIDAwGuAQICAbQBAQEBBDCpdcPEuh4/X0JCakkoKElpQT9gQCECIv7k/uZWYho3LiEECSs8SCcE7f5ZHTkWGhdpX/7r/uFwoWcxLWepfHeeXycuZqMAAQCC/+wEOAROACUAnUBSZBYBZBABeR6JHgJkGgFEFVQVAksRWxECdQiFCAILRwoKHEc/G08bjxufG68bBc8b3xv/GwNgGwEbGycTRwAAAQBwGwEAGxAbYBtwG4AbwBsGG7j/wEAcGx5IGxsYUCEWDlAFHwt/C48LAwtAGx5ICwsFEAA/My8rXRDtP+0zLytdcQEvXe0SOS9dXXHtMi/tMTAAXV1dXV0BXV0TND4CMzIeAhcHLgEjIg4CFRQeAjMyNjcXDgMjIi4CglaNtF9imm9GDcAQgHZWdUcfH0d1VWyOEb4JRHKeZIm/dzYCHqPYgDUyV3ZEDltpN2mbZGSfbjpqbQxDfF45VpfNAAIAiv/mBBkFzAAfADMAa0BLRCJUImQiA0syWzJrMgM6AWoBAjUKAQUHFQd1B4UHBAoEGgR6BIoEBBNGKgBQEgGQEqASAhISNSBHAAYBBhoVEgAvUAsIECVQAAMWAD8z7T8z7T8/AS9d7RI5L11xMzPtMTAAXV1dXV1dJQ4BIyICERAhMhYXMzQmNCY1ETMRFB4CFyMuAzUBFB4CMzI+AjU0LgIjIg4CA14xonnKvgGIeaMxAgEBtAECAgGsAQQDAv3hHT1gQ0VrSSUlSGpFQGA/IK5pXwEWARgCNlZiBSoyLQkBo/sTJ0g8KwkEJDI6GgFscKBoMTBpqHh0nWAqLmajAAAAAgCF/+wERgROACAAKwCQQGVkJAFkAwFJKVkpaSkDSSRZJAJ1HYUdAncchxwCeA6IDgJ6DYoNAkQCVAJkAgMnRx8fC0nPCt8K/woDAAoQCmAKAwoKLSYARwAV4BUCFQBQJiYFIVAaEAVQEN8K7woCgAoBCgoQFgA/My9dXRDtP+0SOS/tAS9d7TISOS9dXe0yL+0xMABdXV1dXV1dAV1dARQeAjMyPgI3Fw4DIyIuAjU0PgIzMh4CHQEBIg4CByEuAwFCJkxxSjddSjIMnhBAaphoc7Z+Q0+Gr2CDtXIz/iUuZVY7AwJICDRNYgH3VY9nORksPSQtLVtJL0iO1Y2c1II4VJfUgBgB0h1Kf2JefkwgAAAAAQCKAAAESwXMAB8AXrkACv/wQDYJDEgdAUYCPwUBBQUGAh4eES8CPwJvAn8CjwIFAkAUJUgAAgECEQIRICEXUAwAAARQHQUPARUAPz8z7TI/7RESATk5Ly9dK10RMy8RMzMvXRDtMjEwACsBESMRITUhNTQ+AjMyHgIXFS4DIyIOAh0BIRUCRLT++gEGLWSfch1QUEcVEkhPSBNCYkAfAesDrPxUA6yOGWWPWyoDBggEkQMGBQMUNl5LCo4AAAAAAgCP/lgEHgRLADEARQCcQD56MIowAmY/AUUMVQxlDANLOls6azoDNSEBBR0VHXUdhR0EChcaF3oXihcEL0YyIlAOAZAOoA4CDg4aRwZGBbr/8AAF/8BAKA8VSAUFPEewGgEAGtAaAhooDzdQIh8QQVAPFRUJUAAgBjAGAgYGABsAPzIvXRDtPzPtPzPtPwEvXXHtMy8rOO0REjkvXXEzM+0xMABdXV1dXV1dASIuAic3HgEzMj4CPQEjDgMjIi4CNTQ+AjMyFhczND4CNzMOAxURFAYTNC4CIyIOAhUUHgIzMj4CAmdaiWM9DbgRcVw5W0EjAhM7U25IZpBcKytfmG5xpy0DAwMFAasBAgIB1CEwT2U1Q2JAHh4/YUI1ZlAx/lgmR2I8GUtRIkt4VsIoTDojQobKh4PMjUppYRk+NygDCSs8SSf8xuPlA89xnmMsLWOdcXWcXicrYJsAAQC5AAAEGQXMAB8AP0AncA6ADgIEDRQNdA2EDQQRRhISIQUCHkYAH4AfAh8fERUYUAULEAAAAD8/M+0/MwEvXe0yMhI5L+0xMABdXRMzERQGBzM+AzMyHgIVESMRNC4CIyIOAhURI7m1BgMDGEBSaUBTglovtSE7UDA7Z00stAXM/noyZS4vTDUdLFyQZf0vArdQZz0YLVV9Uf2NAAAAAAIAjwAABGUFzAAJAA0AQEAiBwcFBAQFC0oMDAEBAEagBQEFBQ4PClMLAAdQCA8ABFADFQA/7TI/7T/tERIBOS9x7TIvMi/tETMvEjkvMTAlIRUhNSERITUhJzUzFQLpAXz8KgGm/sEB88jIjo6OAx6O0sDAAAAAAAIAdf5XA0QFzAAZAB0ARUAodROFEwIKAxoDAhgYChUaSh0dAEYAFQEVFR4fChpTGwAXUBgPEFAFGwA/7T/tP+0BLxESOS9d7TIv7RESOS8xMABdXQUUDgIjIi4CJzUeAzMyPgI1ESE1ISc1MxUDREd2nFYpUkxBGBY8SE8oOGFIKf5pAkvIyBxtl18qBwwPCYwFDAoHHD1fQwPFjtLAwAABAOwAAARlBcwACwCvQCxmB3YHhgcDZAl0CYQJA3sBiwECSQFZAWkBA0kIWQgCawB7AIsAA0kAWQACCrj/6EAoCxFIAQoICRBECVQJAgkJAJ8Lrwu/CwMACxALAgsQCwsNBwNGAAQBBLj/wLMfJUgEuP/AsxYbSAS4/8BAEQ0RSAQCBwoBBwEIDwUABAAVAD8yPz85OREzETMBLysrK13tMhEzLzhdXTMzL104Mzk5MTArXV1dAF1dAV0AXSEBBxEjETMRATMJAQOS/pKEtLQB29P+SQHOAfNi/m8FzPxhAg3+L/2XAAAAAQCGAAAEXAXMAAkAM0AaCAgFBAQFAQEARqAFAQUFCgsHUAgAAARQAxUAP+0yP+0REgE5L3HtMi8RMy8SOS8xMCUhFSE1IREhNSEC4AF8/CoBpv7fAdWOjo4EsI4AAAAAAQBjAAAEZAROADkAjrkAKv/QswkPSCC4/9BAWQkNSCI5SAAADS5Ivy/PL/8vA2AvcC8CHy8vLz8vA08vXy9/L48vBBAvIC8wLwMvLzsZDEgADRANAvANAQ8NPw0Czw3fDQIQDQENNQZQGSIoAx8QEw8vDQAVAD8yMj8/FzPtMgEvXV1xcXLtMhI5L11dcXFx7RI5L+05MTAAKyshETQuAiMiDgIVESMRNC4CJzMeAxUzPgMzMhYXMz4DMzIeAhURIxE0LgIjIgYVEQITDBsrICE0JhSpAQICAZUBAgIBAg0kM0YuWFcTAhIrOEgvPVQ0F6gMGysgQk0Crk9qQRszXYNR/aEDUyJLQzAHBSk1OBQnRzYfYGQvSTIaLFyQZf0vAq5PakEbqKj9jQAAAQCzAAAEGQROACUAPUAmcCKAIgIEIRQhdCGEIQQlRgAAJxkMRgANgA0CDRkGUB8QEw8NABUAPzI/P+0zAS9d7TISOS/tMTAAXV0hETQuAiMiDgIVESMRNC4CJzMeAxUzPgMzMh4CFREDZCE7UDA7Z00stAECAgGqAQIDAgMYQVVqQlOAVy0Ct1BnPRgtVX1R/Y0DUyJLQzAHBSw5OxQvTDUdLFyQZf0vAAAAAAIAgv/sBEkETgAPACMAWUA9ZCIBRiJWIgJkHAFGHFYcAmsYAUkYWRgCaxIBSRJZEgIAR68QAQAQEBBgEAMQECUaRwAKAQoVUA0QH1AFFgA/7T/tAS9d7RI5L11x7TEwAF1dXV1dXV1dARQOAiMiLgI1EBIzMhIDNC4CIyIOAhUUHgIzMj4CBElDfrVybbF9RP3o9O69K01qQEFuTy0vT2k5QW9QLQIejtOMRUSM048BFwEZ/ur+5n6kYicpY6R7fqViKCdipgAAAgCz/lcEQgRQACgAPABlQERkOwFGO1Y7AmsrAUkrWSsCBiYWJnYmhiYENCEBOwgBeQOJAwIAR2ApASkpPjMeEUYAEoASAhIuUB4kEBgPERs4UAoFFgA/M+0/Pz8z7QEvXe0yMhI5L13tMTAAXV1dXV1dXV0BFA4CIyIuAicjHgMVESMRNC4CJzMeAxUzPgMzMh4CBzQuAiMiDgIVFB4CMzI+AgRCKFyWbjdkVkMXBQEBAQG1AQICAa8BAwMDBBk/UGQ+bpZcKLoYO2FJO2hNLSVIakRJYjsZAiJ70JZVFCxGMgIfLjod/lkFAyhKOyoJAyU0PBo0TDEXUJPOfWScazglYayHc51hKjluogAAAAACAIr+VwQaBEoAJAA4AGZAR0stWy1rLQNEMVQxZDEDOhwBNQMBBSQVJHUkhSQECiAaIHogiiAEEkYlBVATAZAToBMCExM6L0cAIgEiNFAZHxYSGypQBQAQAD8y7T8/M+0BL13tEjkvXXEzM+0xMABdXV1dXV0BMh4CFzM0PgI3Mw4DFREjETQ2NzY3Iw4DIyICERASATQuAiMiDgIVFB4CMzI+AgIRQmZPPRgCAwMFAa8BAgIBtQEBAQECGT9RZUHKvsMCEihKaUFEYT0dHDxgRTtoTi0EShYuRS8ZOTEjAwkoRGJD+zYBtxo6Gh4cM041GgEZARUBGQEd/eB3nl4oM2mhbmqfajYnY6sAAQDyAAAEFQROAB8ARkAreAaIBgIEGhQaAgQZFBkCHx8hFglGChAQHwpvCn8KjwoEChYDUhwQEA8JFQA/Pz/tMwEvXTN8LxgQ7TISOS8xMABdXV0BLgEjIg4CFREjETQuAiczHgMXMz4DMzIWFwQVL2c+VIZcMbQMEBIGqwcPDgoCBRw+VXRSOGwqA5YIC0R1nFj+BAK9OHRnUhgYPkNEHT5kRiYKBwAAAQCn/+wEJARLADgAhUBYbBgBeReJFwJsFwFqNgFzMYMxAkcxVzECJDcBKh0BCgMaAwIFIBUgAihJJycASBUVHzoLSQoKL0gAH2AfcB+AHwQfLxUFLVAiICiQKAIoKCIQEFAFCwsFFgA/My8Q7T8zL10Q7RI5OQEvXe0zL+0REjkv7TIv7TEwAF1dXV1dXV1dXV0BFA4CIyIuAic3HgMzMj4CNTQuAicuAzU0NjMyHgIXBy4DIyIVFB4CFx4DBCQ7cKNpXpdyTRKfDDVLYjk6Y0gpM1h5R0B+Yz3UyU+KbEkOogcuQ1Qu9StObEFBiXFJATVMelUuGz5nTB83QSILESlBMDI9Kh4TEShBZE2Tph0/Y0UULTghDJcuOSYbERAqRm0AAAEAvv/wA/kFVAAbAFhANmoYehiKGAMYKAkOSAYGEhIdBQlGGpABAQEBAhpAEiVIGkALDkgAGgEaDFAXFggAUAEDAwUBDwA/MzMvEO0yP+0BL10rKzMzL10Q7TISOS8zLzEwACtdEzUzEzMRIRUhERQWMzI+AjcVDgMjIiY1Eb6qOngBsP5QVWEoVU9FGBZGV2Y2oqIDrI4BGv7mjv10T0wHCgwFiQYQDgqJlAKfAAAAAQC5/+wEHwQ6ACUARUAsfyKPIgJ7IYshAgohGiEqIQM5HAEZDkYLCycBRgAkgCQCJBkGUB8WFBUMAA8APzI/P+0zAS9d7RI5L+0zMTAAXV1dXQERFB4CMzI+AjURMxEUHgIXIy4DNSMOAyMiLgI1EQFtFzVVP0BnSSe1AQICAaoBAgMCAxo+UmpGWoJUJwQ6/VJPakEbLVV9UQJz/K0iS0MwBwUsOTsUL0w1HSxckWQC0QAAAQBFAAAEhwQ6ABAAlEBCVgQBSQ5ZDgIbD1sPAgkPASUDVQMCBgMWAwIoAWgBAgABUg8JD0sQABQQEAABAVIDCQNLAgEUAgEDAgkCcBCAEAIQuP/AQB4KDkgQEBICQAsOSAIPAg9VCQFECQEqCToJAgkAARUAPzMzXV1dPzMBLysRMy8rXRI5EADBhwUrhyvEhxgQK4crxDEwAV1dXV1dXV0hIwEzAR4DFz4DNwEzAsvV/k/KAQwIEhQRBgYTFBUIARTJBDr9QBY/RD8VFT9CPxYCwgABABUAAAS4BDoAKgFSQBB0HoQeAkYeVh4CJB40HgIduP/gQEoTGEiQHQFlHXUdhR0DJB00HQIGHRYdAhwgExhInxwBaxx7HIscAx0cLRw9HAMLHAF7G4sbAhsgCw5IDiANEUgaDioOOg4DCw4BDbj/4EAfExhIkA0BJQ01DXUNhQ0EASATGEifAQEqAToBegEDALj/4EBwDRFIFQAlADUAAwMGAAEOAVIQFhBLDw4UDw8ODQFSHBYcTAcNFAcNAQFSHSMdTAcBFAcBHQcAAVIpIylLKgAUKgAjBxYDDxQqdCqEKgMqKiwPKmYHATIHAQIHHBwWKSoQAw8PIxZ1FoUWAhYNAQAOFQA/MzMzM10RMz8XMxI5LzNfXV0vAS8RMy9dEhc5hyuHK8QQAMGHBRgrhyvEhxgrhyvEhxgQK4crxDEwAV1fXStdXStdXStdXSsrXV1dXV0rXV1dXStdXV0hIwMuAScmJwYHDgEHAyMDMxMeAxU2Nz4BNxMzEx4BFxYXND4CNxMzA/rMjwgUCQsJCQsJFAqUy7eyXQMLCwgLCwkUB4fBggYTCQsKCAwMA2WwAdcbRSAlJSUkH0cf/i0EOv2hGFVgXB0tKSNJFAGo/lcURyMpLh5aX1YZAl8AAAABAF4AAARtBDoACwC5QHBHBAF2B4YHAjkBeQGJAQN2CAEZCFkIAgoCCQcDCAYLBgECCQQDCAUABQoBAgkCBwQDAgkBUggDAgMISwkCFAkJAgABUgYLBksFABQFAAYFCgEHBAQDCwkJEAtwC4ALAwsLDQUFAwcKBAEECAUPAwAVAD8yPzMXOQEvMy8RMy9dMy8REhc5EADBhwUrhyvEhxgQKxAAwYcFKxDEEMDAEIfAwBCHCMAIwBCHCMAIwDEwAV1dAF1dAV0hCQEjCQEzCQEzCQEDpP6//r3CAZ/+c8cBLAEqyf5zAaQBvP5EAiwCDv5bAaX99P3SAAEAQv5XBIkEOgAfAK9AUh4YDxJIZRJ1EoUSA0kdWR0CAyANEUgtAz0DAisCOwICAEgMSXUAhQACJgBmAAJqEHoQihADSRBZEAIAEBhpGHkYiRgDGBAJDEgYHwgIER4fEB+4/8C3ChFIHx8hEhG4//BAChFACw9IEYIYARi4/+BADQ0QSBgQEB4RDwxQBRsAP+0/MzkvMytdAS8rODMRMy8rODMSOS8SOStdETMzXV1dXTEwACtdXSsBXV0rIQ4DIyImJzUeATMyNj8BATMBHgMXPgM3EzMCwSVQYnhOIjogEzART4swEv4qwAEICyAeFwIDFx4fDPy+Yp1vOwQHhwMDdoExBC/9fhtPTT4JCz1LTx0CgQAAAAABAJMAAAQsBDoACQBYQDcGBxYHJgdWBwQHAVICAQJLBgcUBgcCBmAGAQMGCAgGAwMLnwGvAb8BAwABAQEGA1AEDwEHUAAVAD/tMj/tMgEvXV0SFzkvLy9dEADBhwUrhyvEMTABXTM1ASE1IRUBIRWTAqn9fwNM/VYCz4kDJouJ/NqLAAABAOP+VwQlBcwAMQB1QBJ2D4YPAmkIeQiJCAMCGAkMSBS4/+BANwkMSBiAMQExMTMgLPEFJQU/DAEMDBF/BQEABQEFJQv1DwxPDG8MA48MrwwCDAwwGfUYADD1ABsAP+0/7RI5L11x7TkBL11dMzMvXRI5EO0yEjkvXTMxMAArK11dASIuAjURNC4CJzU+AzURND4CMyEVIyIOAhURFA4CBxUeAxURFBY7ARUDHEFsTisvTmMzM2NOLytObEEBCdUtQSoTKUJTKStTQShQW9X+VyxQb0QBXz9XNhoCiQIaN1Y+AWBGcE8qixUuSjb+pjlcRSwKAgotRF06/qVqWYsAAQIT/lcCuQXMAAMAF0AKA6sAAAQFAQAAGwA/PxESATkv7TEwAREzEQITpv5XB3X4iwAAAAEAp/5XA+kFzAAxAHNADXYihiICaSl5KYkpAxy4/+BAPQkNSC8YCQ1ICzAlASUlICzxEQUFMxlPAH8AjwADAAABAAsm9Q8lLyVPJW8lBI8lryUCJSUBGPUZAAH1ABsAP+0/7RI5L11x7TkBL11dMxI5LzPtMjIvXTkxMAArK11dEzUzMjY1ETQ+Ajc1LgM1ETQuAisBNSEyHgIVERQeAhcVDgMVERQOAiOn1VtRKEFSKylSQikUKkEt1QEJQWxOKy9OYzMzY04vK05sQf5Xi1lqAVs6XUQtCgIKLEVcOQFaNkouFYsqT3BG/qA+VjcaAokCGjZXP/6hRG9QLAAAAAABAGwCKQRgAycAIABdQBoWBCYENgRmBJYEpgQGEDAJFABMETAJFABMHrj/wEAlCRQATB8wCRQATA0iEB0BHRitDQBAFxxIAEAJDEgAHQqtDxMBEwAvXe0z3SsrMu0BL10QzjEwKwArKytdATIeAhceAzMyNjcVDgMjIiYnJiMiDgIHNT4BAXMpT01LJRUyMzMXRXs0Hzw9RChFkUmBWCZBPDgdMoQDJw0UGg0HEA4IMiqVFh8TCCwaLQwXIBWPJi4AAAAAAgID/vYCyQQ6AAMABwAsQBUCBJgDAAcQBwIHBwgJAAADBp0HDwO4AQ4APz/tETkvERIBOS9dM+0yMTABMxMjExUjNQIblBjExsICrfxJBUTJyQAAAgCF/8MERgVjAAgALwCTQGBoEIgQAkQoVCgCSiZaJgIbDEkYDQ0TBiBHISEGRgAFEAUCBQUrJ0YAExAT4BPwEwQTJFAYHyF/IY8hAyEhGxgLDiAFAQAFEAVgBXAFgAXABQYFBQBQDhgOGA4MDxkBGQwALy9dEjk5Ly8Q7TMvXXERMxEzMy9dEO0BL13tEjkvXe0zL+0REjkvM+0yMTAAXV1dAREGBwYVFBcWExE2Nz4CNxcOAwcVIzUuAzU0PgI3NTMVHgMXByYnJgI6bkBQVEHpFRMuSC8Jtgk6Y4xagG6kbTY6cKNogFaFYT0NuRFCLgESAwsQT2W9xmROAvr89AMGDjZRNgw+dFw+CMPDCFOJuG52v4pTCbi4BzdWbz8OWzYnAAEAOAAABJMFWgA2AJxAYgMYDA9IBhQBG28iKS1vEE8iXyICfwyPDAIPKgEMKiIiKgwDBgBvADYBNjY4Mm4GDw8GQBckSAAGEAYCBiwOcykfDwE/D28Pnw/PD98P7w8GDw8yJXMWIiIWBwcycwY2NgYYAD8zLxDtMj8zLxDtEjkvXXEz7TIBfC9dKzMYLxDtEjl9L10Y7RIXOS8vL11dXTPtMhDtMTAAXSslDgMjITU+Az0BIzUzNTQ+AjMyHgIXMg4CBwYHLgEjIgYdASEVIRUUDgIHITI2NwSTCSA2UTr8jytIMx26ujNon2xKfmVIEgEOGB8RJzIWdU56eAGY/mgPJDwsAlg7OQvwK1ZEK5oWMEZmS42O3FyTZjcdOlY5BggKBQwQP0BzfdiOiztgTTwXNTUAAgCeAOEELwRzACMANwDqQJ1JIlkiAi0iPSICSR1ZHQItHT0dAkkZWRkCLRk9GQJGFFYUAiIUMhQCRhBWEAIiEDIQAkYLVgsCIgsyCwJGB1YHAiIHMgcCSQJZAgItAj0CAgMhBh4MGA8VFRgeIQQADhYWEqpvLgEQLgEuLgA5BCAgJKoAABAAgAADAAwGDwMVIRgeHiEDBgQJGxcfHymwQBtgGwI/GwEbDQUFM7AJAC/tMy8zL11d7TMvMxESFzkRMxEzETMRMwEvXe0zLzMREjkvXV3tMi8zERc5ETMRMxEzETMxMF1dAF1dXV0BXV1dXQBdXV1dAV1dEzQ2Nyc3Fz4BMzIWFzcXBx4BFRQGBxcHJw4BIyImJwcnNy4BNxQeAjMyPgI1NC4CIyIOArYpJWRoYzZ/SUd+NmFoYCUrLCZkZmU2fkdIgDRpZmYlKZotTGY6OWZNLCxNZjk6ZkwtAqxHfzZkZ2UnKyomYWlgNn9HR4A1ZGllJSkqJmlpZjZ/STpmTCwsTGY6OmZNLCxNZgAAAAABADQAAASYBUUAFgCzQG9dFQFLFQEZFSkVORUDUhMBA0ATARQTJBM0EwMAAEAAUAADDxFPEV8RAwwEAQYGFggQCwsSCRUWDggSCQ4TLxIBEhQEAAhcEQ1PCV8JfwmPCQQQCQEJCRcYBwtgDAQMAw9gEBQAEAwQDBAIFRIDCBIAPz8zEjk5Ly8RMzMQ7TIRMxDtMhESATkvXV0zM+0yMjnEXTIrARgQTeQyERI5LzMREjkvMzEwX15dXV1dX11dXV0BIRUhFSEVIREjESE1ITchNSEBMwkBMwL8AUH+gQF//oGy/oMBfQL+gQFA/mXHAWkBbccCp46JkP8AAQCQiY4Cnv2XAmkAAAACAhP+OQK5Ba4AAwAHACVAEQMHqwAEBAgJBQAFAAEEGwEAAD8/Ejk5Ly8REgE5LzPtMjEwAREzEQMRMxECE6ampgKkAwr89vuVAwv89QAAAAIAn/9UBCwFzABNAGEBBUBzcxCDEAJpVgF1YIVgAkNfU18CQ1tTWwJDWlNac1qDWgRDPlM+AmoVehWKFQMqFEoUWhQDKlFKUVpRalEEKlABUBgNEUgqSAFsOXw5jDkDKjkBBR8VHwIKJBokAgVNFU0CXR0iWElBRlNODklLBkkFN0kiS7j/wEBAEhlIQUsFIiIFS0EELBhJAE4QTgJOTmMtSQAsASxTE0ZdPB12RoZGAmpGAUYdADJRJyAtgC0CLS0nC1EABgYAAAA/Mi8Q7S8zL10Q7RI5OV1dETMzETMzAS9d7RI5L13tERc5Ly8vLysQ7RDtEO0SOTkQ7RE5OTEwAF1dXV1dXStdXV1dXV1dXV1dXQEyHgIXBy4DIyIGFRQeAhceAxUUDgIHHgMVFA4CIyIuAic3HgMzMj4CNTQuAicuAzU0PgI3LgM1NDYBNC4CJw4DFRQeAhc+AwJ4T4psSQ+hCC5DVS59gTJTbTtEi3BGHDdSNjFPNx46cKRrXZp1TxOhDDdOYzk6Zk0sOV97QUGDaEEgO1Q1Kks5IdMB4TVYcT06WTwfMVJsPDZdRCcFzB4/YkUULT0lEVlHLUAuIA4QLklqTC1XSTcNFTNAUTNJdVMsG0BoTR83RykQFS1ELzZJMyMQDy5JakktU0c1Dw4uQFAwi5v8yzBFMyMOAyE0RScuQjAiDwEYL0YAAAIBTwTDA3wFewADAAcAMUAfA4UAAAeFEAQBBAUBkAQPAD8AXwCvAL8ABQBAFh5IAAAvK10y7TIBL13tMy/tMTABNTMVITUzFQLZo/3TpQTDuLi4uAAAAAADAB8AJgStBcwAKQA9AFEBHEB3e1CLUAJ0SoRKAnZPhk8CdkuGSwJ0RoRGAntAi0ACeUWJRQJ5QYlBAgNQE1ACA0oTSgIMEhwSLBIDAxgTGCMYA2YAdgCGAAMAxBUKIMYfCx9wH4AfAg8fHx8CLxU/FQIVQBAUSBUfFR80PhANEUg+wxAqASoqU0i4//BAVw0RSEjDNDAKQAqwCsAK0AoFMAqwCsAKAwoKBckQJckaICAafxCPEO8Q/xAEUBqwGsAaAwAaEBpwGoAaBBAaEBpNaUN5Q4lDA0PIOQBmTXZNhk0DTcgv0AA/7V0/7V0SOTkvL11xXREzLxDtEO0zL11xAS/tKxEzL13tKxE5OS8vK11dXREzEO0yEO1dMTAAXV1dXV1dAV1dAF1dAV1dARQeAjMyPgI3Fw4DIyIuAjU0PgIzMh4CFwcuAyMiDgIFFAIOASMiLgECNTQSPgEzMh4BEgc0LgIjIg4CFRQeAjMyPgIBjhw4VDgpPy8hDHMTNEpjQ1qFVysrVoJXQ2NIMRByCiAuPCc6UzUZAx9bntV5eNSfXFye1Hl51Z5bXE2GsmZlsoRNTYSyZWayhk0C+0h4VjAbLTgcIytRPyZAcp5eYpxvOyQ7SychGjImFy5Tdkq7/u+yVVWyARG7uwERsVZWsf7vu6fumEdHmO6nqO+YRkaY7wACAM4CiwP9BZgAKgA7AHq5AAP/6LMJDEgUuP/YQDcJDUgiKAkRSCkYDRFIKSgJDEgeHhfiJAYANQE1NQA9DeMODivjAAAQAAIAGjDkKDbkBQUTJCEouAEWtA0NCuQTuAEVAD/tMy8/MzMSOS/tEO0yAS9d7TMv7RESOS9dMzPtMi8xMAArKysrKxM0PgI/ATU0JiMiBgcnPgMzMhYVERQWMzI2NxUOASMiJicjDgEjIiY3FB4CMzI+Aj0BBw4Dzjpjgke/XlZUXAuVCDBUeU+Zph8rDBwJFzgXUksDBCuSZnmJkxImOSc7XEEimjJaRCgDZkVcOBgBBCtdWURNCi9SPiOGhf7dOjwFA14GB1VLTVlyfRwyJhYtRFElMwQBDR41AAAAAgB/AI0EYAOsAAgAEQBQQCsA6wgD6wTsBusBARMKCesRDOsN7A/rAAoBCgsCCgEMCQABAg8DBgYD7wDuAD/kOT0vFzMRMzIRMxEzARgvXe397dTtERI5L+397dTtMTAlATUBMxUJARUhATUBMxUJARUDrP6uAVKy/q4BVP1v/rABULH+sQFRjQFtPwFzH/6M/pEdAW0/AXMf/oz+kR0AAAEAdAC0BFcC8gAFACFAEgCqBQcAAhACAgI/AAEAAq0DswA//cZdAS9dEN7tMTAlESE1IREDxvyuA+O0AayS/cIAAAAABAAfACYErQXMABMAJwA1AD4A7EApeyaLJgJ0IIQgAnYlhiUCdiGGIQJ0HIQcAnsWixYCeRuJGwJ5F4kXAi+4/9hAFQsRSDMoCQxIAyYTJgIDIBMgAjQpKbj/8EAmKTE7K8QsKDUQNTUxxDZwNoA2Aiw2LDYKFBANEUgUwxAAAQAAQB64//BAMg0RSB7DCigsNCrIOzrILQAtEC0CLDstLTssAyNpGXkZiRkDGcgPAGYjdiOGIwMjyAXQAD/tXT/tXRIXOS8vL10Q7RDtMhEzAS/tKxEzL13tKxE5OS8vXRDtMi84MxDtMhE5OBEzMTAAXV0rK11dAV1dAF1dAV1dARQCDgEjIi4BAjU0Ej4BMzIeARIHNC4CIyIOAhUUHgIzMj4CBQMjESMRITIWFRQGBxMDNCYrAREzMjYErVue1Xl41J9cXJ7UeXnVnltcTYayZmWyhE1NhLJlZrKGTf7ex6F/ATOOl2hV3Z9fUaq2UFQC+bv+77JVVbIBEbu7ARGxVlax/u+7p+6YR0eY7qeo75hGRpjv+gFQ/rADP35vZnsT/qICUEVI/tNVAP////sF8gTRBlISBwBCAAAGzgAAAAIBRwMgA4UFWgATACcASrkAEf/oswkMSA24/+hAJgkMSAcYCQxIAxgJDEgUrAAAHqwAChAKgAoDCiOvAAUBBQUZrw8EAD/tMy9d7QEvXe0zL+0xMAArKysrARQOAiMiLgI1ND4CMzIeAgc0LgIjIg4CFRQeAjMyPgIDhS1OaTs7aE4uLk5oOztpTi1tGzBBJiVBMBwcMEElJkEwGwQ9O2hNLS1NaDs8aE0sLE1oPCZBMRwcMUEmJUExHR0xQQAAAAIAdAAABFcEwwALAA8AakA3DwwECw4BBAIOBAkBqgYAAgEKAwICEBENrUAMAg4EBwUOLwc/B48HA48HnwffB+8HBAcABK0JBbj/wLMTFkgFAC8rM+0yxl1xKwAYEE3mLxrtERIBOS9fXl0z7TLGKwEYEE3mETMyMTABESMRITUhETMRIRUBNSEVAq+T/lgBqJMBqPwdA+MCqP51AYuRAYr+dpH9WJGRAAEBOAIzA5QFjQAgAFO1WgJqAgIVuP/YQCgJDkgfHxfhbwiPCAIICAAiDuAPDwAeHgAAEAACAA4OC+QU3gEe5ADdAD/tMj/tMy8BL10zLxEzL+0REjkvXe0yLzEwACsBXQEnPgU1NCYjIgYHJz4DMzIWFRQOBAchFwE6AhtYZGdSNEdKRFgIhQYuTGxDg5E2VWdjUxYBywICM2c9X1BHSVIyPktJRAgzV0Alf3A9YlJJSU4vawAAAAABATICJwOZBY0ANQB7uQAq/+hAIAkPSAIoCQxIMC0WIuEjIwgt4RxPFl8WAhYcFhwIAOEPuP/AQCIJDEgPDzcJ4QAIEAgCCDAV5BYWDCgiIh/kKN4M5AMJCQPfAD8zLxDtP+0zLxESOS/tOQEvXe0SOS8r7RI5OS8vXRDtETMv7RESOTEwACsrARQGIyIuAic3HgEzMjY1NC4CKwE1MzI+AjU0JiMiBgcnPgMzMh4CFRQGBxUeAwOZm45XdEkkBogJWFVNUyU4Qx09OR09MiBKR0RUBocHMk9nOkVoRiNWWjRLMBYDG3SAJ0BRKw1DRUhMLTYdCW0NHzUoPEVGQQw6VjkcITtPLktuFAIFJTZEAAEBkgSxAzoFtAAFABpADnsCiwICgAMBAwACjAWTAD/tAS/NXTEwXQE1NzMVBQGS48X+1ASxFO8d5gAAAAEAkP53BDwEOgAnAGhAGAsQDxJIOQcBIkYFEB8gHwJgH8Af0B8DH7j/wEAqJFNIHx8pFQ0RRhJAJ1NIEkAcI0gSQBIVSAASARIgEw8SGxpQDAUJFgAVAD8/MzPtPz8zAS9dKysr7TIyEjkvK11xM+0xMABdKyEuAzUjDgEjIiYnIx4BFREjETMRFB4CMzI+AjURMxEUHgIXA5QBAwMDBDWnclKAIAQDAba2Gz9lSUNwUi61AQICAQYxPj8TbW5AOiA/G/6LBcP9fEV0VS80W35LAmn8ryJMQzEHAAABAH/+vAQ4BUUAEwBBQBgFmgAGAQYGDAITEwGaAgIVAAwQDAIMBBO4ARC3EgcHARIDBgEALzM/EjkvEO0yAS9dEjkv7TIvERI5L13tMTABESMRIxEjESIuAjU0PgIzIRUDt4TFhVCFYDUyX4pXAkcEy/nxBg/58QO+LViGWFSFXTJ6AP//AfABpALbAs8SBgI3AAAAAQB3/kQB4wAAABsAUrkAGv/oQC8PE0hEGlQaAgMYDRNIGBkZFxZACQxIFhYIEIcAAAAIAQgTkhlADRBIGRkXC40FlQA/7S85LyvtAS9dMy/tETkvKzMzETMxMAArXSsBFA4CIyImJzUWMzI+AjU0JiMqAQc3MwceAQHjHkFoSxQtGTIkKTkiDz1IDh0OQWsnXl7+/ipFMRoBA2IGDRYgEygqArZkA1MAAQEdAjMDmwWCABIAP0AiPxEBEREQ4AIICAEBDgACEAICAgITFAjkCQkDDtwQAeQA3QA/7TI/MzMv7RESATkvXTMzLzMvEO0yL10xMAE1IREOAyM1Mj4CNzMRMxUBIwEJDTdKViswV0k4EXnsAjNrAmIaKh4RbRIjMiH9HGsAAAACAOICiwPqBZgAEwAhAFJAMHoZihkCehWKFQJ1IYUhAnUchRwCAOOQFKAUwBQDFBQjGuNvCgEAChAKUAoDChfkD7gBFbIf5AW4ARYAP+0/7QEvXXHtEjkvXe0xMABdXV1dARQOAiMiLgI1ND4CMzIeAgc0JiMiBhUUHgIzMjYD6jFikmJdkGEzMGGSYmeTXSyVeHJ0fSI9VTN1fwQSV49oOTloj1dUj2g7OmiPVZeGiJVMbUUghQAAAgBrAI0ETAOsAAgAEQBQQCoD6wjsAQbrBQDrAQETCgzrEOwKD+sOCesKEQgQBw8JAAcIDAMDAwbvAO4AP+Q5PS8XMxEzMhEzETMBGC/t1O0Q/e0REjkv7dTtEP3tMTAlIzUJATUzARUBIzUJATUzARUC+rIBUv6wsAFS/NO0AVL+sLIBT40dAW8BdB/+jT/+kx0BbwF0H/6NPwD//wAbAAAEzQVFECcCl/72AAAQJgIbAAARBwKaAZj9tgAoQBcDAhgYAwJQGQFAGQEZAWAUARQAIAABABFdNRFdNRFdXTU1AD81NQAA//8AEQAABLAFRRAnApf+7AAAECYCG/AAEQcCmAGs/bQAGEANAhcYAWAUARQAIAABABFdNRFdNQA/NQAA//8ACwAABM0FURAnApn/IQAAECYCGxkAEQcCmgGY/bYAIEASAwI1GAMCUDoBQDoBOgBAAAEAEV01EV1dNTUAPzU1AAAAAgCZ/t8EbAQ5ACcAKwB3QDZmBnYGhgYDZgR2BIYEA0UbVRsCaQB5AIkAAwoJKJgrKwAemAAdcB2AHQMdHS0TmAAAEAACAAm4/8BAFQ8TSAkJIyqdK2kjeSOJIwMdHRieI7gBDgA/7TMvXS/tETkvKwEvXe0SOS9d7RI5L+0zMl0xMABdXV03ND4GNzMOBxUUHgIzMj4CNxcOAyMiLgIBFSM1mSU+T1JPPycBrwInPk5QTTwlKU1tRERvUjIHuAxKfq9xbLF+RAJxw09FaFJCOztEUzdDZlFBOztEUzU3VDkeJkdlPgxal2w9MF2JBETJyQAA//8AAAAABMwGpxImACQAABEHAEP/owDzABW0AhUFJgK4/6O0FhkEByUBKzUAKzUA//8AAAAABMwGqBImACQAABEHAHQAXQD0ABNACwIVBSYCXRUYBAclASs1ACs1AAAA//8AAAAABMwGqBImACQAABEHAUsAAAD0ABNACwIWBSYCABsVBAclASs1ACs1AAAA//8AAAAABMwGnRImACQAABEHAVIAAAD0ABNACwIVBSYCACAwBAclASs1ACs1AAAA//8AAAAABMwGXRImACQAABEHAGkAAADiABdADQMCFQUmAwIAGRcEByUBKzU1ACs1NQAAAP//AAAAAATMBmASJgAkAAARBgFQA1UAFkAMAwI4AwMCAx8VBAclASs1NQA/NTUAAAACAAEAAASrBUUADwAYAIVAUQsEKwSbBAMXAQIEAVICEQJeAwQUAwQCAwkFCQUNCAxcGA8PAw0NGgMBXxcLXwgPCD8IfwiPCARvCI8Inwi/CN8IBRcIFwgMEQdfBAMMXwMPEgA/M+0/7TISOTkvL3FyEO0Q7QEvEjkvEjkvM+0yEjk5Ly8QAMGHBSuHK8QQwMAxMAFdASEDIwEhFSERIRUhESEVIREjDgMHAyEChv6xjqgB5gKb/q8BR/65AXr920kEFBUVBosBHAGc/mQFRZj+Upb+L5gEshBCSEQS/m8A//8Acf5EBHYFWhImACYAABEHAHgBYgAAAAu2ARsyKhULJQErNQAAAP//AKIAAARiBqgSJgAoAAARBwBD/7kA9AAVtAEMBSYBuP+dtA0QAAolASs1ACs1AP//AKIAAARiBqgSJgAoAAARBwB0AFsA9AATQAsBDAUmAT8MDwAKJQErNQArNQAAAP//AKIAAARiBqgSJgAoAAARBwFLAAAA9AAVtAENBSYBuP/ktBIMAAolASs1ACs1AP//AKIAAARiBl0SJgAoAAARBwBpABQA4gAZtgIBDAUmAgG4//i0EA4ACiUBKzU1ACs1NQD//wDKAAAEAQaoEiYALAAAEQcAQ/+vAPQAFbQBDAUmAbj/sLQNEAABJQErNQArNQD//wDKAAAEAQaoEiYALAAAEQcAdABnAPQAE0ALAQwFJgFnDA8AASUBKzUAKzUAAAD//wDKAAAEAQaoEiYALAAAEQcBSwAAAPQAE0ALAQ0FJgEAEgwAASUBKzUAKzUAAAD//wDKAAAEAQZdEiYALAAAEQcAaQAAAOIAF0ANAgEMBSYCAQAQDgABJQErNTUAKzU1AAAAAAIAGwAABGUFRQAQAB8AjkBichaCFgICMBZgFgIUFiQWAnkaiRoCfxmPGQIbGSsZOxlrGQQREQYAWgAXARcXIR4TWgYKBggIAAYQBgIGEghfHh8JTwkCPwlvCZ8JzwnfCe8JBglAHyhICQkTHV8LAxNfBhIAP+0/7RI5LytdcTPtMgEvXTMvETMQ7TISOS9d7RI5LzEwAF1dXV1dX10BFAIOASMhESM1MxEhMh4CASERMzISETQuAisBESEEZVCY3Yz+joeHATee86ZV/h3+36LUzjhyrHV5ASECsKj+/65ZAlWVAltNovr++f5HAQoBCofAeTn+QQD//wCiAAAEKgaeEiYAMQAAEQcBUgAAAPUAE0ALARQFJgEAHy8IEiUBKzUAKzUAAAD//wBm/+wEZgaoEiYAMgAAEQcAQ/+qAPQAFbQCHgUmArj/qrQfIgoAJQErNQArNQD//wBm/+wEZgaoEiYAMgAAEQcAdABiAPQAE0ALAh4FJgJiHiEKACUBKzUAKzUAAAD//wBm/+wEZgaoEiYAMgAAEQcBSwAAAPQAE0ALAh8FJgIAJB4KACUBKzUAKzUAAAD//wBm/+wEZgadEiYAMgAAEQcBUgAAAPQAE0ALAh4FJgIAKTkKACUBKzUAKzUAAAD//wBm/+wEZgZdEiYAMgAAEQcAaQADAOIAF0ANAwIeBSYDAgIiIAoAJQErNTUAKzU1AAAAAAEAnQDhBC4EcwALAI5AHbkCyQLZAgO5AMkA2QADtgjGCNYIA7YGxgbWBgMHuP/wQA4SFkgBEBIWSAoQEhZIBLj/8LMSFkgFuP/wthIWSBkFAQO4//BAJhIWSBkDAQkQEhZIFgkBCxASFkgWCwEEgAoBTwoBAAoQCgIKBwGyABk/MwEvXV1dMzEwAF0rXStdK10rKysBKytdXV1dEwkBNwkBFwkBBwkBnQFi/qBoAV4BXmn+ogFgZv6f/pwBSgFiAWBn/p8BX2n+pP6gaQFh/p0AAAAAAwA4/9oEkgVwABoAIgArAMVAjIsdAWUZdRmFGQNqDHoMigwDdwsBZyWHJQJGFFYUAkYRVhECSQdZBwJJA1kDAjQidCKEIgN2H4YfAnseix4CNh4BdCYBOSYBOyt7K4srAx0mHiUEIxsYFQgLBA4XAFtfGwEbQBkcSAAbARsbLSNbClAOARAOAQ4eJR0mBCApXwgLGBUEBRYTBCBfCQUTAD8z7T8zEhc57REXOQEvXXEz7RI5L10rce0yERc5ERIXOTEwAF1dXV1dXV1dXV1dXV0BXV0AXQEUAg4BIyImJwcnNy4BNTQSPgEzMhc3FwceAQc0JwEWMzISARQXAS4BIyICBGZGhL94b6w/dV6NMC9Egr982YB0XowwMMke/gBPmKOU/ZIeAgAndEucnAKprf76sVlGRJxBvVjoka0BAqxWhpxBu1XkkqRy/VKKARgBCqZ0AqxCQf75AAD//wCO/+wEPQaoEiYAOAAAEQcAQ/+fAPQAFbQBGgUmAbj/oLQbHgoAJQErNQArNQD//wCO/+wEPQaoEiYAOAAAEQcAdABWAPQAE0ALARoFJgFWGh0KACUBKzUAKzUAAAD//wCO/+wEPQaoEiYAOAAAEQcBSwAAAPQAE0ALARsFJgEAIBoKACUBKzUAKzUAAAD//wCO/+wEPQZdEiYAOAAAEQcAaQAAAOIAF0ANAgEaBSYCAQAeHAoAJQErNTUAKzU1AAAA//8AJAAABKgGqBImADwAABEHAHQAZQD0ABNACwEJBSYBZQkMBAglASs1ACs1AAAAAAIAogAABF8FRQAQABsAY0BCdg+GDwJlGnUahRoDahJ6EooSAwBafxGPEQIRQBkcSAARARERHRYLB1oACBAIoAiwCAQIFmAGFWALBgsGCwcJAwcSAD8/Ejk5Ly8Q7RDtAS9d7TIyEjkvXStd7TEwAF1dXQEUDgIjIRUjETMVITIeAgc0JisBETMyPgIEXzt5tnv+57+/AQ19unw+wKSk9v5SeU8mArRYn3hH/gVF6zxvnGOGlf3ALE9rAAAAAQCO/+MEjwXMAEMAvUApfDqMOgJ1OIU4AmVCAWZBAUQ/VD90P4Q/BGUvAWUudS6FLgMDKAkMSDO4/+hAJQkMSDkfATZIHyY9Nj0CPUgYQBhQGJAYoBgEHwkYGAkfAyoASBG4/8CzEhdIEbj/wEApCQ5IERFFKkYrQBIVSAArASsRPR8DBSRQMQArFWAJcAmACQMJCQ5QBRYAP+0zL10/P+0SFzkBL10r7RI5Lysr7RIXOS8vL10Q7V0Q7V0xMAArK11dXV1dAV0AXQEUDgIjIiYvAR4DMzI2NTQuBDU0PgQ1NC4CIyIOAhURIxE0PgIzMh4CFRQOBBUUHgQEjylXh19QlDcCGkJKTiVcYjZRX1E2ITE6MSEhP1o5RGtJJ7Q/eK5uZptpNSEzOjMhN1JfUjcBJ0J2WDQZGKQPGhIKX087Uj85R15GM0k6MDQ/KyU+LRojTXpY/AMEA3escDYuUG0+O1dDNDEyICg9OkBUb///AID/7ASIBbQSJgBEAAARBgBDjgAAFbQCQhEmArj/cLRDRhUDJQErNQArNQAAAP//AID/7ASIBbQSJgBEAAARBgB0TQAAE0ALAkIRJgIvQkUVAyUBKzUAKzUA//8AgP/sBIgFtBImAEQAABEGAUvuAAAZtwJDESYCIEgBuP/QtEhCFQMlAStdNQArNQAAAP//AID/7ASIBakSJgBEAAARBgFS+AAAIkAOAkIRJgIwTQEgTQEQTQG4/9q0TV0VAyUBK11dXTUAKzUAAP//AID/7ASIBXsSJgBEAAARBgBp8AAAHkAKAwJCESYDAiBGAbj/0rRGRBUDJQErXTU1ACs1NQAA//8AgP/sBIgGCxImAEQAABEGAVD4AAAXQA0DAkcRJgMCEkxCJy8lASs1NQArNTUAAAMAFP/sBLgETgBBAFAAWQDGQIF8WIxYAnxUjFQCahN6E4oTA2wRfBGMEQMFPRU9AgU3FTcCAyETIQIbKAkOSBQ4VgBJSyRLCUkKCkBIV89L30sCEFcBS1dLVx5bL0gwMEJITx5fHp8erx4EHlEqUDUAUFZLUSRWJFYkOzg1Ly+PLwIvLzUQBkVQGRQPGYAJAQkJGRYAPzMvXREzMxDtMj8zL10RMzM5OS8vEO0Q7RDtMgEvXe0zL+0REjk5Ly9dXRDtMi/tETMQ7TI5OTEwACtdXV1dXV1dARUeAzMyNjcXDgMjIi4CJw4DIyIuAjU0PgI/ATU0LgIjIg4CByc+AzMyFhc+ATMyHgIdAQUUFjMyPgI9AQcOAwEiDgIHIS4BAqcBFSxGMUtZEIoMK0ltTTlcSDUSFTZJXDpEYT8eOV12PqcPITQkIDMmFwSoCChKcVBbeSMtfUxggU4g/AU5OThRNBl6JUo6JQKeHD4zIwIBaQlYAfcRUohiN15ILS1bSS8YN1lAMVU+JCxUd0triU4fAQQ7Q146Gw8nQzMRQGtOK0ZFSkFYm9J6GMxSZD9gdDVZBAEPMFsCUh1Kf2Krnf//AIL+RAQ4BE4SJgBGAAARBwB4AVEAAAALtgEhLiYAHCUBKzUAAAD//wCF/+wERgW0EiYASAAAEQYAQ7EAABW0AiwRJgK4/7K0LTAVHyUBKzUAKzUAAAD//wCF/+wERgW0EiYASAAAEQYAdG8AABNACwIsESYCbywvFR8lASs1ACs1AP//AIX/7ARGBbQSJgBIAAARBgFLBwAAE0ALAi0RJgIHMiwVHyUBKzUAKzUA//8Ahf/sBEYFexImAEgAABEGAGkIAAAXQA0DAiwRJgMCCDAuFR8lASs1NQArNTUA//8AjwAABGUFtBImAPEAABEGAEO9AAAeQAsBChEmAWALAVALAbj/qbQLDgMBJQErXV01ACs1AAD//wCPAAAEZQW0EiYA8QAAEQYAdGgAABNACwEKESYBVAoNAwElASs1ACs1AP//AI8AAARlBbQSJgDxAAARBgFLCgAAIkAOAQsRJgFgEAFQEAEwEAG4//a0EAoDASUBK11dXTUAKzUAAP//AI8AAARlBXsSJgDxAAARBgBpKQAAL0AfAgEKESYCAZAOAYAOAXAOAWAOAVAOAUAOAQAODAYJJQErXV1dXV1dNTUAKzU1AAACAH3/7AROBdgAJQA3ALtAgUU2VTZlNgNFMVUxZTEDSi5aLmouA0ooWihqKAMrBDsEawQDBSQVJAITEAYJBBIICAwSDBIhF0cDcCYBoCYBACYQJmAmAyYmOTBH/yEB/yEBACEBIWUQdRCFEANqBnoGigYDEAkTBgQHEStQAAMAAAAQAAIHAAcADDNQHBYSEREMAAA/My8zP+0ROTkvL10RMxDtERIXOV1dAS9dXXHtEjkvXXFyM+0ROTkvLzMvEhc5MTAAXV1dXV1dATIWFy4BJwUnNy4BJzMeARclFwcWEh0BFA4CIyIuAjU0PgIBNC4CIyIOAhUUFjMyPgICZEd1KydpTP78N9o4eELRLVMqAQg306SnOXi8hH21djg0dLoBsiFHcVBRc0khkJFRdkskA9MgG1mfRXNuXi1OIxQzH3JsXJX+ffQGecSKS0mEuW9rtoZL/g5eiVosLVyIXL6yLFqL//8AswAABBkFqRImAFEAABEGAVIKAAATQAsBJhEmAQkxQRMkJQErNQArNQD//wCC/+wESQW0EiYAUgAAEQYAQ7oAABW0AiQRJgK4/7u0JSgKACUBKzUAKzUAAAD//wCC/+wESQW0EiYAUgAAEQYAdGUAABNACwIkESYCZSQnCgAlASs1ACs1AP//AIL/7ARJBbQSJgBSAAARBgFLAAAAE0ALAiURJgIAKiQKACUBKzUAKzUA//8Agv/sBEkFqRImAFIAABEGAVIAAAATQAsCJBEmAgAvPwoAJQErNQArNQD//wCC/+wESQV7EiYAUgAAEQYAaQAAABdADQMCJBEmAwIAKCYKACUBKzU1ACs1NQAAAwB0AN8EVwR1AAMABwALAGNAPAYOCwUIDnAFAQUDC6sAPwhPCAIACAEKAwgIDQwJrkAIDgQBBQ4Ari8BPwFPAQNPAY8BnwHvAQQBBK0FswA/7dZdce0rABgQTfYa7RESATkvX15dXTPtMsRdKwEYEE3kMTABNTMVATUhFQE1MxUCEaj9uwPj/bqoA763t/6ikpL+f7e3AAADAG7/7ARdBE4AGQAlADEA20AkRSRVJGUkA2swAUowWjACDCALEUh5B4kHAgdACw9IdBmEGQIZuP/AQAkLD0h0FIQUAhS4/8BAZwsPSB0qHikEJhoYFQgLBA4XFwBHIBowGkAacBqAGpAaBgAaUBqgGrAawBoFABoQGmAacBqAGuAaBhoaMyZHDgoKDkAoLkgOQBgbSA4qHSkeBCEtCAsYFQQTBRYWLVATECFQBQkJBRYAPzMvEO0/7TMvERIXORESFzkBLysrMy8Q7RI5L11xcu0yLxEXORESFzkxMAArXQErXQArXQErAF1dXQEUDgIjIiYnByc3LgE1ND4CMzIXNxcHFgc0JicBHgEzMj4CJRQWFwEuASMiDgIEXUaDvHdlpkBNTFQwM0OBvHnVekhOUGG9ERD+AytyQEV2VjD9ixERAf0qcUVFdVUwAh6O04xFNTZXRF9FvHqM0Y1GZFJEWon3THgu/cA1Kidipn5LdS4CQDInKWOkAAAA//8Auf/sBB8FtBImAFgAABEGAEOiAAAVtAEmESYBuP+ctCcqJBMlASs1ACs1AAAA//8Auf/sBB8FtBImAFgAABEGAHRaAAATQAsBJhEmAVQmKSQTJQErNQArNQD//wC5/+wEHwW0EiYAWAAAEQYBSwAAABW0AScRJgG4//q0LCYkEyUBKzUAKzUAAAD//wC5/+wEHwV7EiYAWAAAEQYAaQAAABm2AgEmESYCAbj/+rQqKCQTJQErNTUAKzU1AAAA//8AQv5XBIkFtBImAFwAABEGAHRrAAATQAsBIBEmAWsgIxEfJQErNQArNQAAAgC5/lcEQgXMABMAOABlQER5IYkhAmQSAUYSVhICawIBSQJZAgI1FgE6JgEGGxYbdhuGGwQeR2AAAQAAOjIKL0YAMIAwAjAxAC8bKA9QIxYUBVAZEAA/7TM/7TM/PwEvXe0yMhI5L13tMTAAXV1dXV1dXV0BNC4CIyIOAhUUHgIzMj4CAT4DMzIeAhUUDgIjIi4CJyMeAxURIxEzERQGBwYHA4gYO2FJO2hNLSVIakRJYjsZ/egZP1BkPm6WXCgoXJZuN2RWQxcFAQEBAbW0AQEBAQIiZJxrOCVhrIdznWEqOW6iAc40TDEXUJPOfXvQllUULEYyAh8uOh3+WQd1/lkdORYaFwD//wBC/lcEiQV7EiYAXAAAEQYAaQUAABdADQIBIBEmAgEFJCIRHyUBKzU1ACs1NQD//wAAAAAEzAZeEiYAJAAAEQcBTQACAQsAE0ALAhUFJgIAFhUEByUBKzUAKzUAAAD//wCA/+wEiAVTEiYARAAAEQYBTdsAABW0AkIRJgK4//S0Q0InLyUBKzUAKzUAAAD//wAAAAAEzAapEiYAJAAAEQcBTgAAAPUAE0ALAhUFJgIAGiIEByUBKzUAKzUAAAD//wCA/+wEiAW0EiYARAAAEQYBTu0AABNACwJCESYCB0dPJy8lASs1ACs1AP//AAD+YATfBUUSJgAkAAARBwFRAcgACwALtgISICAAACUBKzUAAAD//wCA/lUEiAROEiYARAAAEQcBUQFxAAAADrkAAv/CtE5OAwMlASs1//8Acf/sBHYGqBImACYAABEHAHQAhAD0ABNACwEqBSYBdiotFQslASs1ACs1AAAA//8Agv/sBDgFtBImAEYAABEGAHRmAAATQAsBJhEmAW8mKQAcJQErNQArNQD//wBx/+wEdgapEiYAJgAAEQcBSwAUAPUAE0ALASsFJgEGMCoVCyUBKzUAKzUAAAD//wCC/+wEOAW0EiYARgAAEQYBSwAAABNACwEnESYBCSwmABwlASs1ACs1AP//AHH/7AR2BmYSJgAmAAARBwFPAB4AmgATQAsBKgUmAREqLBULJQErNQArNQAAAP//AIL/7AQ4BcwSJgBGAAARBgFPFAAAC7YBHiYoABwlASs1AP//AHH/7AR2BqkSJgAmAAARBwFMABEA9QATQAsBKgUmAQMsMhULJQErNQArNQAAAP//AIL/7AQ4BbQSJgBGAAARBgFM/AAAE0ALASYRJgEFKC4AHCUBKzUAKzUA//8AogAABGUGqRImACcAABEHAUz/4wD1ABW0AhgFJgK4/8a0GiAGACUBKzUAKzUAAAMAH//mBM8FzAAkADgAPgB4QBhmPnY+hj4DBQt1C4ULAwoFegWKBQM+gzm4AQtAITuGPDxAGEYvAD8XAQAXQBdQFwMXF0AlRwhACyBICB8VPrgBDEAOOzsXADRQEQ0QKlAAAxYAPzPtPzPtPzMv7T8BLyvtEjkvXXEzM+0RMy/t/e0xMABdXQFdJQ4BIyIuAjU0PgIzMhYXMzQmNCY1ETMRFB4CFyMuAzUBFB4CMzI+AjU0LgIjIg4CATUTMxUDApcxhWFQg1wyNF6BTmKEMQIBAbQBAgIBrAEEAwL+PhgwSzMxWUUpKURaMDBKMxoC4k/Fq65pX0WM0YyO1Y1GVmIFKjItCQGj+xMnSDwrCQQkMjoaAWxwoGgxNW6mcGybZS8uZqMB+SEBJCX+4AAAAP//ABsAAARlBUUSBgCQAAAAAgCK/+YElgXMACcAOwCWQFZKOlo6ajoDRSpVKmUqAzoOATUXAQUUFRR1FIUUBAoRGhF6EYoRBCEhIxMmJgAkRgwfMgNQIwGQI6AjAiMjPShHABMBEyMAACBRJa8hvyECISEjN1AYFbj/wEAMCQxIFQ8tUAwQFgcVAD8/M+0/KzPtEjkvXTPtMj8BL13tEjkvXXEXM+0yMi8REjkvMTAAXV1dXV1dAREUHgIXIy4DNSMOASMiAhEQITIWFzM0JjQmPQEhNSE1MxUzFQEUHgIzMj4CNTQuAiMiDgIEEwECAgGsAQQDAgUxonnKvgGIeaMxAgEB/tQBLLSD/K4dPWBDRWtJJSVIakVAYD8gBKz8MydIPCsJBCQyOhppXwEPARACK1ZiBSoyLQmdg52dg/1fbJtkLy5monNwmV8pLmSeAP//AKIAAARiBl4SJgAoAAARBwFNABIBCwAVtAEMBSYBuP/1tA0MAAolASs1ACs1AP//AIX/7ARGBVMSJgBIAAARBgFNAgAAE0ALAiwRJgIBLSwVHyUBKzUAKzUA//8AogAABGIGqRImACgAABEHAU4AAAD1ABW0AQwFJgG4/+S0ERkACiUBKzUAKzUA//8Ahf/sBEYFtBImAEgAABEGAU4EAAATQAsCLBEmAgQxORUfJQErNQArNQD//wCiAAAEYgZmEiYAKAAAEQcBTwAAAJoAFbQBDAUmAbj/5bQMDgAKJQErNQArNQD//wCF/+wERgXMEiYASAAAEQYBTwIAAAu2AgMsLhUfJQErNQD//wCi/lUEYgVFEiYAKAAAEQcBUQFLAAAADrkAAf/CtBgYCgolASs1//8Ahf5VBEYEThImAEgAABEGAVE+AAAOuQAC/u60ODgLCyUBKzUAAP//AKIAAARiBqkSJgAoAAARBwFMAAAA9QAVtAEMBSYBuP/ktA4UAAolASs1ACs1AP//AIX/7ARGBbQSJgBIAAARBgFM+QAAFbQCLBEmArj/+rQuNBUfJQErNQArNQAAAP//AHH/7ARPBqkSJgAqAAARBwFLAAAA9QATQAsBKwUmAQYwKgoUJQErNQArNQAAAP//AI/+WAQeBbQSJgBKAAARBgFL9wAAE0ALAkcRJgIGTEYaKSUBKzUAKzUA//8Acf/sBE8GqRImACoAABEHAU4AAwD1ABNACwEqBSYBCS83ChQlASs1ACs1AAAA//8Aj/5YBB4FtBImAEoAABEGAU73AAATQAsCRhEmAgZLUxopJQErNQArNQD//wBx/+wETwZmEiYAKgAAEQcBTwAKAJoAE0ALASoFJgERKiwKFCUBKzUAKzUAAAD//wCP/lgEHgXMEiYASgAAEQYBT/cAAAu2AgdGSBopJQErNQD//wBx/lkETwVaEiYAKgAAEQYCkgAAAAu2AQUqLQoUJQErNQD//wCP/lgEHgYAEiYASgAAEQYClf8AABNACwJIESYCDUlGGiklASs1ACs1AP//AKIAAAQqBqkSJgArAAARBwFLAAAA9QATQAsBDQUmAQASDAQKJQErNQArNQAAAAACALkAAAQZBqkAHwApAIy5ACn/8EBYDhFIKBAOEUgnJDckRyQDIA5wDoAOAwQNFA10DYQNBCkoIyMmIoNQIWAhgCEDISElgyYmHxFGEhIrBQIeRgAfgB8CHyMgCw9II44pjCUiGFAFCwsfERUAAwA/PzM5LzPtLzP97SsBL13tMjISOS/tEjkv7TMvXe0SOREzMzEwAF1dAV0rKxMzERQGBzM+AzMyHgIVESMRNC4CIyIOAhURIwEVIycjByM1NzO5tQYDAxhAUmlAU4JaL7UhO1AwO2dNLLQC+GnbAuho/qQFRf7FMmUuL0w1HSxckGX9awJ7UGc9GC1VfVH9yQW5FIuLFPAAAAACAAIAAATKBUUAEwAXAIBAUXAJAQkJBwtaFAQfDC8MPwxvDH8MBW8MfwyPDAMMDBkXAw9aEH8SARISAHAQAQAQoBCwEAMQFgoSYAcDExMBDl9QFwGgF7AXAhcXARALEgUBAwA/Mz8zEjkvXXHtEjkvMzPtMjIBL11xMzMvcRDtMjISOS9dcTMz7TIyL3ExMBM1MxUhNTMVMxUjESMRIREjESM1ATUhFaK/Agq/oKC//fa/oANp/fYEgcTExMSU/BMCb/2RA+2U/o7e3gABADUAAAQZBcwAJwBxQD50EoQSAgURFRElEXURhREFNgwBAwMiFUYWFikJAiJGIyYmJwAjgCMCIyMVFQUlUQImJgAcUAAPAeAP8A8CD7j/wLYJDEgPDwAAAD8/K11x7RI5LzPtMj8zAS9dMzMvEO0yMhI5L+0ROS8xMABdXV0TMxUhFSEVFAYHMz4DMzIeAhURIxE0LgIjIg4CFREjESM1M7m1ASv+1QYDAxhAUmlAU4JaL7UhO1AwO2dNLLSEhAXMnYOEMmUuL0w1HSxckGX9TQKZUGc9GC1VfVH9qwSsgwAAAP//AMoAAAQBBp4SJgAsAAARBwFSAAEA9QATQAsBDAUmAQEXJwABJQErNQArNQAAAP//AI8AAARlBakSJgDxAAARBgFSAAAAFbQBChEmAbj/7LQVJQMBJQErNQArNQAAAP//AMoAAAQBBl4SJgAsAAARBwFNAAIBCwATQAsBDAUmAQENDAABJQErNQArNQAAAP//AI8AAARlBVMSJgDxAAARBgFNCAAAFbQBChEmAbj/87QLCgMBJQErNQArNQAAAP//AMoAAAQBBqgSJgAsAAARBwFOAAAA9AATQAsBDAUmAQARGQABJQErNQArNQAAAP//AI8AAARlBbQSJgDxAAARBgFOFAAAE0ALAQoRJgEADxcDASUBKzUAKzUA//8Ayv5VBAEFRRImACwAABEGAVENAAAOtwEBDxIMAAElASs1ADUAAP//AI/+VQRlBcwSJgBMAAARBgFROAAADrcCAiYUDgMBJQErNQA1AAD//wDKAAAEAQZmEiYALAAAEQcBTwAAAJoAE0ALAQwFJgEBDA4AASUBKzUAKzUAAAAAAQCPAAAEZQQ6AAkAM0AaBwcFBAQFAQEARqAFAQUFCwoHUAgPAARQAxUAP+0yP+0REgE5L3HtMi8RMy8SOS8xMCUhFSE1IREhNSEC6QF8/CoBpv7BAfOOjo4DHo4AAAAAAgBi/+wEhQVFAAMAGQBxQC51BoUGAmEYcRiBGAMKEwEKDwEQCSAJMAkDCQkDBxdaFgxaB58WrxYCkAegBwIHuP/AQBgJDEgWBxYHGwJaAxcXBF8REwlfAAoDAxIAPz8z7T/tMy8BL+0SOTkvLytdXRDtEO0REjkvXTEwAF1dXV0TMxEjJTI2NREhNSERFA4CIyIuAic3HgFiv78Cnmhf/vEBzTBhk2JVg14+EroUZwVF+ruHj4oDCZz8X2Sjcz4sWoxgH4F1AAAEANj+VwQlBcwAAwAHAB8AIwBtQCd1HYUdAgoNGg0CFBQDHyBKIyMKRmAfAR8fJQMESgcHAkYAA9ADAgO4/8BAGR8lSAMaUA8bAxUIAA8gMARgBAKABAEEIQUALzMvXXEzPzI/P+0BLytd7TIv7RESOS9d7TIv7RESOS8xMABdXRMzESMDNTMVBTMRFA4CIyIuAic1HgMzMj4CNQM1MxXts7QUyAHRtEd2nFYpUkxBGBY8SE8oOGFIKRTIBDr7xgUMwMDS+6ptl18qBwwPCYwFDAoHHD1fQwUlwMD//wCw/+wEKQapEiYALQAAEQcBSwB4APUAE0ALARcFJgGZHBYIACUBKzUAKzUAAAD//wDV/lcEGAW0EiYClgAAEQYBS2cAABNACwEbESYBkCAaCgAlASs1ACs1AP//AKL+WQTLBUUSJgAuAAARBgKSAAAADrkAAf+vtAwPBAslASs1AAD//wDs/lkEZQXMEiYATgAAEQYCkgAAAA65AAH/vbQMDwQLJQErNQAAAAEA7AAABGUEOgALALBALWYHdgeGBwNkCXQJhAkDjQEBewEBSQFZAWkBA0kIWQgCawB7AIsAA0kAWQACCrj/6EAoCxFIRAlUCQIBCggJEAkJAJ8Lrwu/CwMACxALAgsQCwsNBwNGAAQBBLj/wLMfJUgEuP/AsxYbSAS4/8BAEA0RSAQCBwoBBwEIBQ8EABUAPzI/Mzk5ETMRMwEvKysrXe0yETMvOF1dMzMvODM5OV0xMCtdXV0AXV1dAV0AXSEBBxEjETMRATMJAQOS/pKEtLQB29P+SQHOAe5i/nQEOv3mAhr+L/2XAP//AO0AAARMBqkSJgAvAAARBwB0/54A9QAVtAEGBSYBuP9otAYJAAQlASs1ACs1AAACAIYAAARcBqkACQAPAGFACgyGdg2GDQINgg+4//BALAsPSA+EFQoBAwoBAgoKCAgFBAQFAQEARqAFAQUFERAMjA8PB1AIAwAEUAMVAD/tMj/tMy/tERIBOS9x7TIvETMvEjkvMi9fXV3tK/1d7TEwJSEVITUhESE1ISc1NzMVBQLgAXz8KgGm/t8B1c3jxf7Ujo6OBCmOYBTwHecAAAD//wDt/lkETAVFEiYALwAAEQYCkgoAAA65AAH/07QGCQAEJQErNQAA//8Ahv5ZBFwFzBImAE8AABEGApIAAAAOuQAB//S0Cg0DASUBKzUAAP//AO0AAARMBUUSJgAvAAARBwKSASwFpwASQAoBCAMB9AYJAAQlASs1AD81//8AVQAABJMFzBAmAE/PABEHApQBpAAAABSzAQwAAbgBybQKDQMBJQErNQA/NQAA//8A7QAABEwFRRImAC8AABEHAU8AnP1UAAu2AWYGCAAEJQErNQAAAP//AIYAAARrBcwSJgBPAAAQBwFPAaD9VAABADYAAARMBUUADQBkQD2LAQGEBwFgB3AHAgkJCw0NDwcLWgAEAAMDLwA/AAIAABAAAgAJAwEKBAcEAm8IfwiPCAMIAggCBQMLXwASAD/tPzk5Ly9dEhc5MjMBL11dMy8RMxDtMhI5LxI5LzEwAF1dXTMRByc3ETMRJRcFESEV7XVCt78BJD3+nwKgAco9eWAC3/2El3m5/m6cAAABAIYAAARcBcwAEQB8QBUQEAgJYAwBnwwBfwKPAp8CA08CAQK4/8BAMgkMSAwCDAIFCAgJBQUABEYNoAkBCQkSEwANAwoECz8LASABAQELAQsID1AQAAQIUAcVAD/tMj/tEjk5Ly9dXRIXORESATkvcTPtMjIvETMvEjk5Ly8rXXFdcRESOS8xMAE3FwURIRUhNSERByclESE1IQLg4T7+4QF8/CoBptpAARr+rQIHA3SBcaT9ro6OAe17cJ8CL44AAAD//wCiAAAEKgapEiYAMQAAEQcAdAB6APUAE0ALARQFJgF6FBcIEiUBKzUAKzUAAAD//wCzAAAEGQW0EiYAUQAAEQcAdACJAAAAE0ALASYRJgGJJikTJCUBKzUAKzUAAAD//wCi/lkEKgVFEiYAMQAAEQYCkuEAAA65AAH/4LQUFwgSJQErNQAA//8As/5ZBBkEThImAFEAABEGApLlAAAOuQAB/+S0JikTJCUBKzUAAP//AKIAAAQqBqkSJgAxAAARBwFMAAYA9QATQAsBFAUmAQYWHAgSJQErNQArNQAAAP//ALMAAAQZBbQSJgBRAAARBgFMAAAAE0ALASYRJgEAKC4TJCUBKzUAKzUA//8ABQAABIIFRhAmAFFpABEHApL+KgWoABi2ASgDASAmAbj9wLQmKRMkJQErXTUAPzUAAAABALP/7ARVBVoANwCcQDYUMCQwNDADDAMcAywDfAOMAwVzNYM1AgU0FTQlNHU0hTQFdAuECwILDwoBCgohAFxAFeAVAhW4/8BAFxUYSH8VjxUCABUBFRU5LiFcACIQIgIiuP/AsxwgSCK4/8BAFBEUSCIuG2AyBCgDIhIQXwULCwUTAD8zLxDtPz8/7TMBLysrXe0yEjkvXV0rce0SOS9dM10xMABdXV1dARQOAiMiLgInNx4DMzI+AjURNC4CIyIOAhURIxE0LgInMx4DFTM+ATMyHgIVBFUfTYNkPllBMBWDDx4lLh8uOyMNJEFYM0J2WDO0AQICAaoBAgMCAzG+k1eHXTACHoLQkk4ZKjceZBUkGw86a5lfAaFQZz0YLVV9UfyBBF8iS0MwBwUsOTsUX24sXJBlAAABALP+VwQZBE4ANQBPQDMiIAkPSHMcgxwCBRsVGyUbdRuFGwUnJwcfRjAwNxMGRgAHgAcCBytQJBsTAFAZEA0PBxUAPz8/7TM/7QEvXe0yEjkv7RI5LzEwAF1dKwEiDgIVESMRNC4CJzMeAxUzPgMzMh4CFREUDgIjIiYnNR4BMzI+AjURNC4CAog7Z00stAECAgGqAQIDAgMYQVVqQlOAVy0WNl1IIkEcDSQNJjEcCiE7UAPDLVV9Uf2NA1MiS0MwBwUsOTsUL0w1HSxckGX8qT5qTi0EBYsCBBQrQy4DIlBnPRgAAAD//wBm/+wEZgZeEiYAMgAAEQcBTQACAQsAE0ALAh4FJgIAHx4KACUBKzUAKzUAAAD//wCC/+wESQVTEiYAUgAAEQYBTQIAABNACwIkESYCASUkCgAlASs1ACs1AP//AGb/7ARmBqkSJgAyAAARBwFOAAAA9QATQAsCHgUmAgAjKwoAJQErNQArNQAAAP//AIL/7ARJBbQSJgBSAAARBgFOAAAAE0ALAiQRJgIAKTEKACUBKzUAKzUA//8AZv/sBGYGqBImADIAABEHAVMBLQD0ABdADQMCHgUmAwJfJCEKACUBKzU1ACs1NQAAAP//AIL/7ARTBbQSJgBSAAARBwFTAUAAAAAXQA0DAiQRJgMCcionCgAlASs1NQArNTUAAAAAAgAU//sExQVLABcAKAB0QEl2JoYmAkYJVgkCSQRZBAISDhIOFhEVXBsbBhYWKiRcBhRfDxE/EX8RjxEEbxGPEZ8RvxHfEQUREQ4YFl8XAwMXEh8PXw4LCw4DAD8zLxDtMj8zLxDtMhE5L3Fy7QEv7RI5LxI5L+0yEjk5Ly8xMABdXV0hDgEjIgIRNBI+ATMyFyEVIREhFSERIRUlMjY3ES4BIyIOAhUUHgICYRcxGv/sPXu5fDozAi7+cgFv/pEBt/07FjsTEzsVTnVOJyhPdAIDAVIBXLQBAKJMBpj+SJb+OZiMAgQEIQMDOn/Ij47MhD8AAAMAHP/sBLQETgAmADoAQwCqQHN7QotCAno+ij4CdjiGOAJ5KokqAmYDdgOGAwNkM3QzhDMDay97L4svAwUiFSICBRoVGgIKFRoVAhAdQABIJycYJQhJCQklSBBBAUFBRTFITxhfGJ8YrxgEGABQQEA2OyxQIB0bEAU2UBMQDhOACAEICBMWAD8zL10RMzMQ7TI/MzPtMhI5L+0BL13tEjkvXe0yL+0REjkv7TI5OTEwAF1dXV1dXV1dXV0BFB4CMzI2NxcOAyMiJw4BIyIuAjUQEjMyFz4BMzIeAh0BJTQuAiMiDgIVFB4CMzI+AgEiDgIHIS4BAsgTKUAsQU4OigsoRGZItlEqhVtLeFUtqqK7Ty2FUVt7Sh/9axgsPycnQS8ZGy4+IyhBLhkBTBk3LyACAUQIUAH3VY9nOV5ILS1bSS+3XVpEjNOPARcBGbFeU1ib0noYJ36kYicpY6R7fqViKCdipgIpHUp/YqudAAD//wCiAAAEmQapEiYANQAAEQcAdABIAPUAE0ALAhwFJgIQHB8EESUBKzUAKzUAAAD//wDyAAAEFQW0EiYAVQAAEQYAdFkAABNACwEgESYBOyAjEAAlASs1ACs1AP//AKL+WQSZBUUSJgA1AAARBgKS/QAADrkAAv/FtBwfBBElASs1AAD//wDL/lkEFQROEiYAVQAAEQcCkv7wAAAADrkAAf7StCAjEAAlASs1//8AogAABJkGqRImADUAABEHAUz/7QD1ABW0AhwFJgK4/7a0HiQEESUBKzUAKzUA//8A8gAABBUFtBImAFUAABEGAUwUAAAVtAEgESYBuP/3tCIoEAAlASs1ACs1AAAA//8AT//sBGgGqRImADYAABEHAHQAeAD1ABNACwFABSYBgkBDCAAlASs1ACs1AAAA//8Ap//sBCQFtBImAFYAABEGAHRWAAATQAsBOREmAVY5PAoAJQErNQArNQD//wBP/+wEaAapEiYANgAAEQcBSwAEAPUAE0ALAUEFJgEORkAIACUBKzUAKzUAAAD//wCn/+wEJAW0EiYAVgAAEQYBSw8AABNACwE6ESYBDz85CgAlASs1ACs1AP//AE/+RARoBVoSJgA2AAARBwB4AUwAAAALtgEdSEAIACUBKzUAAAD//wCn/kQEJARLEiYAVgAAEQcAeAFWAAAAC7YBHUE5CgAlASs1AAAA//8AT//sBGgGqBImADYAABEHAUwAAAD0ABNACwFABSYBCkJICAAlASs1ACs1AAAA//8Ap//sBCQFtBImAFYAABEGAUwFAAATQAsBOREmAQU7QQoAJQErNQArNQD//wBM/kQEgAVFECcAeAFMAAATBgA3AAAADrkAAf/itAgLBAYlASs1//8Avv5EA/kFVBAnAHgBVgAAEwYAVwAAAAu2AQ4cHwARJQErNQAAAP//AEwAAASABqkSJgA3AAARBwFMAAAA9QATQAsBCAUmAQAKEAQGJQErNQArNQAAAP//AGX/8ATFBcwQJgBXpwARBwKUAdYAAAARsQEBuAI4tBwfABElASs1ADUAAAEATAAABIAFRQAPAG9ARAICDgUJCQYNDg4BBVoGQA0GDg0KDwY/Bo8Gnwa/Bs8GBk8GXwZ/Bo8GzwbfBgYQBgEGBhARAAxfDQQIXwEJCQUNAwUSAD8/EjkvM+0yEO0yERIBOS9dXXEzxCsBGhgQTf0y5BESOS8REjkvMTABETMVIxEjESM1MxEhNSEVAsXw8L7w8P5FBDQEqf5Ylf2UAmyVAaicnAAAAAEAyP/wBAMFVAAjAHtATmoSehKKEgMSKAkOSAEhIQsLJSMfA0YUGpAWARYWGBwDLxQ/FE8UAxRAICRIFEAaHkgUQBIYSAAUARQiGlAbAhZQIxcXHxsdHRsPBlARFgA/7T8zLxEzOS8z7TIQ7TIBL10rKytdFzMvXTMQ7TIyEjkvMy8zMTAAK10BFSEVFBYzMj4CNxUOAyMiJj0BIzUzESM1MxMzESEVIRED1P5QVWEoVU9FGBZGV2Y2oqKoqKiqOngBsP5QAoeE409MBwoMBYkGEA4KiZT2hAEljgEa/uaO/tsA//8Ajv/sBD0GnhImADgAABEHAVIAAQD1ABNACwEaBSYBASU1CgAlASs1ACs1AAAA//8Auf/sBB8FqRImAFgAABEGAVIBAAAVtAEmESYBuP/7tDFBJBMlASs1ACs1AAAA//8Ajv/sBD0GXhImADgAABEHAU0AAgELABNACwEaBSYBARsaCgAlASs1ACs1AAAA//8Auf/sBB8FUxImAFgAABEGAU0CAAAVtAEmESYBuP/7tCcmJBMlASs1ACs1AAAA//8Ajv/sBD0GqRImADgAABEHAU4AAAD1ABNACwEaBSYBAB8nCgAlASs1ACs1AAAA//8Auf/sBB8FtBImAFgAABEGAU4AAAAVtAEmESYBuP/6tCszJBMlASs1ACs1AAAA//8Ajv/sBD0GqRImADgAABEHAVAAAACeAC6yAgEfuP/AQBgUGEiQHwFwHwEQHwEAHwEfAgEAJBoKACUBKzU1ABFdXV1dKzU1//8Auf/sBB8GCxImAFgAABEGAVAAAAAZtgIBKxEmAgG4//q0MCYkEyUBKzU1ACs1NQAAAP//AI7/7ARLBqkSJgA4AAARBwFTATgA9QAXQA0CARoFJgIBaiAdCgAlASs1NQArNTUAAAD//wC5/+wEUQW0EiYAWAAAEQcBUwE+AAAAF0ANAgEmESYCAWosKSQTJQErNTUAKzU1AAAA//8Ajv5VBD0FRRImADgAABEGAVE7AAALtgE9IBoKACUBKzUA//8Auf5VBDgEOhImAFgAABEHAVEBIQAAAAu2AQAxMRQUJQErNQAAAP//AAAAAATMBqkSJgA6AAARBwFL//wA9QAVtAE0BSYBuP/8tDkzEzIlASs1ACs1AP//ABUAAAS4BbQSJgBaAAARBgFL/AAAFbQBLBEmAbj//LQxKw8qJQErNQArNQAAAP//ACQAAASoBqkSJgA8AAARBwFL//wA9QAVtAEKBSYBuP/8tA8JBAglASs1ACs1AP//AEL+VwSJBbQSJgBcAAARBgFL/AAAFbQBIREmAbj//bQmIBEfJQErNQArNQAAAP//ACQAAASoBl0SJgA8AAARBwBpAAEA4gAXQA0CAQkFJgIBAA0LBAglASs1NQArNTUAAAD//wBJAAAEgwapEiYAPQAAEQcAdABmAPUAE0ALAQoFJgFmCg0BACUBKzUAKzUAAAD//wCTAAAELAW0EiYAXQAAEQYAdFUAABNACwEKESYBWwoNAAglASs1ACs1AP//AEkAAASDBmYSJgA9AAARBwFPAA0AmgATQAsBCgUmAQ4KDAEAJQErNQArNQAAAP//AJMAAAQsBcwSJgBdAAARBgFP/QAAC7YBBAoMAAglASs1AP//AEkAAASDBqgSJgA9AAARBwFMAAoA9AATQAsBCgUmAQoMEgEAJQErNQArNQAAAP//AJMAAAQsBbQSJgBdAAARBgFMAQAAE0ALAQoRJgEHDBIACCUBKzUAKzUAAAEBkAAABEsFzAAXAD65AAX/6EAkCQxIAEYvAT8BbwF/AY8BBQFAFCVIAAEBAQwBDBgZElAHAAAVAD8/7RESATk5Ly9dK13tMTAAKyEjETQ+AjMyHgIXFS4DIyIOAhUCRLQtZJ9yHVBQRxUSSE9IE0JiQB8EU2WPWyoDBggEkQMGBQMUNl5LAAABAOr+VwQtBVkAGwBcQDMQDRFvEhQUEg4OAw1vFhMWABYQFgIAEhASAhIWEhYcHQMDHRAUUQ1wFQEVFQARGwdzAAcAP+0/EjkvXTPtMhEBMy8REjk5Ly9dXRI5EO0ROS8RMy8Q7RE5MTABMhYXBy4BIyIOAg8BIQchAyMTIzczNz4DA40uVhwoFEsjLT0pGAkbAS4Z/tHztPP8G/sdDi9UgAVZDwiIBwwQJTwriYP7MgTOg5g7ZkwsAAAAAAQAAAAABMwGqQAWACQAKgA+ASFACwsoCQxIAigJDEgUuP/oswkRSBC4/+hACQkRSHQohCgCKLj/8EB/CQxIFyQGBRwFFxwFIiMHCB0IIh0IAwFSBRwFXgQDFAQEAwoBUggdCF4JChQJCQonhkQoVChkKAMogiqEcCWAJQIlDSuEgAABADWEDQ0KHQADHBwdCQUQBAEEBEAIfwmPCQIJcCeAJwInjH8qjyoCKhIGJAdfIzqOHRwKAwMdHbj/wEASCQxIIx0jHQUwjhLcCQgEAwUSAD8XMz/tEjk5Ly8rERczEO0Q7TMyENZd7V0BL10zETMvXTMSOTkRMzMRMzMv7S9d7RDUXe39Xe2HECuHK8SHGBArhyvEERIAORCHBcDAwBESADkQhwXAwMABK10xMAArKysrARQGBwEjAyEDIwEuATU0PgIzMh4CAy4DJyMOAwcDIQE1NzMVBRc0LgIjIg4CFRQeAjMyPgIDWCssAcvCiv3NicQB0S8uHjxbPT1bPB6bChYVEQYSBhATFAuMAbn+yePF/tRWDR0uISEuHg0NHi4hIS4dDQS7MFMd++UBQ/69BBcdVjEnSDchITdI/kkaODYvEREwNjgZ/rEDyRTwHefqDx0YDw8YHQ8PHhgPDxgeAAAEAID/7ASIBqkAQgBRAFcAawE2QB2KKAF6TYpNAmUEAWo2ejaKNgM3KAkRSAIoCRFIQLj/6LMJEUg8uP/oQBoJEUgdEy0TPRMDHSAJDEgGIRYhAjQYCQxIVbj/4EBhCRFIVIZVgleEUlJihDk2AzkAhFhwWIBYAjlYOVgfSA4OB0YlFk9IX0gCSEgfbTBHwDEBMTFPRwAfAR9JUSXfMO8w/zADMEAJDEgwMDY2AwMrZ12OPkAZIUg+UoBn8GcCZ7j/wLMJDUhSuP/AsxEZSFK4/8BAHAsPSL8lzyUCICVgJQIlZ1JSZyUDVApDUBYRHBYAPzMz7TIvFzkvLy9dXSsrK10Q1ivtEM05ETMRMy8rXRDtAS9d7TMvXe0REjkvXTMz7TIvERI5OS8vXRDtETk5EO0zL+397SsxMAArXStdKysrKwFdAF1dXQEUBgceARURFBYzMjY3FQ4BIyIuAicjDgMjIiY1ND4CPwE1NC4CIyIOAgcnPgM3LgE1ND4CMzIeAgEyPgI9AQcOAxUUFhM1NzMVBRc0LgIjIg4CFRQeAjMyPgIDTjM1gYEqOw8eDiJDJjNJLhgDBhxEWHJKnqBPgKNU7Bs3VDgyUTolBrwIJ0RjRTEwHjxbPT1bPB7+nlN6USi+N29ZOFlm48X+1F0NHS4hIS4eDQ0eLiEhLh0NBOg0WhwesI7+LlBRBANwCAgbN1E2NFQ7IKyWa4lOHwEEO0NeOhsPJ0MzETRbSDQNHFgyJ0g3ISE3SPtmP2B0NVkEAQ8wW0xSZAVjFL0dtPAPHRgPDxgdDw8eGA8PGB4A//8AAQAABKsGqRImAIYAABEHAHQA9QD1ABW0AhkFJgK4AQW0GRwDDSUBKzUAKzUA//8AFP/sBLgFtBImAKYAABEGAHRaAAATQAsDWhEmA1paXR5AJQErNQArNQD//wA4/9oEkgapEiYAmAAAEQcAdABkAPUAE0ALAywFJgNlLC8KFyUBKzUAKzUAAAD//wBu/+wEXQW0EiYAuAAAEQYAdGQAABNACwMyESYDZDI1DgAlASs1ACs1AP//AE/+WQRoBVoQJgKS4wASBgA2AAAAAP//AKf+WQQkBEsQJgKSBQASBgBWAAAAAP//AEz+WQSABUUQJgKS4wASBgA3AAAAAP//AL7+WQP5BVQQJgKSBQASBgBXAAAAAAABARsEsQOxBbQACQAlQBcgAVABYAGAAQQBBgMgCw9IA44JjAUCkwA/M/3tKwEvxF0xMAEVIycjByM1NzMDsWnbAuho/qQExRSKihTvAAAAAAEBGwSxA7EFtAAJACtADiAIUAhgCIAIBAgDBwQGuP/gQAkLD0gGjgSMAZMAP+3tKxEzAS/EXTEwASMnNTMXMzczFQK9pP5o6ALbaQSx7xSKihQAAAEBUQTUA3gFUwADABRACQ8AAQABA48AlAA/7QEvzV0xMAEhNSEDeP3ZAicE1H8AAAEBLQSxA58FtAARADFAHwyEDw0fDS8NAw0NBoQABSAFAgUMBox1CYUJAgmPAJMAP+1d5DIBL13tMy9d7TEwASIuAiczHgEzMjY3Mw4DAmVKbkwsCH8RVlJVVRF/CSxLbgSxL0tcLT9GRj8tXEsvAAABAgMFDALLBcwAAwAVQAoDShAAAQAAUwEAAD/tAS9d7TEwATUzFQIDyAUMwMAAAAACAXQEfANYBgsAEwAnAIu5ABH/6LMJD0gNuP/oQGEJD0gHGAkPSAMYCQ9IFIQAABAAIAADMABwAIAAsADAANAABmAAAQ8AHwACAB6EAAoBChmOfw+PDwIPQAkMSA8jji8FTwVvBd8FBA8FLwU/BU8FbwV/BZ8FvwUIBUAWGUgFAC8rXXHt1Ctd7QEvXe3UXV1xcu0xMAArKysrARQOAiMiLgI1ND4CMzIeAgc0LgIjIg4CFRQeAjMyPgIDWB48Wz09WzweHjxbPT1bPB55DR0uISEuHg0NHi4hIS4dDQVEJ0g4ISE4SCcnSDchITdIJw8dGA8PGB0PDx4YDw8YHgAAAQG5/lUDFwAAABcAMEAcCEANEEgFQA0USAyHCwsGAAARhAAGAQYLFI4DlQA/7S8BL13tMy8SOS/tMTArKwEOASMiJjU0PgI3Mw4DFRQWMzI2NwMXHEcoaWoiMDYThRk0KxsxLR06HP5wDA9mVS9PPSoLDi07RicqMA0LAAEA/wSxA8wFqQAfAFFAEAofGh8CHhgJD0gFDxUPAg64/+hAJAkPSBqDDxsvGz8bfxuPGwUbGwqDAAswCwILGgWPEIwVjwoAkwA/Mu397TMBL13tMy9d7TEwACtdK10BIi4CIyIOAgcjPgMzMh4CMzI+AjczDgMDAipUUE0jFx0TCgVvBRQtSjssVFBKIRceFAoEcAUUK0oEsSUtJRAeLB0tWEcsJS0lEB8sHCxYRy0AAgAdBLEDEwW0AAUACwBaQA8CiXQDhAMCBgMWAwIDiwW4/+hAFgsPSAWKAAAIiXQJhAkCBgkWCQIJiwu4/+hADwsPSAuKAAYBBggCjAsFkwA/M+0yAXwvXRjtK/1dXe0zL+0r/V1d7TEwATU3MxUFITU3MxUFAYnPu/7U/jbPu/7UBLEU7x3mFO8d5gABAdsEsQLvBfYABQAuQApmBXYFhgUDAoYDuAELQAkFgy8APwACAAK4AQyxBZMAP+0BfS9dGO397TEwXQE1EzMVAwHbT8WrBLEhASQl/uAAAAMBNwSxA5YGQQAFAAkADQB1sgKGA7gBC0AKZwV3BYcFAwWDALj/wLMiJkgAuP/AQDIXG0gAAAYNiFQKATQKRApUCoQKlAqkCuQK9AoIEAogCgICAAoBCgmIDwYBBggLkAkKArgBDLEFkwA/7dQy7TIBL3HtL11fXV1x7RI5Lysr7V397TEwATUTMxUDNzUzFSE1MxUCCTbFkpWP/aGRBLEhAW8l/pUSuLi4uP//AAAAAATMBUYSJgAkAAARBwFU/ib/UAAUswIXAwK4/iW0FRgEByUBKzUAPzUAAAABAfABpALbAs8AAwAoQBsDliAAAQAAoAACAACbDwE/AW8BnwHPAe8BBgEAL13tAS9dce0xMAERMxEB8OsBpAEr/tUA////zwAABMMFRhAmAChhABEHAVT99P9QACa0AQ4DAQ+4/8CzFRxID7j/wLIJEki4/+C0Dw8AACUBKysrNQA/NQACAAAAAARpBUUACwARAGhAHmYRdhGGEQMLWgAIAAcDWhAAAQ8EAQQABAAMEw6GD7gBC0ASEYMMAl9QBwGgB7AHAgcHAAURuAEMtw4OCQUDBAASAD8yPzMzL+0REjkvXXHtAS/t/e0REjk5Ly9dXe0yETMQ7TEwXSERIREjETMRIREzEQE1EzMVAwOv/li/vwGouvuXT8WrAm/9kQVF/coCNvq7BAAhASQl/uD//wABAAAEgAVGECYALH8AEQcBVP4m/1AAJrQBDgMBD7j/wLMSE0gPuP/AsgkPSLj/zLQPDwAAJQErKys1AD81////z//sBKwFWhAmADJGABEHAVT99P9QABSzAiADArj9rbQeIQoAJQErNQA/NQAAAAIAAAAABK8FRQAIAA4AlkAUBg4WDiYOAywHAQcYDRBIIwUBAwW4/+hAJg0QSAAGEAYgBgMPBAcIDgEEAg4FDwQBBAYBWgJACw5IAgIQC4YMuAELQBQOgwkGA0AAUABgAAM/AAEAAAQBDrgBDLYLCwcEAwESAD8/MzMQ7RESOS9dXTMzAS/t/e0SOS8r7TnGXTIrARgQTeYyMTAAX15dAStfXStdXQERIxEBMxsBMwE1EzMVAwNNvP6eyfj2yftRT8WrAkj9uAJIAv39pwJZ/rshASQl/uAAAAL/zgAABJsFWgA5AD8Av0A2Zj92P4Y/A2sJewmLCQNrMXsxizEDYiVyJYIlA2IVchWCFQNFOFU4AkUCVQICOh8BOhsBPIY9uAELQDU/gzpAGiFIOjo1MFwoClwSKBIoEjUYEBAFWhAYIBgwGIAYBBAYARgYQUAqKiJaNUAQFEg1P7gBDEAPPAMTJycQKl8SKRIdXwAEAD/tPzPtMjIvMz/tAS8r7TMvERI5L11x7TIvERI5OS8vEO0Q7REzLyvt/e0xMABdXV1dXV1dXQFdATIeAhUUDgIHMDc+ATsBFSE1PgM1NC4CIyIOAhUUHgIXFSE1MzIWFzAXLgM1ND4CATUTMxUDAo1xuYRIJk93UTQWMBPI/jFLXzYUJ0xzTE1zTScUNl9L/jHIEzAWNFF3TyZJhLn9sU/FqwVaVZ3diF+zoIo2BgIDnOA3fYiQSmmod0BAd6hpSpCIfTfgnAMCBjaKoLNfiN2dVf6mIQEkJf7gAAAA//8Alf/sBF0GQRImAYYAABEGAVXzAAAZtQMCAQMCAbj/4bQeHBEHJQErNTU1ADU1NQAAAP//AAAAAATMBUUSBgAkAAD//wCiAAAEgAVFEgYAJQAAAAEA4AAABFsFRQAFACBAEQMDBwBaAAEQAQIBBV8CAwASAD8/7QEvXe0SOS8xMCEjESEVIQGfvwN7/UQFRZwAAAACAAwAAATABUUABQASAHlATCkCAQYDAQMBUhILEl4EAxQEBAMCAVIRCxFeAQIUAQECAgMLAwEEWm8SfxKPEgMQEgESEhQRWgFaCwFLCwELAwIDEgQBAQQSAxFfABIAP+0XMi8vLz8zM11dAS/tEjkvXV3tERc5hxArhyvEhxgQK4crxDEwAV1dMzUBMwEVAS4DJw4DBwEhDAHd9AHj/gYSIhsRAgESGyIS/soDNJEEtPtOkwOpLl5PNgQENk9fLfzzAAD//wCiAAAEYgVFEgYAKAAA//8ASQAABIMFRRIGAD0AAP//AKIAAAQqBUUSBgArAAAAAwBm/+wEZgVaABEAHQAhAMpAUVYQAUUQAUYNVg0CSQdZBwJJA1kDAnYdhh0CNB0BdhmGGQI0GQF5F4kXAjsXAXkTiRMCOxMBHx4vHj8efx6PHgUeQBUcSBAhICEwIXAhgCEFIbj/wEBCFRxIIR4hHgoAW18SARJAGRxIABIBEhIjGFtQCgEQCgEKIF8PIT8hfyGPIQRvIY8hnyG/Id8hBSEhGxVfDwQbXwUTAD/tP+0SOS9xcu0BL11x7RI5L10rce0ROTkvLytdK10xMABdXV1dXV1dXV1dXV1dARQCDgEjIi4BAjU0Ej4BMzIAAxACIyICERASMzISAxUhNQRmRoS/eH/AgEBEgr989wEIyZ6YnJyemaOUj/6xAqmt/vqxWV6zAQWnrQECrFb+pf6qAQ4BB/75/vL+8v7sARgBVpqaAAD//wDKAAAEAQVFEgYALAAA//8AogAABMsFRRIGAC4AAAABAAoAAATCBUUAEABfQDcQAVIBBwFeABAUABABAA8BUg0HDV4ODxQODw0OBw4QAAEAABJ/Do8OAg5aBwFLBwEHEA8DDgASAD8yPzMzXV0BL10RMy9dEjkQAMGHBSuHK8QQAMGHBRgrhyvEMTAhIwEuAScmJwYHDgEHASMBMwTCyf7CEB4MDgwNDgwdEP7AyQH5xgOGMGEpMC0vMCphLfx6BUUA//8AgQAABEsFRRIGADAAAP//AKIAAAQqBUUSBgAxAAAAAwCHAAAERgVFAAMABwALAIdAZcAH0AfgBwPgB/AHAr8CzwLfAgMCQCEkSJ8Irwi/CAMAC8AL0AvgCwQAC+AL8AsDAAsIAgcHAggLAAUNzwQBAAQQBAIECl8PCz8LfwuPCwRvC48Lnwu/C98LBQsLAQVfBBIAXwEDAD/tP+0ROS9xcu0BL11xEhc5Ly8vLy9dcV0rXV1xMTATNSEVATUhFQMVITWbA5f8VQO/kf1jBKmcnPtXnJwDA5qaAP//AGb/7ARmBVoSBgAyAAAAAQCjAAAEKgVFAAcAQ0AvA1ofBC8EPwRvBH8EBW8EfwSPBL8EBAQECQdacAABAAAQAKAAsAAEAAZfAQMEABIAPzI/7QEvXXHtEjkvXXHtMTAzESERIxEhEaMDh7/99wVF+rsEqftXAP//AKIAAARfBUUSBgAzAAAAAQBsAAAEoQVFAAwAZ0AZdgiGCAIIAgIFAQdbnwWvBb8FAwMFAwUBC7j/wEAfCRZICwsOClsQAQEBAwdfBAkIQAIBAgIJBAMBCl8AEgA/7TI/EjkZL3EzMxgQ7TIBL13tEjkvKxI5OS8vXe0REjkvzTEwAF0zNQkBNSEVIQEVASEVbAIa/fcD5/zwAcr+FgNtogIlAd2hnP5hfP4OnAAA//8ATAAABIAFRRIGADcAAP//ACQAAASoBUUSBgA8AAAAAwAI//UExQVPAB0AKgA3AJS5AC3/4LMMD0gpuP/gQFIMD0g2GAwPSCAYDA9IHlpAAA4HDwgOK1oPJRgHXDEVfwiPCAIPCD8IvwjPCARPCF8IfwiPCAQICDk4IzJgFRgVJjFgCQYJkBUBFQkVCQcWAwcTAD8/Ejk5Ly9dETMQ7TIRMxDtMhESATkvXXFyMzPtMjJ91BjtKwEYEE30Gu0xMAArKysrARQOAisBFSM1IyIuAjU0PgI7ATUzFTMyHgIHNC4CKwERMzI+AiUUHgI7AREjIg4CBMU/ebFyKbUpcrF5P0F8tXQetR10tnxBwi1SdkgFDEpzTyr8xypPdEkMCEh0UiwCwmG1i1PZ2VOLtWFqsX9HrKxHf7FuVoBVK/1IMl2DUFCDXTICuCtVgAAA//8AJAAABKkFRRIGADsAAAABADEAAAScBUUAIwBpQD8CFhIWIhYDAg0SDSINAwwEGVxAHA4jBwAOEyNcAApcrwcBBxA/AAF/AI8AAhAAAQAAJCUTEGAiAQEaEQgDABIAPz8zMzkvM+0yERIBOS9dXXEz1F3tEO0yKwEYEE30Gu0xMABfXl1dIREjIi4CNREzERQeAjsBETMRMzI+AjURMxEUDgIrARECGTpyo2gxoR9DaUkzmzNJaEMgoTFponI6AY1Uj7xoAbH+S1CLZjoDMPzQOmaLUAG1/k9ovI9U/nMAAQA7AAAEkwVaADkA2kB4eRWJFQJ2JYYlAmsJewmLCQNrMXsxizEDZiV2JYYlA2YVdhWGFQNGOFY4AkYCVgICORsBOR8BMFwoClwSIBIwElASYBJwEgVPEgHfKO8o/ygDACgQKCAoA3AogCgCKBIoEjUYEBAFWoAYkBjQGOAY8BgFkBigGAIYuP/AQCMJDEgYGDU7KioiWi81PzUCNUAhJEg1EycnECpfEikSHV8ABAA/7T8z7TIyLzMBLytd7TMvERI5Lytdce0yLxESOTkvL11xcXFyEO0Q7TEwAF1dXV1dXV1dAV1dATIeAhUUDgIHNjc+ATsBFSE1PgM1NC4CIyIOAhUUHgIXFSE1MzIWFxYXLgM1ND4CAmd8xYpJLVV+USAeGjYTyP4dS2Y9GidTf1dYgFIoGj1mS/4dyBM2Gh4gUX5VLUmKxQVaVZ3diF+zoIo2AwMCA5zgN32IkEppqHdAQHeoaUqQiH034JwDAgMDNoqgs1+I3Z1VAP//AMoAAAQBBoYSJgAsAAARBwBpAAIBCwAXQA0CAQwFJgIBAhAOAAElASs1NQArNTUAAAD//wAkAAAEqAaGEiYAPAAAEQcAaQASAQsAF0ANAgEJBSYCARENCwQIJQErNTUAKzU1AAAA//8Agf/sBJAF9hImAX4AABEGAVQ8AAATQAsCPBEmAhg8PwgXJQErNQArNQD//wCv/+wEQQX2EiYBggAAEQYBVFAAABNACwE6ESYBPTo9EAYlASs1ACs1AP//ALP+VwQZBfYSJgGEAAARBgFUUAAAE0ALASYRJgFPJikTJCUBKzUAKzUA//8Alf/sBF0F9hImAYYAABEGAVQeAAATQAsBFBEmAQoUFxEHJQErNQArNQD//wCj/+wERAZBEiYBkgAAEQYBVfEAABm1AwIBAwIBuP/ktCooCgAlASs1NTUANTU1AAAAAAIAgf/sBJAETgAnADsAlkBqeiWKJQJ6NIo0AnowijACZSoBSjpaOmo6AyUNNQ0CCwYbBnsGiwYEeyKLIgIiIXsWixYCIRYXFxxJEABgMnAyApAyoDLQMuAyBDIyPShHAAgBCCIVFg83UHQQhBACEAsQLVB7J4snAicFFgA/M13tPzNd7T8/AS9d7RI5L11xMzPtMi8zM10vM10xMABdXV1dAV1dXSUOAyMiAhEQEjMyHgIXMz4DNzMOAwceAxcjLgMnARQeAjMyPgI3LgMjIg4CA3YZQldvRs3B2dFFcFY/FAIEDhMXDbwWLiceBQMXHyQStwsVEA0D/cQcO11CNmRSPQ4MLUdmRkJgQB/tOF5FJgEUARgBHAEaJ0VdNhU4P0EeL4CLizpnr5BuJxxCQToUATFwoGcwNGugbFaac0QuZqMAAAIArP5XBGcFzAAgAEAAjbdqKXopiikDNLj/4EA0DRFIRR9VH2UfA2Q/dD+EPwM1P0U/VT8DCgMaAwIFFBUUAhwXPDwNF0ghIQ4ASAA2EDYCNrj/wEAdEBNINjZCLA1GAA4BDhw7UDw8EjFQBRYmUBIADRsAPz/tP+0ROS/tOQEvXe0yEjkvK13tEjkv7RI5LxI5MTAAXV1dXV0rXQEUDgIjIiYnIx4BFREjETQ2MzIeAhUUDgIHHgMBNC4CIyIOAhURHgMzMj4CNTQuAiM1PgMEZzVvrXhmoDgGAwO05OJjmGY1Iz1RLjlyWzj+9Bs5VzxGaEQiHEdRVytIbkkmLmGZa1F0SyMBlVibdEI3JzlcNf7XBazt3C9aglJJb1I4Egs3XYkCeixNOSAjTXpY/NATIhkOKUxqQkFuUS2OBi5LZAAAAAEANf5YBJAEOgAYALhAGVQLAUULAUAOUA4CLw4BE0eKFwEXGA0QSA64//BAIQwRSBcOBmkGAQYNFBQYDCANEUgoDDgMAgMMcA2ADQICDbj/wEA9Cg9IDQ0aggABcwABZAABUwABRAABNQABJgABEgABBAABABhACxNIGHYGhgYCOw5LDlsOAw4GFxcTGwwADwA/Mj85LzMzXV0BLyszXV1dXV1dXV1dETMvK19dM19dKxI5LxI5XREzMysrXe0xMABdXV1dCQEeAxc+AzcBMwEOAwcjPgE3AQD/AQ8LHRwVAgMXHh8MAP/F/ksRHxsWCL8RMBj+KQQ6/W8bT00+CQtATlIdAof7+y1vfIRBg9VbBC8AAAIAcP/sBFUFzAATADIAo0AbdRuFGwJpCAFqBwFEElQSZBIDYwwBRAxUDAIauP/oQFULEUgyMh9HAHAZgBkCUxljGQIkGTQZRBkDGS4FAC8vKXAAgACQAANQAKAAAgAAEABgAHAAgAAFAAA0CkcpQCgtSClAGBtIACkBKS8yUC4FMQAPUCQWAD/tPzk57TIBL10rK+0SOS9dcXISOS8SOTkzXV1dEO0yLzEwACtdXV1dXV0BNC4CJw4DFRQeAjMyPgIBIi4CJwEeAxUUDgIjIi4CNTQ+AjcBNSEVA5g2S1AaSYpsQShOdUxRdUsj/vANKS0qDQE8N2tVNEWAuHRyuYJHToSuYP7BAuwB11WRc1YbGlFykltMg2A3Nl+DA7QCAwIB/sc2dIafYm62g0hEf7dzcLCHYSEBSIKPAAABAK//7ARBBE4AOQCKQFhzEoMSAnwZjBkCeSWJJQJ2A4YDAgoNGg0CBR4VHiUeAypGFS8gLwEbLxsvEAYkIyMFYAZwBoAGAwYGOzdHABABEBUwUC8vACdQICAkASQkIBAAUAsFBQsWAD8zLxDtPzMvXRDtEjkv7TkBL13tEjkvXTMzLzMREjk5Ly9dEjntMTAAXV1dXV1dJTI+AjcXDgMjIi4CNTQ+Ajc1LgM1ND4CMzIWFwcuASMiBhUUHgIzFSIOBBUUFgJtRXNbQxVpIFl1lV1zpGkyLUtkNjNYQSU3bKBplNNDgC+RaYB3SHeaUzVtZlhCJoRyHzA5GWQnRzUgLlR0RTpfRSoFAgYoQFYzPmpNLFZjWEdEVUo5RiUMhwQOGi1BLltdAAEAuP6VBE4FzAA6AHpAKnk4AWk3AWoZehmKGQNzAoMCAkUCVQJlAgOMKgEZKgEqNDQMSQAXEBcCF7j/wEAhDxNIFxcjPDIyAEcAIwEjNDFQMmYFdgWGBQMFHBwRMgARuAEJAD8/EjkvM10Q/cQBL13tMy8REjkvK13tMi8zXV0xMABdXV1dXQEUHgIXHgUVFA4CByc+AzU0LgInLgU1ND4ENzUOAyMhNSEVDgUBd0Fmfj0nVVNLOSISGh0KfgkTEAs0V3E9LWZkXEYqPGeJnKVPDCMqLRf+MgMiTaOaiGc7AXtATS8bDwkWHSc1SC4iR0I2ETgMISYnEyIxJRwMCRkkNUxlQ1SsrKqjmEQGAQICAY6KRpukqqikAAAAAQCz/lcEGQROACUAQEApcCKAIgIEIRQhJCF0IYQhBSVGAAAnGQxGAA2ADQINGQZQHxATDw0VABsAPz8/P+0zAS9d7TISOS/tMTAAXV0BETQuAiMiDgIVESMRNC4CJzMeAxUzPgMzMh4CFREDZCE7UDA7Z00stAECAgGqAQIDAgMYQVVqQlOAVy3+VwRgUGc9GC1VfVH9jQNTIktDMAcFLDk7FC9MNR0sXJBl+4YAAAADAJf/7AQ2BcsADwAaACUAt7ZrJAFjHQEYuP/oQGoOEUgTGA4RSF8jbyMCSyMBXx5vHgI7HkseAlAYYBgCRBgBJhg2GAJQE2ATAkITASYTNhMCIQBHTxVfFW8VnxWvFQU/FU8VjxWfFQTPFd8V/xUDFUAmKkgVFScgFkeQCAEACMAI0AjgCAQIuP/AQBAiJ0gIFlEgIBAbUQsQUAMWAD/tL+0SOS/tAS8rXXLtMhI5LytdcXLtMzEwAF1dXV1dXV1dXV0BKytdXQEQAiMiLgECNRASMzIeARIBMj4CNyEeAxMiDgIHIS4DBDbw5Gyrdj7p6HmvcDb+Kj5kSSoD/d0DLEdeQj1kSCoDAiMDKEVhAt3+g/6MXLoBG8ABdgF4Xbz+5/zYNIDYpKPYgTQE2TN+1KGh1H4zAAABAJX/7ARdBDoAEwBYQDsMGAkNSCAHMAdAB7AHBAcHAEYPABIBEhIfD08PXw9vDwQPQBI8SA8PFBURUBIPMAZABlAGAwYGA1AKFgA/7TMvXT/tERIBOS8rXTMvXRDtMi9dMTAAKwEUFjMyNjcXDgEjIi4CNREhNSECiFBUQmcqXjqVY1yCUyb+wQHzAVpvZT4seEBMLlyKXQJPjv//AOwAAARlBDoSBgD4AAAAAQByAAAEUgXMACMA1EB8dACEAAJ4F4gXAnMUgxQCAkAUUBRgFANxE4ETAiUTNRNFE2UTBGQRdBGEEQMiEDIQQhADbBZ8FowWAxYQCw5IYyJzIoMiAzYiRiJWIgMlIgEGIhYiAkgAWACIAAMUABxGHFYcAhwVCgojiRYBFhUQcBWAFQIPFQEVFSUiI7j/8EAaACMQIwIjWxwBHBQAQA8SSAAADyMVFQZQDwAAP+0/MxI5LyszM10BL104MxEzL11dODNdEjkvEjldETMzXTEwXV1dXStdAF1dXV1dX10BXQBdAScuAyMiBgcnPgMzMh4CFwEjAy4DJw4DBwEjAjMkHy0sNSYPMREjESksKhE8WEc/JAGrvs8IEhIQBQcWGRgI/v+7A8VjVGw9FwgEhAUIBwQkUYNf+4sCQRY5OjgVFTw9OBL9wQAAAAEAnP5XBH0EOgAnAGtASHoliiUCGx8rHzsfAx8LFhYORg8LHwsCDwuvCwJPC18LvwsDCwspAydGnwCvAAIAQCctSABAHCBIAAABABMIUB8aIxYMAQ8AGwA/PzM/MzPtMgEvXSsrXe0yEjkvXXFy7TIvETldMTAAXRMRMxEUHgIzMjY1ETMRFB4CMzI2NxUOASMiLgInIw4BIyImJxGctSA6VDSAkrQLFB0SCyALGjMkNkcsFAIDNJNkQ20f/lcF4/1STmpBHK6iAnP80Cs5IA0FA4EIDB40RylfYykm/hwAAQBcAAAENgQ6ABIAfrUGCBYIAgi4//BARw0RSEkGAXoCATcJARBGDw8McAWABQJlBQEFBgFSCAkISwcGFAcGCAcKCRoJagkDCQcARgAMEAxgDAMMDBQfBwEHDwcPCQYVAD8zPzMBL10SOS9d7RE5XRAAwYcFK4crxAEyXV0RMxgv7V0xMABdAV0rXQEUDgIHIwEzATYSNTQmJzMeAQQ2QnCTUar+Zr0BS5WJHRSxGBwDTmbc29NeBDr8YLkBT6NRdy0tcQAAAAABAL/+mgQjBcwAUACqQGB6LoouAmoJegmKCQNKLFosAkUlVSUCdDKEMgJGMlYyZjIDBTcVNwILAhsCAg0NHQ0tDQMFKCNGCxAcHEAJDEgoHBoLCxocKAQAOklgRXBFgEUDRUVSMEcAAAEABSlRKDW4AQq2SihKKEoaP7gBCbQcGVAaAAA/7TI/Ejk5Ly8Q7RDtOQEvXe0SOS9d7RIXOS8vLy8rETMQ7REzMTBdXQBdXV1dXQFdAF0TND4CNzUuAzU0PgI3NQ4FKwE1IRUOBRUUHgIXFQ4FFRQeAhceAxUUDgIHJz4DNTQuAicuBb86fMGIUopjNzBTbj4IKTc/OTAMXgLeM29rYEkrSnqeVEKHfW1RLj5iez06dmA9EhodCn4JExALJ0hlPS1lYllEKAFiTJN8WhMCBSdEYD5AWT0kCggBAQICAQGOiAYRGiQzQy0/UTEYBoMIHiw7TF44QE8yHg8OIjlZRCJGPzUROAwhJicTIi8jGwwJGSQ0SmMAAP//AIL/7ARJBE4SBgBSAAAAAQAW/+wEogQ6AC4AZ0BBbxkBEBAJEUgQIAkRSAoKLS0AGkcbXyYBJhsmIQBGcBOAEwITQAsOSBMTMBRGACFAIVAhAyEUACFQLA8bFQZQDRYAP+0/P+0yMgEvXe0SOS8rXe0RMzMvXS/tETMvMy8xMCsAK10BERQeAjMyNjcXDgEjIi4CNREhFRQOAgcjPgM9ASIOAgc1PgMzIRUD1g0YIxYOJw0UH0UrOlM0GP6MBxAaE7wTHhQLJ0k9LwwMKzM2FwPVA6z9Xis5IA0FA4EIDBw7XkICyUiC+d/ASkzC3vN9UAYLDQeWBgsIBI4AAAAAAgCd/lcEVARPABoALwB7QC9DLlMuYy4DTCNcI2wjAzwITAhcCAMdSA9JPB1MHVwdAwBHUBugGwIAGxAbYBsDG7j/wEAnKSxIGxsxJg9GnxCvEAIQQCctSBBAHCBIABABECBQFhAPGytQCgUWAD8z7T8/7QEvXSsrXe0yEjkvK11x7TEwAF0rXV1dARQOAiMiLgInIx4BFREjETQ+AjMyHgIHNC4CIyIOAhURHgMzMj4CBFQ/c6FiPWNQQR0EAgK0PHSqbWe1hk7BLFN0SEVkQB4dR1BXLENkQyECBHbFjk8UJTUhHj0g/lcD7nfBiEpPltqEaKZzPTVlkl3+wyM3JRQ6a5gAAAAAAQCw/pwEKAROADcAgkBXgw8BbB58HoweA2okAWo1ejWKNQNqNXo1ijUDQwlTCQIqAzoDagMDMzIyEUkcQBUYSGAcARwcOTYHdgeGBwMHRwAmASZlDHUMhQwDDCEhLRYzMwBQLRAWuAEJAD8/7TMvERI5LzNdAS9d7V0SOS9dK+0yLzMxMABdXV0BXQBdXV0BIg4EFRQeAhceAxUUDgIHJz4DNTQuAicuAzU0PgQzMh4CFwcuAwKwPWBHMR8NKVeFXTl5ZEESGh0KfgkTEAsnSWlCZ6Z2QBUxTnKYYkVvWUMYcRY0PUcDwS1MZG5xNERfRjccESY8WkQiRD4zETgMISYnEx4tJSARGkBkmHI7jo+GaD4aKzYdchgtIxUAAAAAAgBc/+wEzQQ6ABwALwCBQFxELlQuZC4DYykBRClUKQJtJgFLJlsmAiomOiYCIhcKwBDQEPAQAxAQAEfPHd8d/x0DHUAoNUgAHRAdYB0DHR0xZwoBKEcfCgEKQCg1SApAGCFIChEjUA8PK1AFFgA/7T/tMgEvKytd7V0SOS9dK13tMi9dETk5MTAAXV1dXV1dARQOAiMiLgI1ND4CMyEVIyIuAicVHgMHNC4CJyMiDgIVFBYzMj4CBDY9e7d7e7p8P1aZ1X4CL5sJIyssERw3Kxq9FCItGVlSkGs9l5NOdUwmAetwvIdMSovKgZDSikKOAQICAQQqYG9/TkqBb2AqL2Sdbs/ONGGLAAAAAAEAlf/sBBwEOgAlAE1ALwoiGiIqIgMhGAkPSBkZnwyvDAIMDA9GJA8FHwUCBQUAJAEkJCYnFFAfFg4AUAsPAD/tMj/tERIBOS9dMy9dEO0yL105fC8xMAArXQEiDgIHNT4DMyEVIREUHgIzMj4CNxUOAyMiLgI1EQGRJ09FNQwMKzM2FwLQ/ooWJCwWBycrJwgPMDY3FTpcQCEDrAYLDQeWBgsIBI79VCs2HAoCAwQBgwQHBgMZOl5GAskAAQCj/+wERAQ6AB8ARUArZA4BRBNUEwIKBxoHAhtHABoBGhoARxUVIQ1GAAoBChoLD3kFiQUCEFAFFgA/7V0/MwEvXe0SOS/tMy9d7TEwAF1dXQEUDgIjIi4CNREzERQWMzI+AjU0LgInMx4DBEQ7ebZ7baZwObWJhkptSSQUISgVvBIoIBUCO4jbmlIya6Z0Apf9Y5KUMmyqeESTi3koKHGGlQACADL+VwSZBFIAJQAwAJO1dSOFIwImuP+Ysg9JJrj/yLMLDkgZuP/YQBULD0gWOAsRSGoVehWKFQMFHxUfAhO4/8BANgkRSBMTDS8GSRsHBw0ASBAm4CYCJiYyZg0BGEhPDV8Nbw2fDa8NBQ0vG1EFCBUTK1ESIRAGGwA/PzPtMj8z7TIBL13tXRI5L13tEjkvM+0yEjkvKzEwAF1dKysrK10BFA4CBxEjES4DNTQ+AjcXDgMVFBYXETQ+AjMyHgIHNC4CIyIGFREkBJlJg7NroG6xfEIwY5lpFUJgQB+dlyhNc0tRf1gvqRgsQChLSgFBAjWX14xHBv5pAZcFSIrPjWa8lmcSiA9Nco9Q1dMIAkRgmmw5TI3HeWCaazmUjf25DQAAAQA6/lgEjgRQABgA4kA3NhgBBhAWEAJkD3QPhA8DBQ8VD0UPVQ8ERRZlFnUWhRYEBhYWFjYWAzYWAQkWGRYCFEcVEBUVA7j/4EAqEhZIJgN2A4YDA2YAAWUTdROFEwMnEwEDFhMAAwQKGEcXEIQXAXAXAQIXuP/AQAkKD0gXFxoBRwK4//BALgICCkALEUgKFA8kE3QThBMDfwCPAAJLAFsAAjkAAS0AAQAWAxMEAQdQDRAYARsAPzM/7RIXOV1dXV1dPwEvKzMvOO0RMy8rX11dOO0SFzlfXV1dXSszLzjtMTAAXV0BXV0AXV1dAV0lASMBAy4BIyIHJz4BMzIeAhcTATMJASMCc/6VvAHWvjteMx8dIhhIIDBLREQoogEmu/5yAbS+7/1pAzkBV2twD4MLDhw/ZUr+2QIb/Uf81wABAFj+VwRxBTwAHwCIQF99Eo0SAn0LjQsCChIaEgIKCxoLAgAOSR0PDxUISX8FjwUCIAUwBQLwBQHPBd8FArAFAQVACw5IEAUBBQUhGEkPFV8VjxWfFa8VBTAVcBWAFQMVHh4GFg8NAB1QEBYOGwA/P+0yMz8zMy8BL11x7RI5L10rXV1xcnLtEjkvM+0yMTAAXV1dXSU+AzURMxEUDgIHESMRLgM1ETMRFB4CFxEzArRMbEUhnzJrqXegdqlrMqEgRGxLoHIBIEt7WwKG/Xx6rG41Af5rAZUBNW6segKE/XpaekshAgTKAAAAAAEANf/sBJkETwBBAJ9AcQoYGhgCCicaJwIPDwoAMDAqHwBJPz8qFUgvCj8KTwpvCn8KjwoGDwq/Cs8KAwpAHyJIEAqwCuAK8AoECgpDNUhAKmAqcCrQKuAqBT8qAU8qXypvKp8qryoFKkBAEHAfgB8CHxoFdjqGOgI6UCUWLxAQAD8zP+1dMjMzXRE5LwEvXXFx7RI5L10rcXLtEjkv7TkSOS8REjkvMTAAXV0BFB4CMzI+AjU0LgInNx4DFRQOAiMiLgInIw4DIyIuAjU0PgI3Fw4DFRQeAjMyPgI9ATMCtxgsPCUlNyQSFS9MOB9XgFQpLE9wRTJUQC4MBAwuQFQyRXBPLClUgFcfOE0vFBIkNyUpPioVnwHBTX1XLzlpk1pSmHtVD4YScKHCZYDIiUgmR2I8PGJHJkiJyIBlwqFwEoYPVXuYUlqTaTk2W3pF/AAAAP//AJX/7ARdBXsSJgGGAAARBgBp5AAAGbYCARQRJgIBuP/RtBgWEQclASs1NQArNTUAAAD//wCj/+wERAV7EiYBkgAAEQYAaeQAABm2AgEgESYCAbj/1rQkIgoAJQErNTUAKzU1AAAA//8Agv/sBEkF9hImAFIAABEGAVQ8AAATQAsCJBEmAjskJwoAJQErNQArNQD//wCj/+wERAX2EiYBkgAAEQYBVBQAABNACwEgESYBBSAjCgAlASs1ACs1AP//ADX/7ASZBfYSJgGWAAARBgFULQAAE0ALAUIRJgErQkUqFSUBKzUAKzUA//8AogAABGIGXRImACgAABEHAGkAFADiABm2AgEMBSYCAbj/+LQQDgAKJQErNTUAKzU1AAABAAD/7ASKBUUAKwBotSooCQxII7j/6EA2CQxIBgUaBRoMHBRaFRUXJ1oQDCAMkAygDAQMDC0XEF8wIeAhAiEhCRsXXxgDFRIJXwAGBgATAD8yLxDtPz/tMhI5L13tAS8SOS9d7RI5L+0yETk5Ly8zMTAAKysFIi4CJzceATMyNj0BNCYjIgYHESMRITUhFSERPgMzMh4CHQEUDgIDZSZIPzMRZR1BLSw8UGBNpEe+/toDN/6tJE5SUylgh1coJUluFBQmNCByMzNmbsd6bSAS/SoEqZyc/r4KFRELL1yJWeBRhl40AAD//wDgAAAEWwapEiYBYQAAEQcAdAB4APUAE0ALAQYFJgFABgkBAyUBKzUAKzUAAAAAAQBx/+wEdgVaACwAtUAjRh1WHWYdA4QIATUDAXsgiyACIB8PKwErHysfFXsKiwoCCgu4/8BAWgkMSAsLLip3AIcAAgBbABUQFQIVAGAPKj8qAm8qjyqfKr8q3yoFbyoBKioFRhpWGmYaAyVfGiAgGgRJEFkQAgVfEBAKIAowCmAKcAoFMAqACtAK4AoECgoQEwA/My9dcRDtXT8zLxDtXRI5L11xcu0BL13tXTISOS8rM10SOTkvL10RM10xMABdXV0BHgMzMj4CNxcOAyMiLgECNTQSPgEzMh4CFwcuAyMiDgIHIRUBOwUuVH5VP2VPOhWfHFJ0m2aNzYdBQITKimWYb00ZqA80SWE8UnpSLAUBqwJhcrF4PzBOZjZBRoVpQGW4AQKepgEBr1s3XXlCQS5YRCo7dKxxkQAA//8AT//sBGgFWhIGADYAAP//AMoAAAQBBUUSBgAsAAD//wDKAAAEAQZdEiYALAAAEQcAaQABAOIAF0ANAgEMBSYCAQEQDgABJQErNTUAKzU1AAAA//8AsP/sA9oFRRIGAC0AAAACAAD/8ASxBUUAJgAzAF1AHQgfIS5cBgAGAQAfAQAfQB9QH2AfBB8GHwYTAFwnuP/AQBgLD0gnJzUTLWAhIS4IYB8DF2AQEy5gBhIAP+0/7T/tEjkv7QEvEjkvK+0SOTkvL11xcRDtMhDNMTABFA4CKwERIwMOBSMiJic1HgEzMj4ENxMhETMyHgIHNC4CKwERMzI+AgSxM1+HVOG1HQsaIi5AVDcZKg4LHgocLCUdGhcMKQHrKleMYjSiIDhMLDE5LUk1HQGJUpBqPQS5/lSo+bFxQRkFBYQEAw4uWZjenQIm/cA3Y4xYOFk/Iv4UI0FdAAAAAgBHAAAEsQVFABYAIwBSQDAGBBYEAgEeXBUNDREHXBAXcBeAFwMXFyUUEFxPEV8RAhEdD2ABFBQAHmARDRISAAMAPzI/M+0ROS8z7TIBL13tMhI5L13tEjkvM+0yMTAAXQERMzIeAhUUDgIjIREhESMRMxEhEQE0LgIrAREzMj4CAtxcV4xiNDNfh1T+7f63oaEBSQHeIDhMLGNrLUk1HQVF/cA3Y4xWUpBqPQJ5/YcFRf3AAkD8QjhZPyL+FCNBXQAAAAEAAAAABIoFRQAbAFS5ABf/6EAuCQxIDg4AEAhaCQkLG1oQACAAkACgAAQAAB0LBF+wFQEwFQEVFQAPC18MAwkAEgA/Mj/tMhI5L11x7QEvEjkvXe0SOS/tMhE5LzEwACshETQmIyIGBxEjESE1IRUhET4DMzIeAhURA8xQYE2kR77+2gM3/q0kTlJTKWCHVygCIXptIBL9KgSpnJz+vgoVEQsvXIlZ/csAAP//AKgAAASdBqkSJgG0AAARBwB0AFcA9QATQAsBGgUmARoaHQAQJQErNQArNQAAAP//ABT/7AS2BqkSJgG9AAARBwKTAAAA9QATQAsBGgUmAQ8fKxUZJQErNQArNQAAAAABAJz+VwQwBUUACwBZQD0LXAAAAglaQAYB0AbgBgIfBi8GPwZvBn8GBW8GfwaPBr8GBAYGDQVaTwIBAAIQArACAwIHAwMKBV8CEgAbAD8/7TM/MwEvXXLtEjkvXXFxcu0SOS/tMTABESERMxEhETMRIRECDP6QvwIWv/6Q/lcBqQVF+1sEpfq7/lcA//8AAAAABMwFRRIGACQAAAACAKIAAASUBUUAEAAZAHlAIWUZAWoSAQYOAQhADRRICAgWdwCHAAIAWkARAZARoBECEbj/wLMpLUgRuP/AQCYJDEgRERsLFlpwBgEABhAGoAawBgQGFV9QCwELCxYKXwcDFl8GEgA/7T/tEjkvce0BL11x7TISOS8rK11x7V0ROS8rMTAAXV1dARQOAiMhESEVIREhMh4CBzQmIyERITI2BJQ9ebZ5/fMDlv0pAUJ9unw+wKSk/tUBM6ScAYlXkGg6BUWc/mY2ZpBgeXP+KHD//wCiAAAEgAVFEgYAJQAA//8A4AAABFsFRRIGAWEAAAACAAX+aASvBUUAEAAZAG9ARWsOew6LDgOwEsASAhIPGFoJQA9QDwIPCQ8JGQcCXAMDAFxAGVAZAhlAGRxIEBmQGaAZAxkZGwZcBxJfDwMYAAhfBRIHArgBCAA/Mz/tMjI/7QEv7RI5L10rce0yL+0REjk5Ly9xEO0QzXExMF0lMxEjESERIxEzPgM3EyEHIQMOAwchBACvoPyWoHcpRDguEkMCXKb+2TESKTA4IAIblv3SAZj+aAIuM3qj1I0B/pb+hobNn3oz//8AogAABGIFRRIGACgAAAABAAAAAATMBUUAKwDcQJhrHXsdix0DZA50DoQOA2skeySLJANkB3QHhAcDFhABGRsBCyUbJQINHx0fAgQGFAYCAgwSDAIiJSMrBgkIFytcFOAAAQAACCMdHh4kECMBIyMtDg0NBw8IHwgCDwg/CF8IjwifCAVPCF8IzwjfCAQIQCQnSAhAEBNICCIJJQYJBhdmFHYUhhQDKgFgPxQBFBQdFQ0DJAgAEgA/MjI/MzM5L13tMl0zOTkRMxEzAS8rK11xcjMzLzMRMy9dMzMvMxESOS9xM+0yEjk5ERI5OTEwXV1dXV1dXV1dXSERLgMnAyMBLgEnAzMTHgMXETMRPgM3EzMDDgEHASMDDgMHEQIWCh8gGQT3uQE6HTQXya2UFi4zNx6gHjczLhaUrckXNR0BO7n3BBkgHwoCXwIHCAgB/YcCzx1NNAHY/n44TTEcBwJb/aUHHDFNOAGC/ig1Sx39MAJ5AQgIBwL9oQAAAQBD/+wEcAVZADwA87VFHFUcAja4/+hARA0RSEMmUyYCSgNaAwIzFEUuVS5lLgMuWhlkI3QjhCMDRiNWIwIjJBkUFBkkAwVFOFU4ZTgDOFofEC8QPxADkBCgEAIQuP/AQBoJDEgQED5kBnQGhAYDRgZWBgIGBUALD0gFM7j/8EAgDRFIMxQQDRFIFGAPFT8VAm8VjxWfFb8V3xUFFRULKSm4//BAHw0RSO8jASMjHl8pBAAQDRFIC18AgAbQBuAGAwYGABMAPzIvXRDtKz/tMy9dKxESOS9xcu0rOSsBLyszXV0SOS8rXXHtXRIXOS8vLzNdXRDtXRE5MTAAXV0rXQUiLgInNx4DMzI+AjU0JisBNTMyNjU0LgIjIg4CByc+AzMyHgIVFA4CBx4DFRQOAgJtdq+DXiSlGEJbeVBNelUtwMpHR7SuJ0hoQUx0VDkTryFghKhpbKx4QChJaD9DdVczRYTAFDJbgE9NN2JLLCRDXjp6cpR6aTJQNx4oRFoxPVJ/Vy00XoJNP2VNNg8KMk9sRFmXbT4AAQCiAAAEKgVFABMAlEBtC1x7CYsJAkoJWglqCQMpCTkJAgmADJAM0AzgDAQ/DAHADNAMAn8MjwwCDAwVdBOEEwJFE1UTZRMDFhMmEzYTAwUTARMCXHABAQABEAGgAbABBAGMEgF6EgFpEgESCQEDgwgBdQgBZggBDAgAEgA/MjJdXV0/MzNdXV0BL11x7TJdXV1dEjkvXV1xcTNdXV3tMTAzETMRFAYHBgcBMxEjETQ2NzY3AaKsBQQEBQIQ3qoFAwQE/fgFRfygM2InLigEcvq7A2wnWSYtK/uW//8AogAABCoGqRImAbIAABEHApP/7gD1ABW0ARQFJgG4//y0GSUACiUBKzUAKzUAAAEAqAAABJ0FRQAZAH9AVXkSiRICfxGPEQJsEQERIAsOSAggCxFIFg8mDzYPA3IPgg8CRA9UD2QPAxYPJg82DwMPEhAICQkRABAQEAIQEBsCGFoAGRAZAhkPEhdfAgIZEBIIAAMAPzI/Mzkv7Tk5AS9d7TIRMy9dMzMvMxE5OV1dXQBdMTABKytdXQBdEzMRMj4CNxMzAQ4DBwEjAQ4DIxEjqL8qU1FPJ/vK/tghMykfDAH93v5VES4wLRG/BUX9sxYxUToBe/5SMD4pGAn9IQKHBw4LBv2fAAH//v/wBF0FRQAbAGZADJ0BAQFpGHkYiRgDGLj/yEAOCg5IGBgMGlpAG1AbAhu4/8CzIShIG7j/wLMVGEgbuP/AQBYJDEgbGx0vDD8MAgwaEgFfGAMQXwkTAD/tP+0/AS9dEjkvKysrce0SOS8rXc1dMTABIQMGAg4DIyImJzUeATMyPgQ3EyERIwOj/oYrFiszPVBmQxkvDgsjCh41MCspKBQ9Ate6BKX+rqz++cGBTSEFBZgEAxM3Y6PpoQHg+rsAAP//AIEAAARLBUUSBgAwAAD//wCiAAAEKgVFEgYAKwAA//8AZv/sBGYFWhIGADIAAAABAKIAAAQqBUUABwBDQC8HWh8ALwA/AG8AfwAFbwB/AI8AvwAEAAAJA1pwBAEABBAEoASwBAQEAl8FAwQAEgA/Mj/tAS9dce0SOS9dce0xMCERIREjESERA2v99r8DiASl+1sFRfq7//8AogAABF8FRRIGADMAAP//AHH/7AR2BVoSBgAmAAD//wBMAAAEgAVFEgYANwAAAAEAFP/sBLYFRQAZAHlAVHsSixICexOLEwJpFAGMGAEYIA0QSIIWAWMWcxYCRBZUFgIUFxcVGBAZIBkwGZAZoBmwGQYZGRsKChYVQAsUSBVwF4AXAlQXZBcCFxQUGBUDDl8FEwA/7T8zOS8zXV0BLyszMy8RMy9dMxI5ETMxMF1dXStdXV1dAQ4DIyIuAic3HgEzMj4CPwEBMwkBMwKiLlFabksfQ0A6F1EjUzAmOjY5JCf95tcBoQFdzQE+WYBSJwoSGhCQFiUUNVlFSgON/R0C4wD//wAI//UExQVPEgYBcwAA//8AJAAABKkFRRIGADsAAAABAID+VwS3BUUACwBNQDMBWgICC1pvCH8IjwgDCEAeJUgIQBkcSAgIDQdazwTfBO8EAwAEEAQCBAkFAwsHXwQSARsAPz/tMj8zAS9dXe0SOS8rK13tMi/tMTAlESMRIREzESERMxEEt7T8fb8CCr+g/bcBqQVF+1sEpftbAAAAAAEAXwAABDEFRQAXAE5AM3oHigcCCgYBFloTgBeQF9AXAx8XLxc/FwN/F48XAhcXGQtaCHkFiQUCBV8ODgkWEhQJAwA/Mz8SOS/tXQEv7RI5L11xcTPtMTAAXV0BDgMjIiY1ETMRFBYzMj4CNxEzESMDcyRaZGgwzsy+e28uY2BYI76+Ad4IFBIMu7ICNP3gem0KDxEHAtb6uwAAAAEAWQAABHMFRQALAGxAFAdcBAQAC1wgCDAIQAgDoAjwCAIIuP/AQDUSFkhPCF8IAhAIIAgwCAMICA0DXA8APwBfAI8AnwAFLwDPAN8AAwBAEBNIAAkFAQMHA2AAEgA/7TI/MzMBLytdce0SOS9dXStxcu0SOS/tMTAzETMRIREzESERMxFZogEaogEaogVF+0cEuftHBLn6uwAAAAEAVv5XBMwFRQAPAI5AIAlcBgYKAg9cQABQAAIAAA1cIAowClAKYAoEgAqQCgIKuP/AQEEkKEgfCi8KPwoDkAqgCgJPCl8KAgoKEQVcDwI/AgIvAs8C3wIDAkAoLUgCQB4jSAJAEBNIAgsHAwMNCQVgAhIAGwA/P+0yMj8zMwEvKysrXXHtEjkvXV1xK3Fy7TIvce0REjkv7TEwAREhETMRIREzESERMxEzEQQ+/BiiAQGiAQGijv5XAakFRftHBLn7RwS5+0f9ywAAAAIAAAAABIMFRQAQABkAYkBBZRkBahIBCAkBBgMBABZaDAwOdQaFBgIGWgAREBECPxGvEb8RzxEEABEQEZARoBEEEREbDhVfAAAWDl8PAxZfDBIAP+0/7RI5L+0BLxI5L11xcu1dEjkv7TIxMABdXV1dATMyHgIVFA4CIyERITUhATQmKwERMzI2Ag6Efbp8Pj15tnn+sf6xAg4BtaSkbXWknAMPNmaQWleQaDoEqZz8Qnlv/ih0AAADAGkAAARjBUUADAAUABgAiEAuZRQBag4BBwsXCycLA3cAhwACAFxADQEQDSANMA0DDQ0GGFwQFSAVApAVoBUCFbj/wLMmKUgVuP/Asx0iSBW4/8BAHgkMSBUVGgkRXAZAGh1IEAYBBhBgCQkWBwMRYBUGEgA/M+0/Mzkv7QEvXSvtMhI5LysrK11x7RI5L11x7V0xMABdXV0BFA4CKwERMxEzMhYHNCEjETMyNgERMxEDQz56tnf1qz72+6L+uEVNpZsBF6sBiVeQaDoFRf3AyLby/hR9/vYFRfq7AAAAAAIAogAABJQFRQAOABcAZEAZZRcBahABBgwBdwCHAAIAWkAPAZAPoA8CD7j/wLMpLUgPuP/AQCAJDEgPDxkJFFpwBgEABhAGoAawBgQGE18JCQcDFF8GEgA/7T85L+0BL11x7TISOS8rK11x7V0xMABdXV0BFA4CIyERMxEhMh4CBzQmIyERITI2BJQ9ebZ5/fO/AUJ9unw+wKSk/tUBM6ScAYlXkGg6BUX9yjZmkGB5c/4ocAAAAAABAFf/7ARcBVoAKgCvQH1FDVUNAjMoAXQKhAoCCgsACwAfFVsCryoBQCoBKkAXG0h5KokqAgAqASoqLHQghCACIC8fAR8AYA8BPwECbwGPAZ8BvwHfAQVvAQEBARBJGlkaaRoDJV8aECAgIDAgYCBwIAUwIIAg0CDgIAQgIBoTRhBWEGYQAwoKBV8QBAA/7TMvXT8zL11xEO1dETkvXXFy7QEvXTNdEjkvXV0rcXEz7RI5OS8vM10xMABdXQE1IS4BIyIOAgcnPgMzMh4BEhUUAg4BIyIuAic3HgMzMj4CNwHnAaoKn6U8YUk0D6gaTG+YZYrKhEBBh82NZpt0UR2fFTpPZT9VflQtBQJhkeLqKkRYLkFCeV03W6/+/6ae/v64ZUBphUZBNmZOMD94sXIAAgBW/+wElwVaABYAIgCKQC12FYYVAmAeAWAiAW8cAW8YAR1cEZ8KrwoCCkAJDEgKCg0AXEAXUBfQF+AXBBe4/8CzEhZIF7j/wEAKCg5IFxckEAxcDbj/wEAYJCtILw0BDQtgEBAgGmAUBA4DDRIgYAUTAD/tPz8/7RI5L+0BL10r7TISOS8rK3HtEjkvK10z7TEwAF1dXV1dARQCDgEjIi4CJyMRIxEzETMaATMyEgMQAiMiAhEQEjMyEgSXMWKSYVqMYDYFmaGhmQvGsrzIrGpvbWprbG1sAqmn/vuzXlSg65b9nwVF/a0BNAE0/qj+pwEWAQn+9/7q/ur+6gEWAAIANAAABCsFRQARABsAnEBBdwmHCQJ0CIQIAmoEAQoDAYIQAXQQAWYQARABAQAYDVo/DgHADtAOAm8Ofw6PDgMODh0SWgaCEQFUEWQRdBEDEQC4//BAJgAABkAVHEgQBgEGARBfHxd/FwI/F28XnxfvFwQXFwAaXwsDDgASAD8yP+0SOS9dce0yAS9dKzMvODNdXRDtEjkvXV1x7TMSOS8zXV1dMTAAXV1dXTMBLgM1ND4CMyERIxEjARMUHgIzIREhIDQBkFuCVCc7d7N4AeK/7v6SHB9FclIBGP7w/tACVQ9MZ3s+V4phM/q7Aj/9wQPNMlpDKAHWAAAA//8AgP/sBIgEThIGAEQAAAACAIz/7ARTBd4AEwA4AIxATnkviS8CSghaCAJtAgFKAloCAmISAUUSVRICYgwBRQxVDAIGFXYVhhUDKioKF0egAAEAABAAYADgAAQAADo0CkfAH+AfAgAfAR80BVAULbgBCkANJBQkFCQPKlIpD1AaFgA/7S/tEjk5Ly8Q7RDtMwEvXXHtMhI5L11x7RE5LzEwAF1dXV1dXV1dXQE0LgIjIg4CFRQeAjMyPgIDMhIREAIjIi4CNTQSPgE3PgI/ARUOAQcOBQc+AwOWJ0loQUVyUSwsTWo9RXBOKvPe0vrucbJ7QTqAzpM5ZFsrVlahW058XkMsFgMUQmF/AfZyl1slJ1uXcHKWWSQkWJcCf/77/vr+9/79Rpz6tMABFsFzHAsRDgYMoQsXEQ4hMklslWU4YEgpAAMAuQAABDoEOgAXACQALwBVQDR2KoYqAgoTGhMCBQMVAyUDAwoYBUcsLBYQRx4eMSYYRgAWgBYCFgokUSYmGCVQFw8YUBYVAD/tP+0SOS/tOQEvXe0yEjkv7RI5L+0ROTEwAF1dXQEyHgIVFA4CBxUeAxUUDgIjIRETITI+AjU0LgIjIRkBITI+AjU0JiMCh0yQcEQjPFEvNl9FKD1tl1v+G7QBFEVfOxscP2RH/vgBAERbNxdmeQQ6GD5oUTRSOiUJBwcjPVk+TnVOJwQ6/EsULEMvMkYsFAHC/sATJz0rUkwAAAEBCQAABBoEOgAFACxAGw8AHwACXwD/AAKfAK8AAgAABwNGBAJQBQ8DFQA/P+0BL+0SOS9dcXIxMAEVIREjEQQa/aO0BDqO/FQEOgACABb+aAR2BDoABwAZAIFAHXQUhBQCJBMBBkYPARZgFnAWgBYDDxYPFg0HCEkJuP/AsyYqSAm4/8BAKx0gSAkJGEmQB6AHwAfQBwQHBxsMSZ8Nrw2/Df8NBA0BUBYPGAYOUAsVDQi4AQgAPzM/7TIyP+0BL13tEjkvXe0yLysr7RESOTkvL10QzRDtMTAAXV0BIQYCDgEHIQEjESERIxEzPgU3IREzAz/+xBgxMC8XAfsBN6P85qN3FCcnJyYmEgJwkgOssf8AuoEy/doBmP5oAiYhU26Puu2U/FT//wCF/+wERgROEgYASAAAAAEAAQAABMsEOgAqAO5AOAskGyQCBAYUBgILGxsbAgsaGxoCBBEUEQIEEBQQAmYhdiGGIQMhJCIqaQl5CYkJAwYJCBcqSRQAuP/AQFsmKkgAAAgiax17HYsdAx0eayN7I4sjAx4jECJwIoAiAyIiLGQOdA6EDgMODWQHdAeEBwMNBw8IPwhfCI8InwgFTwhfCJ8IrwjPCN8IBghAJCpICCEJJAYJBikBuAEKQA4XLxQBFBQeDRUPIggAFQA/MjI/MzM5L10z7TI5OREzETMBLytdcTMzXS8zXREzL10zM10vM10REjkvKzPtMhI5OV0REjk5XTEwXV1dXV1dIREuAycDIwEuAScDMxceAxcRMxE+Az8BMwMGBwEjAw4DBxECGQ8gGxQE/bkBTxM4I9iylCA1Ly0YmhgtLzUglLLYRygBULn9BBQbIA8B4AIJDAsD/fsCYBVLNQFF7zNKMyAJAcj+OAkgM0oz7/67aiv9oAIFAwsMCQL+IAABAIr/7AQlBE4AOQCmQHBzM4MzAnosiiwCahABCjgaOAIFJxUnJScDLxMqRhkTGRMZBTVHLw4/DgIODgU7dCGEIQIhSUAiUCICInQGhAYCBkkiBUASFkgABQEFLxNQFBQlCwAhYCFwIYAhBCAhkCHwIQMhIRxQJRALUAAGBgAWAD8yLxDtP+0zL11xERI5L+05AS9dKzPtXS9x7V0REjkvce0SOTkvLxDtETkxMABdXV1dXQUiLgInNx4DMzI2NTQuAiM1Mj4CNTQmIyIOAgcnPgEzMh4CFRQOAgcVHgMVFA4CAlpmmm9KF58ML0tpRoaCS3WLQUGGbUZ1gjZcRy0HohjXwWifbjg0UGAtOGxUMzVvrhQfP2BALCc9KhZeWztOLRKJDyZDNEpWDSE4KhSJeSpMaD85WD0jBQIGKUNdOkV3VzEAAAAAAQC5AAAEFQQ6ABMAWEA8CUgHGA4RSEkHAQcgCjAKAmAKcAqwCsAK4AoFCgoVZRF1EYURAxEASAATgBMCE4oQARAHEw+FBgEKBhIVAD8zM10/MzNdAS9d7TJdEjkvcXIzXSvtMTABERQOAgcBMxEjETQ+AjcBIxEBZwMDAwEB88WsAgMEAf4GwAQ6/bAXTVJKFQNl+8YClBM5PDkU/JcEOgAAAP//ALkAAAQVBbQSJgHSAAARBgKT8wAAE0ALARQRJgEAGSUSCCUBKzUAKzUAAAEA2gAABFwEOgAXAKZANXILggsCdAqECgJmCgF9D40PAkoPWg9qDwONCAFrCHsIAkoIWggCNQ1lDXUNhQ0EBQ0VDQINuP/oQDwMEUgpB3kHiQcDCgcNEAcDDghyCYIJAgkJDwAOAQ4OGQIWRgAXYBdwF4AXBBcNEBVQLwIBAgIXDhUJAA8APzI/MzkvXe05OQEvXe0yETMvXTMzL10zERc5ETNdMTAAK10BXV1dXV1dXV1dEzMRMj4CNxMzAw4BBwEjAQ4DIxEj2rQyVVBOKrTC4jVMFQGBzP7DEjA1Nhi0BDr+JhEtUD8BDf67TEgP/a4B/QgNCQX+JgAAAAEABv/sBBgEOgAZAFlAOgcgCxFIFBgLD0gUFQEXEAsRSJ8CrwK/AgMCEBdwF4AXAxcXDBlGvwABAAABAAAbDAJQFw8QUAkWABUAPz/tP+0BLxI5L11d7RI5L13NXSsxMABdASsAKyERIQYCDgMjIiYnNR4BMzI+AxI3IREDY/6DGigrMkReQR0wEQsmEx8yKSYlKhkCxgOsuP7j1pJbKAgFgQQFKl6V2AEdt/vGAAAAAQBmAAAEZwQ6ACAAlkAadgeGBwJ7CIsIAh4gDRFIKR45HgILHhseAhK4/+BATQ0RSDYSAQQSFBIkEgMIBxh3GIcYAhgQHiBJrwABEAAgAAIgADAAcACAAAQAACISD0lgEHAQoBADEAYJCR4RD0AYUBgCPxgBAAgYAxAVAD8XM11dPzMzETMBL3HtMhI5L11xce0zETldETMzMTBdXStdXStdXSERND4CNwEjAR4DFREjETMTHgMXPgM3EzMRA84BAwMB/uOZ/toCAgEBmvrIChUSDwQFDxIUCsjvAtQWPEA9FvxHA7cZPT05F/0sBDr9fyBNUVAkJFFRTCACgfvGAAEAtQAABBgEOgALAD1AJAVGAgYGDQEJRp8KAT8K7woCAAqACgIKCFEvAQEBAQoFFQMADwA/Mj8zOS9d7QEvXXFy7TISOS8z7TEwAREhETMRIxEhESMRAWkB+7S0/gW0BDr+NgHK+8YB7f4TBDoAAP//AIL/7ARJBE4SBgBSAAAAAQC1AAAEGAQ6AAcAL0AcAUYCAgkFRp8GAT8G7wYCAAaABgIGBFAHDwYBFQA/Mz/tAS9dcXLtEjkv7TEwAREjESERIxEEGLT+BbQEOvvGA6z8VAQ6AAAA//8As/5XBEIEUBIGAFMAAP//AIL/7AQ4BE4SBgBGAAAAAQCCAAAESgQ6AAcAOEAfAg4EBwUODwcBBwRGTwVfBQIABQEFBQgJBBUDB1AADwA/7TI/ERIBOS9dXe3GXSsBGBBN5jEwEyEVIREjESGCA8j+drT+dgQ6jvxUA6wAAAD//wBC/lcEiQQ6EgYAXAAAAAMARv5XBIUFzAAXACIALQCLs0QrASy4/+BAFwwPSAIsASUgDA9IDSUBISAMD0gNIQEauP/gQDUMD0gCGgELDSMBAhgBDwQjR0AADgYNBw4YRw0pFQZJHRIHBy4vEwAoHlAVEhApHVAFCBYGGwA/PzPtMj8z7TI/ERIBOS8zM+0yMtTtKwEYEE30Gu1fXl1dMTAAXl0rXStdK10rXQEUDgIHESMRLgM1ND4CNxEzERYSARQeAhcRDgMFNC4CJxE+AwSFP3esbptrrXpCPniucJvr5fx+LExlOj9mSigCxShIZT49ZUkoAh6Cx4tQCv5nAZgJTovJhIHGjFAKAYH+fxP+6/77bppkNAkDTgk2ZJdrbpljNAj8swk2ZJj//wBeAAAEbQQ6EgYAWwAAAAEAsP5oBKYEOgALAGRAFAdJoAiwCAJACFAIApAIoAiwCAMIuP/AQCcmKkgICAVGDwIBAgINAUafCq8KvwoDPwrvCv8KAwAKAQoFAVEKFQi4AQiyAwAPAD8yPz/tMgEvXXFy7RI5L3HtMi8rXXFy7TEwAREhETMRMxEjESERAWQB+7STo/ytBDr8SQO3/En95QGYBDoAAAAAAQCaAAAD/QQ6ABkAVEA4CiANEUgRIA0RSBYoCQ5IDkYLDw8BTw9fD78PAw8PGwFGnxivGAIYQBwhSAAYARgGUBUVDhUMAA8APzI/OS/tAS9dK13tEjkvXXEz7TEwACsrKwERFB4CMzI+AjcRMxEjEQ4DIyImNREBThUvSzcjTlBPJbS0JltmbDaSlAQ6/m4iOywZCA8TCgIA+8YB0g8gGxGeigGbAAAAAQBmAAAEZwQ6AAsAYEAaB0kEBAALSWAIcAigCLAIwAjwCAZwCIAIAgi4/8BAJDA0SE8IXwgCIAgwCAIICA0DSQ8AAc8A3wACAAkFAQ8HA1EAFQA/7TI/MzMBL11x7RI5L11dK11x7RI5L+0xMDMRMxEhETMRIREzEWagARCgARGgBDr8SQO3/EkDt/vGAAAAAQBc/mgEvQQ6AA8AnEAiB0kEBAAIDUlQDmAOAkAOUA6ADpAOBJAOoA6wDuAO8A4FDrj/wEA+JixIDg4LSY8InwjfCO8IBE8IXwifCK8IBAhALjFICEApLEgIQBcbSAgIEQNJDwABHwDPAN8AAwBAHiFIAA64AQhACgkFAQ8LBwNRABUAP+0yMj8zMz8BLytdce0SOS8rKytdce0yLytdcXLtERI5L+0xMDMRMxEzETMRMxEzETMRIxFcoPmg+aCPjwQ6/EkDt/xJA7f8Sf3lAZgAAAAC//8AAAR+BDoADgAZAEu1CwYbBgIBuP/gQCUJDEgOD0YJCQsDRwAVEBWQFaAVBBUVGwsZUQ4ODwtQDA8PUQkVAD/tP+0SOS/tAS8SOS9d7RI5L+0yMTAAK10BMhYVFA4CIyERITUhGQEzMj4CNTQmKwEC383SNGibZ/5n/rgB/MpFYDsadIXLAnCTn0p2UiwDrI7+Nv4PGTFHLl5XAAAAAwBqAAAEYgQ6AAwAFwAbAIO3CwYbBisGAwG4/+BAFgkMSANI0BPgEwIAExATIBOQE6ATBRO4/8BAFx4iSBMTCRtJsBjQGAIQGCAYkBigGAQYuP/AQBwfIkgYGB0MDUk/CQEQCQEJF1EMDBkKDw1RGAkVAD8z7T8zOS/tAS9dce0yEjkvK11x7RI5Lytdce0xMAArXQEyFhUUDgIjIREzGQEzMj4CNTQmKwEBETMRAanN0jRom2f+wKSbQls5GnF+nAKwpAJwk59KdlIsBDr+Nv4PGTFHLl5X/g0EOvvGAAACAMwAAAQpBDoADAAXAEVALAsGGwYCBAEUAQIDRwATARMTGQwNRhAJIAkCYAlwCYAJAwkXUQwMCg8NUQkVAD/tPzkv7QEvXXHtMhI5L13tMTAAXV0BMhYVFA4CIyERMxkBMzI+AjU0JisBAorN0jRom2f+QbTwRWA7GnSF8QJwk59KdlIsBDr+Nv4PGTFHLl5XAAAAAQB8/+wEPAROACoApUBzeAiICAJ3JIckAmUNAWITAUUTVRMCShpaGmoaAwAXEBdAF1AXBBcXChgARz8VTxWvFQPPFd8V/xUDYBUBFRUKLCBHISELR/8KAQAKAQoWURcXECYfIAEgIB1QJhAQUAUgC3ALgAsDAAsQC2ALwAsECwsFFgA/My9dcRDtP+0zL10REjkv7QEvXV3tMy/tERI5L11dce0zEjkvXTEwAF1dXV1dXQEUDgIjIi4CJzceAzMyPgI3ITUhLgMjIgYHJz4DMzIeAgQ8Nne/iWSidUcJvggxSV02Tm9IJQT+ggF+BCZIb052ihDADkhznWJftI1WAh54zZdWOV58Qww2UTUbMV2HVoNUglguaVsORHZXMjWA2AAAAAIARv/sBJgETgAaAC4Aj0BjYyMBRSNVIwJjHQFFHVUdAmwtAUotWi0CbScBOidKJ1onAwkTAQgOAQcEARtIFRVwAYABsAHAAdABBQEBFwtITyVfJQIlJTAAF0lgGHAYgBgDGBkPGBUWUQAABiBQEBYqUAYQAD/tP+0ROS/tPz8BL13tMhI5L13tEjkvXTMQ7TEwAF1dXV1dXV1dXV1dEzM+AzMyHgIVFA4CIyIuAicjESMRMwEUHgIzMj4CNTQuAiMiDgLqqQlCZ4dNT4toPThljVZVjmY7A6ekpAFUJj1NJylNPCQoPkkhKU8/JgJwebN3O0SM04+L0o1GQ4O/fP4TBDr94n6kYicpY6R7fqViKCdipgAAAAACAEUAAAP7BDoADQAWAHpALwQYCQxIBQgVCAIAPwMBAwMGFgtGDwxfDK8M/wwETwxfDAIMDAYYZQF1AYUBAwECuP/wQB0CQAwPSAICEkefBgEABgEGAwBRFRUBD1EJDwwBFQA/Mz/tEjkv7TIBL11d7TMvKzgzXRESOS9dce0zEjkvXTMxMABdKwkBIwEuATU0NjMhESMZASMiBhUUFjsBAkv+xcsBWIJ32M8BsLTqgnhrfP0Byv42Adcbo3qVlvvGAcoB8VxdXl0AAP//AIX/7ARGBXsSJgBIAAARBgBpCAAAF0ANAwIsESYDAggwLhUfJQErNTUAKzU1AAABADX+VwQZBcwANwCBQEB0EoQSAjUMARgoCQ9IBREVESURdRGFEQWfA68DAh0DHQMyFUYmJjkFAjJGMzY2NwAzgDMCMwU1UQI2NgAsUAkPuP/AQA4JDEgPDwAzFSFQGhsAAAA/P+0/EjkvKzPtEjkvM+0yAS9dMzMvEO0yMhI5L+0SOTkvL10xMABdK11dEzMVIRUhFRQGBzM+AzMyHgIVERQOAiMiJic1HgEzMj4CNRE0LgIjIg4CFREjESM1M7m1ASv+1QYDAxhAUmlAU4JaLxU2XUgiQRwNJA0mMRsKITtQMDtnTSy0hIQFzJ2DhDJlLi9MNR0sXJBl/Mc+ak4tBAWLAgQUK0MuAwRQZz0YLVV9Uf2rBKyDAAAA//8BCQAABBoFtBImAc0AABEHAHQAkwAAABNACwEGESYBZwYJBAAlASs1ACs1AAAAAAEAkf/sBFEETgAqAI9AYnkjiSMCdgiGCAJlHgFjGAFFGFUYAkoRWhFqEQMPFB8UAhQUIAAKRwsLIUcAIBAgYCADICAsExZHAADQAAIAFlETEwUgIHAggCADACAQIGAgwCAEICAbUCYWHwsBCwsOUAUQAD/tMy9dP+0zL11xETkv7QEvXe0yEjkvXe0zL+0REjkvXTEwAF1dXV1dXRM0PgIzMh4CFwcuASMiDgIHIRUhHgMzMj4CNxcOAyMiLgKRVo20X2Kdc0kNwBCKdk5vSCUFAX7+ggUkSG9ONl1JMQi+CUd1omSJv3c2Ah6j2IA1Mld2RA5baS5YglSDVoddMRs1UTYMQ3xeOVaXzf//AKf/7AQkBEsSBgBWAAD//wCPAAAEZQXMEiYA8QAAEQYBTykAAAu2AQAKDQYJJQErNQD//wCPAAAEZQV7EiYA8QAAEQYAaSkAABdADQIBChEmAgEUDgwDASUBKzU1ACs1NQD//wB1/lcDRAXMEgYATQAAAAIAGf/sBKcEOgAfACoAeEALCgYaBgIEARQBAgu4/+hADRccSAsoEhZIC+AdAR24/8BALg0RSB0dFB8gSXAJgAkCCQkUA0ngJgEmJiwAFAEUKlEfHyALUR0PF1ARFiBRCRUAP+0/7T/tEjkv7QEvXRI5L13tEjkvXe0yEjkvK13NKysxMABdXQEyFhUUDgIrAREjAw4DIyImJzUWMzI+AjcTIRkBMzI+AjU0JisBAxy9zjRkk1/PpSgPKj9bQR0mERUlIzAhGQw1AcgzPlc4GW92NAJwlJ5KdlIsA8H+RaHQei8GBYEHJmCmgAId/jb+BRw1Si5eYQAAAgBcAAAEsAQ6ABQAHwBeQDoKDBoMAgQHFAcCBRVJAiAPMA9wD4APBA8PEwlJYBvgGwIbGyEBEkkfEwETHxFRBQEBABVREw8VAwAPAD8yPzPtETkvM+0yAS9d7TISOS9d7RI5L10z7TIxMABdXRMRIREzETMyFhUUDgIrAREhESMRATMyPgI1NCYrAfYBS5o2zdI0aJtn0f61mgJ/NkVgOxp0hTcEOv42Acr+NpOfSnZSLAH3/gkEOvw7HDVKLl5hAAAAAAEANQAABBkFzAAnAHNAOnQShBICNQwBBREVESURdRGFEQWfA68DAgMDIhVGFhYpBQIiRiMnIyYmACOAIwIjBSVRAiYmABxQCQ+4/8BACgkMSA8PFSMVAAAAPz8zOS8rM+0SOS8z7TIBL10zLxEzEO0yMhI5L+0SOS9dMTAAXV1dEzMVIRUhFRQGBzM+AzMyHgIVESMRNC4CIyIOAhURIxEjNTO5tQEr/tUGAwMYQFJpQFOCWi+1ITtQMDtnTSy0hIQFzJ2DhDJlLi9MNR0sXJBl/U0CmVBnPRgtVX1R/asErIMA//8A2gAABFwFtBImAdQAABEGAHRqAAATQAsBGBEmATUYGwAOJQErNQArNQD//wBC/lcEiQW0EiYAXAAAEQYCk/EAABNACwEgESYBACUxER8lASs1ACs1AAABALX+VwQYBDoACwA9QCQJSQoKAAdGBAQNA0afAAE/AO8AAgAAgAACAAkbBQEPCANRABUAP+0zPzM/AS9dcXLtEjkv7RI5L+0xMDMRMxEhETMRIREjEbW0Afu0/qCjBDr8SQO3+8b+VwGpAAABAOIAAQR2BqkABwBLQBQDXBAAAdAA4ADwAAMAAJAAoAADALj/wEAaHSJIAAAJBVoABgEABhAGAgYEXwcBAQcDBRIAPz8zLxDtAS9dcu0SOS8rXXFy7TEwAREzESERIxEDwrT9K78FRQFk/gD7WAVEAAAAAAEA9AAABAYFzAAHAFBAOQZJHwM/AwKwAwFvA38DjwMDAAMBAwMJAEYvAT8BTwGvAb8BzwEGPwG/AQIBQCsuSAEEAAdQAg8AFQA/P+0/AS8rXXHtEjkvXV1dce0xMCEjESERMxEhAai0Am+j/aIEOgGS/eD//wAAAAAEzAapEiYAOgAAEQcAQ//FAPUAFbQBMwUmAbj/xbQ0NxMyJQErNQArNQD//wAVAAAEuAW0EiYAWgAAEQYAQ4gAABW0ASsRJgG4/4i0LC8PKiUBKzUAKzUAAAD//wAAAAAEzAapEiYAOgAAEQcAdABnAPUAE0ALATMFJgFnMzYTMiUBKzUAKzUAAAD//wAVAAAEuAW0EiYAWgAAEQYAdF4AABNACwErESYBXSsuDyolASs1ACs1AP//AAAAAATMBl4SJgA6AAARBwBpAAEA4wAXQA0CATMFJgIBADc1EzIlASs1NQArNTUAAAD//wAVAAAEuAV7EiYAWgAAEQYAaQEAABdADQIBKxEmAgEALy0PKiUBKzU1ACs1NQD//wAkAAAEqAapEiYAPAAAEQcAQ/+6APUAFbQBCQUmAbj/urQKDQQIJQErNQArNQD//wBC/lcEiQW0EiYAXAAAEQYAQ8UAABW0ASARJgG4/8a0ISQRHyUBKzUAKzUAAAAAAQFOAdADfgJwAAMAHUAPAwMFAAAQAAIAALovAQEBAC9d7QEvXRI5LzEwATUhFQFOAjAB0KCgAAABAU4B0AN+AnAAAwAdQA8DAwUAABAAAgAAui8BAQEAL13tAS9dEjkvMTABNSEVAU4CMAHQoKAAAAEBTgHQA34CcAADAB1ADwMDBQAAEAACAAC6LwEBAQAvXe0BL10SOS8xMAE1IRUBTgIwAdCgoAAAAQCqAcMEIgJMAAMAD7UCAAC5AbwAP+0BLy8xMBM1IRWqA3gBw4mJAAH/9gHDBNYCTAADAA+1AgAAuQG8AD/tAS8vMTADNSEVCgTgAcOJiQAB//YBwwTWAkwAAwAOtAACALkBAC/tAS8vMTADNSEVCgTgAcOJiQAAAv/7/lcE0f+EAAMABwAntgcCBAEFuwS4/8BADAkQSAQAuwFACQxIAQAvK+0vK+0BLzMvMzEwBzUhFQU1IRUFBNb7KgTW3GBgzWBgAAEBjQNeAz8FzAADACq1BgEWAQIBuP/wQBEOEUgDmgCXAZkAAgECAZwAAAA/7QEvXe397TEwK10BAyEBAz+p/vcBNwXM/ZICbgAAAAABAY8DXgNBBcwAAwAzQCIAGA4RSAkAGQACCQIZAgICEA4RSAGZApcDmgAAAQADnAEAAD/tAS9d7f3tMTArXV0rARMhAQGPqQEJ/skDXgJu/ZIAAAABAV3+lQMPAQMAAwA7QCgAGA4RSAkAGQACCQIZAgICEA4RSAGZApcDmi8AAQAAEAACAACcAZsEABD27QEvXV3t/e0xMCtdXSsBEyEBAV2pAQn+yf6VAm79kgAAAAEBjgNeA0AFzAADADdAEAAYDhFICQAZAAIGAhYCAgK4//BAEQ4RSACaA5cCmQABAQEAnAIAAD/tAS9d7f3tMTArXV0rCQEhEwLF/skBCakDXgJu/ZIAAAACALEDXgQaBcwAAwAHAFe1BgUWBQIFuP/wQAkOEUgGARYBAgG4//BAJg4RSAeaBJcFmS8GnwYCAAYQBgIGA5oAlwGZAAIQAgICBQcBnAMAAD/tMzIBL13t/e0vXV3t/e0xMCtdK10BAyEBIQMhAQJjqf73ATcCMqn+9wE3Bcz9kgJu/ZICbgAAAgCyA14EGwXMAAMABwBoQEsEGA4RSAkEGQQCCQYZBgIGEA4RSAAYDhFICQAZAAIJAhkCAgIQDhFIBZkGlweaAAQQBJAEAwQBmQKXA5ovAAEAABAAAgAHBQOcAQAAP+0zMgEvXV3t/e0vXe397TEwK11dKytdXSsBEyEBIRMhAQJpqQEJ/sn9zqkBCf7JA14Cbv2SAm79kgACALL+lAQbAQIAAwAHAGpATAQYDhFICQQZBAIJBhkGAgYQDhFIABgOEUgJABkAAgkCGQICAhAOEUgFmQaXB5oABBAEkAQDBAGZApcDmi8AAQAAEAACAAQAnAUBmwgAEPQy7TIBL11d7f3tL13t/e0xMCtdXSsrXV0rARMhASETIQECaakBCf7J/c6pAQn+yf6UAm79kgJu/ZIAAAABALb/KwQWBcsACwAsQBgKwAi+BcAABxAHAgcHDA0LBMEKBcIHAAIALz/2Mu0yERIBOS9d5v3mMTABAyMDBTUFAzMDJRUCrQ5zDv6YAWgawxoBaQPd+04EshGkEwFu/pITpAAAAQC2/ysEFgXLABUAQkAkABHAFAMPvgcMwAkEAA4QDgIODhYXEgvBEQzCDgAAB8EBBsIEAC/2Mu0yP/Yy7TIREgE5L10zM+Yy/TIy5jIxMAEVJRMjEwU1BRMDBTUFAzMDJRUlAxMEFv6XGsMa/pgBaCIi/pgBaBrDGgFp/pciIgEqpBP+kgFuE6QRAWIBYhGkEwFu/pITpBH+nv6eAAAAAAEBUAGRA3sDvAATADdAJRURJRE1EQMVDSUNNQ0DGgcqBzoHAxoDKgM6AwMAABAKAQoFBQ8ALzMvAS9dMy8xMABdXV1dARQOAiMiLgI1ND4CMzIeAgN7LE1mOjljSysrS2M5OmZNLAKqOmZMLS1MZjo5ZEorK0pkAAMAdQAABFgA2wADAAcACwA8QCQLmAgEA5gAB5gQBFAEAhAEkASgBMAE0AQFBAQMDQkFAZsIBAAALzIy7TIyERIBOS9dce3U7RDU7TEwITUzFSE1MxUhNTMVA6qu/bms/biv29vb29vbAAAAAAcAAAAABMwFgwADABcAKwA/AFMAZwB7AO25AGb/2EAOCQ5IYCgJDEhcKAkMSFa4/9izCQ5IPrj/2EAOCQ5IOCgJDEg0KAkMSC64/9izCQ5IFrj/2EAOCQ5IECgJDEgMKAkMSAa4/9hAEQkOSEsCWwJrAgMCAwABAxABuP/wQEQDQAkPSAMBAwExE0q0O7VAtDExaBNytGO1WbRoaBN9GLQJtSK0EwIAAgAENm22VLd3tl4ZRbYst0+2Nhkntg63HbYEBwA/7fTtP+307T/t9O0REjk5Ly8BL+307RESOS/99O0REjkv7fTtERI5OS8vKzg4ETMRM10xMAArKysrKysrKysrKysTIwEzATIeAhUUDgIjIi4CNTQ+AhM0LgIjIg4CFRQeAjMyPgITMh4CFRQOAiMiLgI1ND4CEzQuAiMiDgIVFB4CMzI+AgEyHgIVFA4CIyIuAjU0PgITNC4CIyIOAhUUHgIzMj4Ck5ECR5P+EC9TPiQkP1UwMVU+JCQ/VpUNGSUYGigaDQ0bJxkXJBsOoS9TPyQkP1UwMVU/JCQ/V5UNGiUYGicbDQ4aJxkXJRsOAZYvUz4kJD9VMDFUPyQkP1eVDRolGBooGg0NGycZFyUaDwGLAn8BeRtEcldUdEYfH0Z0VFdyRBv+2DdIKxISLEg2NUgsExMsSP4vG0RyV1R0Rh8fRnRUV3JEG/7YN0grEhIsSDY1SCwTEyxIAV0bRHJXVHRGHx9GdFRXckQb/tg3SCsSEixINjVILBMTLEgAAAABAfYDTQLWBcwAAwAcQA0DlgACAQICBAUAAAIAAD8zLxESATkvXe0xMAEjAzMCrI0p4ANNAn8AAAIBFQNNA7YFzAADAAcAJ0AUA5YCAgkHli8GAQAGAQYFAAAGAgAAPzMzLzIBL11d7RI5L+0xMAEjAzMBIwMzA4yOKOD+FY0p4ANNAn/9gQJ/AAAAAAEBWgCNA10DrAAIAC5AGADrCAPrBOwG608BAQABAQECAQYGA+8A7gA/5Dk9LzMzARgvXV3t/e3U7TEwJQE1ATMVCQEVAqr+sAFQsf6xAVGNAW0/AXMf/oz+kR0AAQFuAI0DcQOsAAgAMEAaA+sI7AEG6wUA6wABYAHQAQMBCAcDAwbvAO4AP+Q5PS8zMwEYL13t1O0Q/e0xMCUjNQkBNTMBFQIgsgFS/rCwAVGNHQFvAXQf/o0/AAAEAO0AAAPgBUQAAwAHAAsADwA8QCALCg+YAAwBDAwRAweYAgAEEAQCBAkBAQINBZ0MBAoCAwA/My8z7TIROS8zAS9dM+0yEjkvXe0zMjEwASMDMwM1MxUBIwMzAzUzFQGblBjExsICGZQYxMbCAY0Dt/q8yckBjQO3+rzJyQAA////+wWsBNEGDBIHAEIAAAaIAAAAAQDMAAAD/gVFAAMAJ7cCAxADAwUAAbj/8EAKAAEQAQIBAgYAGAA/PwEvXTgzEjkvODMxMCEjATMBQnYCv3MFRQAAAAABAWUCBwODBJ0AIQBBuQAe/9hAIgkRSCHgAAAjFwrgAAsBCxcG5B0dDxEBEUALEkgRCxAAAQAAL10yLytdMy/tMwEvXe0yEjkv7TEwACsBETQuAiMiBhURIxE0LgI1MxQeAhUzPgMzMhYVEQMCDR0vI0hVgAEBAncCAgICDyYxQCpuYQIHAY4uPSUQZF7+lAH/FC4oHQQDGyIjDBwuIBFsef5PAAEAIgAABEwFRQARAFBAKwYCBgIKABABEBATBQEJWgoMDgwKCAxgBQ0NCQRfPwHvAQIBAQkAXw8DCRIAPz/tEjkvXe0SOS8z7TIBLzMzLxDtMjISOS9dEjk5Ly8xMAERIRUhFSEVIREjESM1MxEhFQGQAqT9XAGH/nm/r68DewSp/kSey4H+/QEDgQPBnAAAAAEAUAAABGYFWgA6AMyzOgMBGLj/8EBnCQxIH28vKk8gXyACICogKjopMC1vEA5wEwETDRQTA38QjxACEBAGAG86QBATSDo6PDRuAAYQBgIGMA5zDy0PLBJzEykTbw+fD68Pvw8EPxMBDxMPEzQlcxogIBoHBzRzBhA6IDoCOrj/wLMWJkg6uP/AthATSDo6BhgAPzMvKytdEO0yPzMvEO0SOTkvL11dETMQ7TIRMxDtMgF8L10Y7RI5fS8rGO0SOS9dFzMvXTMQ7TIyETk5Ly9dETPtMTAAK10BDgMjITU+Az0BIzUzNSM1MzU0PgIzMh4CFwcuAyMiBh0BIRUhFSEVIRUUBgchMj4CNwRmCTlZc0P9RixCLBW6urq6MGOYZ0Z7Y0cSrgonNUEkcnABmP5oAZj+aFhRAeMmQzUlCAE3UHVNJZoXMUFXPBmOmI1MXJNmNx06Vjk5IDMkFHN9VI2YjgdwlSoTKkMwAAAEAC3/9gS0BUUADAA6AEUAWwDztQ8YDRFIJ7j/6LMNEUgmuP/oQAkNEUhYKAoZSAu4/+hAfAkOSCxwLS0cAG87S09wWjBGQEZQRoBGBEZIWk1NVBRwExMzcCRwVIBUAi9UP1QCQDtQO5A7Aw87ATtaVCQkVFo7BAgNcBxAFBhIHBxdQgdvCE5GdEczHBAwdCktLSkpS0dJSUcGc0JHQkdCCVEZdBBXEBQUEBlBcwkGCBUAPz/tPzMvETMQ7TIROTkvLxDtETMvETMzLzMvEO0SOTkQ7TIBL+0yEjkvK+0SFzkvLy8vXV1dXRDtMy/tETMvETMvXRDtMhDtETMv7TEwACsrKysrARQOAisBESMRMzIWARQGIyImJzceAzMyNjU0JicuAzU0PgIzMhYXBy4BIyIGFRQWFx4DATQuAisBETMyNhM1MzczFTMVIxEUMzI3FQ4BIyImNRECRihPdk49odKhpgJuYFpKYgtsBRAUGAwaIi0wGTIpGhsxQidGWAhtBSMTHRo1MxYuJhn88BYpOyQ4QEtLGVo7R5WVRC0bFzIeVFQD90yEYTj9cgVFpvwOU2RTUBEbIhQHJSgkPiERKTM+Jis+KRNWSAwsIyYjJTkjDyYxPAMjN0otFP5lcv6cYY6OYf6ATgdhBQZSTwGSAAAAAAEAW//sBGMFWgA8AJZAVWkxATcDRwNXAwMrKioMNQAAOQsMDBw+MwEBOW4cIAAXARcXHCIWFhxACw5IHAEXcxg7GDYgcyEzIW8YAT8hARghGCEGLnMlKyslBwZzETALAQsLERkAPzMvXRDtPzMvEO0SOTkvL11dETMQ7TIRMxDtMgEvKzMvMxEzL10yEO0yLzMREjkvMxI5LzMRMxEzMTAAXV0BIR4DMzI+AjcXDgMjIi4CJyM1My4BNTQ2NyM1Mz4BMzIeAhcHLgEjIg4CByEVIQ4BFRQXIQNp/jUIKk10UDRXS0IeTCpYYGw+eLJ7Rw2DdwICAgJ3gR375ThkXVcrUjqKVklyUzMLAc3+JQEBAwHaAc9PelQrEh4lE4ccLiASRH2ybZAXIhIaIxKO6uwOHCwejCo6HEd6X40OKxUqIAAAAAQAAP/0BM0FUAATACcASwBPAMNACUo0ATgoCQ5IPrj/2LMJDkgRuP/YswkOSA24/9hAFAkOSAcoCQ1IAygJDUhOT0xNTxBNuP/wQA8PTwEATQFPTU9NADsetAq4AQVAEAC0FBQ7UUUxtEYAMBAwAjC4AQVAJyi0O04GTBgQMAEgMDAwAjAwLbY2uEm2QD9GAUZGQAcZtg+4I7YFGQA/7fTtPzMvXRDt9O0zL11xPz8BL+30XTLtMhESOS/t9O0REjk5Ly9dXTg4ETMRMzEwACsrKysrK10BFA4CIyIuAjU0PgIzMh4CBzQuAiMiDgIVFB4CMzI+AgEUHgIzMjY3Fw4DIyIuAjU0PgIzMh4CFwcuASMiBhMjATMEzStKYjc3YEgqKUliOTZhSSqUDx4sHR8uHg8QHi0dHC0fEPxZDyAvICY3C40GJTxUNkhoQyErSmU5NVA6JQmPCistPz6wdgK/cwGUcp5jLSxjnnN6oWIoKGKhelh3SB8gSHdXU3VJISFJdQJwP3FUMVJXCTZjTC0+cJpcdJ9jLChGXjcLSFWc+70FRQAAAAACAR7/7AOdBZUAKQA5AJ65ABz/2LMJDkgYuP/YQAwJD0gJGAkNSB9JKgS4ARpAGwMqAyoDOzUlSAwUDBAQAAxADFAMkAygDAUMEbgBGLIQEA24ARi3DxQfFAIUFCS4ARizNTUAL7gBGEANDxo/Gk8abxp/GgUaALgBGbQHBAQHFgA/My8Q7S9d7RI5L+0yL13tMi/tAS9dMy8RMxDtMhI5OS8vEO0Q7TEwACsrKyUyNjczDgEjIi4CPQEOAQc1PgE3ETQ+AjMyHgIVFA4CBxUUHgITNC4CIyIOAhURPgMCxjNOEUUUgm03W0IkIEIiI0IfGTtiSDRVPSEyV3RCFiQtfRQiLxofKBYIMVQ9Ik5obZqdKE92Ta8RHA1JDh0QAks7bVIxKk5vRWO0mHYm9DlTNhoEFDRVPSEkPVEu/gUhaIOXAAAEABYAAAS5BUUAEwAlADkAPQCduQAK/+hACQ0RSAAYDRFII7j/6LMJDkgfuP/oQEsJDkgaKAkOSBcYCQ5IPT0UOjocABFdEjC0HA8SARJACw5IABwBEhwSHAgUtCYmPwoHXQg1thkZITtgOhIrtg8hASEPEQEJAwsACBIAPzMzPzMzP13tP+0ROS/tAS/tMhI5L+0SOTkvL10rXRDtEO0yETMvETMvMTAAKysrKwErKyEBFhceARURIxEzASYnLgE1ETMRARQOAiMiJjU0PgIzMh4CBzQuAiMiDgIVFB4CMzI+AgE1IRUBqv7yAQICAYzAARYCAgICjQJIGTpgSIB1HTxeQkZfORmVCxckGRsmGAsLFiMYHCcZC/7EAbMEGistJlkn/OQFRfveKC4nYjMDEPq7ArJekmM0yr1ckGU1NWSRXFFrQBobQGtQUmw/Gho/bP2giIgAAAIABANKBMgFywAkACwAiLUiGA4RSBS4/+hATA4RSAkIGhokFBHFQA8SHxIvEgMPAxISACwOJiknDikmxAAnASciAMVwJIAkAiQkLiUpyAIPEyIPAyoADxofGgIPCR8JAgAJEhoEJ9EAPxczXV0/FzMRM+0yEQEzL13tMi9d7cYrARgQTeYROS9fXl0a7TISOREzMzEwKysBETUGBw4BBwMjAy4BJyYnFREjETMTHgEXFhc2Nz4DNRMzEQERIxEjNSEVBF8CBAMFAr5ZhwIUDA4RaZy4AgQCAwIRDQYKCQaLmPxWb6sByQNKAWCgCQkIDgX+LQFWBDYfJC0r/isCgf4vAwsGBwgqIg8cFhABAVb9fwIl/dsCJVxcAAAAAQA7AAAEkwVaADkA2kB4eRWJFQJ2JYYlAmsJewmLCQNrMXsxizEDZiV2JYYlA2YVdhWGFQNGOFY4AkYCVgICORsBOR8BMFwoClwSIBIwElASYBJwEgVPEgHfKO8o/ygDACgQKCAoA3AogCgCKBIoEjUYEBAFWoAYkBjQGOAY8BgFkBigGAIYuP/AQCMJDEgYGDU7KioiWi81PzUCNUAhJEg1EycnECpfEikSHV8ABAA/7T8z7TIyLzMBLytd7TMvERI5Lytdce0yLxESOTkvL11xcXFyEO0Q7TEwAF1dXV1dXV1dAV1dATIeAhUUDgIHNjc+ATsBFSE1PgM1NC4CIyIOAhUUHgIXFSE1MzIWFxYXLgM1ND4CAmd8xYpJLVV+USAeGjYTyP4dS2Y9GidTf1dYgFIoGj1mS/4dyBM2Gh4gUX5VLUmKxQVaVZ3diF+zoIo2AwMCA5zgN32IkEppqHdAQHeoaUqQiH034JwDAgMDNoqgs1+I3Z1VAAACAF//3gSDBEgAIgAvAFq2HY8eAR4eEbgBG0AQACMQI2AjcCOAIwUjIzESL7gBG7cfBQEFHR0YErgBGLMvLxgpuAEYsgwQGLgBGLEAFgA/7T/tEjkv7RE5LwEvXe0yEjkvXe0yL10zMTAFIi4CNTQ+BDMyHgIVIREeAzMyPgI3Fw4DExEuAyMiDgIHEQJygsaGRSxMZnaAP3HBjlH8xRZATlguS3RdTSJIJFNuj8sTO0xdNTNXSjwYIl2dzG9ioH1dPB1PktGD/pwYLSMUIDxXNyo5ZEwsAooBFRQqIhYTICoY/uoAAAD//wAB//QEwwVFECcCl/7cAAAQJgIb6wARBwKdAb39tAAkQBQEAwJCGAQDAjBCAS9CAUIBYBQBFBFdNRFdXTU1NQA/NTU1AAD//wAJ//QEwwVRECcCmf8fAAAQJgIb/AARBwKdAb39tAAkQBQEAwJjGAQDAjBCAS9CAUIAQAABABFdNRFdXTU1NQA/NTU1AAD//wAl//QEwwVFECcCm/8hAAAQJgIbCAARBwKdAb39tAAoQBcEAwJPGAQDAjBCAS9CAUIAQAABMAABABFdXTURXV01NTUAPzU1NQAA//8AOf/0BKMFRRAnApz/PQAAECYCG7UAEQcCnQGd/bQAMEAcBAMCPhgEAwIvQgFCAV8PAQ8AYAABUAABQAABABFdXV01EV01EV01NTUAPzU1NQAAAAEACABkBMQCRAARACNAEBAQEwAPDGADAQMHBACvCw8AL839zQEvxF0yOTkRMy8xMBMeARcjLgEnNT4BNzMOAQchFecdOx9IOoJSUoI6SB87HQPdASkiYkFEcCokKnBEQWIiVgABAXb/wwNWBH8AEQAfQA4MEKwDERAPAAxvAwEDBwAvxF0yOTkvAS/O/c4xMAEOAQc1PgE3Mx4BFxUuAScRIwI7ImJBRHAqJCpwREFiIlYDoB07H0g6glJSgjpIHzsd/CMAAAAAAQAIAGQExAJEABEAI0AQAA8DbwwBDAgIExAMEK8DEQAvzv3OAS8RMy/MXTI5OTEwAS4BJzMeARcVDgEHIz4BNyE1A+UdOx9IOoJSUoI6SB87HfwjAX8iYkFEcCokKnBEQWIiVgAAAAABAXb/wwNWBH8AEQAfQA4DAKwMDxAPAANgDAEMCAAvxF0yOTkvAS/N/c0xMCU+ATcVDgEHIy4BJzUeARcRMwKRImJBRHAqJCpwREFiIlaiHTsfSDqCUlKCOkgfOx0D3QABAAgAZATEAkQAHwAzQBkQE28cARwYGCEADwxgAwEDBxMLDxwDAK8PAC/9zTIQzTIBL8RdMjk5ETMvxF0yOTEwEx4BFyMuASc1PgE3Mw4BByEuASczHgEXFQ4BByM+ATfnHTsfSDqCUlKCOkgfOx0C/h07H0g6glJSgjpIHzsdASkiYkFEcCokKnBEQWIiImJBRHAqJCpwREFiIgABAXb/wwNWBH8AHwAvQBcUCxCsGwMfHxATYBwBHBgADwxvAwEDBwAvzF0yOTkvzF0yOTkBL84y/cwyMTABDgEHNT4BNzMeARcVLgEnET4BNxUOAQcjLgEnNR4BFwI7ImJBRHAqJCpwREFiIiJiQURwKiQqcERBYiIDoB07H0g6glJSgjpIHzsd/QIdOx9IOoJSUoI6SB87HQAAAAACAXb/SANWBH8AAwAjAD5AHwcAICMQARcUrCMjFBdgIAEgHAOvAAAcBBMQbwcBBwsAL8xdMjk5LzMv7RDMXTI5OQEv/c0yMhDNMjIxMAUhFSETDgEHNT4BNzMeARcVLgEnET4BNxUOAQcjLgEnNR4BFwF2AeD+IMUiYkFEcCokKnBEQWIiImJBRHAqJCpwREFiImhQBFgdOx9IOoJSUoI6SB87Hf0CHTsfSDqCUlKCOkgfOx0AAAAAAgBp/+UEYwXFAC0AQwBwQEglFDUUAgtBG0ECCQwZDAIlJQ8pLgEuEA0WSC4ZAEYAHRAdAh0dRTpHDzNRLhkZfxaPFp8WvxbPFt8WBhYWKT9QChYlJSBQKQAAP+0zLz/tETkvXTMRM+0BL+0SOS9d7TMzK10SOS8xMABdAV0AXQEUDgIHDgMjIi4CNTQ+BDMyFhczPgE1NCYjIg4CBzc+ATMyHgIDLgMjIg4EFRQeAjMyPgIEYwgOFQ0ibpO4bmmQWScaNlV4mmFkmiUEAgOSkR9EQT0ZJy5/SXuoZyzZCiw/Ti1BalI8JxMaNE82UYVmRQOqLmdrajCAzpBNP2uKSzyPkIZoP2NUGToixNELExwRkxcnWJXD/pMqSjcgM1RudHQwNVtDJmOhzQAAAgAMAAAEwAWBAAUAEgB7QE4pAgEGAwEDAVISCxJeBAMUBAQDAgFSEQsRXgECFAEBAgsBBFpvEn8SjxIDEBIBEhIUEVp/AY8BAgFaCwFLCwELAwIEEgQBAQQSAxFfABIAP+0XMi8vLz8zM11dAS9d7RI5L11d7RE5hxArhyvEhxgQK4crxDEwAV1dMzUBMwEVAS4DJw4DBwEhDAHd9AHj/gYRIhsSAgETHCIQ/soDNJEE8PsSkwPlLl9ONgQENk5fLvy3AAEAaf45BGIFRQAHAEVACwda0ADgAAIAAAEAuP/Asx0gSAC4/8BAFxUZSAAACQNaBEAVHUgQBAEEAl8FAwQAAC8yP+0BL10r7RI5LysrXXHtMTABESERIxEhEQOq/X6/A/n+OQZq+ZYHDPj0AAEAG/45BLEFRQALAHlADSkBaQF5AYkBBCQDAQO4/+BAHQ4RSAhbAkAOEUgCAgUBB1ufBa8FvwUDAwUDBQEKuP/AQBsJJUgKCg0JWwFACyVIAQMHXwQIAgIEAwEJXwAAL+0yPzkZLzMYEO0yAS8r7RI5LysSOTkvL13tERI5LyvtMTAAK11dEzUJATUhFSEJASEVGwJ7/ZUEQvyyAkj9qAOi/jltAyIDE2qY/R39B5gAAQB1AmAEWALyAAMAGEAMAwUAABAAAgAArQGzAD/tAS9dEM4xMBM1IRV1A+MCYJKSAAAAAAEB8AGkAtsCzwADAChAGAOWAAABAAAEBQGbDwAfAD8AAwBADhFIAAAvK13tERIBOS9d7TEwAREzEQHw6wGkASv+1QAAAQBO//IEfQZUAAgAVEA0dgABBgUWBQIrATsBSwEDCQEBAQAGKQZZBmkGiQYEFQYBBgIHCAgDCgUCAgMCrwUFBxkGAAAvMj85L+0BLzMvMhESOS8zEjldXREzMzEwXV1dXQUjASM1IRMBMwKJav7ltgEO8gGugQ4DGHX9TgWHAAADAB0AywSrA9cAIwAzAEMAlUAPRUNVQ2VDA0o1WjVqNQMhuP/oQAkJDEgDGAkMSBW4/+hASQkMSA8YCQxICBonGjQDEi+qDwBPAF8AAwBFPKoSQBIiSBJACw9IEiQ3rSc0CDQaAw0fFypBrQU/DV8N/w0DDUAbLEgNQBIWSA0ALysrXTPtMi8zEhc5ETPtMgEvKyvtEN5d7RIXOREzMTAAKysrK11dARQOAiMiJicOAyMiLgI1ND4CMzIWFz4DMzIeAiUiBgceATMyPgI1NC4CBS4BIyIOAhUUHgIzMjYEqyhKaEBYmT8cRUxRKj5pSyooS2lAVZk8HUJNVS8/Z0kp/s49ZzAtZkImPSwXGSw9/oQsZ0MlPCsXFSo+KDxoAk5OjWo+hZU/ZkgnN2SQWFGOaDyHlD5mSSg3ZY+ofoKAgChGXjY2XEUn+oCAKEZeNjNdRSl+AAAAAAEANAAABJgExwAFABO3AqwFAwKvBQAALy/tAS8v7TEwEzMRIRUhNF4EBvucBMf7l14AAAABAJz//gQwBAgAGQA3QCNACFAIAk8EXwQCDKwADRANIA0DDQ0bGawAABAAAgATrwYNAAAvMi/tAS9d7REzL13tMTBdXRcRND4CMzIeAhURIxE0LgIjIg4CFRGcRHqnYmOpe0ZnNV+CTk6CXjQCAgB0wIpMTIrAdP4AAgJim2w5OGycZP4AAAAAAQDr/jkD4QXjACMAPEAkCgkaCSoJAwUbFRslGwMgIAarFw4OABcQFwIXFyQlAK0dEq0LAC/tL+0REgE5L10zLxDtMi8xMABdXQEiDgIVERQOAiMiJic1HgEzMj4CNRE0PgIzMhYXFS4BA24zQicQMll8SiRLFxQ+IzNBJw8yWn1LIksWEj0FWChBVCz7LV6GVikLCJMIECVAVDAE0V6GVigJCZQKEQAAAgBsAVAEYAP0ACIARAC0QBMlMAkUAEwqMAkUAEwpMAkUAEw4uP/AQCQJFABMOTAJFABMFhEmETYRZhGWEaYRBiAwCRQATCEwCRQATAy4/8BARgkUAEwNMAkUAEwnHkY3EAsBCzKtJjtAFxxIO0AJDEg7NyOtbywBLEASFUgQLCAsAiwGrR0PQBccSA9ACQxIDwsarT8AAQAAL13tM90rKzLtL10rXe0z3SsrMu0BL10zEM4yMTArACsrK10BKwArKysrASImJy4BIyIOAgc1PgEzMhYXHgEXHgMzMjY3FQ4DAzI2NxUOAyMiJicuASMiDgIHNT4BMzIeAhceAwNcRZFJQWstJkE8OB0yhFFNk0YEBwQVMjMzF0V7NB88PUQYRXs0Hzw9RChFkUlBay0mQTw4HTKEUSlPTUslFTIzMwL2KxoWFwwWIRWQJS8sGQIBAgcQDggzK5UWHxMI/uMyKpMXIBMILBoXGAwXIBWNJi4NFBoNBxAOCAAAAAABAHQANwRXBRAAEwCEQFgNEBEABAEMAQoHBgMEAgsLDAJACQxIAgwCDAQTDhUIAAQQBAIEEAitDQswCVAJYAlwCQRQCXAJgAmwCdAJBQ8JAQkRBa0CAB8EfwSfBK8EvwQFBEASFkgEAC8rcTPG7TIvXV1xxjPtMgEvXTMQzjIROTkvLysRMxESFzkyERIXOTEwAQMjEyM1IRMhNSETMwMhFSEDIRUB85iRl+0BN77+CwI9mo+YARX+or8CHQFY/t8BIZQBbJQBJP7clP6UlAAAAwB0APQEVwRQAAMABwALAENAKgsHAg0IBAAAEAACAAitCQkBBa0EAK1vAZ8BrwHPAe8BBVABAQ8BHwECAQAvXV1d7S/tETkv7QEvXTMzEM4yMjEwEzUhFQE1IRUBNSEVdAPj/B0D4/wdA+MDvJSU/TiUlAFklJQAAgBzAAAEWATPAAYACgCJtwoHAAFSBQQFuAENQBAGABQGAAUGAQIBUgMEAQQDuAENQDICARQCAQMCBgwEAAAQAAIACK0HAQAEBAIF0AYBLwY/BgIGA3ACgAKwAgMPAk8CXwIDAgAvXV0zL11dMxI5PS8zMxgv7QEvXTMQ3tTBhwQrEAHBhwQrEMQQAcGHBBgrhyvEATIzMTATNQEVCQEVBTUhFXUD4/ymA1r8GwPjAnfNAYua/qj+qJnskZEAAAAAAgB0AAAEVwTPAAYACgCJtwoHBgFSAQIBuAENQBAABhQABgEABQQBUgMCBQIDuAENQDIEBRQEBQMEAgYMBAAAEAACAAitBwYFAgIDcASABLAEAw8ETwRfBAMEAdAAAS8APwACAAAvXV0yL11dMzk9LzMzGC/tAS9dxBDOMhDBhwQrEAHBhwQrEMQQAcGHBBgrhyvEATMyMTA3NQkBNQEVATUhFXQDWvymA+P8HQPj7JkBWAFYmv51zf2JkZEAAAAAAgCKAAAEQgQ7AAQACQAsQBkErEAGC4AFrAAAEAACAEkIWQgCCK8CBa8AAC/tL+1dAS9d7RoQ3BrtMTAzEQkBESUhEQkBigHcAdz8mwMS/nf+dwJ7AcD+QP2FVQIAAXL+jgAAAAEAcwC0BFcC8gAFAChAGAQHAaoAAhACAgIArQ8DPwPvAwMDPwEBAQAvXS9d7QEvXe0QzjEwAREjEyEVAQaTAQPjAmD+VAI+kgAAAAABAh79mQQCBqkAGQArQBprEnsSixIDZAp0CoQKA28MAQyAAEkBFA8HAAAvL83NAS/9GsxdMTBdXQEjETQ+AjMyHgIVFAYjIi4CIyIOAhUCr5ElTHZSID4wHTIjJysdGxYZIxcL/ZkHHmm2hk0SITAeJzEkKyQhS3lZAAAAAQDL/ZkCrwapABkAK0AaZBJ0EoQSA2sKewqLCgNgDAEMgAJJGRQPBwAALy/NzQEv7RrMXTEwXV0BMxEUDgIjIi4CNTQ2MzIeAjMyPgI1Ah6RJE12UiA+MB0yIycrHRsWGSMXCwap+OJptoZNEiEwHicxJCskIUt5WQAAAAH/9gIrBNcCvAADABa0AgIFAAC4AQCxAfwAP+0BLxEzLzEwAzUhFQoE4QIrkZEAAAECHv2ZAq8GqQADABC2Av8DAv4A+gA/PwEv7TEwATMRIwIekZEGqfbwAAAAAQIe/ZkE1wK8AAUAHUAJAQEHBP8FBP4DuAEAsQD8AD/tPwEv7REzLzEwASEVIREjAh4Cuf3YkQK8kftuAAAAAAH/9v2ZAq8CvAAFABi2AAP/BAP+ALgBALEB/AA/7T8BL+0vMTADNSERIxEKArmRAiuR+t0EkgAAAQIeAisE1wapAAUAHLYDAwcC/wUFuAEAswL8APoAPz/tAS/tETMvMTABMxEhFSECHpECKP1HBqn8E5EAAf/2AisCrwapAAUAGLYF/wIAA/oFuAEAsQL8AD/tPwEvL+0xMAM1IREzEQoCKJECK5ED7fuCAAABAh79mQTXBqkABwAiQAoDAwkCBv8HBv4FuAEAswL8APoAPz/tPwEv7TIRMy8xMAEzESEVIREjAh6RAij92JEGqfwTkftuAAAB//b9mQKvBqkABwAeQAoF/wIGAAX+A/oAuAEAsQH8AD/tPz8BLy8z7TEwAzUhETMRIxEKAiiRkQIrkQPt9vAEkgAAAAH/9v2ZBNcCvAAHACFACwICCQX/BgEF/gQAuAEAsQH8AD/tMj8BLy/tETMvMTADNSEVIREjEQoE4f3YkQIrkZH7bgSSAAAAAAH/9gIrBNcGqQAHACFACwYGCQX/AgED+gUAuAEAsQH8AD/tMz8BLy/tETMvMTADNSERMxEhFQoCKJECKAIrkQPt/BORAAAAAAH/9v2ZBNcGqQALACpADwYGDQUJ/wIKAQn+A/oIALgBALIFAfwAPzPtMj8/AS8vM+0yETMvMTADNSERMxEhFSERIxEKAiiRAij92JECK5ED7fwTkftuBJIAAAAAAv/2AXcE1wNwAAMABwAjtgcCAgkEAAS4AQCyBf0AuAEAsQH7AD/tP+0BLzMRMy8zMTADNSEVATUhFQoE4fsfBOEC35GR/piRkQAAAAIBav2ZA2MGqQADAAcAHkAPBv8HAv8AAwEDBwL+BAD6AD8yPzMBL13tL+0xMAEzESMBMxEjAWqRkQFokZEGqfbwCRD28AAAAAECHv2ZBNcDcAAJACpACwYBAQsECP8JCP4HuAEAsgT9A7gBALEA+wA/7T/tPwEv7TIRMy8zMTABIRUhFSEVIREjAh4Cuf3YAij92JEDcJHXkfwiAAEBav2ZBNcCvAAJACpADgAACwf/AAgBCAP/BAIGuAEAtAn8CAP+AD8zP+0yAS/tL13tETMvMTABFSERIxEjESMRBNf+jJHXkQK8kftuBJL7bgUjAAIBav2ZBNcDcAAFAAsAM0AOCAEBDQr/CwT/AAUBBQm4AQC1Bv0LBP4DuAEAsQD7AD/tPzM/7QEvXe0v7REzLzMxMAEhFSERIwEhFSERIwFqA239JJEBaAIF/oyRA3CR+roEb5H8IgAAAf/2/ZkCrwNwAAkAJkAJB/8CCAQAB/4EuAEAsgX7ALgBALEB/QA/7T/tPwEvMy8z7TEwAzUhNSE1IREjEQoCKP3YArmRAXeR15H6KQPeAAAB//b9mQNjArwACQAmQA8H/wAIAQgD/wQACAP+BgC4AQCxAfwAP+0yPzMBLy/tL13tMTADNSERIxEjESMRCgNtkdeRAiuR+t0EkvtuBJIAAAL/9v2ZA2MDcAAFAAsAL0AMBv8ABwEHCQQB/wIJuAEAsgr9BLgBALQF+wcB/gA/Mz/tP+0BL+0vMy9d7TEwAREjESE1ASMRITUhA2OR/SQCBZH+jAIFA3D6KQVGkfopA96RAAABAh4BdwTXBqkACQAqQAkIAwMLAgb/CQm4AQCyBv0FuAEAswL7APoAPz/tP+0BL+0yETMvMzEwATMRIRUhFSEVIQIekQIo/dgCKP1HBqn8x5HXkQABAWoCKwTXBqkACQAqQA0DAwsC/wkI/wAFAQUFuAEAtQII/AYA+gA/Mj8z7QEvXe0v7REzLzEwATMRIRUhETMRMwLSkQF0/JOR1wap/BORBH78EwACAWoBdwTXBqkABQALADNADgoDAw0I/wsC/wAFAQULuAEAsgj7BbgBALQC/QYA+gA/Mj/tP+0BL13tL+0RMy8zMTABMxEhFSEBMxEhFSEBapEC3PyTAWiRAXT9+wap+1+RBTL8x5EAAAH/9gF3Aq8GqQAJACZACQn/BgIEAAf6BLgBALIF+wC4AQCxAf0AP+0/7T8BLzMvM+0xMAM1ITUhNSERMxEKAij92AIokQF3kdeRAzn6zgAAAf/2AisDYwapAAkAJkAPAP8HBv8AAwEDAQgE+gYBuAEAsQL8AD/tMz8zAS8vXe0v7TEwASE1IREzETMRMwNj/JMBdJHXkQIrkQPt/BMD7QAC//YBdwNjBqkABQALAC9ADAj/AAsBCwD/AwkBCbgBALUK+wYE+gG4AQCxAv0AP+0/Mz/tAS8zL+0vXe0xMAEhNSERMyEzESE1IQNj/JMC3JH+B5H9+wF0AXeRBKH8NpEAAAAAAQIe/ZkE1wapAAsAL0AMCAMDDQYCCv8LCv4JuAEAsgb9BbgBALMC+wD6AD8/7T/tPwEv7TIyETMvMzEwATMRIRUhFSEVIREjAh6RAij92AIo/diRBqn8x5HXkfwiAAAAAgFq/ZkE1wapAAcACwAvQBEDAw0K/wALAQsCBv8HCwb+BbgBALQC/AgA+gA/Mj/tPzMBL+0yL13tETMvMTABMxEhFSERIwEzESMC0pEBdP6Mkf6YkZEGqfwTkftuCRD28AAAAAMBav2ZBNcGqQADAAkADwA8QBAOBQURDAj/DwkA/wABAQEPuAEAsgz7B7gBALcE/QoC+gkA/gA/Mj8zP+0/7QEvXe0vM+0yETMvMzEwASMRMxMhFSERIxEzESEVIQH7kZHXAgX+jJGRAXT9+/2ZCRD7X5H8IgkQ/MeRAAAB//b9mQKvBqkACwArQAwJ/wYCCgQACf4H+gS4AQCyBfsAuAEAsQH9AD/tP+0/PwEvMy8zM+0xMAM1ITUhNSERMxEjEQoCKP3YAiiRkQF3kdeRAzn28APeAAAAAAL/9v2ZA2MGqQAHAAsAK0ASCv8LBf8CAAYBBgALBf4IA/oAuAEAsQH8AD/tPzM/MwEvL10z7S/tMTADNSERMxEjEQEzESMKAXSRkQFokZECK5ED7fbwBJIEfvbwAAAAAAP/9v2ZA2MGqQADAAkADwA4QA4GCv8JAAsBCw0HAv8DDbgBALIO/Qe4AQC3CPsLAv4EAPoAPzI/Mz/tP+0BL+0vMy9dM+0yMTABMxEjATMRITUhEyMRITUhAtKRkf6Ykf37AXSRkf6MAgUGqfbwCRD8NpH6KQPekQAAAAAC//b9mQTXA3AABwALAC5ACgsCAg0F/wYIAAi4AQC1CfsF/gQAuAEAsQH9AD/tMj8/7QEvMy/tETMvMzEwAzUhFSERIxEBNSEVCgTh/diR/dgE4QF3kZH8IgPeAWiRkQAB//b9mQTXArwACwAuQBMCAg0J/wAKAQoF/wYACgX+CAQAuAEAsQH8AD/tMjI/MwEvL+0vXe0RMy8xMAM1IRUhESMRIxEjEQoE4f6MkdeRAiuRkftuBJL7bgSSAAP/9v2ZBNcDcAAFAAsADwA7QBANBwcRCv8LDgMA/wABAQEOuAEAsw/7CQO4AQC1BgT9CwD+AD8yPzPtMj/tAS9d7S8zL+0RMy8zMTABIxEhNSEzIRUhESMBFSE1AfuR/owCBdcCBf6MkQIF+x/9mQPekZH8IgXXkZEAAAAC//YBdwTXBqkABwALAC5ACgsGBg0F/wIIAAi4AQC1Cf0D+gUAuAEAsQH7AD/tMz8/7QEvMy/tETMvMzEwAzUhETMRIRUBNSEVCgIokQIo+x8E4QLfkQM5/MeR/piRkQAB//YCKwTXBqkACwAuQBMKCg0J/wYF/wACAQIABwP6CQUAuAEAsQH8AD/tMzM/MwEvL13tL+0RMy8xMAM1IREzETMRMxEhFQoBdJHXkQF0AiuRA+38EwPt/BORAAP/9gF3BNcGqQAFAAsADwA7QBAPAwMRCP8ACwELDAkC/wUMuAEAsw39BQm4AQC1Agr7BgD6AD8yPzPtMj/tAS/tLzMvXe0RMy8zMTABMxEhFSEBMxEhNSEBNSEVAtKRAXT9+/6Ykf37AXT+jAThBqn8x5EDyvw2kf4HkZEAAAAAAf/2/ZkE1wapABMAP0ATDwoKFQ0JEf8GAhIEABH+B/oMBLgBALQJBfsQALgBALINAf0APzPtMj8z7TI/PwEvMy8zM+0yMhEzLzMxMAM1ITUhNSERMxEhFSEVIRUhESMRCgIo/dgCKJECKP3YAij92JEBd5HXkQM5/MeR15H8IgPeAAAAAf/2/ZkE1wapABMAQEAUAwMVDRIK/w8ACwELAgb/EwcJBQ24AQBAChICDvwLBv4QAPoAPzI/Mz8zM+0yMgEvM+0yL10z7TIvETMvMTABMxEhFSERIxEjESMRITUhETMRMwLSkQF0/oyR15H+jAF0kdcGqfwTkftuBJL7bgSSkQPt/BMABP/2/ZkE1wapAAUACwARABcATUAVDgMDGQIQ/wURFQkUBv8XAAcBBwUVuAEAtAIW+w8JuAEAQAkMCv0RBv4SAPoAPzI/Mz8z7TI/M+0yAS9dM+0yLzMvM+0yETMvMzEwATMRIRUhAyMRITUhMyEVIREjATMRITUhAtKRAXT9+9eR/owCBdcCBf6Mkf6Ykf37AXQGqfzHkfq6A96RkfwiCRD8NpEAAAAAAQAAAnMEzQapAAMADrQBAAAC+gA/LwEvLzEwASERIQTN+zMEzQJzBDYAAAABAAD9mQTNAnMAAwAOtAEAAP4CAC8/AS8vMTABIREhBM37MwTN/ZkE2gAAAAEAAP2ZBM0GqQADAA+1AQAA/gL6AD8/AS8vMTABIREhBM37MwTN/ZkJEAAAAQAA/ZkCZwapAAMAD7UBAAD+AvoAPz8BLy8xMAEhESECZ/2ZAmf9mQkQAAABAmb9mQTNBqkAAwAPtQEAAP4C+gA/PwEvLzEwASERIQTN/ZkCZ/2ZCRAAACQAAP37BGcGqQADAAcACwAPABMAFwAbAB8AIwAnACsALwAzADcAOwA/AEMARwBLAE8AUwBXAFsAXwBjAGcAawBvAHMAdwB7AH8AgwCHAIsAjwGttg4mRlZ6BW64AQNAD28PJ0dXewVvBh42TooFZrgBA0APZwcfN0+LBWcSKj5afgVyuAEDQA9zEys/W38FcwoiOkqOBWK4AQNAGWMLIztLjwVjb2dzY2NzZ28EdwIaMlKGBWq4AQNADgMbM1OHBWsWLkJeggV2uAEDQAoXL0NfgwV3Z2NruAEEtmhkYGhfW1e4AQS2VFxYVE9LU7gBBLZQTEhQQz9HuAEEtkRAPEQ7NzO4AQS2MDg0MC8rJ7gBBLYkLCgkIx8buAEEthggHBgXEw+4AQS2DBQQDAsHA7gBBLYACAQAg397uAEEQB14gHx4aFRQRDAkGAwAeHgADBgkMERQVGgKhHRwbLgBBLV3c2+Pi4e4AQSzjIiE+gA/MzPtMjIvMzPtMjIRFzkvLy8vLy8vLy8vETMzEO0yMhEzMxDtMjIRMzMQ7TIyETMzEO0yMhEzMxDtMjIRMzMQ7TIyETMzEO0yMhEzMxDtMjIRMzMQ7TIyETMzEO0yMgEvFzPtFzIvFzPtFzISFzkvLy8vERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMjEwETMVIyUzFSMlMxUjBTMVIyUzFSMlMxUjBTMVIyUzFSMlMxUjBTMVIyUzFSMlMxUjBTMVIyUzFSMlMxUjBzMVIyUzFSMlMxUjBTMVIyUzFSMlMxUjFzMVIyUzFSMlMxUjBzMVIyUzFSMlMxUjFzMVIyUzFSMlMxUjATMVIyUzFSMlMxUjATMVIyUzFSMlMxUjZ2cBmmdnAZpnZ/2ZZmYBmmZmAZpmZvv/Z2cBmmdnAZpnZ/2ZZmYBmmZmAZpmZvv/Z2cBmmdnAZpnZ81mZgGaZmb8zGZmAmdnZ/5mZ2f+ZmdnzWZmAZpmZgGaZmbNZ2f+Zmdn/mZnZ81mZgGaZmYBmmZm/MxmZgGaZmYBmmZm+/9nZwGaZ2cBmmdnBShiYmJiYmFgYGBgYGBgYGBgYGNgYGBgYGBgYGBgYGNgYGBgYGBhYWFhYWJeXl5eXmJhYWFhYWBgYGBgYAftYmJiYmIBI2BgYGBgAAAASAAA/fsEzgapAAMABwALAA8AEwAXABsAHwAjACcAKwAvADMANwA7AD8AQwBHAEsATwBTAFcAWwBfAGMAZwBrAG8AcwB3AHsAfwCDAIcAiwCPAJMAlwCbAJ8AowCnAKsArwCzALcAuwC/AMMAxwDLAM8A0wDXANsA3wDjAOcA6wDvAPMA9wD7AP8BAwEHAQsBDwETARcBGwEfAxGzAjJiprsBCgAFANYBA7TXAzNjp7gBC0AJBdceTo6u9gXeuAEDQAzfH0+Pr/cF3wY2ZqK7AQ4ABQDSAQO00wc3Z6O4AQ9ACQXTIlJ+svoF4rgBA0AM4yNTf7P7BeMKOmqeuwESAAUAzgEDtM8LO2ufuAETQAkFzyZWgrb+Bea4AQNADOcnV4O3/wXnDj5umrsBFgAFAMoBA7TLDz9vm7gBF7UFyypahrq7AQIABQDqAQO06ytbh7u4AQO1BesSQnKWuwEaAAUAxgEDtMcTQ3OXuAEbtQXHLl6KvrsBBgAFAO4BA7TvL1+Lv7gBB0AfBe/X39Pjz+fL68fv78fry+fP49Pf1wrDGkp6qvIF2rgBA0ALG0t7q/MF2xZGdpK7AR4ABQDCAQOzF0d3k7gBH0AJBcPDx8vP0wXXuAEEQA/UwMTIzNAF1K+zt7u/Bau4AQRAD6issLS4vAWok5ebn6MFp7gBBEAPpJCUmJygBaR/g4eLjwV7uAEEQA94fICEiIwFeGdrb3N3BWO4AQRAD2BkaGxwdAVgT1NXW18FS7gBBEAPSExQVFhcBUg3Oz9DRwUzuAEEQA8wNDg8QEQFMB8jJysvBRu4AQRADxgcICQoLAUYBwsPExcFA7gBBEALAAQIDBAUBQD3+/+8AQMBBwAFAPMBBLPw9Pj8uQEAAQRAFwXw1KikeGBIMBgA8PAAGDBIYHikqNQKuAEIttzg5OjsBdi4AQS23+Pn6+8F20EQAQ8BEwEXARsBHwAFAQsBBAEMARABFAEYARwABQEIAPoAPxcz7RcyLxcz7RcyERc5Ly8vLy8vLy8vLxEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIBLxcz7RcyLxcz7RcyEhc5Ly8vLy8vLy8vLxEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIxMBMzFSM3MxUjNzMVIzczFSM3MxUjNzMVIwUzFSM3MxUjNzMVIzczFSM3MxUjNzMVIwUzFSM3MxUjNzMVIzczFSM3MxUjNzMVIwUzFSM3MxUjNzMVIzczFSM3MxUjNzMVIwUzFSM3MxUjNzMVIzczFSM3MxUjNzMVIwUzFSMlMxUjNzMVIzczFSM3MxUjJTMVIwUzFSMnMxUjJzMVIyczFSMnMxUjJzMVIwczFSM3MxUjNzMVIzczFSM3MxUjNzMVIxczFSMnMxUjJzMVIyczFSMnMxUjJzMVIwczFSM3MxUjNzMVIzczFSM3MxUjNzMVIwEzFSM3MxUjNzMVIzczFSM3MxUjNzMVIwEzFSM3MxUjNzMVIzczFSM3MxUjNzMVI2ZnZ81nZ81nZ81nZ81nZ81nZ/uZZmbNZmbNZmbNZmbNZmbNZmb8ZWdnzWdnzWdnzWdnzWdnzWdn+5lmZs1mZs1mZs1mZs1mZs1mZvxlZ2fNZ2fNZ2fNZ2fNZ2fNZ2f7mWZmAZpmZs1mZs1mZs1mZvzMZmYDmmdnzWdnzWdnzWdnzWdnzWdnZmZmzWZmzWZmzWZmzWZmzWZmZmdnzWdnzWdnzWdnzWdnzWdnZmZmzWZmzWZmzWZmzWZmzWZm+/9mZs1mZs1mZs1mZs1mZs1mZvxlZ2fNZ2fNZ2fNZ2fNZ2fNZ2cFKGJiYmJiYmJiYmJiYWBgYGBgYGBgYGBgYGBgYGBgYGBgYGBgY2BgYGBgYGBgYGBgYGBgYGBgYGBgYGBgY2BgYGBgYGBgYGBgYGFhYWFhYWFhYWFhYl5eXl5eXl5eXl5eYmFhYWFhYWFhYWFhYGBgYGBgYGBgYGBgB+1iYmJiYmJiYmJiYgEjYGBgYGBgYGBgYGAAAAA4AAD9mQTOBqkARQBJAE0AUQBVAFkAXQBhAGUAaQBtAHEAdQB5AH0AgQCFAIkAjQCRAJUAmQCdAKEApQCpAK0AsQC1ALkAvQDBAMUAyQDNANEA1QDZAN0A4QDlAOkA7QDxAPUA+QD9AQEBBQEJAQ0BEQEVARkBHQEhAxe2GmR4peQFxbgBA0APAwcLDxMXBQNLa5Gr8AXLuAEDQA/ISGiIqPUFyB5ge6HgBcG4AQNAD8IbZXmi5QXCT2+Lr+wFz7gBA0APzExsjqzxBcwiXH+d3AW9uAEDQA++H2F8nuEFvlNzk7PoBdO4AQNAD9BQcIyw7QXQJliDmdgFubgBA0AKuiNdgJrdBbr3/70BBwEPASAABQEXAQNACtRUdJS06QXUKvy9AQMBDQEcAAUBFQEDQA+2J1mEltkFtjA0ODxABURBCQEDARgA+AEAAQgBEAEhAAUBGEAJA8jCzL7QutS2uQEYARhACrbUutC+zMLIAwq4ARK2R2eHp/QFx7gBA0ARBQkNERUFAS4yNjo+QgYAK/28AQQBCgEdAAUBEkAMHCAkKCwFGBZDys7SuwEWAAUAxgEEtAK5vcHFuAEVtQUCuLzAxLsBFAAFAAUBBLSnQKuvs7gBD7UFpz+qrrK7AQ4ABQCmAQS0BpmdoaW4AQ21BQaYnKCkuwEMAAUACQEEtIc8i5GTuAEHtQWHO4qQkrsBBgAFAIYBBLQKeHt/g7gBA7UFCnd6foK7AQIABQANAQRAD2c4a29z/wVnN2pucv4FZrgBBEAPDlhcYGT8BQ5XW19j+wURuAEEQA9HNEtPU/cFRzNKTlL2BUa4AQS0Etjc4OS4ARy1BRLX29/juwEbAAUAFQEEtPQw6OzwuAEgQBwF9AKnBocKZw5HEvT0EkcOZwqHBqcCChZEy8/TuwEXAAUAxwEEtQH+L+fr77sBHwAFAPMBBLYaHiImKgUWAC8XM+0XMj/tFzIRFzkvLy8vLy8vLy8vERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhDGFzIBLxczxBcyLxcz7RcyEhc5Ly8vLy8vLy8vLxEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIRFzMQ7RcyERczEO0XMhEXMxDtFzIxMAEhETM1IxEzNSMRMzUjETM1IxEzNSMRMzUzFTM1MxUzNTMVMzUzFTM1MxUzNTMVIxUzESMVMxEjFTMRIxUzESMVMxEjFTMBFTM1MxUzNTMVMzUzFTM1FyMVMycjFTMnIxUzJyMVMwcVMzUzFTM1MxUzNTMVMzUFIxUzNxUzNTMVMzUzFTM1BRUzNSEVMzUHNSMVJRUzNRM1IxUjNSMVIzUjFSM1IxUHFTM1MxUzNTMVMzUzFTM1EzUjFSM1IxUjNSMVIzUjFQcVMzUzFTM1MxUzNTMVMzUTIxUzJyMVMycjFTMnIxUzASMVMycjFTMnIxUzJyMVMwEVMzUXIxUzBxUzNR0BMzUHFTM1EzUjFQcVMzUTNSMVBxUzNRMjFTMDIxUzBM77MmZmZmZmZmZmZmZmZ2ZnZmdmZ2ZnZmdnZ2dnZ2dnZ2dnZ2f7mGdmZ2ZnZmdmZmbNZmbNZmbNZmbNZ2ZnZmdmZ/3/ZmZnZmdmZ2b8zGcBM2fNZwGaZ2ZmZ2ZnZmdmZ2dmZ2ZnZmdmZmdmZ2ZnZmdnZmdmZ2ZnZmZmzWZmzWZmzWZmAgFnZ81nZ81nZ81nZwLNZ2ZmZs1nZs1nZmZnZ2ZmZ2dmZmZmZ2f9mQEiYQEiYQEjYAEhYgEhYgEhYGBgYGBgYGBgYGDBYv7fYP7dYP7dYP7dXv7dYAZqYGBgYGBgYGDAYmJiYmJiYmFgYGBgYGBgYMBgYGBgYGBgYMNgYGBgYGBgYGBg/t9hYWFhYWFhYWJeXl5eXl5eXv7fYWFhYWFhYWFgYGBgYGBgYGAGzWJiYmJiYmIBImJiYmJiYmL+32BgwGJhYGDAYGDDYGD+32FhYl5e/t9hYWBgYAbNYgEiYgABAHcAdQRWBFQAAwANswABAgAALy8BLy8xMBMhESF3A9/8IQRU/CEAAgACAAAEywTJAAMABwAmQQwABQEBAAMABgEBAAIABQECAAMABAECAAAAL+0v7QEv7S/tMTATIREhExEhEQIEyfs3TAQxBMn7NwR9+88EMQABAWgBfwNkA3sAAwAUQAkAAAFgAQIBAAIAL80BL13NMTABIREhA2T+BAH8AX8B/AACAWgBfwNkA3sAAwAHACu8AAQBAQAAAAcBAbYAAWABAgEHvAECAAAABgECAAIAL+3c7QEvXe3d7TEwASERIQMRIREDZP4EAfxM/pwBfwH8/lABYv6eAAAAAQAIAEYExQIiAAMADbMAAQIAAC8vAS8vMTATIREhCAS9+0MCIv4kAAEADwAyBL0ErgACAA2zAAIAAQAvLwEvLzEwNwkBDwJYAlYyBHz7hAABADT/5QTLBKwAAgANswABAgAALy8BLy8xMBMJATQEl/tpBKz9nv2bAAAAAAEAD//lBL0EYQACAA2zAgABAAAvLwEvLzEwCQIEvf2q/agEYfuEBHwAAAAAAQAC/+UEmQSsAAIADbMCAAEAAC8vAS8vMTABEQEEmftpBKz7OQJlAAIAcwAABFkFoAAFAAkAVUAyBAMGAAEGAwgIAgWqEAkgCTAJcAmACQUJCQsHqgACEAICAgIFCQMHBwgGsA8DAQMIsAEAL+0vXe0SOT0vFzMBGC9d7RI5L13tETk9LxczETMzMTAhIwkBMwkEAo5S/jcByVIBy/4O/p4BYgFgAs8C0f0xAjX9y/3CAj4AAgCjAKIEKgQpABMAJwBHQBVLJlsmAksgWyACRBxUHAJEFlQWAh64AQGyCgoUuAEBtAAAAQAZuAECsg8PI7kBAgAFAC/tMy/tAS9d7TMv7TEwAF1dXV0TND4CMzIeAhUUDgIjIi4CNxQeAjMyPgI1NC4CIyIOAqNGeqReXqV7R0d7pV5epHpGVjlihUxMhmM6OmOGTEyFYjkCZF6le0dHe6VeXqR6RkZ6pF5MhGM5OWOETEyGYzo6Y4YAAAABAK4AiQQfA/oAFwAYQA0IABCQEKAQsBAEEAwAAC/NAS9dzTEwATIXHgEXHgEVFAcGIyInJjU0Njc+ATc2AmZuazVSHR0fgYG3toGBHh0dUzRsA/o5HFI0Nm45t4GBgYG3Om02NFIcOQAAAAACACUAAASoBIMAAwAXAB5ADs8OAd8OAQ4DBAATAQkAAC/NL80BL83dzV1xMTAzESERARQeAjMyPgI1NC4CIyIOAiUEg/wERXigW1uheEVFeKFbW6B4RQSD+30CQVugeEVFeKBbW6F4RUV4oQADACUAAASoBIMAAwAXACsAMEAZ8AQBBBgAAA4BDs8iAd8iASIDAAknARMdAAAv3c4v3c4BL93dXXHOchDdznExMDMRIREBND4CMzIeAhUUDgIjIi4CJxQeAjMyPgI1NC4CIyIOAiUEg/xROmOFS0uFYzo6Y4VLS4VjOk1FeKBbW6F4RUV4oVtboHhFBIP7fQJBS4VjOjpjhUtLhWM6OmOFS1ugeEVFeKBbW6F4RUV4oQAAAAACAW4BhQNeA3UAEgAiADC8ABMBAQAAABsBAUALAAtQC2ALsAsECx+8AQIABgAXAQIADwAv7dztAS9d7dTtMTABFAYHDgEjIicuATU0NzYzMhcWBzQnJiMiBwYVFBcWMzI3NgNeJSUlVjNlSyMlSEpmZ0dKTDMzRkYzMzMxSEgxMwJ9NVYlIyVIJVY1ZkhKSkdnRjMzMzNGRTYxMTYAAAAABQAbAAIEsQSYABkALQA5AEUAWwC/QEobLCssayx7LARpK3krAmkneScCGyYrJmsmeyYEFCIkImQidCIEZiF2IQJmHXYdAhQcJBxkHHQcBDT/Ljr/QFsALlFADC5ALkAAJLsBAQAMABoBAbIAUEa4/8C1CQ1IRkZWuAEEsktDN7gBAEAOMT0xP0tPSwJLMUsxBx+7AQIAEwApAQKxBxMAL9ztEO0ROTkvL10RMxDtMhDtMy8rMwEv7dTtEjk5Ly8REjkREjkQ7RDtMTAAXV1dXV1dXV0TND4EMzIeAhUUDgQjIi4ENxQeAjMyPgI1NC4CIyIOAjc0NjMyFhUUBiMiJiU0NjMyFhUUBiMiJgEeAzMyPgI3Fw4DIyIuAicbKkxsgpZRetWgXCpMbIKWUVGWgmxMKj9Sj79sbL6PUlKPvmxsv49S7CkdHSoqHR0pAbMpHR0qKh0dKf5oEiw9Ujg4Uj0sEjoTNk1lRENmTTUUAk1RloJsTCpcoNV6UZaCbEwqKkxsgpZRbL+PUlKPv2xsvo9SUo++LB0qKh0dKSkdHSoqHR0pKf7yGDAnGRknMBgxHj8zISEzPx4AAAAABAAbAAIEsQSYABkAJQAxAEcAbUAeJv8sIP8aPAwsMhoAHywvLAIQGiAaAiwaLBoMACkduAEAtiMvIz1HRze4AQRAFUIPIwEPQj9CT0JvQn9CBSNCI0IHEwAvxDk5Ly9dXRDuMy8zETMQ5jIBL805OS8vXV0REjkREjkQ5hDmMTATND4EMzIeAhUUDgQjIi4EJRQWMzI2NTQmIyIGBRQWMzI2NTQmIyIGAR4DMzI+AjcnDgMjIi4CJxsqTGyCllF61aBcKkxsgpZRUZaCbEwqASspHR0qKh0dKQGzKR0dKiodHSn+LhQ1TWZDRGVNNhM6Eiw9Ujg4Uj0sEgJNUZaCbEwqXKDVelGWgmxMKipMbIKW6R0pKR0dKiodHSkpHR0qKv6HHj8zISEzPx4xGDAnGRknMBgAAAAAAgAa/4YEsgQeAC8AQwCPt1kvaS95LwMkuP/wsw4RSBe4//BACw4RSFkMaQx5DAMwuAEBtCsoKAQ6uAEBtxBwEwETExwHuAEBQA4fAAQQBEAEUARwBAUENbgBArQfHBwTKLsBAgArAD8BAkALBHAHAQcHEB8rASsAL10zMy9dM+0Q7TIyLzPtAS9dM+0yMi9dM+0RMy8z7TEwAF0rK10TFz4BNzUzFR4BFzcXBx4BFzMVIw4BBxcHJw4BBxUjNS4BJwcnNy4BJyM1Mz4BNycTFB4CMzI+AjU0LgIjIg4C4KQoYDZINl8opTOlICoF6ekFKiClM6UoXzZINmAopDOkICoF6OgFKiCknC1NaDs7aE0tLU1oOztoTS0Di6UgKgXp6QUqIKUzpShfNkg2YCikM6QgKgXo6AUqIKQzpChgNkg2Xyil/no8aE0sLE1oPDtoTS0tTWgAAAACATwARgOQBJQAHgAyAFa2FCAMD0gXG7gBAbQBHBwHKbgBAbIZER+4AQG0HgccGh64AQKzFwAAJLgBArUWMAIBAi65AQIADAAv7dRdMu0zLzPtMjIBLzPt1DLtETkvM+0yMTAAKwEzNS4DNTQ+AjMyHgIVFA4CBxUzFSMVIzUjExQeAjMyPgI1NC4CIyIOAgFY6jdgRikvUW09PmxRLylGYDfq6kjqLCM+Ui8vUj0kJD1SLy9SPiMBeMoHM09mOT5sUS8vUWw+OWZPMwfKSOrqAjovUj4jIz5SLy9SPSQkPVIAAAACAKQAcgQEA9IAHQAxAGezEAkLD7gBAUAMDw4fDi8OAw4RCAAouwEBABQAHgEBtwAAAQAIEQUjuAECQBMwGQEZBQkQDgoPCx8LLwsDCwstuQECAAUAL+0zL13NzDk5ENRd7RI5OQEvXe3U7RI5OdZd7cQ5OTEwEzQ+AjMyFhcBLwEhFxEvAQEeARUUDgIjIi4CNxQeAjMyPgI1NC4CIyIOAqQvUW09NF0mAQHiAgFLFzcU/v8eIi9RbD49bVEvSCM+Ui8vUj0kJD1SLy9SPiMBnD5sUS8iHgEBFDcX/rUC4v7/Jl00PW1RLy9RbT0vUj4jIz5SLy9SPSQkPVIAAAAAAQBmAAAEZgSrADUARkAuRzBXMAIgCjAKcAoDChQ/K38rAisQIUAhUCGAIQQhDyYUISEfJi8mPyYDJiYaAAAvLzkvXTkRMxEzAS9dzV3dzV0xMF0BFB4CFx4DFRQOAiMiLgInFB4CMxUhNTI+AjUOAyMiLgI1ND4CNz4DNQKAKUVbMjhXPCAnQlUtJEY9MA4vVXZG/SBHdVUvDjA9RiQtVUInIDxYNzJbRSkEqy5nZWAnLFFPUy06WTwfEx0kEERqSCY4OCZIakQQJB0THzxZOi1TT1EsJ2BlZy4AAAEAYQAABGsEqwA+AFRANDUmOjovMD8wfzADMCYKGQUFIA8wD3APAw8ZECZAJlAmgCYEJhQrGSYmHysvKz8rAysrHwAALy85L105ETMRMwEvXd3NXTkvEjkQzV05LxI5MTABMh4CFRQOAgc2HgIVFA4CIyIuAicUHgIzFSE1Mj4CNQ4DIyIuAjU0PgIXLgM1ND4CAmZLakIeEyArGFOFXTEnQlUtJEc/Mg4vVXZG/SBHdVUvDjI/RyQtVUInMV2FUxgrIBMeQmoEqyxFUyYjRj40EQgfQ2E8Olk8HxMdJBBEakgmODgmSGpEECQdEx88WTo8YUMfCBE0PkYjJlNFLAABAGb//wRmBGgAKQAqQBoJJgEGAwEQHwEfHysQCkAKUApwCoAKBQoPAAAvLwEvXREzL10xMF1dBTQuAicuAzU0PgIzMh4CFzM+AzMyHgIVFA4CBw4DFQJMMEpYKTRWPiMrRVgtL1REMw4GDjNEVC8tWEUrIz5WNChZSjABL250cTE/eXFoLTpcQCIlP1MvL1M/JSJAXDotaHF5PzFxdG4vAAAAAAEAhP//BEgErgAXACxAHHAQgBACTxABMBABDxABEBAABBAEQARQBAQEFgoALy8BL10zL11dXV0xMCQuAic1PgM3Mx4DFxUOAwcjAjFwe4JAQIJ7cC8ML3B7gkBAgntwLwxAlZucSQNJnJuVQUGVm5xJA0mcm5VBAAEBGgAYA6kEZgAqACxAFwNAJYAdCR8TARMAGxAbMBsDGwgcDQAYAC8zzS8zAS9dzV3NMhrcGs0xMAE+ATU0LgInERQOAiMiLgI1ND4CMzIWFxEzHgEXHgMVFA4CBwMUIykhN0goKUBPJiE6LBknP04oGjQWJgU7RSs+KBMUHyQQARAmc0E6Yk01Df2qJT4sGBEgLh0iPC0aCwwDRDF4RixUVlszLlBBMxEAAAACAHD/0gQ8BIMAKQAtAIZAUyoQIislHwUBBQ0NHxoBGgAiECICIokPAQ8qiCoBZyoBVCoBKokOAQ4rJysBFSsBBCsBKyR5LYktAi0jdyOHIwJWIwEjJAAKCh+JLAEsJBU/HwEfAC9dzS8zXRI5L80RM11dETNdETNdXV0RM10zXV1dETNdAS9dzV0zL81dzTMQzTIxMCUiLgI1ND4CMzIWFxEFERQOAiMiLgI1ND4CMzIWFxElERQOAgElNQUDXiE6LBknP04oGjQW/fApQE8mITosGSc/TigaNBYCjClAT/5qAhD98CwRIC4dIjwtGgsMAbNR/eElPiwYESAuHSI8LRoLDANDZPxQJT4sGAL4UXhRAAADAFQAAAQlBcwAGwAfACMAfrVFClUKAgq4/+BARgkMSBoaD0AdIkgPQAsYSA8PIAIcRh8fI0ZgINAgAiAgJRkBRgIFBQYAAgECMBxgHAKAHJAcAhwdE1AMAAAEUSEZBQ8gARUAPzM/MzPtMj/tLy9dcQEvXTMzLxDtMhI5L13tMi/tERI5LysrMy8xMAArXQERIxEjNTM1ND4CMzIWFxUuASMiDgIdATMVEzUzFQMRMxEBoLSYmBY7ZlEgRRoRLRIoMx0L0/60tLQDt/xJA7eDejtlSysGBokDBRYpPCdhgwFprKz64AQ6+8YAAAIAVAAABCUFzAAbAB8AZrVFClUKAgq4/+BANgkMSBoaD0AdIkgPQAsYSA8PAh9GYBzQHAIcHCEZAUYCBQUGAAIBAh0AE1AMAAAEURkFDxwBFQA/Mz8z7TI/7T8BL10zMy8Q7TISOS9d7RI5LysrMy8xMAArXQERIxEjNTM1ND4CMzIWFxUuASMiDgIdATMVExEzEQGgtJiYFjtmUSBFGhEtEigzHQvT/rQDt/xJA7eDejtlSysGBokDBRYpPCdhg/xJBcz6NAAAAQHb/lkC7/+eAAUAIEAJAhgJEUgDgAAFuAEMtQACEAICAgAvXe0BLxrNMTArATUTMxUDAdtPxav+WSEBJCX+4AAAAAABAQUEsAPjBbQAFQAlQBQQhQ8RARERBoUABQEFEAaMC44AkwA/7eQyAS9d7TMvXe0xMAEiLgInMx4DMzI+AjczDgMCdGSKVygCpAMeM0kuLkkzHgOkAihXigSwJkVgOSs6Ig4OIjorOWBFJgABAdsEhwLvBcwABQApsgKGA7gBC0AOZgV2BYYFAwWDAAABAAK4AQyxBZMAP+0BL13tXf3tMTABNRMzFQMB20/FqwSHIQEkJf7gAAAAAQHbBLsC7wYAAAUAHbkAAv/otgkRSACAAwW4AQyxApQAP+0BLxrNMTArARUDIzUTAu9PxasGACH+3CUBIAAAAAEA1f5XA6QEOgAZADBAGgoDGgMCGBgKAEYAFQEVFRsaChdQGA8QUAUbAD/tP+0BLxESOS9d7RI5LzEwAF0FFA4CIyIuAic1HgMzMj4CNREhNSEDpEd2nFYpUkxBGBY8SE8oOGFIKf5pAkscbZdfKgcMDwmMBQwKBxw9X0MDxY4AAQElAk0CxwVFABIAREAcEREQ4AIICAEBDgACEAICAgITFAjkAAkBCQkDDrgBEbMQAeQAuAESAD/tMj8zMy9d7RESATkvXTMzLzMvEO0yLzEwATUzEQ4DIzUyPgI3MxEzFQFJhw0vMy8NEjAzLxF5dAJNawIBGiQXCncMGywh/XNrAAAAAQD6Ak0DBAVRACAAT7kAFf/YQCAJEUgfHxfhCAgAIg7gDw8AHh4AABAAAgBfDgEODgvkFLgBE7MBHuQAuAESAD/tMj/tMy9dAS9dMy8RMy/tERI5L+0yLzEwACsTNT4FNTQmIyIGByc+AzMyFhUUDgQHIRX6GEpUVEQqMzw9OwiCBidBXD14eS5HVlJEEAF8Ak1hN1VIP0BHLDlAPj0FL1A6IXBnN1lLQT9BJmsAAAABAOoCOwLtBVEAMwCKuQAq/9hAQAkRSAMoCRFIABwQHCAcA3swASLhIyMKLeEcGBwYHAoA4REL4QoRETVPCgEAChAKAgowGBcWFg4oXyIBIiIf5Ci4ARNACQ7kBVALAQsLBbgBFAA/My9dEO0/7TMvXRESOS/EETkBL11dEjkvEO0Q7RI5OS8vEO0RMy/tAF0BXTEwACsrARQOAiMiLgInNx4BMzI2NTQuAisBNTMyNjU0JiMiBgcnPgMzMh4CFRQGBxUeAQLtJ0ReOEBcPiIGiAlBMDZCGSk2HSklREA2KS1CBocHLERVMDpXOh1DRVJLAxo2UzkdJTxMJw08PTxBJS8aCm05QjUyPzkMNlA2Gh83SipCVRoCEmQAAAIAxQJLAzUFRQAKABcAXUASCQkIAeASBmACcAKAAgMCAhkRuAEXQCAEQA0RSAAEEAQCBAAE5AgFDxEfES8RnxG/EQUREQELBroBEQABARIAPz8zEjkvXTMz7TIBL10r7RI5L10zM+0yMi8xMAEVIzUhNQEzETMVAw4DBwMhETwCNgK7f/6JAWmNevgGFRgXB7kBCQEC7KGhYwH2/gxlAdkJHyIgCv8AAQQNIB8bAAAAAQEEAkYC+wVFAB8AZrkAHv/YQCwJEUgCKAkOSBkaFhTgFRUFDhcXAOEODiEG4AAFEAUCBRrlFRUR5B0dCRnlFrgBEbUJ5AMGBgO4ARQAPzMvEO0/7RI5L+0zL+0BL13tEjkv7TIvERI5L+0zMjIxMAArKwEUBiMiJzceATMyPgI1NCYjIgYHIxMhFSEHPgEzMhYC+4N22yOFCzkyGCsgEj81KDIVgSEBqv7CExxDJ3B7A0N6g78PNi8OIjkrST8eHgG2cdcgG34AAAAAAQD8Ak0DAwVFAA4AL0AUBeAGBgwA4AsLEAAMEAwCDAAM5Q26AREABQESAD8/7TIBL10SOS/tEjkv7TEwAQ4DFSM0PgI3ITUhAwNDYz8fhSJDY0D+egIHBOBdmpahZV6jmZlUcQAAAAADARECQAMGBVEAEQAlAEcAbbkAPv/oswwRSDq4/+hALgwRSC0YCQ9IKRgJEUhFMzdB4AAI4DcANwA3MCbgEhJJHOAwRTMzF+QNDSEF5Dy4AROyIeQruAEUAD/tP+0SOS/tOREzAS/tEjkv7RI5OS8vEO0Q7RE5OTEwACsrKysBNC4CIyIGFRQeAjMyPgITNC4CIyIOAhUUHgIzMj4CNxQOAiMiLgI1NDY3NS4BNTQ+AjMyHgIVFAYHFR4BAmsIFiUeOCgIFiUeISYUBRUMGy0iIS0aCwsbLiIjLRoJhh08X0JCXz0dQDk2Lx05Vjk8WDgbMTVCOQSAGSgdDzsyEykhFRYhKf67HC8iExMiLxwcMCQUFCMxEzJTOyAhO1IyTlkSAxpXPylINR8fNkgpPlgYAxNaAAAAHAFWAAEAAAAAAAAAQACCAAEAAAAAAAEADwDjAAEAAAAAAAIABwEDAAEAAAAAAAMAMwFzAAEAAAAAAAQAFwHXAAEAAAAAAAUADAIJAAEAAAAAAAYAFgJEAAEAAAAAAAcAegNRAAEAAAAAAAgAFAP2AAEAAAAAAAkADgQpAAEAAAAAAAsAHARyAAEAAAAAAAwALgTtAAEAAAAAAA0AfwYcAAEAAAAAAA4AKwb0AAMAAQQJAAAAgAAAAAMAAQQJAAEAHgDDAAMAAQQJAAIADgDzAAMAAQQJAAMAZgELAAMAAQQJAAQALgGnAAMAAQQJAAUAGAHvAAMAAQQJAAYALAIWAAMAAQQJAAcA9AJbAAMAAQQJAAgAKAPMAAMAAQQJAAkAHAQLAAMAAQQJAAsAOAQ4AAMAAQQJAAwAXASPAAMAAQQJAA0A/gUcAAMAAQQJAA4AVgacAEQAaQBnAGkAdABpAHoAZQBkACAAZABhAHQAYQAgAKkAIAAyADAAMAA3ACAAQQBzAGMAZQBuAGQAZQByACAAQwBvAHIAcABvAHIAYQB0AGkAbwBuAC4AIABBAGwAbAAgAHIAaQBnAGgAdABzACAAcgBlAHMAZQByAHYAZQBkAC4AAERpZ2l0aXplZCBkYXRhIKkgMjAwNyBBc2NlbmRlciBDb3Jwb3JhdGlvbi4gQWxsIHJpZ2h0cyByZXNlcnZlZC4AAEwAaQBiAGUAcgBhAHQAaQBvAG4AIABNAG8AbgBvAABMaWJlcmF0aW9uIE1vbm8AAFIAZQBnAHUAbABhAHIAAFJlZ3VsYXIAAEYAbwBuAHQARgBvAHIAZwBlACAAMgAuADAAIAA6ACAATABpAGIAZQByAGEAdABpAG8AbgAgAE0AbwBuAG8AIABSAGUAZwB1AGwAYQByACAAOgAgADEAMgAtADEALQAyADAAMAA5AABGb250Rm9yZ2UgMi4wIDogTGliZXJhdGlvbiBNb25vIFJlZ3VsYXIgOiAxMi0xLTIwMDkAAEwAaQBiAGUAcgBhAHQAaQBvAG4AIABNAG8AbgBvACAAUgBlAGcAdQBsAGEAcgAATGliZXJhdGlvbiBNb25vIFJlZ3VsYXIAAFYAZQByAHMAaQBvAG4AIAAxAC4AMAA0AABWZXJzaW9uIDEuMDQAAEwAaQBiAGUAcgBhAHQAaQBvAG4ATQBvAG4AbwAtAFIAZQBnAHUAbABhAHIAAExpYmVyYXRpb25Nb25vLVJlZ3VsYXIAAEwAaQBiAGUAcgBhAHQAaQBvAG4AIABpAHMAIABhACAAdAByAGEAZABlAG0AYQByAGsAIABvAGYAIABSAGUAZAAgAEgAYQB0ACwAIABJAG4AYwAuACAAcgBlAGcAaQBzAHQAZQByAGUAZAAgAGkAbgAgAFUALgBTAC4AIABQAGEAdABlAG4AdAAgAGEAbgBkACAAVAByAGEAZABlAG0AYQByAGsAIABPAGYAZgBpAGMAZQAgAGEAbgBkACAAYwBlAHIAdABhAGkAbgAgAG8AdABoAGUAcgAgAGoAdQByAGkAcwBkAGkAYwB0AGkAbwBuAHMALgAATGliZXJhdGlvbiBpcyBhIHRyYWRlbWFyayBvZiBSZWQgSGF0LCBJbmMuIHJlZ2lzdGVyZWQgaW4gVS5TLiBQYXRlbnQgYW5kIFRyYWRlbWFyayBPZmZpY2UgYW5kIGNlcnRhaW4gb3RoZXIganVyaXNkaWN0aW9ucy4AAEEAcwBjAGUAbgBkAGUAcgAgAEMAbwByAHAAbwByAGEAdABpAG8AbgAAQXNjZW5kZXIgQ29ycG9yYXRpb24AAFMAdABlAHYAZQAgAE0AYQB0AHQAZQBzAG8AbgAAU3RldmUgTWF0dGVzb24AAGgAdAB0AHAAOgAvAC8AdwB3AHcALgBhAHMAYwBlAG4AZABlAHIAYwBvAHIAcAAuAGMAbwBtAC8AAGh0dHA6Ly93d3cuYXNjZW5kZXJjb3JwLmNvbS8AAGgAdAB0AHAAOgAvAC8AdwB3AHcALgBhAHMAYwBlAG4AZABlAHIAYwBvAHIAcAAuAGMAbwBtAC8AdAB5AHAAZQBkAGUAcwBpAGcAbgBlAHIAcwAuAGgAdABtAGwAAGh0dHA6Ly93d3cuYXNjZW5kZXJjb3JwLmNvbS90eXBlZGVzaWduZXJzLmh0bWwAAFUAcwBlACAAbwBmACAAdABoAGkAcwAgAEwAaQBiAGUAcgBhAHQAaQBvAG4AIABmAG8AbgB0ACAAcwBvAGYAdAB3AGEAcgBlACAAaQBzACAAcwB1AGIAagBlAGMAdAAgAHQAbwAgAHQAaABlACAAbABpAGMAZQBuAHMAZQAgAGEAZwByAGUAZQBtAGUAbgB0ACAAdQBuAGQAZQByACAAdwBoAGkAYwBoACAAeQBvAHUAIABhAGMAYwBlAHAAdABlAGQAIAB0AGgAZQAgAEwAaQBiAGUAcgBhAHQAaQBvAG4AIABmAG8AbgB0ACAAcwBvAGYAdAB3AGEAcgBlAC4AAFVzZSBvZiB0aGlzIExpYmVyYXRpb24gZm9udCBzb2Z0d2FyZSBpcyBzdWJqZWN0IHRvIHRoZSBsaWNlbnNlIGFncmVlbWVudCB1bmRlciB3aGljaCB5b3UgYWNjZXB0ZWQgdGhlIExpYmVyYXRpb24gZm9udCBzb2Z0d2FyZS4AAGgAdAB0AHAAOgAvAC8AdwB3AHcALgBhAHMAYwBlAG4AZABlAHIAYwBvAHIAcAAuAGMAbwBtAC8AbABpAGIAZQByAGEAdABpAG8AbgAuAGgAdABtAGwAAGh0dHA6Ly93d3cuYXNjZW5kZXJjb3JwLmNvbS9saWJlcmF0aW9uLmh0bWwAAAAAAgAAAAAAAP3PAFQAAAABAAAAAAAAAAAAAAAAAAAAAAKeAAAAAQACAAMABAAFAAYABwAIAAkACgALAAwADQAOAA8AEAARABIAEwAUABUAFgAXABgAGQAaABsAHAAdAB4AHwAgACEAIgAjACQAJQAmACcAKAApACoAKwAsAC0ALgAvADAAMQAyADMANAA1ADYANwA4ADkAOgA7ADwAPQA+AD8AQABBAEIAQwBEAEUARgBHAEgASQBKAEsATABNAE4ATwBQAFEAUgBTAFQAVQBWAFcAWABZAFoAWwBcAF0AXgBfAGAAYQCjAIQAhQC9AJYA6ACGAI4AiwCdAKkApACKANoAgwCTAQIBAwCNAQQAiADDAN4BBQCeAKoA9QD0APYAogCtAMkAxwCuAGIAYwCQAGQAywBlAMgAygDPAMwAzQDOAOkAZgDTANAA0QCvAGcA8ACRANYA1ADVAGgA6wDtAIkAagBpAGsAbQBsAG4AoABvAHEAcAByAHMAdQB0AHYAdwDqAHgAegB5AHsAfQB8ALgAoQB/AH4AgACBAOwA7gC6AQYBBwEIAQkBCgELAP0A/gEMAQ0BDgEPAP8BAAEQAREBEgEBARMBFAEVARYBFwEYARkBGgEbARwBHQEeAPgA+QEfASABIQEiASMBJAElASYBJwEoASkBKgErASwBLQEuAPoA1wEvATABMQEyATMBNAE1ATYBNwE4ATkBOgE7ATwBPQDiAOMBPgE/AUABQQFCAUMBRAFFAUYBRwFIAUkBSgFLAUwAsACxAU0BTgFPAVABUQFSAVMBVAFVAVYA+wD8AOQA5QFXAVgBWQFaAVsBXAFdAV4BXwFgAWEBYgFjAWQBZQFmAWcBaAFpAWoBawFsALsBbQFuAW8BcADmAOcBcQCmAXIBcwF0AXUBdgF3AXgBeQF6AXsA2ADhAXwA2wDcAN0A4ADZAN8BfQF+AX8BgAGBAYIBgwGEAYUBhgGHAYgBiQGKAKgBiwGMAY0BjgGPAZABkQGSAZMBlAGVAZYBlwGYAZkBmgGbAZwBnQCfAZ4BnwGgAaEBogGjAaQBpQGmAacBqAGpAaoBqwGsAa0BrgGvAJcBsAGxAbIAmwGzAbQBtQG2AbcBuAG5AboBuwG8Ab0BvgG/AcABwQHCAcMBxAHFAcYBxwHIAckBygHLAcwBzQHOAc8B0AHRAdIB0wHUAdUB1gHXAdgB2QHaAdsB3AHdAd4B3wHgAeEB4gHjAeQB5QHmAecB6AHpAeoB6wHsAe0B7gHvAfAB8QHyAfMB9AH1AfYB9wH4AfkB+gH7AfwB/QH+Af8CAAIBAgICAwIEAgUCBgIHAggCCQIKAgsCDAINAg4CDwIQAhECEgITAhQCFQIWAhcCGAIZAhoCGwIcAh0CHgIfAiACIQIiAiMCJAIlAiYCJwIoAikAsgCzAioCKwC2ALcAxAIsALQAtQDFAIIAwgCHAKsAxgItAi4AvgC/Ai8CMAC8AjEA9wIyAjMCNAI1AjYCNwCMAjgCOQI6AjsCPAI9Aj4CPwJAAkECQgJDAkQAmAJFAJoAmQDvAkYApQCSAkcCSACcAKcAjwJJAJQAlQJKAksCTAJNAk4CTwJQAlECUgJTAlQCVQJWAlcCWAJZAloCWwJcAl0CXgJfAmACYQJiAmMCZAJlAmYCZwJoAmkCagJrAmwCbQJuAm8CcAJxAnICcwJ0AnUCdgJ3AngCeQJ6AnsCfAJ9An4CfwKAAoECggKDAoQChQKGALkChwKIAokCigKLAowCjQKOAo8CkAKRApICkwKUApUClgKXApgCmQKaApsCnAKdAp4CnwKgAqECogKjAqQHdW5pMDBCMgd1bmkwMEIzBXUwMEI1B3VuaTAwQjkHQW1hY3JvbgdhbWFjcm9uBkFicmV2ZQZhYnJldmUHQW9nb25lawdhb2dvbmVrC0NjaXJjdW1mbGV4C2NjaXJjdW1mbGV4CkNkb3RhY2NlbnQKY2RvdGFjY2VudAZEY2Fyb24GZGNhcm9uBkRjcm9hdAdFbWFjcm9uB2VtYWNyb24GRWJyZXZlBmVicmV2ZQpFZG90YWNjZW50CmVkb3RhY2NlbnQHRW9nb25lawdlb2dvbmVrBkVjYXJvbgZlY2Fyb24LR2NpcmN1bWZsZXgLZ2NpcmN1bWZsZXgKR2RvdGFjY2VudApnZG90YWNjZW50DEdjb21tYWFjY2VudAxnY29tbWFhY2NlbnQLSGNpcmN1bWZsZXgLaGNpcmN1bWZsZXgESGJhcgRoYmFyBkl0aWxkZQZpdGlsZGUHSW1hY3JvbgdpbWFjcm9uBklicmV2ZQZpYnJldmUHSW9nb25lawdpb2dvbmVrAklKAmlqC0pjaXJjdW1mbGV4C2pjaXJjdW1mbGV4DEtjb21tYWFjY2VudAxrY29tbWFhY2NlbnQMa2dyZWVubGFuZGljBkxhY3V0ZQZsYWN1dGUMTGNvbW1hYWNjZW50DGxjb21tYWFjY2VudAZMY2Fyb24GbGNhcm9uBExkb3QEbGRvdAZOYWN1dGUGbmFjdXRlDE5jb21tYWFjY2VudAxuY29tbWFhY2NlbnQGTmNhcm9uBm5jYXJvbgtuYXBvc3Ryb3BoZQNFbmcDZW5nB09tYWNyb24Hb21hY3JvbgZPYnJldmUGb2JyZXZlDU9odW5nYXJ1bWxhdXQNb2h1bmdhcnVtbGF1dAZSYWN1dGUGcmFjdXRlDFJjb21tYWFjY2VudAxyY29tbWFhY2NlbnQGUmNhcm9uBnJjYXJvbgZTYWN1dGUGc2FjdXRlC1NjaXJjdW1mbGV4C3NjaXJjdW1mbGV4DFRjb21tYWFjY2VudAx0Y29tbWFhY2NlbnQGVGNhcm9uBnRjYXJvbgRUYmFyBHRiYXIGVXRpbGRlBnV0aWxkZQdVbWFjcm9uB3VtYWNyb24GVWJyZXZlBnVicmV2ZQVVcmluZwV1cmluZw1VaHVuZ2FydW1sYXV0DXVodW5nYXJ1bWxhdXQHVW9nb25lawd1b2dvbmVrC1djaXJjdW1mbGV4C3djaXJjdW1mbGV4C1ljaXJjdW1mbGV4C3ljaXJjdW1mbGV4BlphY3V0ZQZ6YWN1dGUKWmRvdGFjY2VudAp6ZG90YWNjZW50BWxvbmdzCkFyaW5nYWN1dGUKYXJpbmdhY3V0ZQdBRWFjdXRlB2FlYWN1dGULT3NsYXNoYWN1dGULb3NsYXNoYWN1dGUMU2NvbW1hYWNjZW50DHNjb21tYWFjY2VudAd1bmkwMjFBB3VuaTAyMUIHdW5pMDJDOQV0b25vcw1kaWVyZXNpc3Rvbm9zCkFscGhhdG9ub3MJYW5vdGVsZWlhDEVwc2lsb250b25vcwhFdGF0b25vcwlJb3RhdG9ub3MMT21pY3JvbnRvbm9zDFVwc2lsb250b25vcwpPbWVnYXRvbm9zEWlvdGFkaWVyZXNpc3Rvbm9zBUFscGhhBEJldGEFR2FtbWEHRXBzaWxvbgRaZXRhA0V0YQVUaGV0YQRJb3RhBUthcHBhBkxhbWJkYQJNdQJOdQJYaQdPbWljcm9uAlBpA1JobwVTaWdtYQNUYXUHVXBzaWxvbgNQaGkDQ2hpA1BzaQxJb3RhZGllcmVzaXMPVXBzaWxvbmRpZXJlc2lzCmFscGhhdG9ub3MMZXBzaWxvbnRvbm9zCGV0YXRvbm9zCWlvdGF0b25vcxR1cHNpbG9uZGllcmVzaXN0b25vcwVhbHBoYQRiZXRhBWdhbW1hBWRlbHRhB2Vwc2lsb24EemV0YQNldGEFdGhldGEEaW90YQVrYXBwYQZsYW1iZGECbnUCeGkHb21pY3JvbgNyaG8Gc2lnbWExBXNpZ21hA3RhdQd1cHNpbG9uA3BoaQNjaGkDcHNpBW9tZWdhDGlvdGFkaWVyZXNpcw91cHNpbG9uZGllcmVzaXMMb21pY3JvbnRvbm9zDHVwc2lsb250b25vcwpvbWVnYXRvbm9zCWFmaWkxMDAyMwlhZmlpMTAwNTEJYWZpaTEwMDUyCWFmaWkxMDA1MwlhZmlpMTAwNTQJYWZpaTEwMDU1CWFmaWkxMDA1NglhZmlpMTAwNTcJYWZpaTEwMDU4CWFmaWkxMDA1OQlhZmlpMTAwNjAJYWZpaTEwMDYxCWFmaWkxMDA2MglhZmlpMTAxNDUJYWZpaTEwMDE3CWFmaWkxMDAxOAlhZmlpMTAwMTkJYWZpaTEwMDIwCWFmaWkxMDAyMQlhZmlpMTAwMjIJYWZpaTEwMDI0CWFmaWkxMDAyNQlhZmlpMTAwMjYJYWZpaTEwMDI3CWFmaWkxMDAyOAlhZmlpMTAwMjkJYWZpaTEwMDMwCWFmaWkxMDAzMQlhZmlpMTAwMzIJYWZpaTEwMDMzCWFmaWkxMDAzNAlhZmlpMTAwMzUJYWZpaTEwMDM2CWFmaWkxMDAzNwlhZmlpMTAwMzgJYWZpaTEwMDM5CWFmaWkxMDA0MAlhZmlpMTAwNDEJYWZpaTEwMDQyCWFmaWkxMDA0MwlhZmlpMTAwNDQJYWZpaTEwMDQ1CWFmaWkxMDA0NglhZmlpMTAwNDcJYWZpaTEwMDQ4CWFmaWkxMDA0OQlhZmlpMTAwNjUJYWZpaTEwMDY2CWFmaWkxMDA2NwlhZmlpMTAwNjgJYWZpaTEwMDY5CWFmaWkxMDA3MAlhZmlpMTAwNzIJYWZpaTEwMDczCWFmaWkxMDA3NAlhZmlpMTAwNzUJYWZpaTEwMDc2CWFmaWkxMDA3NwlhZmlpMTAwNzgJYWZpaTEwMDc5CWFmaWkxMDA4MAlhZmlpMTAwODEJYWZpaTEwMDgyCWFmaWkxMDA4MwlhZmlpMTAwODQJYWZpaTEwMDg1CWFmaWkxMDA4NglhZmlpMTAwODcJYWZpaTEwMDg4CWFmaWkxMDA4OQlhZmlpMTAwOTAJYWZpaTEwMDkxCWFmaWkxMDA5MglhZmlpMTAwOTMJYWZpaTEwMDk0CWFmaWkxMDA5NQlhZmlpMTAwOTYJYWZpaTEwMDk3CWFmaWkxMDA3MQlhZmlpMTAwOTkJYWZpaTEwMTAwCWFmaWkxMDEwMQlhZmlpMTAxMDIJYWZpaTEwMTAzCWFmaWkxMDEwNAlhZmlpMTAxMDUJYWZpaTEwMTA2CWFmaWkxMDEwNwlhZmlpMTAxMDgJYWZpaTEwMTA5CWFmaWkxMDExMAlhZmlpMTAxOTMJYWZpaTEwMDUwCWFmaWkxMDA5OAZXZ3JhdmUGd2dyYXZlBldhY3V0ZQZ3YWN1dGUJV2RpZXJlc2lzCXdkaWVyZXNpcwZZZ3JhdmUGeWdyYXZlB3VuaTIwMTAHdW5pMjAxMQpmaWd1cmVkYXNoCWFmaWkwMDIwOA11bmRlcnNjb3JlZGJsDXF1b3RlcmV2ZXJzZWQGbWludXRlBnNlY29uZAlleGNsYW1kYmwHdW5pMjAzRQd1bmkyMDdGBGxpcmEGcGVzZXRhBEV1cm8JYWZpaTYxMjQ4CWFmaWk2MTI4OQlhZmlpNjEzNTIFdTIxMjYJZXN0aW1hdGVkCW9uZWVpZ2h0aAx0aHJlZWVpZ2h0aHMLZml2ZWVpZ2h0aHMMc2V2ZW5laWdodGhzCWFycm93bGVmdAdhcnJvd3VwCmFycm93cmlnaHQJYXJyb3dkb3duCWFycm93Ym90aAlhcnJvd3VwZG4MYXJyb3d1cGRuYnNlBXUyMjA2B3VuaTIyMTkKb3J0aG9nb25hbAxpbnRlcnNlY3Rpb24LZXF1aXZhbGVuY2UFaG91c2UNcmV2bG9naWNhbG5vdAppbnRlZ3JhbHRwCmludGVncmFsYnQIU0YxMDAwMDAIU0YxMTAwMDAIU0YwMTAwMDAIU0YwMzAwMDAIU0YwMjAwMDAIU0YwNDAwMDAIU0YwODAwMDAIU0YwOTAwMDAIU0YwNjAwMDAIU0YwNzAwMDAIU0YwNTAwMDAIU0Y0MzAwMDAIU0YyNDAwMDAIU0Y1MTAwMDAIU0Y1MjAwMDAIU0YzOTAwMDAIU0YyMjAwMDAIU0YyMTAwMDAIU0YyNTAwMDAIU0Y1MDAwMDAIU0Y0OTAwMDAIU0YzODAwMDAIU0YyODAwMDAIU0YyNzAwMDAIU0YyNjAwMDAIU0YzNjAwMDAIU0YzNzAwMDAIU0Y0MjAwMDAIU0YxOTAwMDAIU0YyMDAwMDAIU0YyMzAwMDAIU0Y0NzAwMDAIU0Y0ODAwMDAIU0Y0MTAwMDAIU0Y0NTAwMDAIU0Y0NjAwMDAIU0Y0MDAwMDAIU0Y1NDAwMDAIU0Y1MzAwMDAIU0Y0NDAwMDAHdXBibG9jawdkbmJsb2NrBWJsb2NrB2xmYmxvY2sHcnRibG9jawdsdHNoYWRlBXNoYWRlB2Rrc2hhZGUJZmlsbGVkYm94BkgyMjA3MwZIMTg1NDMGSDE4NTUxCmZpbGxlZHJlY3QHdHJpYWd1cAd0cmlhZ3J0B3RyaWFnZG4HdHJpYWdsZgZjaXJjbGUGSDE4NTMzCWludmJ1bGxldAlpbnZjaXJjbGUKb3BlbmJ1bGxldAlzbWlsZWZhY2UMaW52c21pbGVmYWNlA3N1bgZmZW1hbGUEbWFsZQVzcGFkZQRjbHViBWhlYXJ0B2RpYW1vbmQLbXVzaWNhbG5vdGUObXVzaWNhbG5vdGVkYmwHdW5pRkIwMQd1bmlGQjAyEHVuZGVyY29tbWFhY2NlbnQNY3lyaWxsaWNicmV2ZRBjYXJvbmNvbW1hYWNjZW50EWNvbW1hYWNjZW50cm90YXRlCGRvdGxlc3NqC29uZWZyYWN0aW9uC3R3b2ZyYWN0aW9uDXRocmVlZnJhY2l0b24MZm91cmZyYWN0aW9uDGZpdmVmcmFjdGlvbg1zZXZlbmZyYWN0aW9uDWVpZ2h0ZnJhY3Rpb24AAAAAAAADAAgAAgARAAH//wADAAEAAAAMAAAAFgAAAAIAAQABAp0AAQAEAAAAAgAAAAAAAAABAAAAAMTblNcAAAAAvXaJJAAAAADFY7E0"
 #define DEFAULT_FONT_BLOCKSIZE 144224
+#ifdef USE_RETINA
+#define DEFAULT_FONT_HEIGHT 28
+#define DEFAULT_FONT_ATLAS_WIDTH 256
+#define DEFAULT_FONT_ATLAS_HEIGHT 128
+static const unsigned char DEFAULT_FONT_ATLAS[] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,52,69,41,0,146,232,232,4,0,49,232,232,101,0,0,0,0,0,0,37,58,0,0,0,0,58,37,0,0,0,
+  0,0,0,0,0,0,55,208,58,0,0,0,0,0,0,0,6,72,99,70,4,0,0,0,0,0,1,79,69,0,0,0,
+  0,0,0,0,20,63,87,56,4,0,0,0,0,0,0,212,232,170,0,0,0,0,7,195,232,99,0,144,232,162,0,0,
+  0,0,0,0,0,0,0,84,229,54,0,0,0,0,0,0,0,0,0,33,68,20,0,0,0,0,0,0,0,0,142,155,
+  155,34,0,131,135,135,135,135,135,107,0,2,155,155,128,0,0,0,0,0,0,0,0,0,0,11,213,231,44,0,0,0,
+  0,1,55,97,126,91,43,0,0,0,0,0,0,0,0,0,0,0,53,72,27,0,0,0,0,0,0,0,0,3,61,102,
+  127,100,61,1,0,0,0,0,0,0,0,2,64,105,127,98,61,3,0,0,0,0,0,0,0,0,0,0,0,14,72,72,
+  22,0,0,0,0,29,72,72,72,72,72,72,72,72,72,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,189,255,149,0,144,255,243,0,0,38,255,255,95,0,0,0,0,0,0,167,172,0,0,0,2,239,98,0,0,0,
+  0,0,0,0,0,20,104,255,106,16,0,0,0,0,0,24,215,254,235,254,207,14,0,0,0,0,103,255,94,0,0,0,
+  0,0,0,128,247,255,255,255,218,52,0,0,0,0,0,217,255,171,0,0,0,0,142,255,188,2,0,15,224,255,98,0,
+  0,0,0,0,0,0,0,84,255,49,0,0,0,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,30,255,255,
+  213,2,0,247,255,255,255,255,255,201,0,4,255,255,210,0,0,0,0,0,0,0,0,0,0,124,255,170,0,0,0,0,
+  25,185,255,255,255,255,255,150,9,0,0,0,0,0,0,0,0,71,252,255,96,0,0,0,0,0,0,0,56,207,255,255,
+  255,255,255,207,58,0,0,0,0,0,65,212,255,255,255,255,255,211,64,0,0,0,0,0,0,0,0,0,0,166,255,255,
+  79,0,0,0,0,113,255,255,255,255,255,255,255,255,255,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,183,255,143,0,128,255,226,0,0,22,255,255,78,0,0,0,0,0,0,223,117,0,0,0,41,255,43,0,0,0,
+  0,0,5,115,224,255,255,255,255,255,216,93,0,0,0,156,255,73,0,88,255,135,0,0,0,36,243,173,0,0,0,0,
+  0,0,97,255,199,62,32,104,251,227,3,0,0,0,0,201,255,154,0,0,0,70,254,237,27,0,0,0,60,252,243,36,
+  0,0,0,0,76,56,0,74,255,38,2,70,53,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,95,255,255,
+  95,0,0,99,102,102,102,102,102,81,0,4,255,255,210,0,0,0,0,0,0,0,0,0,22,241,250,37,0,0,0,9,
+  227,255,207,107,71,113,227,255,185,0,0,0,0,0,0,20,133,251,254,255,96,0,0,0,0,0,0,34,239,255,202,99,
+  73,107,213,255,236,32,0,0,0,52,244,255,215,135,85,152,228,255,241,32,0,0,0,0,0,0,0,0,93,255,255,255,
+  79,0,0,0,0,130,255,200,120,120,120,120,120,120,120,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,176,255,136,0,112,255,210,0,0,6,255,255,62,0,0,0,0,0,23,255,62,0,0,0,96,241,2,0,0,0,
+  0,1,162,255,238,142,142,255,151,167,253,255,114,0,0,216,225,0,0,2,241,196,0,0,3,197,231,20,0,0,0,0,
+  0,0,187,255,28,0,0,0,172,255,43,0,0,0,0,184,255,137,0,0,2,212,255,116,0,0,0,0,0,164,255,168,
+  0,0,0,0,213,255,209,154,255,146,224,255,167,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,160,255,225,
+  5,0,0,0,0,0,0,0,0,0,0,4,255,255,210,0,0,0,0,0,0,0,0,0,147,255,148,0,0,0,0,111,
+  255,201,13,0,0,0,31,231,255,59,0,0,29,153,190,250,255,170,208,255,96,0,0,0,0,0,0,170,255,195,4,0,
+  0,0,12,217,255,138,0,0,0,185,255,202,0,0,0,0,18,246,255,142,0,0,0,0,0,0,0,34,241,205,226,255,
+  79,0,0,0,0,146,255,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,170,255,130,0,95,255,193,0,0,0,245,255,45,0,0,0,0,0,79,251,11,0,0,0,151,188,0,0,0,0,
+  0,43,255,239,30,0,68,255,71,0,84,254,250,22,0,246,203,0,0,0,222,227,0,0,120,255,76,0,0,0,0,0,
+  0,0,212,247,1,0,0,0,196,253,20,0,0,0,0,168,255,120,0,0,87,255,234,11,0,0,0,0,0,40,252,253,
+  43,0,0,0,37,103,170,241,255,229,157,91,25,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,225,255,111,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,250,242,22,0,0,0,5,228,
+  255,87,0,0,0,0,0,138,255,181,0,0,55,255,252,192,84,1,206,255,96,0,0,0,0,0,3,233,255,80,0,0,
+  0,0,0,133,255,188,0,0,11,236,255,76,0,0,0,0,0,161,255,188,0,0,0,0,0,0,4,198,244,39,220,255,
+  79,0,0,0,0,162,255,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,163,255,124,0,79,255,176,0,0,0,229,255,28,0,0,67,91,91,171,230,91,91,91,91,217,183,91,91,3,0,
+  0,96,255,178,0,0,68,255,71,0,0,193,209,68,0,225,216,0,0,0,237,205,0,47,249,155,0,0,0,0,0,0,
+  0,0,181,255,32,0,6,134,255,168,0,0,0,0,0,152,255,104,0,0,206,255,123,0,0,0,0,0,0,0,169,255,
+  161,0,0,0,0,0,37,241,238,212,10,0,0,0,15,26,26,26,26,136,255,92,26,26,26,26,10,0,35,255,235,11,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,255,126,0,0,0,0,35,255,
+  247,10,0,0,0,0,0,53,255,238,0,0,14,49,16,0,0,0,206,255,96,0,0,0,0,0,0,0,17,5,0,0,
+  0,0,0,141,255,171,0,0,0,0,6,1,0,0,0,0,0,150,255,168,0,0,0,0,0,0,129,255,98,0,220,255,
+  79,0,0,0,0,179,255,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,157,255,117,0,63,255,159,0,0,0,213,255,11,0,0,177,241,241,253,249,241,241,241,243,255,244,241,241,9,0,
+  0,81,255,212,1,0,68,255,71,0,0,1,0,0,0,180,252,35,0,52,255,158,7,210,221,13,0,0,0,0,0,0,
+  0,0,111,255,130,103,220,255,166,7,0,0,0,0,0,135,255,87,0,28,255,255,43,0,0,0,0,0,0,0,89,255,
+  234,2,0,0,0,9,208,221,43,247,156,0,0,0,153,255,255,255,255,255,255,255,255,255,255,255,104,0,100,255,126,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,254,231,12,0,0,0,0,63,255,
+  222,0,0,0,0,0,0,19,255,255,12,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,3,219,255,109,0,0,0,0,0,0,0,0,0,0,39,234,255,73,0,0,0,0,0,59,252,169,0,0,220,255,
+  79,0,0,0,0,195,255,85,20,73,111,93,50,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,150,255,111,0,38,204,116,0,0,0,160,201,0,0,0,0,0,1,239,107,0,0,0,59,255,27,0,0,0,0,
+  0,16,238,255,151,20,68,255,71,0,0,0,0,0,0,53,250,229,170,234,245,35,137,252,60,0,0,0,0,0,0,0,
+  0,0,42,254,255,255,194,67,0,0,0,0,0,0,0,97,204,58,0,98,255,228,0,0,0,0,0,0,0,0,21,253,
+  255,50,0,0,0,153,255,75,0,133,255,88,0,0,101,169,169,169,169,210,255,194,169,169,169,169,69,0,166,243,18,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,194,255,104,0,0,0,0,0,91,255,
+  203,0,2,179,179,148,0,2,252,255,41,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,141,255,224,17,0,0,0,0,0,0,22,60,79,139,238,253,124,0,0,0,0,0,15,223,224,16,0,0,220,255,
+  79,0,0,0,0,212,255,182,244,255,255,255,255,206,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,144,255,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,255,51,0,0,0,113,228,0,0,0,0,0,
+  0,0,70,242,255,250,215,255,146,45,0,0,0,0,0,0,46,152,180,148,36,61,252,136,0,0,1,0,0,0,0,0,
+  0,87,239,255,255,148,0,0,0,0,190,123,0,0,0,0,0,0,0,158,255,165,0,0,0,0,0,0,0,0,0,210,
+  255,109,0,0,0,40,124,0,0,12,141,20,0,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,80,68,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,255,216,4,0,0,0,0,0,118,255,
+  184,0,4,255,255,210,0,0,236,255,69,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,0,0,0,0,
+  0,117,255,250,59,0,0,0,0,0,0,0,96,255,255,255,198,49,0,0,0,0,0,0,164,252,60,0,0,0,220,255,
+  79,0,0,0,0,228,255,253,170,96,84,125,227,255,247,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,137,255,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,246,5,0,0,0,167,175,0,0,0,0,0,
+  0,0,0,25,135,220,255,255,255,255,217,106,5,0,0,0,0,0,0,0,13,221,209,13,131,229,251,218,94,0,0,0,
+  84,252,243,91,236,243,29,0,0,38,255,176,0,0,0,0,0,0,0,181,255,139,0,0,0,0,0,0,0,0,0,184,
+  255,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,214,255,82,0,0,0,0,0,0,110,255,
+  189,0,4,255,255,210,0,0,243,255,60,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,0,0,0,3,
+  147,255,245,75,0,0,0,0,0,0,0,0,62,166,182,226,255,242,120,3,0,0,0,91,255,127,0,0,0,0,220,255,
+  79,0,0,0,0,122,129,63,0,0,0,0,13,203,255,198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,131,255,91,0,0,0,0,0,0,0,0,0,0,0,20,58,58,167,214,58,58,58,58,224,156,58,58,32,0,0,
+  0,0,0,0,0,0,85,255,170,203,255,255,184,7,0,0,0,0,0,0,154,248,46,122,255,152,83,188,254,61,0,11,
+  231,255,59,0,95,255,184,1,0,99,255,106,0,0,0,0,0,0,0,201,255,120,0,0,0,0,0,0,0,0,0,164,
+  255,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,255,198,1,0,0,0,0,0,0,81,255,
+  209,0,1,77,77,63,0,9,255,255,30,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,0,0,13,180,
+  255,234,59,0,0,0,0,0,0,0,0,0,0,0,0,1,70,232,255,136,0,0,33,240,195,3,0,0,0,0,220,255,
+  79,0,0,0,0,0,0,0,0,0,0,0,0,63,255,254,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,125,255,85,0,0,0,0,0,0,0,0,0,0,0,89,255,255,255,255,255,255,255,255,255,255,255,255,141,0,0,
+  0,0,0,0,0,0,68,255,71,0,60,235,255,114,0,0,0,0,0,75,255,118,0,223,226,2,0,33,255,160,0,75,
+  255,217,0,0,1,187,255,115,0,189,254,34,0,0,0,0,0,0,0,217,255,103,0,0,0,0,0,0,0,0,0,146,
+  255,169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,255,74,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,230,255,60,0,0,0,0,0,0,0,52,255,
+  229,0,0,0,0,0,0,31,255,251,3,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,0,25,209,255,
+  206,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,255,251,16,0,174,255,173,144,144,144,144,144,240,255,
+  178,144,83,0,0,0,0,0,0,0,0,0,0,12,255,255,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,25,53,17,0,0,0,0,0,0,0,0,0,0,0,7,19,27,251,92,19,19,19,93,253,31,19,19,11,0,0,
+  0,0,0,0,0,0,68,255,71,0,0,104,255,191,0,0,0,0,20,231,195,3,6,252,187,0,0,0,248,196,0,111,
+  255,156,0,0,0,24,228,251,107,254,185,0,0,0,0,0,0,0,0,204,255,116,0,0,0,0,0,0,0,0,0,159,
+  255,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,211,61,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,255,176,0,0,0,0,0,0,0,0,22,255,
+  254,32,0,0,0,0,0,89,255,222,0,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,0,25,215,255,181,
+  10,0,0,0,0,0,0,0,41,116,120,0,0,0,0,0,0,22,255,255,55,0,193,255,255,255,255,255,255,255,255,255,
+  255,255,147,0,0,0,4,0,0,0,0,0,0,33,255,255,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,255,29,0,0,0,131,212,0,0,0,0,0,0,
+  10,181,231,13,0,0,68,255,71,0,0,66,255,212,0,0,0,0,171,242,34,0,7,253,186,0,0,1,248,198,0,89,
+  255,177,0,0,0,0,55,248,255,255,72,0,0,0,0,0,0,0,0,184,255,135,0,0,0,0,0,0,0,0,0,180,
+  255,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,242,251,41,0,0,0,0,0,0,0,0,0,185,
+  255,121,0,0,0,0,0,181,255,128,0,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,11,213,255,168,5,
+  0,0,0,0,0,0,0,0,57,255,254,32,0,0,0,0,0,110,255,255,20,0,29,38,38,38,38,38,38,38,225,255,
+  105,38,22,0,67,233,236,9,0,0,0,0,0,106,255,239,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,85,109,60,0,0,0,0,0,0,0,0,0,0,0,0,0,107,231,0,0,0,0,185,157,0,0,0,0,0,0,
+  0,144,255,127,0,0,68,255,71,0,0,133,255,168,0,0,0,92,255,100,0,0,0,225,224,1,0,33,255,162,0,35,
+  251,250,49,0,0,0,5,189,255,255,96,0,0,0,0,0,0,0,0,164,255,157,0,0,0,0,0,0,0,0,0,202,
+  255,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,255,154,0,0,0,0,0,0,0,0,0,0,63,
+  255,239,58,0,0,0,104,253,241,17,0,0,0,0,0,0,0,0,206,255,96,0,0,0,0,0,0,142,255,215,11,0,
+  0,0,0,0,0,0,0,0,4,215,255,195,21,0,0,0,38,218,255,208,0,0,0,0,0,0,0,0,0,0,220,255,
+  79,0,0,0,10,239,255,160,7,0,0,0,60,239,255,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,200,255,142,0,0,0,0,0,0,0,0,0,0,0,0,0,160,179,0,0,0,1,238,102,0,0,0,0,0,0,
+  0,15,232,252,143,34,69,255,71,24,127,252,251,62,0,0,29,239,179,0,0,0,0,132,255,140,68,182,255,67,0,0,
+  138,255,244,141,98,119,214,255,209,251,254,189,150,54,0,0,0,0,0,111,255,213,0,0,0,0,0,0,0,0,11,248,
+  255,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,250,245,26,0,0,0,0,0,0,0,0,0,0,0,
+  158,255,246,185,150,198,254,250,99,0,0,0,20,191,191,191,191,191,243,255,215,191,191,191,122,0,41,252,255,221,194,194,
+  194,194,194,194,194,194,16,0,0,50,245,255,240,178,156,218,255,255,245,44,0,0,0,0,0,0,0,0,0,0,220,255,
+  79,0,0,0,0,74,252,255,225,163,148,190,253,255,193,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,200,255,142,0,0,0,0,0,0,0,0,0,0,0,0,0,212,126,0,0,0,37,255,47,0,0,0,0,0,0,
+  0,0,79,235,255,255,249,255,244,255,255,235,95,0,0,1,187,235,24,0,0,0,0,10,157,252,255,242,111,0,0,0,
+  2,103,230,255,255,255,228,118,5,69,212,255,255,71,0,0,0,0,0,41,255,255,28,0,0,0,0,0,0,0,73,255,
+  243,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,255,132,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,102,229,255,255,253,211,58,0,0,0,0,27,255,255,255,255,255,255,255,255,255,255,255,163,0,67,255,255,255,255,255,
+  255,255,255,255,255,255,21,0,0,0,30,166,242,255,255,255,247,163,36,0,0,0,0,0,0,0,0,0,0,0,220,255,
+  79,0,0,0,0,0,55,185,252,255,255,253,221,105,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,12,102,147,200,255,200,144,100,14,0,0,0,0,0,0,0,0,0,0,0,0,0,6,27,2,0,0,0,0,
+  0,0,0,20,53,35,1,0,0,0,0,23,22,0,0,0,0,0,0,0,224,255,102,0,0,0,0,0,0,0,148,255,
+  178,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,254,234,14,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,21,49,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,1,25,53,28,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,6,37,48,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,68,255,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,255,215,2,0,0,0,0,0,21,243,255,
+  67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,62,39,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,48,179,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,231,255,87,0,0,0,0,0,135,255,195,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,255,216,9,0,0,0,31,243,253,61,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,181,255,149,0,0,3,195,255,138,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,231,254,78,0,126,255,204,6,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,33,23,0,30,33,14,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,6,55,113,119,82,7,0,0,0,0,7,72,72,72,72,72,72,72,72,72,72,65,0,0,0,0,6,
+  64,103,126,94,54,1,0,0,0,0,0,0,0,5,58,100,123,78,26,0,0,0,0,0,0,15,15,12,0,0,0,15,
+  15,12,0,0,0,0,0,0,0,0,0,0,0,0,0,17,34,0,18,30,30,30,30,30,30,30,30,30,30,30,12,0,
+  44,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,70,110,125,95,54,0,0,0,0,0,0,0,0,1,
+  50,120,190,206,140,73,1,0,0,0,0,0,0,0,0,0,0,64,72,59,0,0,0,0,0,0,0,3,72,72,72,72,
+  72,58,35,9,0,0,0,0,0,0,0,0,0,22,71,119,109,69,7,0,0,0,0,3,72,72,72,70,43,9,0,0,
+  0,0,0,0,0,3,72,72,72,72,72,72,72,72,72,72,72,3,0,47,72,72,72,72,72,72,72,72,72,72,7,0,
+  0,0,0,0,27,76,122,108,69,5,0,0,0,0,3,72,72,19,0,0,0,0,0,32,72,62,0,0,0,0,0,0,
+  0,0,0,0,61,236,255,255,255,255,232,60,0,0,0,24,255,255,255,255,255,255,255,255,255,255,230,0,0,0,78,220,
+  255,255,255,255,255,198,50,0,0,0,0,0,56,210,255,255,255,255,254,127,1,0,0,0,4,255,255,210,0,0,4,255,
+  255,210,0,0,0,0,0,0,0,0,0,0,0,48,155,245,104,0,153,255,255,255,255,255,255,255,255,255,255,255,104,0,
+  153,234,135,31,0,0,0,0,0,0,0,0,0,0,0,5,118,240,255,255,255,255,255,202,61,0,0,0,0,0,2,158,
+  255,243,172,155,226,255,145,1,0,0,0,0,0,0,0,0,37,254,255,250,21,0,0,0,0,0,0,11,255,255,255,255,
+  255,255,255,247,167,48,0,0,0,0,0,8,158,255,255,255,255,255,221,75,0,0,0,11,255,255,255,255,255,254,227,144,
+  16,0,0,0,0,11,255,255,255,255,255,255,255,255,255,255,255,12,0,168,255,255,255,255,255,255,255,255,255,255,24,0,
+  0,0,12,172,255,255,255,255,255,218,69,0,0,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,0,79,247,254,156,84,104,193,255,244,30,0,0,11,120,120,120,120,120,120,120,120,170,255,200,0,0,61,251,251,
+  138,54,31,65,175,255,233,26,0,0,0,42,249,255,196,98,76,137,248,255,150,0,0,0,4,255,255,210,0,0,4,255,
+  255,210,0,0,0,0,0,0,0,0,6,89,196,255,255,212,56,0,102,171,171,171,171,171,171,171,171,171,171,171,70,0,
+  88,229,255,252,175,68,1,0,0,0,0,0,0,0,0,144,255,253,162,97,81,116,215,255,241,44,0,0,0,1,151,254,
+  104,8,0,0,0,117,255,145,0,0,0,0,0,0,0,0,132,255,232,255,111,0,0,0,0,0,0,11,255,255,173,144,
+  144,173,225,255,255,240,50,0,0,0,15,203,255,247,165,110,121,208,255,250,70,0,0,11,255,255,180,155,182,218,252,255,
+  234,86,0,0,0,11,255,255,180,153,153,153,153,153,153,153,153,7,0,168,255,219,153,153,153,153,153,153,153,153,15,0,
+  0,20,210,255,244,163,108,152,234,255,247,60,0,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,4,226,255,105,0,0,0,9,214,255,139,0,0,0,0,0,0,0,0,0,0,9,216,252,53,0,0,191,255,141,
+  0,0,0,0,2,203,255,137,0,0,0,193,255,180,4,0,0,0,67,253,251,31,0,0,4,255,255,210,0,0,4,255,
+  255,210,0,0,0,0,0,0,27,130,231,255,252,176,67,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,5,88,197,255,255,215,109,14,0,0,0,0,0,65,255,253,78,0,0,0,0,6,195,255,165,0,0,0,120,255,120,
+  0,0,0,0,0,0,138,254,36,0,0,0,0,0,0,2,226,254,87,255,206,0,0,0,0,0,0,11,255,255,66,0,
+  0,0,0,45,251,255,165,0,0,0,118,255,246,71,0,0,0,5,164,255,231,10,0,11,255,255,66,0,0,0,45,197,
+  255,245,31,0,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  0,127,255,242,61,0,0,0,4,199,255,215,2,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,87,255,200,0,0,0,0,0,30,40,3,0,0,0,0,0,0,0,0,0,0,139,255,142,0,0,0,240,255,71,
+  0,0,0,0,0,135,255,185,0,0,14,254,255,46,0,0,0,0,0,174,255,139,0,0,2,140,140,115,0,0,2,140,
+  140,115,0,0,0,0,63,170,250,255,237,138,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,50,159,247,255,243,150,43,0,0,0,152,255,170,0,0,0,0,0,0,91,255,220,0,0,4,230,172,0,
+  0,7,55,33,0,3,21,246,139,0,0,0,0,0,0,70,255,199,1,224,255,46,0,0,0,0,0,11,255,255,66,0,
+  0,0,0,0,161,255,218,0,0,6,228,255,143,0,0,0,0,0,9,231,222,53,0,11,255,255,66,0,0,0,0,3,
+  212,255,175,0,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  8,232,255,131,0,0,0,0,0,45,245,185,28,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,187,255,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,252,224,11,0,0,0,219,255,86,
+  0,0,0,0,0,146,255,163,0,0,55,255,248,3,0,0,0,0,0,101,255,206,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,75,211,255,255,209,101,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,21,122,226,255,254,191,47,0,91,128,61,0,0,0,0,0,0,88,255,219,0,0,80,255,65,0,
+  63,231,253,252,93,171,188,162,235,0,0,0,0,0,0,166,255,114,0,137,255,140,0,0,0,0,0,11,255,255,66,0,
+  0,0,0,0,129,255,199,0,0,69,255,255,51,0,0,0,0,0,0,32,2,0,0,11,255,255,66,0,0,0,0,0,
+  77,255,255,29,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  72,255,255,44,0,0,0,0,0,0,9,0,0,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,224,255,48,9,65,125,143,98,28,0,0,0,0,0,0,0,0,0,0,0,197,255,95,0,0,0,0,123,255,198,
+  10,0,0,0,25,234,255,67,0,0,56,255,247,2,0,0,0,0,0,74,255,232,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,153,255,179,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,4,84,203,255,104,0,0,0,0,0,0,0,0,0,0,180,255,160,0,0,181,228,2,34,
+  241,171,16,93,225,227,138,97,255,19,0,0,0,0,16,247,253,27,0,48,255,231,4,0,0,0,0,11,255,255,66,0,
+  0,0,0,21,225,255,105,0,0,99,255,249,1,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,
+  5,252,255,66,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  101,255,245,0,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,2,250,255,44,210,255,255,255,255,242,102,0,0,0,0,0,0,0,0,0,75,255,219,4,0,0,0,0,6,166,255,
+  218,140,114,150,234,252,120,0,0,0,17,255,255,42,0,0,0,0,0,116,255,253,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,153,255,233,132,27,0,0,0,0,0,0,0,0,0,144,239,239,239,239,239,239,239,239,239,239,239,98,0,
+  0,0,0,0,0,0,0,0,44,152,244,255,104,0,0,0,0,0,0,0,0,1,136,255,238,34,0,4,251,141,0,169,
+  233,13,0,0,223,255,89,68,255,49,0,0,0,0,104,255,188,0,0,0,215,255,75,0,0,0,0,11,255,255,144,106,
+  106,120,154,240,254,144,3,0,0,127,255,228,0,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,
+  0,226,255,103,0,11,255,255,124,78,78,78,78,78,78,78,25,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  128,255,226,0,0,0,0,0,0,0,0,0,0,0,11,255,255,151,115,115,115,115,115,176,255,221,0,0,0,0,0,0,
+  0,24,255,255,212,190,67,23,55,158,255,255,68,0,0,0,0,0,0,0,1,206,255,95,0,0,0,0,0,0,13,147,
+  255,255,255,255,247,110,6,0,0,0,0,202,255,169,1,0,0,0,21,224,255,255,23,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,36,145,240,255,250,168,59,0,0,0,0,0,0,0,130,216,216,216,216,216,216,216,216,216,216,216,88,0,
+  0,0,0,0,0,3,80,189,254,255,227,125,20,0,0,0,0,0,0,0,17,180,255,229,52,0,0,28,255,96,23,251,
+  139,0,0,0,174,255,39,40,255,78,0,0,0,0,201,255,97,0,0,0,127,255,169,0,0,0,0,11,255,255,255,255,
+  255,255,255,247,128,28,0,0,0,153,255,208,0,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,
+  0,197,255,137,0,11,255,255,255,255,255,255,255,255,255,255,82,0,0,168,255,204,111,111,111,111,111,111,111,90,0,0,
+  153,255,208,0,0,0,64,130,130,130,130,130,37,0,11,255,255,255,255,255,255,255,255,255,255,221,0,0,0,0,0,0,
+  0,37,255,255,192,4,0,0,0,0,156,255,210,0,0,0,0,0,0,0,77,255,225,4,0,0,0,0,0,45,222,255,
+  168,94,69,103,192,255,204,27,0,0,0,58,254,255,179,80,53,106,224,203,255,252,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,12,104,210,255,255,205,96,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,18,117,223,255,254,190,84,4,0,0,0,0,0,0,0,0,29,219,255,185,23,0,0,0,56,255,71,87,255,
+  68,0,0,0,186,242,2,37,255,77,0,0,0,42,255,246,15,0,0,0,39,255,247,17,0,0,0,11,255,255,139,98,
+  98,104,125,181,252,247,117,0,0,142,255,217,0,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,
+  0,211,255,120,0,11,255,255,171,141,141,141,141,141,141,141,46,0,0,168,255,255,255,255,255,255,255,255,255,205,0,0,
+  141,255,218,0,0,0,126,255,255,255,255,255,73,0,11,255,255,157,123,123,123,123,123,181,255,221,0,0,0,0,0,0,
+  0,11,255,255,90,0,0,0,0,0,43,255,254,12,0,0,0,0,0,0,170,255,140,0,0,0,0,0,5,212,255,121,
+  0,0,0,0,1,161,255,176,0,0,0,0,81,237,255,255,255,255,188,68,255,229,0,0,2,155,155,128,0,0,0,123,
+  155,155,53,0,0,0,0,0,0,63,170,250,255,234,133,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,45,154,245,255,242,149,43,0,0,0,0,0,0,0,0,0,0,2,204,255,159,3,0,0,0,0,84,255,46,136,255,
+  24,0,0,0,220,194,0,52,255,57,0,0,0,138,255,216,104,104,104,104,104,237,255,104,0,0,0,11,255,255,66,0,
+  0,0,0,0,56,241,255,84,0,113,255,239,0,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,
+  0,239,255,85,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,207,120,120,120,120,120,120,120,97,0,0,
+  112,255,240,0,0,0,53,108,108,108,249,255,73,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,238,255,64,0,0,0,0,0,7,254,255,47,0,0,0,0,0,12,245,255,55,0,0,0,0,0,57,255,248,6,
+  0,0,0,0,0,44,255,253,12,0,0,0,0,20,80,127,119,58,0,76,255,200,0,0,4,255,255,210,0,0,8,246,
+  255,235,11,0,0,0,0,0,0,0,0,26,128,230,255,251,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  128,255,255,214,108,14,0,0,0,0,0,0,0,0,0,0,0,0,69,255,228,9,0,0,0,0,0,110,255,22,156,254,
+  3,0,0,18,254,145,0,70,255,36,0,0,4,231,255,255,255,255,255,255,255,255,255,198,0,0,0,11,255,255,66,0,
+  0,0,0,0,0,153,255,186,0,85,255,254,12,0,0,0,0,0,0,0,0,0,0,11,255,255,66,0,0,0,0,0,
+  24,255,255,51,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  84,255,255,13,0,0,0,0,0,0,244,255,73,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,202,255,101,0,0,0,0,0,25,255,255,22,0,0,0,0,0,90,255,224,1,0,0,0,0,0,89,255,228,0,
+  0,0,0,0,0,25,255,255,40,0,0,0,0,0,0,0,0,0,0,151,255,149,0,0,4,255,255,210,0,0,64,255,
+  255,126,0,0,0,0,0,0,0,0,0,0,0,5,87,194,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  149,173,67,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,176,121,0,0,0,0,0,0,99,255,32,159,252,
+  1,0,0,76,255,98,0,116,242,6,0,0,76,255,241,99,99,99,99,99,99,112,255,255,39,0,0,11,255,255,66,0,
+  0,0,0,0,0,128,255,216,0,34,253,255,92,0,0,0,0,0,0,99,197,78,0,11,255,255,66,0,0,0,0,0,
+  131,255,235,10,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  30,252,255,93,0,0,0,0,0,0,244,255,73,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,103,255,196,0,0,0,0,0,91,255,235,0,0,0,0,0,0,160,255,158,0,0,0,0,0,0,53,255,253,17,
+  0,0,0,0,0,65,255,250,7,0,0,87,136,53,0,0,0,0,14,242,254,41,0,0,4,255,255,210,0,0,129,255,
+  243,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,255,59,139,255,
+  16,0,0,172,255,61,0,173,175,0,0,0,173,255,158,0,0,0,0,0,0,0,200,255,133,0,0,11,255,255,66,0,
+  0,0,0,0,1,193,255,164,0,0,174,255,192,2,0,0,0,0,18,225,255,104,0,11,255,255,66,0,0,0,0,38,
+  237,255,111,0,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  0,172,255,193,2,0,0,0,0,0,244,255,73,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,10,236,255,122,0,0,0,36,224,255,125,0,0,0,0,0,0,193,255,126,0,0,0,0,0,0,8,226,255,156,
+  3,0,0,0,9,189,255,181,0,0,0,153,255,213,7,0,0,11,190,255,181,0,0,0,0,0,0,0,0,0,194,255,
+  142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,109,83,0,0,0,0,0,0,40,255,85,81,255,
+  79,0,63,219,255,51,33,250,90,0,0,20,249,255,67,0,0,0,0,0,0,0,108,255,225,2,0,11,255,255,66,0,
+  0,0,0,34,157,255,255,83,0,0,58,255,255,158,4,0,0,26,194,255,209,6,0,11,255,255,66,0,0,29,98,241,
+  255,221,7,0,0,11,255,255,66,0,0,0,0,0,0,0,0,0,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  0,59,254,255,158,3,0,0,0,60,250,255,73,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,0,70,241,255,203,146,170,242,255,208,8,0,0,0,0,0,0,226,255,95,0,0,0,0,0,0,0,66,251,255,
+  207,135,108,138,218,255,236,28,0,0,0,34,234,255,234,165,162,229,255,207,27,0,0,0,0,0,0,0,0,10,249,249,
+  28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,255,194,0,0,0,0,0,0,11,253,139,10,218,
+  231,162,238,68,240,181,223,179,1,0,0,110,255,228,2,0,0,0,0,0,0,0,21,250,255,67,0,11,255,255,226,216,
+  216,219,237,254,255,255,118,0,0,0,0,94,248,255,243,188,189,244,255,231,32,0,0,11,255,255,233,225,239,255,255,255,
+  182,24,0,0,0,11,255,255,233,225,225,225,225,225,225,225,225,122,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  0,0,95,250,255,241,185,174,221,255,255,216,35,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,0,0,47,193,245,255,255,236,139,8,0,0,0,0,0,0,6,252,255,65,0,0,0,0,0,0,0,0,41,177,
+  247,255,255,255,242,152,22,0,0,0,0,0,45,187,254,255,255,232,159,12,0,0,0,0,0,0,0,0,0,69,255,157,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,255,194,0,0,0,0,0,0,0,176,234,6,35,
+  147,168,62,0,79,177,111,14,0,0,0,207,255,139,0,0,0,0,0,0,0,0,0,179,255,162,0,11,255,255,255,255,
+  255,253,232,205,144,42,0,0,0,0,0,0,60,188,239,255,255,244,157,20,0,0,0,11,255,255,255,255,247,207,162,95,
+  1,0,0,0,0,11,255,255,255,255,255,255,255,255,255,255,255,138,0,168,255,165,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,70,191,244,255,255,251,194,97,5,0,0,11,255,255,66,0,0,0,0,0,112,255,221,0,0,0,0,0,0,
+  0,0,0,0,0,0,4,45,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  2,29,52,23,0,0,0,0,0,0,0,0,0,0,19,49,32,0,0,0,0,0,0,0,0,0,0,0,0,134,253,40,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,91,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,38,37,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,4,46,41,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,80,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,243,60,
+  0,0,0,0,0,19,168,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,211,242,
+  125,56,12,41,121,236,228,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,180,
+  248,255,255,255,242,144,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  9,64,95,67,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,40,72,72,72,72,72,72,72,72,72,27,0,0,0,0,11,72,72,72,72,72,64,0,3,72,72,19,0,0,0,0,
+  0,1,68,72,54,0,0,10,72,72,12,0,0,0,0,0,0,0,0,0,32,72,72,34,0,0,0,0,0,36,72,72,
+  19,0,3,72,72,50,0,0,0,0,0,15,72,62,0,0,0,0,2,40,90,123,82,31,0,0,0,0,0,3,72,72,
+  72,72,72,68,38,7,0,0,0,0,0,0,0,0,2,40,90,123,82,31,0,0,0,0,0,3,72,72,72,72,72,71,
+  49,17,0,0,0,0,0,0,0,0,0,0,14,82,111,129,107,78,11,0,0,0,0,6,72,72,72,72,72,72,72,72,
+  72,72,72,72,65,0,21,72,72,1,0,0,0,0,0,14,72,72,7,0,59,72,43,0,0,0,0,0,0,0,0,0,
+  56,72,46,0,70,72,21,0,0,0,0,0,0,0,0,0,34,72,57,0,1,69,72,35,0,0,0,0,0,0,0,47,
+  72,58,0,0,34,72,70,1,0,0,0,0,0,0,0,12,72,72,21,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,143,255,255,255,255,255,255,255,255,255,95,0,0,0,0,37,255,255,255,255,255,229,0,11,255,255,66,0,0,0,0,
+  0,128,255,246,58,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,255,182,0,0,0,0,0,190,255,255,
+  67,0,11,255,255,240,14,0,0,0,0,54,255,221,0,0,0,25,197,255,255,255,255,255,165,9,0,0,0,11,255,255,
+  255,255,255,255,255,253,188,54,0,0,0,0,0,25,197,255,255,255,255,255,165,9,0,0,0,11,255,255,255,255,255,255,
+  255,255,217,94,3,0,0,0,0,0,1,133,242,255,255,255,255,255,237,111,0,0,0,21,255,255,255,255,255,255,255,255,
+  255,255,255,255,230,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,150,255,210,0,0,0,0,0,0,0,0,11,
+  244,255,104,0,224,255,98,0,0,0,0,0,0,0,0,0,142,255,178,0,0,138,255,221,11,0,0,0,0,0,32,243,
+  255,96,0,0,30,243,255,99,0,0,0,0,0,0,0,144,255,219,9,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,86,153,153,153,229,255,210,153,153,153,57,0,0,0,0,22,153,153,153,193,255,229,0,11,255,255,66,0,0,0,0,
+  90,254,253,82,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,255,252,26,0,0,0,33,254,255,255,
+  67,0,11,255,255,255,118,0,0,0,0,54,255,221,0,0,34,229,255,231,146,105,157,245,255,204,11,0,0,11,255,255,
+  173,144,144,164,229,255,255,254,84,0,0,0,34,229,255,231,146,105,157,245,255,204,11,0,0,11,255,255,173,144,144,151,
+  204,252,255,255,135,0,0,0,0,0,131,255,247,145,81,60,86,178,255,255,95,0,0,13,153,153,153,153,153,228,255,210,
+  153,153,153,153,139,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,54,255,255,45,0,0,0,0,0,0,0,90,
+  255,247,17,0,184,255,131,0,0,0,0,0,0,0,0,0,174,255,139,0,0,8,213,255,142,0,0,0,0,1,185,255,
+  178,0,0,0,0,112,255,235,19,0,0,0,0,0,48,251,254,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,66,0,0,0,59,
+  247,255,109,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,208,255,120,0,0,0,128,255,211,255,
+  67,0,11,255,239,252,229,7,0,0,0,54,255,221,0,0,154,255,228,36,0,0,0,66,246,255,109,0,0,11,255,255,
+  66,0,0,0,1,42,197,255,238,20,0,0,154,255,228,36,0,0,0,66,246,255,109,0,0,11,255,255,66,0,0,0,
+  0,14,161,255,254,44,0,0,0,3,242,255,93,0,0,0,0,0,160,255,222,2,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,214,255,136,0,0,0,0,0,0,0,180,
+  255,168,0,0,144,255,164,0,0,0,0,0,0,0,0,0,206,255,99,0,0,0,53,251,252,55,0,0,0,96,255,237,
+  25,0,0,0,0,3,203,255,156,0,0,0,0,2,198,255,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,66,0,0,34,234,
+  255,140,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,136,249,216,0,0,2,223,222,171,255,
+  67,0,11,255,233,169,255,99,0,0,0,54,255,221,0,24,248,255,102,0,0,0,0,0,150,255,222,4,0,11,255,255,
+  66,0,0,0,0,0,77,255,255,76,0,24,248,255,102,0,0,0,0,0,150,255,222,4,0,11,255,255,66,0,0,0,
+  0,0,36,252,255,100,0,0,0,45,255,255,13,0,0,0,0,0,38,173,128,15,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,118,255,225,2,0,0,0,0,0,20,250,
+  255,73,0,0,104,255,198,0,0,0,0,0,0,0,0,0,237,255,59,0,0,0,0,132,255,211,6,0,24,237,255,89,
+  0,0,0,0,0,0,48,251,254,58,0,0,0,99,255,234,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,66,0,16,214,255,
+  168,2,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,122,184,255,58,0,65,255,138,176,255,
+  67,0,11,255,248,52,255,215,2,0,0,54,255,221,0,101,255,249,18,0,0,0,0,0,59,255,255,57,0,11,255,255,
+  66,0,0,0,0,0,2,230,255,116,0,101,255,249,18,0,0,0,0,0,59,255,255,57,0,11,255,255,66,0,0,0,
+  0,0,0,217,255,121,0,0,0,38,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,26,252,255,62,0,0,0,0,0,105,255,
+  229,3,0,0,64,255,231,0,0,0,40,60,31,0,0,14,255,255,19,0,0,0,0,6,208,255,127,0,172,255,172,0,
+  0,0,0,0,0,0,0,138,255,209,4,0,19,235,255,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,66,5,187,255,193,
+  7,0,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,93,255,153,0,161,255,50,176,255,
+  67,0,11,255,255,1,189,255,81,0,0,54,255,221,0,131,255,216,0,0,0,0,0,0,7,255,255,86,0,11,255,255,
+  66,0,0,0,0,0,2,244,255,86,0,131,255,216,0,0,0,0,0,0,7,255,255,86,0,11,255,255,66,0,0,0,
+  0,0,26,249,255,78,0,0,0,4,223,255,210,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,0,182,255,152,0,0,0,0,0,195,255,
+  137,0,0,0,24,255,254,10,0,0,211,255,175,0,0,46,255,235,0,0,0,0,0,0,48,249,249,124,255,233,21,0,
+  0,0,0,0,0,0,0,10,221,255,114,0,155,255,185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,66,153,255,242,18,
+  0,0,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,10,241,234,9,240,210,0,176,255,
+  67,0,11,255,255,2,72,255,199,0,0,54,255,221,0,159,255,195,0,0,0,0,0,0,0,241,255,114,0,11,255,255,
+  66,0,0,0,0,0,105,255,250,31,0,159,255,195,0,0,0,0,0,0,0,241,255,114,0,11,255,255,66,0,0,0,
+  0,35,194,255,216,4,0,0,0,0,68,244,255,255,207,138,70,9,0,0,0,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,0,87,255,237,6,0,0,0,31,254,255,
+  41,0,0,0,0,239,255,42,0,27,254,254,240,4,0,78,255,195,0,0,0,0,0,0,0,125,255,255,255,82,0,0,
+  0,0,0,0,0,0,0,0,71,255,242,85,253,245,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,178,255,255,255,115,
+  0,0,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,155,255,125,255,115,0,176,255,
+  67,0,11,255,255,2,1,209,255,62,0,54,255,221,0,187,255,174,0,0,0,0,0,0,0,220,255,141,0,11,255,255,
+  71,7,7,15,51,141,250,255,132,0,0,187,255,174,0,0,0,0,0,0,0,220,255,141,0,11,255,255,210,194,194,197,
+  226,253,255,223,44,0,0,0,0,0,0,37,160,243,255,255,255,244,165,45,0,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,0,8,238,255,78,0,0,0,120,255,201,
+  0,0,0,0,0,200,255,76,0,96,255,180,255,59,0,110,255,155,0,0,0,0,0,0,0,9,243,255,210,0,0,0,
+  0,0,0,0,0,0,0,0,0,164,255,254,255,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,255,229,174,255,250,
+  56,0,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,58,255,243,251,23,0,176,255,
+  67,0,11,255,255,2,0,92,255,181,0,54,255,221,0,176,255,183,0,0,0,0,0,0,0,228,255,129,0,11,255,255,
+  255,255,255,255,255,255,252,142,7,0,0,178,255,183,0,0,0,0,0,0,0,228,255,132,0,11,255,255,255,255,255,255,
+  255,209,105,17,0,0,0,0,0,0,0,0,0,9,68,136,206,255,255,251,99,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,0,0,151,255,169,0,0,0,210,255,105,
+  0,0,0,0,0,160,255,109,0,165,252,63,255,129,0,141,255,116,0,0,0,0,0,0,0,128,255,255,255,85,0,0,
+  0,0,0,0,0,0,0,0,0,21,236,255,208,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,233,40,9,209,255,
+  224,18,0,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,1,216,255,179,0,0,176,255,
+  67,0,11,255,255,2,0,5,225,254,45,54,255,221,0,149,255,204,0,0,0,0,0,0,0,248,255,100,0,11,255,255,
+  217,203,203,201,167,124,49,0,0,0,0,152,255,204,0,0,0,0,0,0,0,248,255,107,0,11,255,255,78,15,15,152,
+  255,210,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,201,255,250,36,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,73,255,255,5,0,0,0,0,0,51,255,255,24,0,0,0,0,56,255,246,14,0,44,255,247,17,
+  0,0,0,0,0,120,255,142,1,233,205,3,241,198,0,173,255,76,0,0,0,0,0,0,50,250,248,122,255,235,23,0,
+  0,0,0,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,0,0,0,0,0,0,0,100,255,229,0,11,255,255,81,0,0,38,241,
+  255,177,1,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,0,93,176,68,0,0,176,255,
+  67,0,11,255,255,2,0,0,113,255,162,52,255,221,0,122,255,229,0,0,0,0,0,0,18,255,255,71,0,11,255,255,
+  66,0,0,0,0,0,0,0,0,0,0,127,255,229,0,0,0,0,0,0,18,255,255,82,0,11,255,255,66,0,0,15,
+  228,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,243,255,117,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,65,255,255,14,0,0,0,0,0,65,255,255,11,0,0,0,0,0,215,255,94,0,134,255,169,0,
+  0,0,0,0,0,80,255,170,46,255,142,0,179,251,13,201,255,36,0,0,0,0,0,7,210,255,125,0,170,255,175,0,
+  0,0,0,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,64,115,68,0,0,0,0,134,255,209,0,11,255,255,66,0,0,0,85,
+  255,255,113,0,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,0,0,0,0,0,0,176,255,
+  67,0,11,255,255,2,0,0,12,238,250,74,255,221,0,78,255,255,49,0,0,0,0,0,89,255,253,30,0,11,255,255,
+  66,0,0,0,0,0,0,0,0,0,0,76,255,255,49,0,0,0,0,0,89,255,252,25,0,11,255,255,66,0,0,0,
+  80,255,251,52,0,0,0,0,1,48,99,37,0,0,0,0,0,0,0,187,255,146,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,34,255,255,33,0,0,0,0,0,87,255,235,0,0,0,0,0,0,120,255,177,0,217,255,74,0,
+  0,0,0,0,0,40,255,196,108,255,74,0,110,255,71,227,248,3,0,0,0,0,0,134,255,208,5,0,23,236,255,92,
+  0,0,0,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,166,255,179,0,0,0,0,198,255,172,0,11,255,255,66,0,0,0,0,
+  144,255,249,55,0,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,0,0,0,0,0,0,176,255,
+  67,0,11,255,255,2,0,0,0,133,255,167,255,221,0,4,224,255,144,0,0,0,0,0,179,255,175,0,0,11,255,255,
+  66,0,0,0,0,0,0,0,0,0,0,4,228,255,144,0,0,0,0,0,179,255,184,0,0,11,255,255,66,0,0,0,
+  0,173,255,212,7,0,0,0,0,210,255,148,0,0,0,0,0,0,1,223,255,108,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,5,252,255,91,0,0,0,0,0,155,255,202,0,0,0,0,0,0,27,252,245,50,255,230,4,0,
+  0,0,0,0,0,5,250,221,168,248,11,0,42,255,134,250,212,0,0,0,0,0,55,252,251,51,0,0,0,92,255,238,
+  26,0,0,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,191,255,142,0,0,0,0,0,84,255,254,78,0,1,70,250,255,97,0,11,255,255,66,0,0,0,0,
+  6,199,255,223,17,0,0,36,255,255,42,0,0,0,0,0,0,0,0,0,113,255,124,0,0,0,0,0,0,0,176,255,
+  67,0,11,255,255,2,0,0,0,23,247,246,255,221,0,0,116,255,253,94,0,0,0,123,255,255,58,0,0,11,255,255,
+  66,0,0,0,0,0,0,0,0,0,0,0,126,255,253,94,0,0,0,123,255,253,72,0,0,11,255,255,66,0,0,0,
+  0,26,240,255,135,0,0,0,0,107,255,253,101,2,0,0,0,5,138,255,248,40,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,0,176,255,210,26,0,0,0,68,244,255,106,0,0,0,0,0,0,0,184,255,187,255,138,0,0,
+  0,0,0,0,0,0,215,244,228,189,0,0,0,228,214,255,172,0,0,0,0,9,215,255,137,0,0,0,0,0,180,255,
+  181,0,0,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,127,225,225,225,247,255,242,225,225,225,83,0,1,182,255,253,189,209,255,255,206,3,0,11,255,255,66,0,0,0,0,
+  0,30,235,255,175,1,0,36,255,255,230,225,225,225,225,225,225,225,62,0,113,255,124,0,0,0,0,0,0,0,176,255,
+  67,0,11,255,255,2,0,0,0,0,153,255,255,221,0,0,7,165,255,255,220,177,229,255,253,120,0,0,0,11,255,255,
+  66,0,0,0,0,0,0,0,0,0,0,0,3,165,255,255,220,177,229,255,255,120,0,0,0,11,255,255,66,0,0,0,
+  0,0,103,255,252,54,0,0,0,2,162,255,255,220,171,149,169,230,255,255,104,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,0,38,248,255,240,191,171,205,253,255,210,4,0,0,0,0,0,0,0,88,255,255,255,43,0,0,
+  0,0,0,0,0,0,175,255,255,119,0,0,0,160,255,255,133,0,0,0,0,141,255,217,9,0,0,0,0,0,28,241,
+  255,98,0,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,143,255,255,255,255,255,255,255,255,255,95,0,0,14,103,186,250,255,247,158,14,0,0,11,255,255,66,0,0,0,0,
+  0,0,72,253,255,111,0,36,255,255,255,255,255,255,255,255,255,255,70,0,113,255,124,0,0,0,0,0,0,0,176,255,
+  67,0,11,255,255,2,0,0,0,0,38,253,255,221,0,0,0,1,120,215,253,255,250,207,77,0,0,0,0,11,255,255,
+  66,0,0,0,0,0,0,0,0,0,0,0,0,3,124,211,255,255,255,206,86,0,0,0,0,11,255,255,66,0,0,0,
+  0,0,1,194,255,214,8,0,0,0,4,94,206,255,255,255,255,247,181,55,0,0,0,0,0,0,0,0,0,188,255,142,
+  0,0,0,0,0,0,0,0,40,183,252,255,255,255,241,134,11,0,0,0,0,0,0,0,0,9,239,255,202,0,0,0,
+  0,0,0,0,0,0,136,255,255,49,0,0,0,91,255,255,93,0,0,0,60,253,253,61,0,0,0,0,0,0,0,103,
+  255,241,30,0,0,0,0,0,0,0,185,255,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,42,4,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,48,9,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,255,255,70,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,10,37,53,25,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,6,35,52,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,255,214,5,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,254,255,184,86,23,28,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,252,255,255,255,184,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,125,163,155,87,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,17,72,72,72,72,72,72,72,72,72,72,72,27,0,12,232,232,232,232,232,232,128,0,85,232,182,0,0,0,0,
+  0,0,0,0,0,0,0,172,232,232,232,232,232,200,0,0,0,0,0,0,64,72,48,0,0,0,0,0,0,8,128,128,
+  128,128,128,128,128,128,128,128,128,128,128,128,113,0,15,154,158,83,0,0,0,0,0,0,0,23,54,66,33,3,0,0,
+  0,0,0,178,232,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,35,67,45,10,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,136,232,136,0,0,0,0,0,5,40,65,25,0,0,0,0,0,0,0,0,0,0,0,36,152,
+  194,222,227,215,193,45,0,0,0,0,0,15,53,10,0,0,5,15,11,0,178,232,97,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,98,232,230,0,0,0,0,0,0,0,0,0,0,0,0,75,232,232,21,0,35,232,232,5,0,0,0,
+  0,0,0,0,0,0,0,0,181,232,232,232,232,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,61,255,255,255,255,255,255,255,255,255,255,255,95,0,13,255,255,203,196,196,196,108,0,3,212,255,78,0,0,0,
+  0,0,0,0,0,0,0,145,196,196,196,214,255,219,0,0,0,0,0,41,254,255,234,7,0,0,0,0,0,10,167,167,
+  167,167,167,167,167,167,167,167,167,167,167,167,147,0,0,62,230,251,79,0,0,0,0,63,200,255,255,255,255,226,90,0,
+  0,0,0,196,255,103,0,0,0,0,0,0,0,0,0,0,0,0,9,121,241,255,255,255,250,153,25,0,0,0,0,0,
+  0,0,0,0,0,0,0,149,255,150,0,0,0,10,134,248,255,255,255,232,123,1,0,0,0,0,0,0,0,63,250,255,
+  255,240,230,242,254,67,0,0,0,44,210,254,255,247,187,31,105,255,176,0,196,255,106,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,108,255,253,0,0,0,0,0,0,0,0,0,0,0,0,83,255,255,23,0,39,255,255,5,0,0,0,
+  0,0,0,0,0,0,0,0,159,205,205,219,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,37,153,153,153,153,153,153,153,153,194,255,253,60,0,13,255,255,31,0,0,0,0,0,0,77,255,214,4,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,0,147,254,146,255,93,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,190,248,69,0,0,50,245,255,180,106,102,161,253,255,75,
+  0,0,0,196,255,103,0,0,0,0,0,0,0,0,0,0,0,3,200,255,229,153,118,174,242,255,216,20,0,0,0,0,
+  0,0,0,0,0,0,0,149,255,150,0,0,5,207,255,227,121,88,123,233,255,172,1,0,0,0,0,0,0,209,255,194,
+  33,0,0,0,5,5,0,0,42,240,255,205,120,113,196,212,136,255,167,0,196,255,106,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,44,104,103,0,0,0,0,0,0,0,0,0,0,0,0,34,104,104,9,0,39,255,255,5,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,18,223,255,132,0,0,13,255,255,31,0,0,0,0,0,0,0,193,255,101,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,12,241,192,13,242,200,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,107,116,0,0,165,255,181,0,0,0,0,137,255,204,
+  0,0,0,196,255,103,0,0,0,0,0,0,0,0,0,0,0,117,255,211,24,0,0,0,21,239,255,152,0,0,0,0,
+  0,0,0,0,0,0,0,149,255,150,0,0,120,255,216,13,0,0,0,25,236,255,75,0,0,0,0,0,8,254,255,50,
+  0,0,0,0,0,0,0,0,152,255,199,9,0,0,3,164,250,255,165,0,196,255,106,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,255,255,5,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,2,183,255,186,3,0,0,13,255,255,31,0,0,0,0,0,0,0,56,254,230,11,0,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,104,255,89,0,151,255,51,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,89,48,0,0,0,0,58,255,246,
+  2,0,0,196,255,103,0,0,26,69,27,0,0,0,0,0,1,242,255,85,0,0,0,0,0,101,181,146,0,0,0,0,
+  0,0,18,50,9,0,0,149,255,150,0,1,242,255,73,0,0,0,0,0,115,255,189,0,0,5,15,15,50,255,255,26,
+  15,15,15,15,14,0,0,5,242,255,90,0,0,0,0,26,247,255,165,0,196,255,106,0,3,46,67,36,3,0,0,0,
+  0,0,15,15,15,15,15,15,0,0,0,0,0,0,0,0,15,15,15,15,15,15,15,1,0,39,255,255,5,0,0,0,
+  0,4,15,15,4,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,129,255,225,20,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,172,255,125,0,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,210,234,7,0,46,255,158,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,255,255,
+  17,0,0,196,255,102,62,220,255,255,255,210,34,0,0,0,31,255,254,7,0,0,0,0,0,0,0,0,0,0,0,0,
+  43,210,254,255,250,202,36,148,255,150,0,29,255,254,17,0,0,0,0,0,53,255,246,1,0,85,255,255,255,255,255,255,
+  255,255,255,255,236,0,0,27,255,255,30,0,0,0,0,0,190,255,165,0,196,255,101,73,223,255,255,255,214,57,0,0,
+  0,8,255,255,255,255,255,253,0,0,0,0,0,0,0,0,254,255,255,255,255,255,255,23,0,39,255,255,5,0,0,0,
+  6,186,255,189,8,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,74,253,248,54,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,38,250,242,22,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,62,255,137,0,0,0,197,246,19,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,132,194,220,236,240,246,255,255,
+  18,0,0,196,255,136,237,170,108,127,220,255,234,18,0,0,71,255,236,0,0,0,0,0,0,0,0,0,0,0,0,39,
+  239,255,199,116,113,179,223,173,255,150,0,67,255,251,188,188,188,188,188,188,192,255,255,20,0,56,167,167,182,255,255,167,
+  167,167,167,167,155,0,0,50,255,255,10,0,0,0,0,0,158,255,165,0,196,255,146,251,181,115,121,222,255,231,14,0,
+  0,5,167,167,167,183,255,253,0,0,0,0,0,0,0,0,166,167,167,167,174,255,255,23,0,39,255,255,5,0,0,2,
+  166,255,199,12,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,33,238,255,105,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,150,255,148,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,168,253,35,0,0,0,92,255,117,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,249,255,236,178,157,149,158,255,255,
+  18,0,0,196,255,253,113,0,0,0,23,226,255,117,0,0,101,255,222,0,0,0,0,0,0,0,0,0,0,0,0,149,
+  255,192,7,0,0,0,133,255,255,150,0,91,255,253,237,237,237,237,237,237,237,237,237,42,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,64,255,252,1,0,0,0,0,0,140,255,165,0,196,255,251,112,0,0,0,22,240,255,102,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,0,0,143,
+  255,208,17,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,9,206,255,162,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,23,243,250,
+  37,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,25,250,185,0,0,0,0,8,235,221,2,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,247,255,153,4,0,0,0,36,255,255,
+  18,0,0,196,255,230,5,0,0,0,0,129,255,212,0,0,78,255,240,0,0,0,0,0,0,0,0,0,0,0,7,242,
+  255,83,0,0,0,0,15,243,255,150,0,63,255,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,44,255,255,15,0,0,0,0,0,169,255,165,0,196,255,205,1,0,0,0,0,171,255,140,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,0,119,255,
+  217,23,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,158,255,209,10,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,128,255,
+  172,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,126,255,81,0,0,0,0,0,138,255,76,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,255,251,12,0,0,0,0,73,255,255,
+  18,0,0,196,255,158,0,0,0,0,0,63,255,246,0,0,47,255,255,13,0,0,0,0,0,2,0,0,0,0,33,255,
+  255,19,0,0,0,0,0,194,255,150,0,29,255,255,21,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,22,255,255,38,0,0,0,0,0,209,255,165,0,196,255,140,0,0,0,0,0,140,255,167,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,96,254,224,
+  30,0,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,102,255,240,37,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,12,232,
+  254,57,0,0,0,0,0,0,0,0,0,80,255,219,0,4,228,229,4,0,0,0,0,0,35,253,182,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,255,231,0,0,0,0,0,172,255,255,
+  19,0,0,196,255,132,0,0,0,0,0,42,255,255,16,0,7,230,255,97,0,0,0,0,0,140,250,209,0,0,58,255,
+  251,2,0,0,0,0,0,169,255,150,0,2,228,255,109,0,0,0,0,0,16,60,4,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,2,228,255,113,0,0,0,0,64,255,255,165,0,196,255,107,0,0,0,0,0,134,255,168,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,80,251,255,56,
+  0,0,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,53,248,254,79,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,106,
+  255,195,0,0,0,0,0,0,0,0,0,80,255,219,0,43,170,98,0,0,0,0,0,0,0,134,168,13,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,251,255,50,0,0,0,113,220,255,255,
+  52,0,0,196,255,110,0,0,0,0,0,28,255,255,33,0,0,115,255,221,33,0,0,0,33,247,255,139,0,0,79,255,
+  237,0,0,0,0,0,0,156,255,150,0,0,98,255,230,41,0,0,0,4,163,255,159,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,128,255,228,45,0,0,47,221,215,255,165,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,246,255,255,180,
+  1,0,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,20,224,255,135,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,5,
+  217,255,79,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,255,237,148,136,198,246,56,223,255,
+  194,98,0,196,255,125,0,0,0,0,0,45,255,255,11,0,0,11,184,255,235,164,127,185,248,255,201,9,0,0,63,255,
+  250,1,0,0,0,0,0,177,255,150,0,0,3,183,255,239,154,110,131,216,255,224,31,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,20,204,255,251,215,214,253,157,131,255,165,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,200,56,232,255,
+  117,0,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,3,185,255,189,3,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  83,255,215,4,0,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,210,255,255,255,206,61,0,87,245,
+  255,251,0,196,255,150,0,0,0,0,0,68,255,240,0,0,0,0,2,122,217,253,255,255,238,127,11,0,0,0,38,255,
+  255,15,0,0,0,0,0,203,255,150,0,0,0,1,111,227,255,255,255,245,150,26,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,0,11,126,178,208,177,85,1,132,255,163,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,10,0,70,253,
+  250,58,0,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,132,255,228,22,0,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,199,255,103,0,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,27,53,27,0,0,0,0,5,
+  26,7,0,196,255,213,1,0,0,0,0,133,255,199,0,0,0,0,0,0,0,11,50,26,1,0,0,0,0,0,11,249,
+  255,79,0,0,0,0,30,252,255,150,0,0,0,0,0,0,17,52,30,3,0,0,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,157,255,135,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,0,0,137,
+  255,225,19,0,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,24,254,255,241,225,225,225,225,225,225,225,225,225,212,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,62,255,230,11,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,196,255,255,89,0,0,0,24,228,255,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,
+  255,190,6,0,0,3,159,252,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,13,58,85,1,0,0,0,0,204,255,101,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  0,0,0,0,0,46,255,253,0,0,0,0,0,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,0,0,5,
+  200,255,179,1,0,0,0,0,0,0,0,74,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,30,255,255,255,255,255,255,255,255,255,255,255,255,240,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,178,255,126,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,200,255,144,239,159,107,129,222,255,213,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,
+  249,255,197,118,120,194,213,149,255,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,43,255,255,99,0,0,0,87,255,244,26,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  50,182,182,182,182,195,255,254,182,182,182,182,105,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,0,0,0,
+  33,240,255,116,0,0,70,182,182,182,182,203,255,246,182,182,182,182,85,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,43,252,242,23,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,207,255,77,63,212,253,255,250,179,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  64,232,255,255,253,207,33,120,255,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,0,
+  0,0,0,0,0,0,0,0,0,153,255,252,202,147,181,254,255,120,0,0,196,255,103,0,0,0,0,0,134,255,168,0,
+  70,255,255,255,255,255,255,255,255,255,255,255,147,0,0,0,0,0,0,0,21,255,255,23,0,39,255,255,5,0,0,0,
+  0,86,255,250,57,0,98,255,255,255,255,255,255,255,255,255,255,255,120,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,50,62,23,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,14,48,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,1,35,65,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,3,109,215,252,255,243,202,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,255,254,13,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,5,21,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,255,220,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,80,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,35,220,255,157,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,255,255,154,140,140,140,77,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,104,140,140,140,176,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,222,188,174,198,250,255,223,18,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,189,255,255,255,255,255,219,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,227,255,255,255,235,143,25,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,33,33,33,33,33,33,18,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,24,33,33,33,33,33,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,29,13,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,12,15,0,12,60,12,0,0,8,60,44,2,0,0,13,15,3,0,2,43,68,39,4,0,0,0,0,0,0,0,2,
+  36,66,32,1,0,0,0,0,0,13,15,4,0,7,57,71,23,0,0,0,0,0,0,0,0,0,18,56,36,1,0,8,
+  18,12,0,1,15,15,0,0,0,17,55,72,58,21,0,0,0,0,8,37,60,42,10,0,0,0,0,0,0,2,117,58,
+  0,0,0,0,0,0,0,11,15,6,0,0,0,0,0,8,15,10,0,2,15,15,4,0,0,0,0,0,0,0,7,15,
+  15,0,11,15,6,0,0,0,0,0,0,0,0,0,8,15,9,0,9,15,12,0,0,0,0,0,0,1,15,15,6,0,
+  3,15,15,2,0,0,0,0,0,0,0,4,15,15,0,0,0,11,15,15,15,15,15,15,15,15,15,7,0,0,0,0,
+  0,0,58,181,224,232,232,187,0,137,232,96,0,229,232,232,218,167,35,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,198,255,41,227,255,244,83,27,220,255,255,171,1,0,207,255,62,70,220,255,255,255,221,63,0,0,0,0,9,145,245,
+  255,255,255,244,134,6,0,0,0,206,255,80,85,235,255,255,255,212,36,0,0,0,0,0,43,211,254,255,255,216,58,131,
+  255,164,0,2,240,255,32,3,142,249,255,255,255,156,0,0,22,151,247,255,255,255,244,159,16,0,0,0,0,39,255,126,
+  0,0,0,0,0,0,0,196,255,103,0,0,0,0,0,134,255,168,0,7,234,255,123,0,0,0,0,0,0,0,167,255,
+  193,0,166,255,124,0,0,0,0,0,0,0,0,0,163,255,123,0,62,251,247,46,0,0,0,0,0,108,255,227,21,0,
+  9,235,255,88,0,0,0,0,0,0,0,128,255,198,0,0,0,189,255,255,255,255,255,255,255,255,255,113,0,0,0,0,
+  0,59,252,255,226,197,196,158,0,151,255,105,0,193,196,199,235,255,239,25,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,191,255,186,168,142,255,203,171,216,128,251,255,50,0,200,255,130,251,181,115,121,222,255,235,16,0,0,13,214,255,222,
+  121,89,124,233,255,200,4,0,0,200,255,146,252,169,107,128,216,255,231,26,0,0,0,39,239,255,200,118,112,182,242,178,
+  255,156,0,0,193,255,89,139,255,252,208,182,199,137,0,6,197,255,206,144,99,113,194,255,208,4,0,0,0,91,255,126,
+  0,0,0,0,0,0,0,196,255,103,0,0,0,0,0,134,255,168,0,0,139,255,219,1,0,0,0,0,0,19,248,255,
+  89,0,123,255,163,0,0,0,0,0,0,0,0,0,205,255,78,0,0,120,255,212,9,0,0,0,43,246,251,59,0,0,
+  0,132,255,192,0,0,0,0,0,0,3,225,255,91,0,0,0,117,158,158,158,158,158,158,174,255,255,95,0,0,0,0,
+  0,184,255,151,1,0,0,0,0,151,255,105,0,0,0,0,8,190,255,136,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,188,255,213,3,0,208,255,230,15,0,175,255,111,0,197,255,251,112,0,0,0,22,240,255,105,0,0,129,255,211,16,
+  0,0,0,26,236,255,96,0,0,196,255,253,112,0,0,0,20,221,255,122,0,0,0,149,255,193,7,0,0,0,138,255,
+  255,153,0,0,155,255,169,251,177,17,0,0,0,0,0,66,255,227,9,0,0,0,2,187,251,71,0,11,15,149,255,133,
+  15,15,15,15,11,0,0,196,255,103,0,0,0,0,0,134,255,168,0,0,38,254,255,62,0,0,0,0,0,112,255,233,
+  6,0,80,255,202,0,0,0,0,0,0,0,0,2,245,255,33,0,0,2,181,255,147,0,0,7,208,255,117,0,0,0,
+  0,26,249,255,43,0,0,0,0,0,73,255,232,6,0,0,0,0,0,0,0,0,0,5,187,255,171,2,0,0,0,0,
+  0,228,255,59,0,0,0,0,0,151,255,105,0,0,0,0,0,104,255,182,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,136,0,0,165,255,186,0,0,132,255,130,0,196,255,205,1,0,0,0,0,171,255,141,0,11,243,255,88,0,
+  0,0,0,0,131,255,213,0,0,196,255,228,6,0,0,0,0,122,255,214,0,0,7,242,255,82,0,0,0,0,17,243,
+  255,153,0,0,129,255,255,187,2,0,0,0,0,0,0,105,255,170,0,0,0,0,0,11,4,0,0,180,255,255,255,255,
+  255,255,255,255,180,0,0,196,255,103,0,0,0,0,0,134,255,168,0,0,0,189,255,159,0,0,0,0,0,211,255,135,
+  0,0,37,255,241,0,0,0,105,127,84,0,0,35,255,242,1,0,0,0,20,226,254,75,0,140,255,178,1,0,0,0,
+  0,0,164,255,147,0,0,0,0,0,173,255,131,0,0,0,0,0,0,0,0,0,0,152,255,202,10,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,99,0,0,154,255,147,0,0,121,255,143,0,196,255,140,0,0,0,0,0,140,255,167,0,46,255,255,15,0,
+  0,0,0,0,63,255,252,4,0,196,255,162,0,0,0,0,0,58,255,250,1,0,33,255,255,16,0,0,0,0,0,196,
+  255,153,0,0,117,255,255,52,0,0,0,0,0,0,0,59,255,248,111,13,0,0,0,0,0,0,0,118,167,227,255,210,
+  167,167,167,167,118,0,0,196,255,103,0,0,0,0,0,134,255,168,0,0,0,87,255,244,13,0,0,0,56,255,253,32,
+  0,0,3,246,255,26,0,20,252,254,225,1,0,77,255,199,0,0,0,0,0,58,250,233,90,253,223,17,0,0,0,0,
+  0,0,52,255,240,12,0,0,0,24,250,251,28,0,0,0,0,0,0,0,0,0,112,255,226,25,0,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,82,0,0,151,255,115,0,0,118,255,144,0,196,255,107,0,0,0,0,0,134,255,168,0,78,255,243,0,0,
+  0,0,0,0,36,255,255,32,0,196,255,136,0,0,0,0,0,39,255,255,19,0,58,255,250,1,0,0,0,0,0,170,
+  255,153,0,0,115,255,234,0,0,0,0,0,0,0,0,3,167,255,255,247,190,123,50,0,0,0,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,196,255,103,0,0,0,0,0,134,255,168,0,0,0,7,234,255,99,0,0,0,156,255,180,0,
+  0,0,0,206,255,65,0,98,255,168,255,49,0,120,255,154,0,0,0,0,0,0,115,255,255,249,54,0,0,0,0,0,
+  0,0,0,195,255,102,0,0,0,119,255,171,0,0,0,0,0,0,0,0,0,76,252,243,48,0,0,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,101,255,224,0,0,
+  0,0,0,0,18,255,255,53,0,196,255,113,0,0,0,0,0,27,255,255,34,0,79,255,237,0,0,0,0,0,0,157,
+  255,153,0,0,115,255,198,0,0,0,0,0,0,0,0,0,3,87,192,251,255,255,255,202,59,0,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,196,255,103,0,0,0,0,0,134,255,168,0,0,0,0,138,255,196,0,0,13,243,255,76,0,
+  0,0,0,163,255,104,0,179,239,40,255,127,0,162,255,109,0,0,0,0,0,0,27,248,255,209,4,0,0,0,0,0,
+  0,0,0,83,255,207,0,0,1,218,255,63,0,0,0,0,0,0,0,0,46,242,252,77,0,0,0,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,74,255,246,0,0,
+  0,0,0,0,40,255,255,25,0,196,255,126,0,0,0,0,0,42,255,255,15,0,62,255,250,1,0,0,0,0,0,181,
+  255,153,0,0,115,255,184,0,0,0,0,0,0,0,0,0,0,0,0,16,80,151,234,255,245,54,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,196,255,103,0,0,0,0,0,138,255,168,0,0,0,0,37,254,254,38,0,100,255,223,3,0,
+  0,0,0,119,255,140,13,247,167,0,216,205,0,202,255,64,0,0,0,0,0,3,191,255,231,255,136,0,0,0,0,0,
+  0,0,0,3,223,255,57,0,65,255,210,0,0,0,0,0,0,0,0,24,225,255,114,0,0,0,0,0,0,0,0,0,
+  16,253,255,31,0,0,0,0,0,151,255,105,0,0,0,0,0,74,255,223,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,39,255,255,19,0,
+  0,0,0,0,68,255,244,1,0,196,255,150,0,0,0,0,0,64,255,247,0,0,37,255,255,17,0,0,0,0,0,208,
+  255,153,0,0,115,255,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,184,255,149,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,194,255,110,0,0,0,0,0,169,255,168,0,0,0,0,0,189,255,132,0,198,255,121,0,0,
+  0,0,0,76,255,171,86,255,86,0,138,254,28,236,255,20,0,0,0,0,0,129,255,189,26,233,254,75,0,0,0,0,
+  0,0,0,0,114,255,160,0,167,255,103,0,0,0,0,0,0,0,9,200,255,153,0,0,0,0,0,0,0,0,0,0,
+  118,255,223,0,0,0,0,0,0,151,255,105,0,0,0,0,0,22,247,255,70,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,6,238,255,96,0,
+  0,0,0,0,143,255,194,0,0,196,255,214,1,0,0,0,0,130,255,199,0,0,10,248,255,84,0,0,0,0,32,251,
+  255,153,0,0,115,255,184,0,0,0,0,0,0,0,0,22,71,3,0,0,0,0,0,82,255,185,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,172,255,132,0,0,0,0,7,226,255,168,0,0,0,0,0,87,255,212,31,254,249,23,0,0,
+  0,0,0,33,255,201,161,247,13,0,61,255,111,255,230,0,0,0,0,0,67,253,235,26,0,73,254,236,29,0,0,0,
+  0,0,0,0,15,242,245,34,248,239,11,0,0,0,0,0,0,1,169,255,188,5,0,0,0,0,0,0,0,16,85,165,
+  253,242,66,0,0,0,0,0,0,151,255,105,0,0,0,0,0,0,101,251,245,144,77,5,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,0,115,255,218,21,
+  0,0,0,41,244,255,65,0,0,196,255,255,93,0,0,0,24,226,255,106,0,0,0,165,255,196,8,0,0,2,162,251,
+  255,153,0,0,115,255,184,0,0,0,0,0,0,0,0,196,255,89,0,0,0,0,0,147,255,133,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,140,255,213,4,0,0,1,134,248,255,168,0,0,0,0,0,6,234,255,138,255,167,0,0,0,
+  0,0,0,2,243,225,229,180,0,0,3,235,202,255,185,0,0,0,0,24,231,254,76,0,0,0,143,255,197,5,0,0,
+  0,0,0,0,0,145,255,204,255,143,0,0,0,0,0,0,0,130,255,215,17,0,0,0,0,0,0,0,0,66,255,255,
+  213,39,0,0,0,0,0,0,0,151,255,105,0,0,0,0,0,0,0,65,233,255,255,21,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,0,7,202,255,228,
+  131,104,144,244,255,158,0,0,0,196,255,165,252,162,109,132,219,255,212,16,0,0,0,54,248,255,202,120,116,194,234,163,
+  255,153,0,0,115,255,184,0,0,0,0,0,0,0,0,71,250,251,161,109,100,117,184,255,224,21,0,0,0,173,255,126,
+  0,0,0,0,0,0,0,38,251,255,205,130,131,196,238,131,255,171,0,0,0,0,0,0,138,255,248,255,62,0,0,0,
+  0,0,0,0,202,253,255,99,0,0,0,161,253,255,140,0,0,0,2,188,255,145,0,0,0,0,7,206,255,139,0,0,
+  0,0,0,0,0,36,253,255,254,37,0,0,0,0,0,0,45,254,255,201,173,173,173,173,173,173,173,154,0,30,140,218,
+  255,220,41,0,0,0,0,0,0,151,255,105,0,0,0,0,0,0,68,237,255,200,133,9,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,187,255,78,0,0,151,255,111,0,0,118,255,144,0,196,255,103,0,0,0,0,0,134,255,168,0,0,0,5,131,235,
+  255,255,254,223,92,0,0,0,0,196,255,104,86,226,255,255,247,185,21,0,0,0,0,0,62,231,255,255,255,215,47,149,
+  255,153,0,0,115,255,184,0,0,0,0,0,0,0,0,0,65,195,253,255,255,255,247,154,32,0,0,0,0,170,255,136,
+  0,0,0,0,0,0,0,0,83,231,255,255,255,202,46,90,255,180,0,0,0,0,0,0,37,254,255,212,0,0,0,0,
+  0,0,0,0,159,255,252,21,0,0,0,84,255,255,95,0,0,0,126,255,207,7,0,0,0,0,0,40,244,254,77,0,
+  0,0,0,0,0,0,178,255,183,0,0,0,0,0,0,0,58,255,255,255,255,255,255,255,255,255,255,227,0,0,0,2,
+  160,255,204,0,0,0,0,0,0,151,255,105,0,0,0,0,0,13,234,255,115,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  24,50,14,0,0,0,0,0,0,196,255,106,0,2,38,50,7,0,0,0,0,0,0,0,0,1,34,71,46,1,0,149,
+  255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,42,55,30,3,0,0,0,0,0,0,102,255,215,
+  2,0,0,0,0,0,0,0,0,2,30,53,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,2,203,255,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  28,255,255,23,0,0,0,0,0,151,255,105,0,0,0,0,0,66,255,235,1,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,196,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,
+  255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,246,255,
+  235,171,163,187,224,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,102,255,217,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,242,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,196,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,196,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,
+  255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,181,
+  245,255,255,250,209,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,42,239,255,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,196,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,
+  255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  8,44,31,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,145,190,254,255,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,196,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,149,
+  255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,248,255,235,134,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,240,255,44,0,0,0,0,0,151,255,105,0,0,0,0,0,86,255,194,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,25,33,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,
+  33,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,16,26,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,234,255,71,0,0,0,0,0,151,255,105,0,0,0,0,0,114,255,188,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,196,255,140,0,0,0,0,0,151,255,105,0,0,0,0,0,185,255,148,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,88,255,254,203,142,140,113,0,151,255,105,0,138,140,147,218,255,250,46,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,106,234,255,255,255,205,0,151,255,105,0,251,255,255,255,220,75,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,24,33,33,27,0,20,33,14,0,32,33,33,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+static const float DEFAULT_FONT_GLYPHS[] = { /* x0, y0, x1, y1, xoff, yoff, xadvance */
+  1,1,1,1,0,0,14.8327589,
+  2,1,5,18,6,-17,14.8327589,
+  6,1,15,9,3,-18,14.8327589,
+  16,1,31,18,0,-17,14.8327589,
+  32,1,46,21,0,-18,14.8327589,
+  47,1,62,19,0,-17,14.8327589,
+  63,1,78,19,0,-17,14.8327589,
+  79,1,82,9,6,-18,14.8327589,
+  83,1,90,25,4,-18,14.8327589,
+  91,1,98,25,4,-18,14.8327589,
+  99,1,109,10,2,-18,14.8327589,
+  110,1,123,14,1,-15,14.8327589,
+  124,1,130,10,3,-4,14.8327589,
+  131,1,138,4,4,-8,14.8327589,
+  139,1,143,5,5,-4,14.8327589,
+  144,1,157,20,1,-18,14.8327589,
+  158,1,171,19,1,-17,14.8327589,
+  172,1,185,18,1,-17,14.8327589,
+  186,1,199,18,1,-17,14.8327589,
+  200,1,213,19,1,-17,14.8327589,
+  214,1,227,18,1,-17,14.8327589,
+  228,1,241,19,1,-17,14.8327589,
+  1,26,14,44,1,-17,14.8327589,
+  15,26,27,43,1,-17,14.8327589,
+  28,26,41,44,1,-17,14.8327589,
+  42,26,55,44,1,-17,14.8327589,
+  56,26,60,40,5,-14,14.8327589,
+  61,26,67,45,4,-14,14.8327589,
+  68,26,81,40,1,-15,14.8327589,
+  82,26,95,35,1,-13,14.8327589,
+  96,26,109,40,1,-15,14.8327589,
+  110,26,122,43,1,-17,14.8327589,
+  123,26,138,48,0,-18,14.8327589,
+  139,26,154,43,0,-17,14.8327589,
+  155,26,168,43,1,-17,14.8327589,
+  169,26,182,44,1,-17,14.8327589,
+  183,26,196,43,1,-17,14.8327589,
+  197,26,210,43,1,-17,14.8327589,
+  211,26,223,43,2,-17,14.8327589,
+  224,26,237,44,1,-17,14.8327589,
+  238,26,250,43,1,-17,14.8327589,
+  1,49,12,66,2,-17,14.8327589,
+  13,49,23,67,2,-17,14.8327589,
+  24,49,38,66,1,-17,14.8327589,
+  39,49,51,66,2,-17,14.8327589,
+  52,49,65,66,1,-17,14.8327589,
+  66,49,78,66,1,-17,14.8327589,
+  79,49,92,67,1,-17,14.8327589,
+  93,49,106,66,1,-17,14.8327589,
+  107,49,120,71,1,-17,14.8327589,
+  121,49,135,66,1,-17,14.8327589,
+  136,49,150,67,0,-17,14.8327589,
+  151,49,165,66,0,-17,14.8327589,
+  166,49,179,67,1,-17,14.8327589,
+  180,49,195,66,0,-17,14.8327589,
+  196,49,211,66,0,-17,14.8327589,
+  212,49,227,66,0,-17,14.8327589,
+  228,49,243,66,0,-17,14.8327589,
+  1,72,15,89,0,-17,14.8327589,
+  16,72,24,96,4,-18,14.8327589,
+  25,72,38,91,1,-18,14.8327589,
+  39,72,46,96,3,-18,14.8327589,
+  47,72,60,84,1,-17,14.8327589,
+  61,72,77,74,-1,1,14.8327589,
+  78,72,84,76,4,-18,14.8327589,
+  85,72,98,87,1,-14,14.8327589,
+  99,72,111,91,2,-18,14.8327589,
+  112,72,125,87,1,-14,14.8327589,
+  126,72,138,91,1,-18,14.8327589,
+  139,72,152,87,1,-14,14.8327589,
+  153,72,166,90,1,-18,14.8327589,
+  167,72,179,92,1,-14,14.8327589,
+  180,72,191,90,2,-18,14.8327589,
+  192,72,205,90,1,-18,14.8327589,
+  206,72,216,96,1,-18,14.8327589,
+  217,72,229,90,2,-18,14.8327589,
+  230,72,243,90,1,-18,14.8327589,
+  1,97,14,111,1,-14,14.8327589,
+  15,97,26,111,2,-14,14.8327589,
+  27,97,40,112,1,-14,14.8327589,
+  41,97,53,117,2,-14,14.8327589,
+  54,97,66,117,1,-14,14.8327589,
+  67,97,78,111,2,-14,14.8327589,
+  79,97,90,112,2,-14,14.8327589,
+  91,97,102,115,2,-17,14.8327589,
+  103,97,114,112,2,-14,14.8327589,
+  115,97,129,111,0,-14,14.8327589,
+  130,97,145,111,0,-14,14.8327589,
+  146,97,159,111,1,-14,14.8327589,
+  160,97,175,117,0,-14,14.8327589,
+  176,97,188,111,1,-14,14.8327589,
+  189,97,200,121,2,-18,14.8327589,
+  201,97,204,121,6,-18,14.8327589,
+  205,97,216,121,2,-18,14.8327589,
+};
+#else
+#define DEFAULT_FONT_HEIGHT 14
+#define DEFAULT_FONT_ATLAS_WIDTH 256
+#define DEFAULT_FONT_ATLAS_HEIGHT 64
+static const unsigned char DEFAULT_FONT_ATLAS[] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,30,10,0,73,241,1,143,171,0,0,0,9,15,0,14,9,0,0,0,0,5,155,45,0,0,0,1,43,18,0,
+  0,0,37,0,0,0,0,5,37,15,0,0,0,0,229,85,0,0,37,218,25,0,154,129,0,0,0,0,0,163,26,0,
+  0,0,0,0,25,5,0,0,0,0,107,195,9,0,192,195,195,77,0,1,205,84,0,0,0,0,0,0,151,111,0,0,
+  0,14,56,33,0,0,0,0,0,0,13,25,0,0,0,0,0,16,57,40,0,0,0,0,0,16,58,40,1,0,0,0,
+  0,0,0,21,23,0,0,0,25,36,36,36,36,5,0,0,0,1,42,50,2,0,0,2,36,36,36,36,36,16,0,0,
+  0,18,57,37,0,0,0,0,0,16,52,4,0,0,0,1,135,56,0,1,135,56,0,0,0,0,0,0,0,13,0,4,
+  15,15,15,15,15,11,0,11,2,0,0,0,0,0,0,0,0,22,59,37,0,0,0,0,0,116,181,182,118,0,0,0,
+  0,0,0,34,15,0,0,0,0,1,36,36,32,11,0,0,0,0,0,5,47,45,2,0,0,0,0,0,0,0,0,0,
+  0,0,220,73,0,60,237,0,135,162,0,0,0,97,72,0,134,35,0,0,0,134,215,227,207,204,29,0,162,141,201,37,
+  0,96,130,0,0,0,24,207,151,207,71,0,0,0,224,73,0,1,198,95,0,0,15,229,51,0,0,72,130,184,102,136,
+  0,0,0,0,189,37,0,0,0,0,191,145,0,0,50,51,51,20,0,2,255,105,0,0,0,0,0,42,224,9,0,0,
+  65,225,172,212,150,0,0,0,0,38,207,176,0,0,0,0,82,230,170,207,189,8,0,0,90,234,182,223,193,8,0,0,
+  0,0,23,233,167,0,0,0,188,207,187,187,187,26,0,0,20,200,188,202,198,8,0,9,187,187,187,187,234,108,0,0,
+  97,216,149,188,184,7,0,0,87,229,171,191,99,0,0,2,255,105,0,2,255,105,0,0,0,0,1,71,178,154,0,64,
+  213,213,213,213,213,150,0,60,213,114,17,0,0,0,0,0,130,227,172,210,190,11,0,0,132,119,2,0,127,109,0,0,
+  0,0,42,249,159,0,0,0,0,6,255,207,207,245,177,12,0,0,56,229,196,210,200,18,0,0,0,0,0,0,0,0,
+  0,0,214,67,0,44,220,0,119,146,0,0,0,152,18,0,169,1,0,0,35,232,7,161,36,133,137,0,222,0,116,106,
+  31,190,5,0,0,0,100,133,0,92,143,0,0,0,207,56,0,73,217,3,0,0,0,115,178,0,0,9,78,244,152,29,
+  0,0,0,0,189,37,0,0,0,9,243,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,98,0,0,1,
+  212,75,0,8,220,60,0,21,212,195,146,176,0,0,0,1,228,70,0,3,215,81,0,3,233,69,0,4,229,82,0,0,
+  0,1,179,172,167,0,0,0,205,64,0,0,0,0,0,0,143,140,0,2,135,35,0,0,0,0,0,37,216,13,0,0,
+  235,53,0,0,212,81,0,3,239,58,0,17,228,10,0,0,70,29,0,0,70,29,0,0,16,112,213,169,61,0,0,0,
+  0,0,0,0,0,0,0,0,23,125,219,155,48,0,0,54,233,19,0,2,199,96,0,21,181,16,136,94,96,195,0,0,
+  0,0,138,135,235,11,0,0,0,6,255,33,0,11,231,96,0,1,214,115,0,1,165,129,0,0,0,0,0,0,0,0,
+  0,0,207,60,0,25,184,0,93,117,0,61,166,226,166,167,225,166,3,0,24,240,43,161,36,0,0,0,218,9,136,92,
+  182,42,0,0,0,0,73,168,82,203,44,0,0,0,173,36,0,159,131,0,0,0,0,27,249,13,0,0,156,85,198,22,
+  0,42,140,140,225,157,140,99,0,67,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,211,3,0,0,24,
+  245,3,0,0,146,126,0,4,16,0,103,176,0,0,0,0,4,1,0,1,217,70,0,0,2,0,0,10,223,60,0,0,
+  0,110,131,110,167,0,0,0,221,52,46,36,1,0,0,0,230,39,47,60,7,0,0,0,0,0,0,190,83,0,0,0,
+  213,74,0,6,223,57,0,28,251,1,0,0,171,65,0,0,0,0,0,0,0,0,0,57,225,132,28,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,5,88,199,149,0,23,47,0,0,0,194,95,0,109,93,169,50,135,177,169,17,0,
+  0,4,230,35,174,94,0,0,0,6,255,33,0,5,216,76,0,42,253,13,0,0,8,0,0,0,0,0,0,0,0,0,
+  0,0,201,54,0,0,0,0,0,0,0,0,10,163,0,43,128,0,0,0,0,84,215,245,175,81,1,0,88,183,166,121,
+  112,0,0,0,0,0,92,255,149,17,48,31,0,0,0,0,0,212,76,0,0,0,0,0,226,60,0,0,41,0,38,5,
+  0,25,84,84,211,109,84,59,0,20,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,200,76,0,0,0,52,
+  224,1,217,89,123,155,0,0,0,0,103,176,0,0,0,0,0,0,0,128,197,4,0,0,0,30,162,207,107,0,0,0,
+  45,189,4,110,167,0,0,0,238,212,173,216,191,11,0,7,254,164,150,181,213,17,0,0,0,0,70,206,1,0,0,0,
+  46,219,191,221,122,0,0,4,242,53,0,5,212,124,0,0,0,0,0,0,0,0,0,47,218,166,57,0,0,0,0,68,
+  228,228,228,228,228,160,0,0,0,0,21,122,220,126,0,0,0,0,4,143,193,9,0,148,69,178,0,90,134,147,39,0,
+  0,76,199,0,86,188,0,0,0,6,255,190,184,224,138,1,0,70,237,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,195,47,0,0,0,0,0,0,0,20,79,131,29,112,97,23,0,0,0,0,0,166,111,201,140,0,0,0,42,181,
+  130,179,188,15,0,82,202,106,178,0,162,70,0,0,0,0,0,232,56,0,0,0,0,0,205,80,0,0,0,0,0,0,
+  0,0,0,0,189,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,192,0,0,0,0,48,
+  227,1,166,68,127,150,0,0,0,0,103,176,0,0,0,0,0,3,146,198,19,0,0,0,0,16,87,138,212,35,0,8,
+  195,33,0,110,167,0,0,0,63,16,0,3,194,116,0,12,255,72,0,0,177,119,0,0,0,0,189,92,0,0,0,1,
+  184,136,41,74,219,51,0,0,98,232,161,193,195,121,0,1,205,84,0,2,195,114,0,0,3,79,186,202,94,7,0,0,
+  0,0,0,0,0,0,0,0,50,159,217,122,22,0,0,0,0,0,177,151,6,0,0,176,90,134,0,123,85,158,23,0,
+  0,173,145,52,62,248,30,0,0,6,255,76,50,77,199,114,0,64,242,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,114,25,0,0,0,0,0,0,0,92,197,155,137,214,140,107,0,0,48,61,0,161,36,42,228,0,0,5,189,32,
+  222,0,134,89,0,174,93,0,173,118,220,8,0,0,0,0,0,225,63,0,0,0,0,0,212,73,0,0,0,0,0,0,
+  0,0,0,0,173,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,218,54,0,0,0,0,19,
+  248,8,0,0,158,119,0,0,0,0,103,176,0,0,0,0,6,176,163,8,0,0,0,10,59,0,0,0,152,144,0,92,
+  234,199,199,223,236,157,0,0,1,0,0,0,139,149,0,0,237,41,0,0,135,145,0,0,0,26,245,14,0,0,0,36,
+  246,1,0,0,145,140,0,0,0,25,62,15,184,87,0,2,255,105,0,48,252,36,0,0,0,0,0,39,144,158,0,0,
+  0,0,0,0,0,0,0,69,187,81,3,0,0,0,0,0,0,36,195,2,0,0,0,170,97,131,0,190,40,177,2,0,
+  20,245,177,177,177,219,123,0,0,6,255,33,0,0,70,228,0,30,254,26,0,0,25,69,0,0,0,0,0,0,0,0,
+  0,0,48,15,0,0,0,0,0,0,0,0,162,7,0,171,0,0,0,0,40,216,44,162,42,128,184,0,0,130,94,2,
+  222,0,134,90,0,158,119,0,15,237,169,0,0,0,0,0,0,196,92,0,0,0,0,3,240,45,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,170,0,0,0,0,0,0,
+  190,105,0,26,233,36,0,0,0,0,103,176,0,0,0,0,155,162,1,0,0,0,0,15,245,62,0,10,210,120,0,7,
+  19,19,19,121,173,15,0,19,241,44,0,15,214,91,0,0,151,143,0,9,206,90,0,0,0,88,198,0,0,0,0,15,
+  247,44,0,2,191,109,0,0,158,68,0,54,233,10,0,0,0,0,0,113,168,0,0,0,0,0,0,0,0,2,0,0,
+  0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,16,48,0,0,0,0,140,79,196,116,195,122,130,0,0,
+  110,184,0,0,0,77,217,1,0,6,255,33,0,8,151,189,0,0,185,152,1,7,173,143,0,0,0,0,0,0,0,0,
+  0,0,228,71,0,0,0,0,0,0,0,0,169,0,10,160,0,0,0,0,0,71,159,237,211,151,24,0,54,169,0,0,
+  139,179,197,17,0,35,208,187,204,147,197,212,31,0,0,0,0,130,160,0,0,0,0,55,233,1,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,229,37,0,0,0,0,0,0,
+  40,208,211,229,102,0,0,12,223,223,236,245,223,183,0,27,254,231,225,225,225,122,0,0,81,226,211,244,175,11,0,0,
+  0,0,0,110,167,0,0,0,95,229,205,229,139,1,0,0,18,184,212,226,152,2,0,0,0,121,167,0,0,0,0,0,
+  89,221,188,213,166,7,0,0,78,233,209,219,62,0,0,0,0,0,0,178,49,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,224,0,0,0,0,60,146,46,58,20,72,4,0,0,
+  207,92,0,0,0,5,235,57,0,6,255,238,236,232,174,30,0,0,24,188,231,233,165,8,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,30,0,0,0,0,0,0,0,
+  0,8,1,0,0,0,0,18,9,0,0,11,0,0,0,0,0,31,239,22,0,0,0,164,129,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,25,0,0,0,0,0,0,0,
+  0,0,18,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,7,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,1,21,3,0,0,0,0,0,0,12,7,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,20,6,0,0,0,0,0,5,20,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,107,17,40,163,23,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,10,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,157,0,0,57,222,15,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,109,167,144,40,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,134,25,0,111,56,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,1,36,35,13,0,0,0,0,1,36,36,36,36,36,19,0,30,36,36,36,36,20,0,0,0,7,49,44,1,0,0,
+  1,36,5,0,0,26,16,0,28,36,36,36,36,7,0,0,3,36,36,34,0,1,36,5,0,0,17,31,0,0,20,21,
+  0,0,0,0,0,8,36,8,0,0,27,23,0,1,36,13,0,0,22,16,0,0,0,11,51,5,0,0,0,1,36,36,
+  35,11,0,0,0,0,0,11,51,5,0,0,0,1,36,36,36,16,0,0,0,0,0,0,24,60,46,3,0,0,19,36,
+  36,36,36,36,34,0,5,36,0,0,0,21,20,0,33,11,0,0,0,0,32,12,0,35,5,0,0,0,0,26,14,0,
+  17,27,0,0,0,12,32,0,0,26,18,0,0,0,3,36,5,0,4,36,36,36,36,36,25,0,128,231,214,166,0,22,
+  220,20,0,0,0,0,0,79,214,219,227,0,0,0,0,34,12,0,0,0,2,64,64,64,64,64,64,64,28,0,58,180,
+  20,0,0,16,120,154,95,17,0,0,215,49,0,0,0,0,0,0,2,91,153,140,44,0,0,0,0,0,0,0,0,0,
+  0,6,255,211,227,219,84,0,0,6,255,211,204,204,204,107,0,211,221,204,204,204,112,0,0,61,231,195,224,197,15,0,
+  6,255,33,0,0,184,110,0,160,204,249,218,204,38,0,0,15,204,214,242,0,6,255,33,0,23,222,96,0,0,145,149,
+  0,0,0,0,0,56,255,115,0,8,238,161,0,6,255,157,0,0,154,110,0,0,72,241,213,220,114,1,0,6,255,207,
+  205,248,188,21,0,0,72,241,213,220,114,1,0,6,255,207,201,241,205,34,0,0,0,130,222,163,194,214,24,0,111,204,
+  204,248,218,204,194,0,36,255,2,0,0,153,140,0,178,128,0,0,0,25,250,30,0,229,57,0,0,0,0,207,79,0,
+  37,236,38,0,0,179,132,0,0,96,211,5,0,0,111,199,2,0,24,204,204,204,204,240,166,0,134,143,0,0,0,0,
+  131,143,0,0,0,0,0,0,0,40,237,0,0,0,47,227,147,0,0,0,3,84,84,84,84,84,84,84,37,0,0,54,
+  135,0,0,179,154,52,138,164,0,0,225,52,0,0,0,0,0,0,144,180,68,109,241,43,0,0,0,0,0,0,0,0,
+  0,6,255,33,0,61,242,52,0,6,255,33,0,0,0,0,0,211,82,0,0,0,0,0,2,217,109,0,1,186,107,0,
+  6,255,33,0,0,184,110,0,0,0,223,71,0,0,0,0,0,0,50,242,0,6,255,33,8,199,126,0,0,0,145,149,
+  0,0,0,0,0,56,213,210,0,88,215,161,0,6,245,226,26,0,154,110,0,6,228,118,1,38,233,46,0,6,255,33,
+  0,11,196,147,0,6,228,118,1,38,233,46,0,6,255,33,0,4,176,163,0,0,12,252,27,0,0,156,92,0,0,0,
+  0,221,71,0,0,0,36,255,2,0,0,153,140,0,83,218,0,0,0,113,188,0,0,190,90,0,0,0,0,238,40,0,
+  0,109,193,1,89,209,6,0,0,1,189,117,0,25,235,45,0,0,0,0,0,0,51,230,34,0,134,143,0,0,0,0,
+  14,228,34,0,0,0,0,0,0,40,237,0,0,0,153,74,212,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,36,12,0,23,245,4,0,225,67,125,130,23,0,0,8,251,23,0,0,70,37,0,0,0,0,0,0,0,0,
+  0,6,255,33,0,0,147,151,0,6,255,33,0,0,0,0,0,211,82,0,0,0,0,0,43,252,11,0,0,2,0,0,
+  6,255,33,0,0,184,110,0,0,0,223,71,0,0,0,0,0,0,50,242,0,6,255,34,168,156,0,0,0,0,145,149,
+  0,0,0,0,0,56,189,197,53,184,135,161,0,6,253,124,138,0,154,110,0,58,255,25,0,0,176,112,0,6,255,33,
+  0,0,120,178,0,58,255,25,0,0,176,112,0,6,255,33,0,0,123,177,0,0,11,247,76,0,0,0,0,0,0,0,
+  0,221,71,0,0,0,36,255,2,0,0,153,140,0,7,236,54,0,0,202,92,0,0,150,124,0,142,51,15,250,5,0,
+  0,2,190,125,229,48,0,0,0,0,37,235,30,166,133,0,0,0,0,0,0,19,221,75,0,0,134,143,0,0,0,0,
+  0,109,167,0,0,0,0,0,0,40,237,0,0,16,209,2,124,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,90,204,198,198,255,9,0,225,185,70,92,239,17,0,43,242,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,6,255,33,0,0,106,187,0,6,255,178,166,166,166,27,0,211,120,56,56,56,22,0,70,236,0,16,65,65,42,0,
+  6,255,194,185,185,235,110,0,0,0,223,71,0,0,0,0,0,0,50,242,0,6,255,163,252,33,0,0,0,0,145,149,
+  0,0,0,0,0,56,190,102,156,205,88,161,0,6,255,19,229,16,154,110,0,86,231,0,0,0,127,177,0,6,255,36,
+  5,48,216,104,0,87,231,0,0,0,127,177,0,6,255,118,98,129,232,66,0,0,0,88,228,214,144,52,0,0,0,0,
+  0,221,71,0,0,0,36,255,2,0,0,153,140,0,0,147,144,0,38,241,10,0,0,110,157,31,236,140,47,215,0,0,
+  0,0,34,252,137,0,0,0,0,0,0,122,209,218,9,0,0,0,0,0,2,183,131,0,0,0,134,143,0,0,0,0,
+  0,6,219,52,0,0,0,0,0,40,237,0,0,111,118,0,25,207,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,20,252,42,0,27,255,9,0,225,98,0,0,176,75,0,31,251,3,0,0,1,0,0,0,0,0,0,0,0,0,
+  0,6,255,33,0,0,137,179,0,6,255,95,71,71,71,11,0,211,209,188,188,188,75,0,63,251,9,45,181,217,164,0,
+  6,255,87,61,61,201,110,0,0,0,223,71,0,0,0,0,0,0,50,242,0,6,255,189,162,196,4,0,0,0,145,149,
+  0,0,0,0,0,56,190,15,242,113,88,161,0,6,255,1,144,120,154,110,0,81,240,1,0,0,135,185,0,6,255,232,
+  228,200,111,2,0,83,240,1,0,0,135,187,0,6,255,151,169,232,32,0,0,0,0,0,2,51,126,241,96,0,0,0,
+  0,221,71,0,0,0,36,255,2,0,0,153,140,0,0,52,231,3,127,156,0,0,0,70,190,100,131,206,79,175,0,0,
+  0,0,107,220,207,6,0,0,0,0,0,5,233,88,0,0,0,0,0,0,129,185,3,0,0,0,134,143,0,0,0,0,
+  0,0,87,190,0,0,0,0,0,40,237,0,1,209,21,0,0,171,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,29,248,13,0,126,255,18,0,225,61,0,0,145,130,0,2,214,88,0,8,223,87,0,0,0,0,0,0,0,0,
+  0,6,255,33,0,0,203,138,0,6,255,33,0,0,0,0,0,211,82,0,0,0,0,0,28,254,58,0,0,122,164,0,
+  6,255,33,0,0,184,110,0,0,0,223,71,0,0,0,45,17,0,59,237,0,6,255,37,9,209,136,0,0,0,145,149,
+  0,0,0,0,0,56,190,0,67,17,88,161,0,6,255,1,31,226,159,110,0,50,255,36,0,0,181,152,0,6,255,33,
+  0,0,0,0,0,51,255,36,0,0,181,154,0,6,255,33,4,205,109,0,0,0,12,34,0,0,0,110,193,0,0,0,
+  0,221,71,0,0,0,25,255,12,0,0,166,125,0,0,0,211,68,215,61,0,0,0,30,219,166,54,199,128,136,0,0,
+  0,35,232,32,171,130,0,0,0,0,0,0,220,69,0,0,0,0,0,74,223,20,0,0,0,0,134,143,0,0,0,0,
+  0,0,1,203,74,0,0,0,0,40,237,0,11,67,0,0,0,34,45,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,155,218,199,91,203,200,0,225,69,0,0,156,99,0,0,49,207,200,232,149,2,0,0,0,0,0,0,0,0,
+  0,6,255,33,31,135,244,30,0,6,255,33,0,0,0,0,0,211,82,0,0,0,0,0,0,185,174,26,0,138,164,0,
+  6,255,33,0,0,184,110,0,0,0,223,71,0,0,0,163,128,0,130,195,0,6,255,33,0,38,240,74,0,0,145,149,
+  0,0,0,0,0,56,190,0,0,0,88,161,0,6,255,1,0,165,231,110,0,1,213,153,12,72,239,58,0,6,255,33,
+  0,0,0,0,0,1,216,153,12,72,239,64,0,6,255,33,0,50,240,36,0,0,51,225,26,0,1,154,163,0,0,0,
+  0,221,71,0,0,0,1,234,82,0,17,227,77,0,0,0,116,184,219,1,0,0,0,1,233,208,3,131,213,96,0,0,
+  2,194,110,0,23,232,52,0,0,0,0,0,220,69,0,0,0,0,34,231,54,0,0,0,0,0,134,143,0,0,0,0,
+  0,0,0,65,211,3,0,0,0,40,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,13,7,0,1,8,0,226,140,0,6,218,37,0,0,0,0,15,7,0,0,0,0,0,0,0,0,0,0,
+  0,6,255,242,238,192,52,0,0,6,255,242,240,240,240,185,0,211,82,0,0,0,0,0,0,24,191,242,225,200,64,0,
+  6,255,33,0,0,184,110,0,187,240,253,244,240,44,0,38,199,226,229,56,0,6,255,33,0,0,84,234,28,0,145,249,
+  240,240,240,153,0,56,190,0,0,0,88,161,0,6,255,1,0,48,254,110,0,0,43,211,240,242,113,0,0,6,255,33,
+  0,0,0,0,0,0,43,211,240,243,115,0,0,6,255,33,0,0,139,194,2,0,0,109,201,206,225,186,26,0,0,0,
+  0,221,71,0,0,0,0,81,232,218,239,152,1,0,0,0,24,251,125,0,0,0,0,0,205,170,0,63,255,56,0,0,
+  114,197,2,0,0,93,212,7,0,0,0,0,220,69,0,0,0,0,141,252,240,240,240,240,233,0,134,143,0,0,0,0,
+  0,0,0,0,182,98,0,0,0,40,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,229,131,183,197,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,13,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,2,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,135,198,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,7,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,1,22,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,143,0,0,0,0,
+  0,0,0,0,13,21,0,0,0,40,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,3,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,19,222,195,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,174,70,54,0,0,
+  0,0,0,0,0,0,0,26,70,99,237,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,13,72,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,144,144,112,0,0,
+  0,0,0,0,0,0,0,53,144,144,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,193,72,0,0,3,97,154,128,31,0,0,0,0,16,173,228,229,140,0,0,11,120,141,55,95,47,
+  0,215,51,0,0,0,0,0,0,0,0,173,121,0,0,0,0,0,0,39,244,11,0,140,124,0,0,0,0,0,0,85,
+  219,235,108,0,0,0,52,78,138,85,64,154,43,0,122,34,130,154,72,0,0,0,0,45,136,89,8,0,0,122,42,139,
+  151,62,0,0,0,1,74,149,69,103,44,0,65,75,36,144,160,44,0,4,74,141,138,44,0,0,0,30,15,0,0,0,
+  0,119,27,0,0,103,45,0,64,99,0,0,0,44,120,0,112,33,0,0,0,0,110,33,0,18,131,12,0,0,95,67,
+  0,66,90,0,0,0,33,121,0,0,0,118,135,135,135,135,30,0,0,0,92,221,214,86,0,194,50,0,212,221,174,6,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,202,75,0,0,147,177,52,95,230,19,0,0,0,118,188,8,0,3,0,0,172,167,58,144,224,83,
+  0,225,53,0,0,0,0,0,0,0,0,37,26,0,0,0,0,0,0,8,52,2,0,147,130,0,0,0,0,0,0,0,
+  0,164,113,0,0,0,95,227,78,230,158,138,168,0,227,186,74,91,246,30,0,0,128,176,52,96,229,8,0,226,191,69,
+  91,240,37,0,0,151,164,58,141,236,77,0,87,192,206,119,95,34,0,98,174,61,77,225,19,0,0,160,63,0,0,0,
+  0,225,52,0,0,194,84,0,44,246,16,0,0,158,146,0,178,91,0,0,0,1,240,28,0,0,140,156,0,64,217,15,
+  0,40,238,11,0,0,139,146,0,0,0,69,79,79,131,234,24,0,0,0,231,53,0,0,0,203,53,0,0,2,201,79,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,1,74,140,60,202,75,0,8,251,23,0,0,170,109,0,23,135,204,198,135,135,62,0,8,252,30,0,6,237,83,
+  0,225,70,132,153,69,0,0,0,70,135,135,67,0,0,0,0,67,135,135,135,6,0,147,130,0,1,115,54,0,0,0,
+  0,164,113,0,0,0,93,186,0,207,83,63,196,0,225,86,0,0,205,77,0,0,216,26,0,0,176,69,0,225,99,0,
+  0,173,116,0,0,222,25,0,4,237,77,0,62,255,60,0,0,0,0,166,132,3,0,4,0,0,115,228,165,135,115,0,
+  0,225,52,0,0,194,84,0,0,197,104,0,14,243,42,0,135,131,5,184,77,28,238,0,0,0,5,197,99,218,49,0,
+  0,0,181,100,0,6,232,40,0,0,0,0,0,28,222,59,0,0,0,0,248,22,0,0,0,203,53,0,0,0,171,97,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,151,163,57,134,234,75,0,40,253,212,212,212,230,138,0,14,84,184,169,84,84,39,0,28,254,3,0,0,202,83,
+  0,225,190,74,91,245,29,0,0,43,84,185,126,0,0,0,0,42,84,91,255,11,0,147,130,0,141,170,3,0,0,0,
+  0,164,113,0,0,0,93,168,0,203,57,59,200,0,225,53,0,0,194,84,0,33,244,0,0,0,141,138,0,225,62,0,
+  0,144,141,0,23,249,0,0,0,209,77,0,58,235,0,0,0,0,0,43,197,236,171,65,0,0,71,228,126,84,71,0,
+  0,225,52,0,0,194,84,0,0,95,201,0,103,191,0,0,92,170,69,176,172,70,193,0,0,0,0,36,253,129,0,0,
+  0,0,69,205,0,85,186,0,0,0,0,0,12,206,92,0,0,0,0,0,248,22,0,0,0,203,53,0,0,0,171,97,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,222,26,0,4,237,75,0,23,252,5,0,0,0,0,0,0,0,149,128,0,0,0,0,17,255,13,0,0,222,83,
+  0,225,86,0,0,205,77,0,0,0,0,151,126,0,0,0,0,0,0,11,255,11,0,147,130,117,181,6,0,0,0,0,
+  0,164,113,0,0,0,93,167,0,203,56,59,200,0,225,52,0,0,194,84,0,28,253,5,0,0,154,131,0,225,69,0,
+  0,154,129,0,8,247,5,0,0,225,77,0,58,219,0,0,0,0,0,0,0,24,99,235,51,0,0,214,63,0,0,0,
+  0,225,53,0,0,204,84,0,0,9,238,43,202,87,0,0,49,205,150,63,203,117,148,0,0,0,0,145,175,219,19,0,
+  0,0,1,212,54,185,79,0,0,0,0,2,176,130,0,0,0,0,0,33,247,8,0,0,0,203,53,0,0,0,149,137,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,23,249,0,0,0,209,75,0,1,209,95,0,1,123,41,0,0,0,149,128,0,0,0,0,0,217,97,0,83,245,83,
+  0,225,53,0,0,194,84,0,0,0,0,151,126,0,0,0,0,0,0,11,255,11,0,147,209,254,59,0,0,0,0,0,
+  0,164,113,0,0,0,93,167,0,203,56,59,200,0,225,52,0,0,194,84,0,2,216,84,0,10,224,65,0,225,141,0,
+  6,216,76,0,0,199,72,0,49,253,77,0,58,219,0,0,0,0,0,136,23,0,0,185,80,0,0,214,63,0,0,0,
+  0,205,87,0,36,246,84,0,0,0,146,159,231,6,0,0,9,231,204,3,139,206,104,0,0,0,80,204,7,117,179,1,
+  0,0,0,101,185,221,3,0,0,0,0,139,169,1,0,0,0,0,105,221,87,0,0,0,0,203,53,0,0,0,25,199,
+  183,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,8,247,4,0,0,223,75,0,0,47,208,193,212,164,8,0,0,0,149,128,0,0,0,0,0,59,202,203,124,193,81,
+  0,225,52,0,0,194,84,0,0,0,0,151,126,0,0,0,0,0,0,11,255,11,0,147,180,90,219,14,0,0,0,0,
+  0,164,113,0,0,0,93,167,0,203,56,59,200,0,225,52,0,0,194,84,0,0,54,212,186,216,126,0,0,225,152,188,
+  213,168,4,0,0,71,197,187,172,205,77,0,58,219,0,0,0,0,0,97,215,180,201,166,5,0,0,214,63,0,0,0,
+  0,93,237,193,170,183,88,0,0,0,44,253,133,0,0,0,0,217,157,0,61,255,59,0,0,32,226,38,0,2,186,117,
+  0,0,0,9,235,119,0,0,0,0,26,255,221,214,214,214,95,0,43,159,180,0,0,0,0,203,53,0,0,0,79,216,
+  83,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,199,69,0,48,254,75,0,0,0,0,17,8,0,0,0,0,0,149,128,0,0,0,0,0,18,22,0,0,217,29,
+  0,225,52,0,0,194,84,0,0,0,0,151,126,0,0,0,0,0,0,11,255,11,0,147,130,0,149,169,0,0,0,0,
+  0,164,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,3,0,0,0,225,53,10,
+  14,0,0,0,0,0,1,28,0,202,77,0,0,0,0,0,0,0,0,0,4,24,8,0,0,0,0,196,88,0,0,0,
+  0,0,8,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,26,232,19,0,0,0,0,0,0,0,0,0,0,0,0,0,7,252,17,0,0,0,203,53,0,0,0,166,108,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,72,196,186,162,195,78,0,0,0,0,0,0,0,0,0,0,0,149,128,0,0,0,0,0,113,215,87,130,198,0,
+  0,225,52,0,0,194,84,0,30,219,219,240,237,219,172,0,0,0,0,11,255,11,0,147,130,0,8,209,106,0,42,219,
+  219,242,235,219,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,53,0,
+  0,0,0,0,0,0,0,0,0,202,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,229,211,217,29,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,84,197,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,22,0,0,0,203,53,0,0,0,171,97,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,1,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,81,131,72,4,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,246,3,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,30,0,
+  0,0,0,0,0,0,0,0,0,114,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,19,1,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,136,93,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,29,0,0,0,203,53,0,0,0,178,96,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,102,93,190,163,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,149,70,28,0,203,53,0,69,91,236,48,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,123,138,94,6,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,128,144,58,0,115,30,0,143,140,74,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+static const float DEFAULT_FONT_GLYPHS[] = { /* x0, y0, x1, y1, xoff, yoff, xadvance */
+  1,1,1,1,0,0,7.41637945,
+  2,1,4,10,3,-9,7.41637945,
+  5,1,10,5,1,-9,7.41637945,
+  11,1,19,10,0,-9,7.41637945,
+  20,1,27,11,0,-9,7.41637945,
+  28,1,36,11,0,-9,7.41637945,
+  37,1,45,11,0,-9,7.41637945,
+  46,1,48,5,3,-9,7.41637945,
+  49,1,53,13,2,-9,7.41637945,
+  54,1,58,13,2,-9,7.41637945,
+  59,1,64,6,1,-9,7.41637945,
+  65,1,72,8,0,-8,7.41637945,
+  73,1,77,6,1,-2,7.41637945,
+  78,1,82,3,2,-4,7.41637945,
+  83,1,86,3,2,-2,7.41637945,
+  87,1,94,11,0,-9,7.41637945,
+  95,1,102,11,0,-9,7.41637945,
+  103,1,110,10,0,-9,7.41637945,
+  111,1,118,10,0,-9,7.41637945,
+  119,1,126,11,0,-9,7.41637945,
+  127,1,134,10,0,-9,7.41637945,
+  135,1,142,11,0,-9,7.41637945,
+  143,1,150,11,0,-9,7.41637945,
+  151,1,158,10,0,-9,7.41637945,
+  159,1,166,11,0,-9,7.41637945,
+  167,1,174,11,0,-9,7.41637945,
+  175,1,178,8,2,-7,7.41637945,
+  179,1,182,11,2,-7,7.41637945,
+  183,1,190,9,0,-8,7.41637945,
+  191,1,198,6,0,-7,7.41637945,
+  199,1,206,9,0,-8,7.41637945,
+  207,1,214,10,0,-9,7.41637945,
+  215,1,223,12,0,-9,7.41637945,
+  224,1,232,10,0,-9,7.41637945,
+  233,1,240,10,0,-9,7.41637945,
+  241,1,248,11,0,-9,7.41637945,
+  1,14,8,23,0,-9,7.41637945,
+  9,14,16,23,0,-9,7.41637945,
+  17,14,23,23,1,-9,7.41637945,
+  24,14,31,24,0,-9,7.41637945,
+  32,14,39,23,0,-9,7.41637945,
+  40,14,46,23,1,-9,7.41637945,
+  47,14,52,24,1,-9,7.41637945,
+  53,14,61,23,0,-9,7.41637945,
+  62,14,68,23,1,-9,7.41637945,
+  69,14,76,23,0,-9,7.41637945,
+  77,14,84,23,0,-9,7.41637945,
+  85,14,92,24,0,-9,7.41637945,
+  93,14,100,23,0,-9,7.41637945,
+  101,14,108,26,0,-9,7.41637945,
+  109,14,117,23,0,-9,7.41637945,
+  118,14,125,24,0,-9,7.41637945,
+  126,14,133,23,0,-9,7.41637945,
+  134,14,141,24,0,-9,7.41637945,
+  142,14,150,23,0,-9,7.41637945,
+  151,14,159,23,0,-9,7.41637945,
+  160,14,168,23,0,-9,7.41637945,
+  169,14,177,23,0,-9,7.41637945,
+  178,14,185,23,0,-9,7.41637945,
+  186,14,190,26,2,-9,7.41637945,
+  191,14,198,24,0,-9,7.41637945,
+  199,14,203,26,1,-9,7.41637945,
+  204,14,211,21,0,-9,7.41637945,
+  212,14,221,16,-1,0,7.41637945,
+  222,14,225,16,2,-9,7.41637945,
+  226,14,233,22,0,-7,7.41637945,
+  234,14,240,24,1,-9,7.41637945,
+  241,14,248,22,0,-7,7.41637945,
+  1,27,8,37,0,-9,7.41637945,
+  9,27,16,35,0,-7,7.41637945,
+  17,27,24,36,0,-9,7.41637945,
+  25,27,32,37,0,-7,7.41637945,
+  33,27,39,36,1,-9,7.41637945,
+  40,27,47,36,0,-9,7.41637945,
+  48,27,54,39,0,-9,7.41637945,
+  55,27,61,36,1,-9,7.41637945,
+  62,27,69,36,0,-9,7.41637945,
+  70,27,77,34,0,-7,7.41637945,
+  78,27,84,34,1,-7,7.41637945,
+  85,27,92,35,0,-7,7.41637945,
+  93,27,99,37,1,-7,7.41637945,
+  100,27,107,37,0,-7,7.41637945,
+  108,27,114,34,1,-7,7.41637945,
+  115,27,121,35,1,-7,7.41637945,
+  122,27,128,37,1,-9,7.41637945,
+  129,27,135,35,1,-7,7.41637945,
+  136,27,143,34,0,-7,7.41637945,
+  144,27,152,34,0,-7,7.41637945,
+  153,27,160,34,0,-7,7.41637945,
+  161,27,169,37,0,-7,7.41637945,
+  170,27,177,34,0,-7,7.41637945,
+  178,27,184,39,1,-9,7.41637945,
+  185,27,187,39,3,-9,7.41637945,
+  188,27,194,39,1,-9,7.41637945,
+};
+#endif
@@ -6,11 +6,16 @@
 #ifdef USE_DEFAULT_FONT
 #include "default_font.h"
 #endif
+#include "draw.h"
 #include "font.h"
 #include "screen.h"
 #include "texture.h"
+#include "util.h"
+#include <math.h>
 #include <string.h>
 
+#define CIRCLE_POINTS 64
+
 typedef struct {
     char name[STRING_SIZE];
     float height;
@@ -19,11 +24,24 @@ typedef struct {
 
 static LoadedFont* _loaded_fonts = NULL;
 static Font* _active_font = NULL;
+static bool_t _distance_field_fonts = FALSE;
 #ifdef USE_DEFAULT_FONT
 static Font* _default_font = NULL;
 #endif
+static lvert_t* _batch_verts = NULL; /* primitives waiting to be drawn with the same texture and mode */
+static const ltex_t* _batch_tex = NULL;
+static lrendermode_t _batch_mode = R_TRIANGLES;
+static float _draw_color[4] = { 1, 1, 1, 1 };
+static float _unit_circle[CIRCLE_POINTS][2];
+static bool_t _unit_circle_ready = FALSE;
+
+static lvert_t* _AddDrawVerts(const ltex_t* tex, lrendermode_t mode, int count);
+static void _AddDrawQuad(const ltex_t* tex, float x, float y, float width, float height, float u0, float v0, float u1, float v1);
+static lvert_t _DrawVert(float x, float y, float u, float v);
 
 EXPORT void CALL wzSetup2D() {
+    _FlushDraw2D();
+    _draw_color[0] = _draw_color[1] = _draw_color[2] = _draw_color[3] = 1;
 #ifndef PLATFORM_NULL
     lgfx_setup2d(wzGetScreenWidth(), wzGetScreenHeight());
 #else
@@ -32,19 +50,22 @@ EXPORT void CALL wzSetup2D() {
 }
 
 EXPORT void CALL wzSetViewport(int x, int y, int w, int h) {
+    _FlushDraw2D();
     lgfx_setviewport(x, y, w, h);
 }
 
 EXPORT void CALL wzSetResolution(int w, int h) {
+    _FlushDraw2D();
     lgfx_setresolution(w, h);
 }
 
 EXPORT void CALL wzSetDrawColor(int color) {
-    lgfx_setcolor(
-        wzGetRed(color) / 255.0f,
-        wzGetGreen(color) / 255.0f,
-        wzGetBlue(color) / 255.0f,
-        wzGetAlpha(color) / 255.0f);
+    /* batched primitives keep the color in their vertices, so they do not need to be drawn yet */
+    _draw_color[0] = wzGetRed(color) / 255.0f;
+    _draw_color[1] = wzGetGreen(color) / 255.0f;
+    _draw_color[2] = wzGetBlue(color) / 255.0f;
+    _draw_color[3] = wzGetAlpha(color) / 255.0f;
+    lgfx_setcolor(_draw_color[0], _draw_color[1], _draw_color[2], _draw_color[3]);
 }
 
 EXPORT void CALL wzSetDrawFont(const char* filename, float height) {
@@ -53,14 +74,32 @@ EXPORT void CALL wzSetDrawFont(const char* filename, float height) {
 
     /* search for already loaded font */
     for (i = 0; i < sb_count(_loaded_fonts); ++i) {
-        if (strcmp(_loaded_fonts[i].name, filename) == 0 && _loaded_fonts[i].height == height) {
+        if (strcmp(_loaded_fonts[i].name, filename) == 0
+                && _loaded_fonts[i].height == height
+                && IsDistanceFieldFont(_loaded_fonts[i].font) == _distance_field_fonts) {
             _active_font = _loaded_fonts[i].font;
             return;
         }
     }
 
-    /* load font */
-    font = LoadFont(filename, height);
+    /* load font. distance field fonts of any height share the atlas of the file */
+    if (_distance_field_fonts) {
+        for (i = 0; i < sb_count(_loaded_fonts); ++i) {
+            if (strcmp(_loaded_fonts[i].name, filename) == 0 && IsDistanceFieldFont(_loaded_fonts[i].font)) {
+                font = CreateScaledFont(_loaded_fonts[i].font, height);
+                break;
+            }
+        }
+        if (!font) {
+            Font* base = LoadDistanceFieldFont(filename);
+            if (base) {
+                font = CreateScaledFont(base, height);
+                ReleaseFont(base);
+            }
+        }
+    } else {
+        font = LoadFont(filename, height);
+    }
     if (font) {
         LoadedFont data;
 
@@ -73,7 +112,16 @@ EXPORT void CALL wzSetDrawFont(const char* filename, float height) {
     }
 }
 
+EXPORT void CALL wzSetDistanceFieldFonts(bool_t enable) {
+    _distance_field_fonts = enable;
+}
+
+EXPORT bool_t CALL wzGetDistanceFieldFonts() {
+    return _distance_field_fonts;
+}
+
 EXPORT void CALL wzClearScreen(int color) {
+    _FlushDraw2D();
     lgfx_clearcolorbuffer(
         wzGetRed(color) / 255.0f,
         wzGetGreen(color) / 255.0f,
@@ -83,12 +131,17 @@ EXPORT void CALL wzClearScreen(int color) {
 
 EXPORT void CALL wzSetDefaultFont() {
 #ifdef USE_DEFAULT_FONT
-#ifdef USE_RETINA
-    float font_height = 28;
-#else
-    float font_height = 14;
-#endif
-    _default_font = _LoadBase64Font(DEFAULT_FONT, DEFAULT_FONT_BLOCKSIZE, font_height);
+    /* the glyphs are baked by stuff/gen_defaultfont.cc, so loading only uploads the atlas */
+    if (!_default_font) {
+        _default_font = _LoadBase64Font(
+            DEFAULT_FONT,
+            DEFAULT_FONT_BLOCKSIZE,
+            DEFAULT_FONT_HEIGHT,
+            DEFAULT_FONT_ATLAS,
+            DEFAULT_FONT_ATLAS_WIDTH,
+            DEFAULT_FONT_ATLAS_HEIGHT,
+            DEFAULT_FONT_GLYPHS);
+    }
     _active_font = _default_font;
 #else
     _active_font = NULL;
@@ -96,28 +149,70 @@ EXPORT void CALL wzSetDefaultFont() {
 }
 
 EXPORT void CALL wzDrawPoint(float x, float y) {
-    lgfx_drawpoint(x, y);
+    *_AddDrawVerts(NULL, R_POINTS, 1) = _DrawVert(x, y, 0, 0);
 }
 
 EXPORT void CALL wzDrawLine(float x1, float y1, float x2, float y2) {
-    lgfx_drawline(x1, y1, x2, y2);
+    lvert_t* verts = _AddDrawVerts(NULL, R_LINES, 2);
+    verts[0] = _DrawVert(x1, y1, 0, 0);
+    verts[1] = _DrawVert(x2, y2, 0, 0);
 }
 
 EXPORT void CALL wzDrawEllipse(float x, float y, float width, float height) {
-    lgfx_drawoval(x, y, width, height);
+    lvert_t* verts;
+    float centerx, centery, halfwidth, halfheight;
+    int i;
+
+    if (!_unit_circle_ready) {
+        for (i = 0; i < CIRCLE_POINTS; ++i) {
+            _unit_circle[i][0] = (float)cos(i * 6.28318530718f / CIRCLE_POINTS);
+            _unit_circle[i][1] = (float)sin(i * 6.28318530718f / CIRCLE_POINTS);
+        }
+        _unit_circle_ready = TRUE;
+    }
+
+    /* triangulate as a fan from the first point of the outline */
+    centerx = x + width * 0.5f;
+    centery = y + height * 0.5f;
+    halfwidth = width * 0.5f;
+    halfheight = height * 0.5f;
+    verts = _AddDrawVerts(NULL, R_TRIANGLES, (CIRCLE_POINTS - 2) * 3);
+    for (i = 1; i < CIRCLE_POINTS - 1; ++i) {
+        verts[0] = _DrawVert(centerx + _unit_circle[0][0] * halfwidth, centery + _unit_circle[0][1] * halfheight, 0, 0);
+        verts[1] = _DrawVert(centerx + _unit_circle[i][0] * halfwidth, centery + _unit_circle[i][1] * halfheight, 0, 0);
+        verts[2] = _DrawVert(centerx + _unit_circle[i+1][0] * halfwidth, centery + _unit_circle[i+1][1] * halfheight, 0, 0);
+        verts += 3;
+    }
 }
 
 EXPORT void CALL wzDrawRect(float x, float y, float width, float height) {
-    lgfx_drawrect(x, y, width, height);
+    _AddDrawQuad(NULL, x, y, width, height, 0, 0, 0, 0);
 }
 
 EXPORT void CALL wzDrawTexture(const Texture* tex, float x, float y, float width, float height) {
     const ltex_t* ltex = (const ltex_t*)_GetTexturePtr(tex);
-    ltex_drawrotsized(ltex, x, y, 0, 0, 0, width != 0 ? width : ltex->width, height != 0 ? height : ltex->height, 0, 0, 1, 1);
+    const Texture* atlas;
+    float u0, v0, u1, v1;
+
+    if (width == 0) width = (float)ltex->width;
+    if (height == 0) height = (float)ltex->height;
+
+    /* streamed textures need the levels for the size they are drawn at */
+    _RequestTextureSize(tex, _Max(fabs(width), fabs(height)));
+
+    /* textures packed into an atlas are drawn from their region of the page */
+    atlas = _GetTextureAtlas(tex, &u0, &v0, &u1, &v1);
+    _UpdateTextureMipmaps(atlas ? atlas : tex);
+    _AddDrawQuad(
+        atlas ? (const ltex_t*)_GetTexturePtr(atlas) : ltex,
+        x, y,
+        width, height,
+        u0, v0, u1, v1);
 }
 
 EXPORT void CALL wzDrawText(const char* text, float x, float y) {
     if (_active_font) {
+        _FlushDraw2D();
         DrawFont(_active_font, text, x, y);
     }
 }
@@ -138,6 +233,49 @@ EXPORT float CALL wzGetTextHeight(const char* text) {
     }
 }
 
+EXPORT Text* CALL wzCreateText(const char* string) {
+    if (_active_font) {
+        return CreateText(_active_font, string);
+    } else {
+        return NULL;
+    }
+}
+
+EXPORT void CALL wzDeleteText(Text* text) {
+    DeleteText(text);
+}
+
+EXPORT void CALL wzSetTextString(Text* text, const char* string) {
+    SetTextString(text, string);
+}
+
+EXPORT const char* CALL wzGetTextString(const Text* text) {
+    return GetTextString(text);
+}
+
+EXPORT float CALL wzGetTextObjectWidth(const Text* text) {
+    return GetTextObjectWidth(text);
+}
+
+EXPORT float CALL wzGetTextObjectHeight(const Text* text) {
+    return GetTextObjectHeight(text);
+}
+
+EXPORT void CALL wzDrawTextObject(Text* text, float x, float y) {
+    _FlushDraw2D();
+    DrawTextObject(text, x, y);
+}
+
+void _FlushDraw2D() {
+    if (sb_count(_batch_verts) == 0) return;
+    ltex_bind(_batch_tex, 0, 0);
+    lgfx_setusevertexcolor(TRUE);
+    lvert_draw(_batch_verts, sb_count(_batch_verts), _batch_mode);
+    lgfx_setusevertexcolor(FALSE);
+    lgfx_setcolor(_draw_color[0], _draw_color[1], _draw_color[2], _draw_color[3]);
+    stb__sbn(_batch_verts) = 0;
+}
+
 EXPORT void CALL _UnloadFonts() {
     int i;
 
@@ -150,3 +288,24 @@ EXPORT void CALL _UnloadFonts() {
     _default_font = NULL;
 #endif
 }
+
+static lvert_t* _AddDrawVerts(const ltex_t* tex, lrendermode_t mode, int count) {
+    if (tex != _batch_tex || mode != _batch_mode) _FlushDraw2D();
+    _batch_tex = tex;
+    _batch_mode = mode;
+    return sb_add(_batch_verts, count);
+}
+
+static void _AddDrawQuad(const ltex_t* tex, float x, float y, float width, float height, float u0, float v0, float u1, float v1) {
+    lvert_t* verts = _AddDrawVerts(tex, R_TRIANGLES, 6);
+    verts[0] = _DrawVert(x, y, u0, v0);
+    verts[1] = _DrawVert(x + width, y, u1, v0);
+    verts[2] = _DrawVert(x, y + height, u0, v1);
+    verts[3] = verts[2];
+    verts[4] = verts[1];
+    verts[5] = _DrawVert(x + width, y + height, u1, v1);
+}
+
+static lvert_t _DrawVert(float x, float y, float u, float v) {
+    return lvert(x, y, 0, 0, 0, -1, u, v, _draw_color[0], _draw_color[1], _draw_color[2], _draw_color[3]);
+}
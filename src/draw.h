@@ -14,6 +14,8 @@ EXPORT void CALL wzSetResolution(int w, int h);
 EXPORT void CALL wzSetDrawColor(int color);
 EXPORT void CALL wzSetDrawFont(const char* filename, float height);
 EXPORT void CALL wzSetDefaultFont();
+EXPORT void CALL wzSetDistanceFieldFonts(bool_t enable);
+EXPORT bool_t CALL wzGetDistanceFieldFonts();
 EXPORT void CALL wzClearScreen(int color);
 EXPORT void CALL wzDrawPoint(float x, float y);
 EXPORT void CALL wzDrawLine(float x1, float y1, float x2, float y2);
@@ -25,7 +27,16 @@ EXPORT void CALL wzDrawText(const char* text, float x, float y);
 EXPORT float CALL wzGetTextWidth(const char* text);
 EXPORT float CALL wzGetTextHeight(const char* text);
 
+EXPORT Text* CALL wzCreateText(const char* string);
+EXPORT void CALL wzDeleteText(Text* text);
+EXPORT void CALL wzSetTextString(Text* text, const char* string);
+EXPORT const char* CALL wzGetTextString(const Text* text);
+EXPORT float CALL wzGetTextObjectWidth(const Text* text);
+EXPORT float CALL wzGetTextObjectHeight(const Text* text);
+EXPORT void CALL wzDrawTextObject(Text* text, float x, float y);
+
 #ifndef SWIG
+void _FlushDraw2D(); /* draws the batched primitives */
 EXPORT void CALL _UnloadFonts();
 #endif
 
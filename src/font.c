@@ -3,13 +3,41 @@
 #include "../lib/base64/base64.h"
 #endif
 #include "../lib/litelibs/litegfx.h"
+#include "../lib/stb/stb_rect_pack.h"
 #include "../lib/stb/stb_truetype.h"
+#include "../lib/stb/stretchy_buffer.h"
 #include "font.h"
 #include "memblock.h"
 #include "util.h"
 #include <stdio.h>
 #include <string.h>
 
+#define SDF_HEIGHT      48 /* height at which distance field atlases are baked */
+#define SDF_PADDING     2
+#define GLYPH_PAGE_SIZE 512 /* glyphs out of the baked range are rasterized into pages of this size */
+#define GLYPH_MAX_PAGES 4
+#define GLYPH_BUCKETS   256
+
+typedef struct {
+    ltex_t* tex;
+    stbrp_context context;
+    stbrp_node nodes[GLYPH_PAGE_SIZE];
+    unsigned int last_used;
+} GlyphPage;
+
+typedef struct {
+    int codepoint;
+    int page; /* -1 if the glyph has no pixels */
+    stbtt_bakedchar glyph;
+    int next; /* next glyph in the same bucket, or -1 */
+} CachedGlyph;
+
+typedef struct {
+    const ltex_t* tex;
+    int first;
+    int count;
+} FontBatch;
+
 typedef struct SFont
 {
     size_t                    refcount;
@@ -17,23 +45,68 @@ typedef struct SFont
     stbtt_bakedchar glyphs[94];
     float                     height;
     float                     maxheight;
+    float                     scale; /* of the drawn glyphs relative to the atlas */
+    bool_t                    sdf;
+    Font*                     base; /* font that owns the atlas, or NULL */
+    unsigned char*            data; /* font file, to rasterize glyphs on first use */
+    stbtt_fontinfo            info;
+    GlyphPage**               pages;
+    CachedGlyph*              cached_glyphs;
+    int                       buckets[GLYPH_BUCKETS]; /* first glyph of each bucket, or -1 */
+    unsigned int              generation; /* increased when glyphs are evicted */
 } Font;
 
+typedef struct SText {
+    Font* font;
+    char* string;
+    lvert_t* verts; /* laid out at position x, y */
+    FontBatch* batches;
+    unsigned int generation; /* of the font when the text was laid out */
+    float x, y;
+    float width;
+    float height;
+} Text;
+
+#define METRICS_CACHE_SIZE 32
+
+typedef struct {
+    const Font* font; /* NULL if the entry is free */
+    unsigned int hash;
+    char text[STRING_SIZE];
+    float width;
+    float height;
+    unsigned int last_used;
+} TextMetrics;
+
+static lvert_t* _font_verts = NULL; /* reused by all draw calls */
+static FontBatch* _font_batches = NULL;
+static TextMetrics _text_metrics[METRICS_CACHE_SIZE]; /* recently measured texts */
+static unsigned int _text_metrics_time = 0;
+static unsigned int _glyph_time = 0; /* increased on every text laid out or measured */
+
+static Font* _CreateFont(const Memblock* memblock, float height, bool_t sdf);
+static float _GetMaxGlyphHeight(const Font* font);
+static void _LayoutText(Text* text);
+static void _DrawFontVerts(const Font* font, const lvert_t* verts, const FontBatch* batches);
+static void _AddFontVerts(Font* font, const char* text, float x, float y, lvert_t** verts, FontBatch** batches);
+static void _MeasureFontText(Font* font, const char* text, float* width, float* height);
+static const TextMetrics* _GetTextMetrics(Font* font, const char* text);
+static int _DecodeUTF8(const char** text);
+static const stbtt_bakedchar* _GetFontGlyph(Font* font, int codepoint, const ltex_t** tex);
+static int _CacheFontGlyph(Font* font, int codepoint);
+static int _AllocGlyphRect(Font* font, int width, int height, int* x, int* y);
+static GlyphPage* _CreateGlyphPage(bool_t sdf);
+static void _ClearGlyphPage(Font* font, int page);
+static void _UpdateGlyphBuckets(Font* font);
 
 Font* CreateFontFromMemblock(const Memblock* memblock, float height) {
     Font* font;
     int w, h;
     unsigned char* alphabuffer;
-    unsigned char* colorbuffer;
-    size_t len, i;
-    float x = 0, y = 0;
-    float miny = 999999, maxy = -999999;
-    stbtt_aligned_quad q;
 
     /* create font object */
-    font = _Alloc(Font);
-    font->refcount = 1;
-    font->height = height;
+    font = _CreateFont(memblock, height, FALSE);
+    if (!font) return NULL;
 
     /* bake font into alpha buffer */
     w = h = 256;
@@ -53,30 +126,128 @@ Font* CreateFontFromMemblock(const Memblock* memblock, float height) {
         alphabuffer = (unsigned char*)realloc(alphabuffer, w * h);
     }
 
-    /* copy into color buffer */
-    colorbuffer = _AllocMany(unsigned char, w*h*4);
-    memset(colorbuffer, 255, w*h*4);
-    for (i = 0; i < w*h; ++i) colorbuffer[i*4 + 3] = alphabuffer[i];
+    /* create alpha texture, which gets its color from the drawing color */
+    font->tex = ltex_alloc(w, h, FALSE, TF_A8);
+    ltex_setpixels(font->tex, alphabuffer);
     free(alphabuffer);
 
-    /* create texture */
-    font->tex = ltex_alloc(w, h, FALSE);
-    ltex_setpixels(font->tex, colorbuffer);
-    free(colorbuffer);
+    font->maxheight = _GetMaxGlyphHeight(font);
 
-    /* get max char height */
-    font->maxheight = -999999;
-    len = sizeof(font->glyphs) / sizeof(font->glyphs[0]);
-    for (i = 0; i < len; ++i) {
-        stbtt_GetBakedQuad(font->glyphs, font->tex->width, font->tex->height, i, &x, &y, &q, TRUE);
-        miny = _Min(miny, q.y0);
-        maxy = _Max(maxy, q.y1);
+    return font;
+}
+
+Font* CreateBakedFontFromMemblock(const Memblock* memblock, float height, const unsigned char* atlas, int atlas_width, int atlas_height, const float* glyphs) {
+    Font* font;
+    int i;
+
+    font = _CreateFont(memblock, height, FALSE);
+    if (!font) return NULL;
+
+    /* glyphs have been baked in advance with stbtt_BakeFontBitmap */
+    for (i = 0; i < 94; ++i) {
+        font->glyphs[i].x0 = (unsigned short)glyphs[i*7];
+        font->glyphs[i].y0 = (unsigned short)glyphs[i*7 + 1];
+        font->glyphs[i].x1 = (unsigned short)glyphs[i*7 + 2];
+        font->glyphs[i].y1 = (unsigned short)glyphs[i*7 + 3];
+        font->glyphs[i].xoff = glyphs[i*7 + 4];
+        font->glyphs[i].yoff = glyphs[i*7 + 5];
+        font->glyphs[i].xadvance = glyphs[i*7 + 6];
+    }
+    font->tex = ltex_alloc(atlas_width, atlas_height, FALSE, TF_A8);
+    ltex_setpixels(font->tex, atlas);
+    font->maxheight = _GetMaxGlyphHeight(font);
+
+    return font;
+}
+
+Font* CreateDistanceFieldFontFromMemblock(const Memblock* memblock) {
+    stbrp_context context;
+    stbrp_node* nodes;
+    stbrp_rect rects[94];
+    unsigned char* bitmaps[94];
+    int widths[94], heights[94], xoffs[94], yoffs[94], advances[94];
+    Font* font;
+    unsigned char* alphabuffer;
+    float scale;
+    float miny = 999999, maxy = -999999;
+    int w, h, i, y;
+
+    font = _CreateFont(memblock, SDF_HEIGHT, TRUE);
+    if (!font) return NULL;
+
+    /* get the distance field of each glyph with its padding. it saturates one pixel inside the edge, so glyphs are opaque when blended */
+    scale = stbtt_ScaleForPixelHeight(&font->info, SDF_HEIGHT);
+    for (i = 0; i < 94; ++i) {
+        int lsb;
+        memset(&rects[i], 0, sizeof(stbrp_rect));
+        bitmaps[i] = stbtt_GetCodepointSDF(&font->info, scale, 32 + i, SDF_PADDING, 128, 128.0f, &widths[i], &heights[i], &xoffs[i], &yoffs[i]);
+        if (!bitmaps[i]) widths[i] = heights[i] = xoffs[i] = yoffs[i] = 0;
+        stbtt_GetCodepointHMetrics(&font->info, 32 + i, &advances[i], &lsb);
+        rects[i].id = i;
+        rects[i].w = widths[i];
+        rects[i].h = heights[i];
+    }
+
+    /* pack glyphs, growing the atlas until all of them fit */
+    w = h = 256;
+    nodes = _AllocMany(stbrp_node, 4096);
+    for (;;) {
+        stbrp_init_target(&context, w, h, nodes, _Min(w, 4096));
+        if (stbrp_pack_rects(&context, rects, 94)) break;
+        if (w == h) w *= 2;
+        else h *= 2;
+    }
+    free(nodes);
+
+    /* fill atlas, with the glyph rects and offsets excluding the padding */
+    alphabuffer = _AllocMany(unsigned char, w * h);
+    memset(alphabuffer, 0, w * h);
+    for (i = 0; i < 94; ++i) {
+        stbtt_bakedchar* glyph = &font->glyphs[i];
+        if (bitmaps[i]) {
+            for (y = 0; y < rects[i].h; ++y) {
+                memcpy(&alphabuffer[(rects[i].y + y) * w + rects[i].x], &bitmaps[i][y * rects[i].w], rects[i].w);
+            }
+            stbtt_FreeSDF(bitmaps[i], NULL);
+            glyph->x0 = rects[i].x + SDF_PADDING;
+            glyph->y0 = rects[i].y + SDF_PADDING;
+            glyph->x1 = rects[i].x + rects[i].w - SDF_PADDING;
+            glyph->y1 = rects[i].y + rects[i].h - SDF_PADDING;
+            glyph->xoff = (float)(xoffs[i] + SDF_PADDING);
+            glyph->yoff = (float)(yoffs[i] + SDF_PADDING);
+            miny = _Min(miny, glyph->yoff);
+            maxy = _Max(maxy, glyph->yoff + glyph->y1 - glyph->y0);
+        } else {
+            glyph->x0 = glyph->y0 = glyph->x1 = glyph->y1 = 0;
+            glyph->xoff = glyph->yoff = 0;
+        }
+        glyph->xadvance = advances[i] * scale;
     }
     font->maxheight = maxy - miny;
 
+    /* the distance to the glyph edges is stored as alpha, so it must be interpolated */
+    font->tex = ltex_alloc(w, h, F_LINEAR, TF_A8);
+    ltex_setpixels(font->tex, alphabuffer);
+    free(alphabuffer);
+
     return font;
 }
 
+Font* CreateScaledFont(Font* font, float height) {
+    Font* scaled;
+
+    if (font->base) font = font->base;
+    scaled = _Alloc(Font);
+    *scaled = *font;
+    scaled->refcount = 1;
+    scaled->height = height;
+    scaled->scale = height / font->height;
+    scaled->maxheight = font->maxheight * scaled->scale;
+    scaled->base = font;
+    RetainFont(font);
+    return scaled;
+}
+
 Font* LoadFont(const char* filename, float height) {
     Memblock* memblock;
     Font* font = NULL;
@@ -90,13 +261,43 @@ Font* LoadFont(const char* filename, float height) {
     return font;
 }
 
+Font* LoadDistanceFieldFont(const char* filename) {
+    Memblock* memblock;
+    Font* font = NULL;
+
+    memblock = wzLoadMemblock(filename);
+    if (memblock) {
+        font = CreateDistanceFieldFontFromMemblock(memblock);
+        wzDeleteMemblock(memblock);
+    }
+
+    return font;
+}
+
 void RetainFont(Font* font) {
     ++font->refcount;
 }
 
 void ReleaseFont(Font* font) {
     if (--font->refcount == 0) {
-        ltex_free(font->tex);
+        int i;
+
+        /* a new font could get the same address */
+        for (i = 0; i < METRICS_CACHE_SIZE; ++i) {
+            if (_text_metrics[i].font == font) memset(&_text_metrics[i], 0, sizeof(TextMetrics));
+        }
+        if (font->base) {
+            ReleaseFont(font->base);
+        } else {
+            for (i = 0; i < sb_count(font->pages); ++i) {
+                ltex_free(font->pages[i]->tex);
+                free(font->pages[i]);
+            }
+            sb_free(font->pages);
+            sb_free(font->cached_glyphs);
+            free(font->data);
+            ltex_free(font->tex);
+        }
         free(font);
     }
 }
@@ -105,54 +306,435 @@ float GetFontHeight(const Font* font) {
     return font->height;
 }
 
-float GetFontTextWidth(const Font* font, const char* text) {
+bool_t IsDistanceFieldFont(const Font* font) {
+    return font->sdf;
+}
+
+float GetFontTextWidth(Font* font, const char* text) {
+    return _GetTextMetrics(font, text)->width;
+}
+
+float GetFontTextHeight(Font* font, const char* text) {
+    return _GetTextMetrics(font, text)->height;
+}
+
+void DrawFont(Font* font, const char* text, float x, float y) {
+    if (_font_verts) stb__sbn(_font_verts) = 0;
+    if (_font_batches) stb__sbn(_font_batches) = 0;
+    _AddFontVerts(font, text, x, y, &_font_verts, &_font_batches);
+    _DrawFontVerts(font, _font_verts, _font_batches);
+}
+
+Text* CreateText(Font* font, const char* string) {
+    Text* text;
+
+    text = _Alloc(Text);
+    text->font = font;
+    text->string = NULL;
+    text->verts = NULL;
+    text->batches = NULL;
+    RetainFont(font);
+    SetTextString(text, string);
+    return text;
+}
+
+void DeleteText(Text* text) {
+    ReleaseFont(text->font);
+    sb_free(text->verts);
+    sb_free(text->batches);
+    free(text->string);
+    free(text);
+}
+
+void SetTextString(Text* text, const char* string) {
+    if (text->string && strcmp(text->string, string) == 0) return;
+
+    /* lay out the glyphs once, they only need to be moved when drawn somewhere else */
+    free(text->string);
+    text->string = _AllocMany(char, strlen(string) + 1);
+    strcpy(text->string, string);
+    text->x = 0;
+    text->y = 0;
+    _LayoutText(text);
+    _MeasureFontText(text->font, string, &text->width, &text->height);
+}
+
+const char* GetTextString(const Text* text) {
+    return text->string;
+}
+
+float GetTextObjectWidth(const Text* text) {
+    return text->width;
+}
+
+float GetTextObjectHeight(const Text* text) {
+    return text->height;
+}
+
+void DrawTextObject(Text* text, float x, float y) {
+    /* the glyphs of the text could have been evicted from the cache since it was laid out */
+    if (text->generation != (text->font->base ? text->font->base : text->font)->generation) _LayoutText(text);
+    if (sb_count(text->verts) == 0) return;
+    if (x != text->x || y != text->y) {
+        int i;
+
+        for (i = 0; i < sb_count(text->verts); ++i) {
+            text->verts[i].pos[0] += x - text->x;
+            text->verts[i].pos[1] += y - text->y;
+        }
+        text->x = x;
+        text->y = y;
+    }
+    _DrawFontVerts(text->font, text->verts, text->batches);
+}
+
+#ifdef USE_DEFAULT_FONT
+Font* _LoadBase64Font(const char* data, size_t size, float height, const unsigned char* atlas, int atlas_width, int atlas_height, const float* glyphs) {
+    Memblock* memblock;
+    Font* font;
+
+    memblock = wzCreateMemblock(BASE64_DECODE_OUT_SIZE(size));
+    base64_decode(data, size, (unsigned char*)memblock);
+    font = CreateBakedFontFromMemblock(memblock, height, atlas, atlas_width, atlas_height, glyphs);
+    wzDeleteMemblock(memblock);
+
+    return font;
+}
+#endif
+
+static Font* _CreateFont(const Memblock* memblock, float height, bool_t sdf) {
+    Font* font;
+    int i;
+
+    /* keep a copy of the font file, since glyphs are rasterized as they are used */
+    font = _Alloc(Font);
+    memset(font, 0, sizeof(Font));
+    font->data = _AllocMany(unsigned char, wzGetMemblockSize(memblock));
+    memcpy(font->data, memblock, wzGetMemblockSize(memblock));
+    if (!stbtt_InitFont(&font->info, font->data, stbtt_GetFontOffsetForIndex(font->data, 0))) {
+        free(font->data);
+        free(font);
+        return NULL;
+    }
+    font->refcount = 1;
+    font->height = height;
+    font->scale = 1;
+    font->sdf = sdf;
+    for (i = 0; i < GLYPH_BUCKETS; ++i) font->buckets[i] = -1;
+    return font;
+}
+
+static float _GetMaxGlyphHeight(const Font* font) {
     float x = 0, y = 0;
-    stbtt_aligned_quad q = { 0 };
-    size_t len, i;
+    float miny = 999999, maxy = -999999;
+    stbtt_aligned_quad q;
+    int i;
 
-    len = strlen(text);
-    for (i = 0; i < len; ++i) {
-        stbtt_GetBakedQuad(font->glyphs, font->tex->width, font->tex->height, _Min(text[i] - 32, 94), &x, &y, &q, TRUE);
+    for (i = 0; i < 94; ++i) {
+        stbtt_GetBakedQuad(font->glyphs, font->tex->width, font->tex->height, i, &x, &y, &q, TRUE);
+        miny = _Min(miny, q.y0);
+        maxy = _Max(maxy, q.y1);
+    }
+    return maxy - miny;
+}
+
+static void _LayoutText(Text* text) {
+    if (text->verts) stb__sbn(text->verts) = 0;
+    if (text->batches) stb__sbn(text->batches) = 0;
+    _AddFontVerts(text->font, text->string, text->x, text->y, &text->verts, &text->batches);
+    text->generation = (text->font->base ? text->font->base : text->font)->generation;
+}
+
+static void _DrawFontVerts(const Font* font, const lvert_t* verts, const FontBatch* batches) {
+    int i;
+
+    if (sb_count(verts) == 0) return;
+
+    /* distance field glyphs are cut where the distance crosses the edge value */
+    if (font->sdf) lgfx_setalphatest(0.5f);
+    for (i = 0; i < sb_count(batches); ++i) {
+        ltex_bind(batches[i].tex, 0, 0);
+        lvert_draw(&verts[batches[i].first], batches[i].count, R_TRIANGLES);
     }
-    return q.x1;
+    if (font->sdf) lgfx_setalphatest(0);
 }
 
-float GetFontTextHeight(const Font* font, const char* text) {
+static void _AddFontVerts(Font* font, const char* text, float x, float y, lvert_t** verts, FontBatch** batches) {
+    Font* owner = font->base ? font->base : font;
+
+    /* add two triangles per visible glyph, and draw glyphs on the same texture at once */
+    ++_glyph_time;
+    x /= font->scale;
+    y = (y + font->maxheight) / font->scale;
+    while (*text) {
+        const stbtt_bakedchar* glyph;
+        const ltex_t* tex;
+        lvert_t* v;
+        stbtt_aligned_quad q;
+
+        glyph = _GetFontGlyph(owner, _DecodeUTF8(&text), &tex);
+        if (!glyph) continue;
+        stbtt_GetBakedQuad(glyph, tex->width, tex->height, 0, &x, &y, &q, TRUE);
+        if (q.x0 == q.x1 || q.y0 == q.y1) continue;
+        q.x0 *= font->scale;
+        q.y0 *= font->scale;
+        q.x1 *= font->scale;
+        q.y1 *= font->scale;
+        if (sb_count(*batches) == 0 || sb_last(*batches).tex != tex) {
+            FontBatch batch;
+            batch.tex = tex;
+            batch.first = sb_count(*verts);
+            batch.count = 0;
+            sb_push(*batches, batch);
+        }
+        sb_last(*batches).count += 6;
+        v = sb_add(*verts, 6);
+        v[0] = lvert(q.x0, q.y0, 0, 0, 0, -1, q.s0, q.t0, 1, 1, 1, 1);
+        v[1] = lvert(q.x1, q.y0, 0, 0, 0, -1, q.s1, q.t0, 1, 1, 1, 1);
+        v[2] = lvert(q.x0, q.y1, 0, 0, 0, -1, q.s0, q.t1, 1, 1, 1, 1);
+        v[3] = v[2];
+        v[4] = v[1];
+        v[5] = lvert(q.x1, q.y1, 0, 0, 0, -1, q.s1, q.t1, 1, 1, 1, 1);
+    }
+}
+
+static void _MeasureFontText(Font* font, const char* text, float* width, float* height) {
+    Font* owner = font->base ? font->base : font;
     float x = 0, y = 0, miny = 999999, maxy = -999999;
     stbtt_aligned_quad q = { 0 };
-    size_t len, i;
 
-    len = strlen(text);
-    for (i = 0; i < len; ++i) {
-        stbtt_GetBakedQuad(font->glyphs, font->tex->width, font->tex->height, _Min(text[i] - 32, 94), &x, &y, &q, TRUE);
+    ++_glyph_time;
+    while (*text) {
+        const stbtt_bakedchar* glyph;
+        const ltex_t* tex;
+
+        glyph = _GetFontGlyph(owner, _DecodeUTF8(&text), &tex);
+        if (!glyph) continue;
+        stbtt_GetBakedQuad(glyph, tex->width, tex->height, 0, &x, &y, &q, TRUE);
         miny = _Min(miny, q.y0);
         maxy = _Max(maxy, q.y1);
     }
-    return maxy - miny;
+    *width = q.x1 * font->scale;
+    *height = (maxy >= miny) ? (maxy - miny) * font->scale : 0;
 }
 
-void DrawFont(const Font* font, const char* text, float x, float y) {
+static const TextMetrics* _GetTextMetrics(Font* font, const char* text) {
+    static TextMetrics uncached;
+    TextMetrics* metrics;
+    unsigned int hash = 5381;
     size_t len, i;
+    int oldest = 0;
 
-    y += font->maxheight;
+    /* texts that do not fit in the cache are measured every time */
     len = strlen(text);
-    for (i = 0; i < len; ++i) {
-        stbtt_aligned_quad q;
-        stbtt_GetBakedQuad(font->glyphs, font->tex->width, font->tex->height, _Min(text[i] - 32, 94), &x, &y, &q, TRUE);
-        ltex_drawrotsized(font->tex, q.x0, q.y0, 0, 0, 0, q.x1 - q.x0, q.y1 - q.y0, q.s0, q.t0, q.s1, q.t1);
+    if (len >= STRING_SIZE) {
+        _MeasureFontText(font, text, &uncached.width, &uncached.height);
+        return &uncached;
     }
+
+    /* look for the text, keeping track of the least recently used entry */
+    for (i = 0; i < len; ++i) hash = hash * 33 + (unsigned char)text[i];
+    for (i = 0; i < METRICS_CACHE_SIZE; ++i) {
+        metrics = &_text_metrics[i];
+        if (metrics->font == font && metrics->hash == hash && strcmp(metrics->text, text) == 0) {
+            metrics->last_used = ++_text_metrics_time;
+            return metrics;
+        }
+        if (metrics->last_used < _text_metrics[oldest].last_used) oldest = (int)i;
+    }
+
+    /* replace the least recently used entry */
+    metrics = &_text_metrics[oldest];
+    metrics->font = font;
+    metrics->hash = hash;
+    strcpy(metrics->text, text);
+    _MeasureFontText(font, text, &metrics->width, &metrics->height);
+    metrics->last_used = ++_text_metrics_time;
+    return metrics;
 }
 
-#ifdef USE_DEFAULT_FONT
-Font* _LoadBase64Font(const char* data, size_t size, float height) {
-    Memblock* memblock;
-    Font* font;
+static int _DecodeUTF8(const char** text) {
+    const unsigned char* c = (const unsigned char*)*text;
+    int codepoint, extra, i;
 
-    memblock = wzCreateMemblock(BASE64_DECODE_OUT_SIZE(size));
-    base64_decode(data, size, (unsigned char*)memblock);
-    font = CreateFontFromMemblock(memblock, height);
-    wzDeleteMemblock(memblock);
+    if (c[0] < 0x80) {
+        codepoint = c[0];
+        extra = 0;
+    } else if ((c[0] & 0xe0) == 0xc0) {
+        codepoint = c[0] & 0x1f;
+        extra = 1;
+    } else if ((c[0] & 0xf0) == 0xe0) {
+        codepoint = c[0] & 0x0f;
+        extra = 2;
+    } else if ((c[0] & 0xf8) == 0xf0) {
+        codepoint = c[0] & 0x07;
+        extra = 3;
+    } else {
+        *text += 1;
+        return 0xfffd;
+    }
 
-    return font;
+    /* a truncated sequence stops before the next character, or the terminator */
+    for (i = 1; i <= extra; ++i) {
+        if ((c[i] & 0xc0) != 0x80) {
+            *text += i;
+            return 0xfffd;
+        }
+        codepoint = (codepoint << 6) | (c[i] & 0x3f);
+    }
+    *text += extra + 1;
+    return codepoint;
+}
+
+static const stbtt_bakedchar* _GetFontGlyph(Font* font, int codepoint, const ltex_t** tex) {
+    CachedGlyph* cached;
+    int i;
+
+    /* glyphs in the baked range are always in the font texture */
+    if (codepoint < 32) return NULL;
+    if (codepoint < 32 + 94) {
+        *tex = font->tex;
+        return &font->glyphs[codepoint - 32];
+    }
+
+    /* rasterize the rest the first time they are used */
+    for (i = font->buckets[codepoint % GLYPH_BUCKETS]; i != -1; i = font->cached_glyphs[i].next) {
+        if (font->cached_glyphs[i].codepoint == codepoint) break;
+    }
+    if (i == -1) i = _CacheFontGlyph(font, codepoint);
+    if (i == -1) return NULL;
+    cached = &font->cached_glyphs[i];
+    if (cached->page != -1) {
+        font->pages[cached->page]->last_used = _glyph_time;
+        *tex = font->pages[cached->page]->tex;
+    } else {
+        *tex = font->tex;
+    }
+    return &cached->glyph;
+}
+
+static int _CacheFontGlyph(Font* font, int codepoint) {
+    CachedGlyph cached;
+    unsigned char* bitmap;
+    float scale;
+    int padding, advance, lsb;
+    int w = 0, h = 0, xoff = 0, yoff = 0;
+
+    /* rasterize glyph the same way as the baked ones */
+    scale = stbtt_ScaleForPixelHeight(&font->info, font->height);
+    padding = font->sdf ? SDF_PADDING : 0;
+    if (font->sdf) bitmap = stbtt_GetCodepointSDF(&font->info, scale, codepoint, SDF_PADDING, 128, 128.0f, &w, &h, &xoff, &yoff);
+    else bitmap = stbtt_GetCodepointBitmap(&font->info, 0, scale, codepoint, &w, &h, &xoff, &yoff);
+    stbtt_GetCodepointHMetrics(&font->info, codepoint, &advance, &lsb);
+    memset(&cached, 0, sizeof(CachedGlyph));
+    cached.codepoint = codepoint;
+    cached.page = -1;
+    cached.glyph.xadvance = advance * scale;
+
+    /* upload its pixels to a page */
+    if (bitmap && w > 0 && h > 0) {
+        int x, y;
+
+        cached.page = _AllocGlyphRect(font, w, h, &x, &y);
+        if (cached.page != -1) {
+            ltex_setregion(font->pages[cached.page]->tex, x, y, w, h, bitmap, w);
+            cached.glyph.x0 = x + padding;
+            cached.glyph.y0 = y + padding;
+            cached.glyph.x1 = x + w - padding;
+            cached.glyph.y1 = y + h - padding;
+            cached.glyph.xoff = (float)(xoff + padding);
+            cached.glyph.yoff = (float)(yoff + padding);
+        }
+    }
+    if (bitmap && font->sdf) stbtt_FreeSDF(bitmap, NULL);
+    else if (bitmap) stbtt_FreeBitmap(bitmap, NULL);
+    if (bitmap && cached.page == -1) return -1;
+
+    cached.next = font->buckets[codepoint % GLYPH_BUCKETS];
+    font->buckets[codepoint % GLYPH_BUCKETS] = sb_count(font->cached_glyphs);
+    sb_push(font->cached_glyphs, cached);
+    return sb_count(font->cached_glyphs) - 1;
+}
+
+static int _AllocGlyphRect(Font* font, int width, int height, int* x, int* y) {
+    stbrp_rect rect;
+    int page = -1;
+    int i;
+
+    /* leave a pixel between glyphs so they do not bleed into each other */
+    if (width + 1 > GLYPH_PAGE_SIZE || height + 1 > GLYPH_PAGE_SIZE) return -1;
+    memset(&rect, 0, sizeof(stbrp_rect));
+    rect.w = width + 1;
+    rect.h = height + 1;
+    for (i = 0; i < sb_count(font->pages); ++i) {
+        stbrp_pack_rects(&font->pages[i]->context, &rect, 1);
+        if (rect.was_packed) {
+            *x = rect.x;
+            *y = rect.y;
+            return i;
+        }
+    }
+
+    /* add a page, or clear the least recently used one if it is not used by the current text */
+    if (sb_count(font->pages) < GLYPH_MAX_PAGES) {
+        page = sb_count(font->pages);
+        sb_push(font->pages, _CreateGlyphPage(font->sdf));
+    } else {
+        for (i = 0; i < sb_count(font->pages); ++i) {
+            if (font->pages[i]->last_used == _glyph_time) continue;
+            if (page == -1 || font->pages[i]->last_used < font->pages[page]->last_used) page = i;
+        }
+        if (page == -1) return -1;
+        _ClearGlyphPage(font, page);
+    }
+    stbrp_pack_rects(&font->pages[page]->context, &rect, 1);
+    *x = rect.x;
+    *y = rect.y;
+    return page;
+}
+
+static GlyphPage* _CreateGlyphPage(bool_t sdf) {
+    GlyphPage* page;
+    unsigned char* pixels;
+
+    page = _Alloc(GlyphPage);
+    page->tex = ltex_alloc(GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE, sdf ? F_LINEAR : F_NONE, TF_A8);
+    pixels = _AllocMany(unsigned char, GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE);
+    memset(pixels, 0, GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE);
+    ltex_setpixels(page->tex, pixels);
+    free(pixels);
+    stbrp_init_target(&page->context, GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE, page->nodes, GLYPH_PAGE_SIZE);
+    page->last_used = 0;
+    return page;
+}
+
+static void _ClearGlyphPage(Font* font, int page) {
+    unsigned char* pixels;
+    int i, count = 0;
+
+    /* clear pixels, so filtering does not pick the evicted glyphs */
+    pixels = _AllocMany(unsigned char, GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE);
+    memset(pixels, 0, GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE);
+    ltex_setpixels(font->pages[page]->tex, pixels);
+    free(pixels);
+    stbrp_init_target(&font->pages[page]->context, GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE, font->pages[page]->nodes, GLYPH_PAGE_SIZE);
+
+    /* remove its glyphs */
+    for (i = 0; i < sb_count(font->cached_glyphs); ++i) {
+        if (font->cached_glyphs[i].page != page) font->cached_glyphs[count++] = font->cached_glyphs[i];
+    }
+    stb__sbn(font->cached_glyphs) = count;
+    _UpdateGlyphBuckets(font);
+    ++font->generation;
+}
+
+static void _UpdateGlyphBuckets(Font* font) {
+    int i;
+
+    for (i = 0; i < GLYPH_BUCKETS; ++i) font->buckets[i] = -1;
+    for (i = 0; i < sb_count(font->cached_glyphs); ++i) {
+        int bucket = font->cached_glyphs[i].codepoint % GLYPH_BUCKETS;
+        font->cached_glyphs[i].next = font->buckets[bucket];
+        font->buckets[bucket] = i;
+    }
 }
-#endif
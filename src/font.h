@@ -11,16 +11,28 @@ extern "C" {
 #ifndef SWIG
 
 Font* CreateFontFromMemblock(const Memblock* memblock, float height);
+Font* CreateBakedFontFromMemblock(const Memblock* memblock, float height, const unsigned char* atlas, int atlas_width, int atlas_height, const float* glyphs);
+Font* CreateDistanceFieldFontFromMemblock(const Memblock* memblock);
+Font* CreateScaledFont(Font* font, float height);
 Font* LoadFont(const char* filename, float height);
+Font* LoadDistanceFieldFont(const char* filename);
 void RetainFont(Font* font);
 void ReleaseFont(Font* font);
 float GetFontHeight(const Font* font);
-float GetFontTextWidth(const Font* font, const char* text);
-float GetFontTextHeight(const Font* font, const char* text);
-void DrawFont(const Font* font, const char* text, float x, float y);
+bool_t IsDistanceFieldFont(const Font* font);
+float GetFontTextWidth(Font* font, const char* text);
+float GetFontTextHeight(Font* font, const char* text);
+void DrawFont(Font* font, const char* text, float x, float y);
+Text* CreateText(Font* font, const char* string);
+void DeleteText(Text* text);
+void SetTextString(Text* text, const char* string);
+const char* GetTextString(const Text* text);
+float GetTextObjectWidth(const Text* text);
+float GetTextObjectHeight(const Text* text);
+void DrawTextObject(Text* text, float x, float y);
 
 #ifdef USE_DEFAULT_FONT
-Font* _LoadBase64Font(const char* data, size_t size, float height);
+Font* _LoadBase64Font(const char* data, size_t size, float height, const unsigned char* atlas, int atlas_width, int atlas_height, const float* glyphs);
 #endif
 
 #endif
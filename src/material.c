@@ -49,4 +49,5 @@ void _InitMaterial(Material* material) {
 
 void _FinishMaterial(Material* material) {
     if (material->texture) ReleaseTexture(material->texture);
+    if (material->lightmap) ReleaseTexture(material->lightmap);
 }
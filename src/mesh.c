@@ -1,10 +1,13 @@
 #define LITE_ASSBIN_USE_GFX /* add support for litegfx specific stuff in assbin loader */
 #define LITE_MD2_USE_GFX /* add support for litegfx specific stuff in md2 loader */
+#define LITE_GLB_USE_GFX /* add support for litegfx specific stuff in glb loader */
 #include "../lib/litelibs/liteassbin.h"
+#include "../lib/litelibs/liteglb.h"
 #include "../lib/litelibs/litegfx.h"
 #include "../lib/litelibs/litemath3d.h"
 #include "../lib/litelibs/litemd2.h"
 #include "../lib/stb/stretchy_buffer.h"
+#include "bvh.h"
 #include "color.h"
 #include "light.h"
 #include "material.h"
@@ -31,16 +34,88 @@ typedef struct {
     Frame* frames;
 } Buffer;
 
+typedef struct {
+    lvec3_t v0;
+    lvec3_t v1;
+    lvec3_t v2;
+    int buffer;
+    int index;
+} Triangle;
+
 typedef struct SMesh {
     size_t refcount;
     Buffer* buffers;
     Material* materials;
     lvec3_t boxmin;
     lvec3_t boxmax;
+    Triangle* triangles; /* sorted by the hierarchy, which is built the first time it is needed after the mesh changes */
+    BVHNode* nodes;
+    bool_t tree_dirty;
 } Mesh;
 
+/* baked mesh format (.wzm). the file starts with the header and the buffer,
+   material and texture tables. vertex, index and frame blocks follow, each
+   one starting at a 16 byte boundary and laid out exactly like the engine
+   stores them, so loading a block is a single memcpy */
+#define WZM_MAGIC 827152983 /* "WZM1" */
+#define WZM_VERSION 1
+#define WZM_ALIGN 16
+
+typedef struct {
+    int magic;
+    int version;
+    int num_buffers;
+    int num_textures;
+} WZMHeader;
+
+typedef struct {
+    int num_vertices;
+    int num_indices;
+    int num_frames;
+    int vertices_offset; /* lvert_t[num_vertices] */
+    int indices_offset; /* unsigned short[num_indices] */
+    int frames_offset; /* WZMFrame[num_frames] */
+    int reserved[2];
+} WZMBuffer;
+
+typedef struct {
+    int texture; /* index in texture table, or -1 */
+    int diffuse;
+    int emissive;
+    int specular;
+    float shininess;
+    int blend;
+    int flags;
+    int reserved;
+} WZMMaterial;
+
+typedef struct {
+    int name_offset; /* null terminated filename, or -1 if pixels are embedded */
+    int width;
+    int height;
+    int pixels_offset; /* RGBA pixels, or -1 if loaded from filename */
+} WZMTexture;
+
+typedef struct {
+    int frame;
+    int positions_offset; /* lvec3_t[num_vertices] */
+    int normals_offset; /* lvec3_t[num_vertices] */
+    int reserved;
+} WZMFrame;
+
+#define GLB_MAGIC 1179937895 /* "glTF" */
+
 bool_t _InitAssimpMesh(const Memblock* memblock, Mesh* mesh);
+bool_t _InitGLBMesh(const Memblock* memblock, Mesh* mesh);
 bool_t _InitMD2Mesh(const Memblock* memblock, Mesh* mesh);
+bool_t _InitWZMMesh(const Memblock* memblock, Mesh* mesh);
+static int _AddWZMBlock(char** data, const void* block, int size);
+static int _FindWZMTexture(const Texture** textures, const Texture* texture);
+static bool_t _IsWZMBlockValid(int memblock_size, int offset, int count, size_t elem_size);
+static void _BuildMeshTree(Mesh* mesh);
+static bool_t _RaycastTriangle(const Triangle* triangle, lvec3_t origin, lvec3_t delta, MeshHit* hit);
+static Texture* _GetAssimpTexture(const lassbin_scene_t* scene, const char* name, int format);
+static Texture* _GetGLBTexture(const lglb_scene_t* scene, int image, Texture** textures);
 
 
 Mesh* CreateMesh(const Memblock* memblock) {
@@ -51,11 +126,21 @@ Mesh* CreateMesh(const Memblock* memblock) {
     mesh->refcount = 1;
     mesh->buffers = NULL;
     mesh->materials = NULL;
+    mesh->triangles = NULL;
+    mesh->nodes = NULL;
+    mesh->tree_dirty = TRUE;
     
     if (memblock) {
+        int magic;
+
         init_ok = FALSE;
-        if (wzGetMemblockInt(memblock, 0) == 844121161) {
+        magic = (wzGetMemblockSize(memblock) >= (int)sizeof(int)) ? wzGetMemblockInt(memblock, 0) : 0;
+        if (magic == 844121161) {
             init_ok = _InitMD2Mesh(memblock, mesh);
+        } else if (magic == WZM_MAGIC) {
+            init_ok = _InitWZMMesh(memblock, mesh);
+        } else if (magic == GLB_MAGIC) {
+            init_ok = _InitGLBMesh(memblock, mesh);
         } else {
             init_ok = _InitAssimpMesh(memblock, mesh);
         }
@@ -92,10 +177,127 @@ void ReleaseMesh(Mesh* mesh) {
 
         sb_free(mesh->materials);
         sb_free(mesh->buffers);
+        sb_free(mesh->triangles);
+        sb_free(mesh->nodes);
         free(mesh);
     }
 }
 
+bool_t SaveMesh(const Mesh* mesh, const Material* materials, const char* filename) {
+    WZMHeader header;
+    WZMBuffer* buffers;
+    WZMMaterial* wzm_materials;
+    WZMTexture* textures;
+    const Texture** used_textures = NULL;
+    char* data = NULL;
+    int num_buffers;
+    int tables_offset;
+    int b, f, t;
+    FILE* fhandle;
+    bool_t ok;
+
+    /* if no material array is specified, take it from the mesh */
+    if (!materials) materials = mesh->materials;
+
+    /* collect textures used by the materials */
+    num_buffers = sb_count(mesh->buffers);
+    for (b = 0; b < num_buffers; ++b) {
+        const Texture* texture = wzGetMaterialTexture(&materials[b]);
+        if (texture && _FindWZMTexture(used_textures, texture) == -1) sb_push(used_textures, texture);
+    }
+
+    /* reserve space for header and tables, which are filled once block offsets are known */
+    header.magic = WZM_MAGIC;
+    header.version = WZM_VERSION;
+    header.num_buffers = num_buffers;
+    header.num_textures = sb_count(used_textures);
+    buffers = _AllocMany(WZMBuffer, num_buffers);
+    wzm_materials = _AllocMany(WZMMaterial, num_buffers);
+    textures = _AllocMany(WZMTexture, header.num_textures);
+    tables_offset = _AddWZMBlock(
+        &data,
+        NULL,
+        sizeof(WZMHeader) + num_buffers * (sizeof(WZMBuffer) + sizeof(WZMMaterial)) + header.num_textures * sizeof(WZMTexture));
+
+    /* add textures */
+    for (t = 0; t < header.num_textures; ++t) {
+        const char* tex_name = _GetTextureFilename(used_textures[t]);
+        const ltex_t* ltex = (const ltex_t*)_GetTexturePtr(used_textures[t]);
+        textures[t].width = ltex->width;
+        textures[t].height = ltex->height;
+        if (tex_name) {
+            textures[t].name_offset = _AddWZMBlock(&data, tex_name, strlen(tex_name) + 1);
+            textures[t].pixels_offset = -1;
+        } else {
+            /* texture was not loaded from disk, so embed its pixels */
+            unsigned char* pixels = _AllocMany(unsigned char, ltex->width * ltex->height * 4);
+            _GetTexturePixels(used_textures[t], pixels);
+            textures[t].name_offset = -1;
+            textures[t].pixels_offset = _AddWZMBlock(&data, pixels, ltex->width * ltex->height * 4);
+            free(pixels);
+        }
+    }
+
+    /* add buffers and materials */
+    for (b = 0; b < num_buffers; ++b) {
+        const Buffer* buffer = &mesh->buffers[b];
+        const Material* material = &materials[b];
+        WZMFrame* frames;
+
+        buffers[b].num_vertices = sb_count(buffer->vertices);
+        buffers[b].num_indices = sb_count(buffer->indices);
+        buffers[b].num_frames = sb_count(buffer->frames);
+        buffers[b].vertices_offset = _AddWZMBlock(&data, buffer->vertices, buffers[b].num_vertices * sizeof(lvert_t));
+        buffers[b].indices_offset = _AddWZMBlock(&data, buffer->indices, buffers[b].num_indices * sizeof(unsigned short));
+        buffers[b].reserved[0] = buffers[b].reserved[1] = 0;
+
+        /* add frames */
+        frames = _AllocMany(WZMFrame, buffers[b].num_frames);
+        for (f = 0; f < buffers[b].num_frames; ++f) {
+            frames[f].frame = buffer->frames[f].frame;
+            frames[f].positions_offset = _AddWZMBlock(&data, buffer->frames[f].positions, buffers[b].num_vertices * sizeof(lvec3_t));
+            frames[f].normals_offset = _AddWZMBlock(&data, buffer->frames[f].normals, buffers[b].num_vertices * sizeof(lvec3_t));
+            frames[f].reserved = 0;
+        }
+        buffers[b].frames_offset = _AddWZMBlock(&data, frames, buffers[b].num_frames * sizeof(WZMFrame));
+        free(frames);
+
+        /* add material */
+        wzm_materials[b].texture = _FindWZMTexture(used_textures, wzGetMaterialTexture(material));
+        wzm_materials[b].diffuse = wzGetMaterialDiffuse(material);
+        wzm_materials[b].emissive = wzGetMaterialEmissive(material);
+        wzm_materials[b].specular = wzGetMaterialSpecular(material);
+        wzm_materials[b].shininess = wzGetMaterialShininess(material);
+        wzm_materials[b].blend = wzGetMaterialBlend(material);
+        wzm_materials[b].flags = wzGetMaterialFlags(material);
+        wzm_materials[b].reserved = 0;
+    }
+
+    /* fill header and tables */
+    memcpy(data + tables_offset, &header, sizeof(WZMHeader));
+    tables_offset += sizeof(WZMHeader);
+    memcpy(data + tables_offset, buffers, num_buffers * sizeof(WZMBuffer));
+    tables_offset += num_buffers * sizeof(WZMBuffer);
+    memcpy(data + tables_offset, wzm_materials, num_buffers * sizeof(WZMMaterial));
+    tables_offset += num_buffers * sizeof(WZMMaterial);
+    memcpy(data + tables_offset, textures, header.num_textures * sizeof(WZMTexture));
+    free(buffers);
+    free(wzm_materials);
+    free(textures);
+    sb_free(used_textures);
+
+    /* write file */
+    ok = FALSE;
+    fhandle = fopen(filename, "wb");
+    if (fhandle) {
+        ok = fwrite(data, sizeof(char), sb_count(data), fhandle) == (size_t)sb_count(data);
+        fclose(fhandle);
+    }
+    sb_free(data);
+
+    return ok;
+}
+
 int AddMeshBuffer(Mesh* mesh) {
     Buffer* buffer;
     Material* material;
@@ -130,12 +332,15 @@ int AddMeshTriangle(Mesh* mesh, int buffer, int v0, int v1, int v2) {
     index[0] = v0;
     index[1] = v1;
     index[2] = v2;
+    mesh->tree_dirty = TRUE;
     return (sb_count(mesh->buffers[buffer].indices) - 3) / 3;
 }
 
 void RebuildMesh(Mesh* mesh) {
     int b, v;
 
+    mesh->tree_dirty = TRUE;
+
     /* calculate mesh bounds */
     if (sb_count(mesh->buffers) > 0 && sb_count(mesh->buffers[0].vertices) > 0) {
         mesh->boxmin = lvec3(mesh->buffers[0].vertices[0].pos[0], mesh->buffers[0].vertices[0].pos[1], mesh->buffers[0].vertices[0].pos[2]);
@@ -211,6 +416,8 @@ int _GetMeshLastFrame(const Mesh* mesh) {
 void _AnimateMesh(Mesh* mesh, float frame) {
     int b;
 
+    mesh->tree_dirty = TRUE;
+
     /* animate all buffers */
     for (b = 0; b < sb_count(mesh->buffers); ++b) {
         Buffer* buffer;
@@ -290,6 +497,91 @@ void _AnimateMesh(Mesh* mesh, float frame) {
     }
 }
 
+bool_t _IsMeshUVRangeUnit(const Mesh* mesh, int buffer) {
+    const float epsilon = 0.001f;
+    int v;
+
+    for (v = 0; v < sb_count(mesh->buffers[buffer].vertices); ++v) {
+        const float* tex = mesh->buffers[buffer].vertices[v].tex;
+        if (tex[0] < -epsilon || tex[0] > 1 + epsilon || tex[1] < -epsilon || tex[1] > 1 + epsilon) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+void _RemapMeshUVs(Mesh* mesh, int buffer, float u0, float v0, float u1, float v1) {
+    int v;
+
+    for (v = 0; v < sb_count(mesh->buffers[buffer].vertices); ++v) {
+        float* tex = mesh->buffers[buffer].vertices[v].tex;
+        tex[0] = u0 + _Clamp(tex[0], 0.0f, 1.0f) * (u1 - u0);
+        tex[1] = v0 + _Clamp(tex[1], 0.0f, 1.0f) * (v1 - v0);
+    }
+}
+
+bool_t _RaycastMesh(Mesh* mesh, lvec3_t origin, lvec3_t delta, MeshHit* hit) {
+    int stack[BVH_MAX_DEPTH];
+    int top = 0;
+    bool_t found = FALSE;
+
+    if (mesh->tree_dirty) _BuildMeshTree(mesh);
+    if (sb_count(mesh->nodes) == 0) return FALSE;
+
+    /* visit nodes which the segment enters before the closest hit found so far */
+    stack[top++] = 0;
+    while (top > 0) {
+        int index = stack[--top];
+        const BVHNode* node = &mesh->nodes[index];
+        if (GetBoxSegmentTime(node->min, node->max, origin, delta) >= hit->time) continue;
+        if (node->count > 0) {
+            int i;
+            for (i = node->first; i < node->first + node->count; ++i) {
+                if (_RaycastTriangle(&mesh->triangles[i], origin, delta, hit)) found = TRUE;
+            }
+        } else {
+            stack[top++] = node->first;
+            stack[top++] = index + 1;
+        }
+    }
+    return found;
+}
+
+int _GetMeshTriangles(Mesh* mesh, lvec3_t min, lvec3_t max, float** coords) {
+    int stack[BVH_MAX_DEPTH];
+    int top = 0;
+    int count = 0;
+
+    if (mesh->tree_dirty) _BuildMeshTree(mesh);
+    if (sb_count(mesh->nodes) == 0) return 0;
+
+    stack[top++] = 0;
+    while (top > 0) {
+        int index = stack[--top];
+        const BVHNode* node = &mesh->nodes[index];
+        if (node->min.x > max.x || node->max.x < min.x
+                || node->min.y > max.y || node->max.y < min.y
+                || node->min.z > max.z || node->max.z < min.z) {
+            continue;
+        }
+        if (node->count > 0) {
+            int i;
+            for (i = node->first; i < node->first + node->count; ++i) {
+                const Triangle* triangle = &mesh->triangles[i];
+                float* c = sb_add(*coords, 9);
+                c[0] = triangle->v0.x; c[1] = triangle->v0.y; c[2] = triangle->v0.z;
+                c[3] = triangle->v1.x; c[4] = triangle->v1.y; c[5] = triangle->v1.z;
+                c[6] = triangle->v2.x; c[7] = triangle->v2.y; c[8] = triangle->v2.z;
+            }
+            count += node->count;
+        } else {
+            stack[top++] = node->first;
+            stack[top++] = index + 1;
+        }
+    }
+    return count;
+}
+
 void _DrawMesh(const Mesh* mesh, const Material* materials) {
     int i;
 
@@ -313,6 +605,8 @@ void _DrawMesh(const Mesh* mesh, const Material* materials) {
 
         /* set material settings */
         lgfx_setblend(wzGetMaterialBlend(material));
+        _UpdateTextureMipmaps(wzGetMaterialTexture(material));
+        _UpdateTextureMipmaps(wzGetMaterialLightmap(material));
         ltex_bind(
             (const ltex_t*)_GetTexturePtr(wzGetMaterialTexture(material)),
             (const ltex_t*)_GetTexturePtr(wzGetMaterialLightmap(material)),
@@ -427,12 +721,12 @@ bool_t _InitAssimpMesh(const Memblock* memblock, Mesh* mesh) {
     lassbin_scene_t* scene;
     int m, t;
 
-    scene = lassbin_loadmem((const char*)memblock);
+    scene = lassbin_loadmem((const char*)memblock, wzGetMemblockSize(memblock));
     if (!scene) return FALSE;
 
-    /* make sure that meshes use 16 bits indices */
+    /* make sure that meshes use 16 bits indices, which liteassbin only extracts below 65536 vertices */
     for (m = 0; m < scene->num_meshes; ++m) {
-        if (scene->meshes[m].num_vertices > 65536) {
+        if (scene->meshes[m].num_vertices >= 65536) {
             lassbin_free(scene);
             return FALSE;
         }
@@ -441,11 +735,10 @@ bool_t _InitAssimpMesh(const Memblock* memblock, Mesh* mesh) {
     /* add buffers */
     for (m = 0; m < scene->num_meshes; ++m) {
         int buffer;
-        lvert_t* verts;
-        unsigned short* indices;
         int num_indices;
         const lassbin_material_t* material;
         const char* tex_name;
+        const char* lightmap_name;
         float opacity;
         const float* diffuse;
         const float* emissive;
@@ -456,22 +749,21 @@ bool_t _InitAssimpMesh(const Memblock* memblock, Mesh* mesh) {
         buffer = AddMeshBuffer(mesh);
 
         /* add vertices */
-        verts = lassbin_getvertices(&scene->meshes[m]);
-        sb_add(mesh->buffers[buffer].vertices, scene->meshes[m].num_vertices);
-        memcpy(mesh->buffers[buffer].vertices, verts, scene->meshes[m].num_vertices * sizeof(lvert_t));
-        free(verts);
+        if (scene->meshes[m].num_vertices > 0) {
+            lassbin_getvertices(&scene->meshes[m], sb_add(mesh->buffers[buffer].vertices, scene->meshes[m].num_vertices));
+        }
 
         /* add indices */
-        indices = lassbin_getindices(&scene->meshes[m], &num_indices);
-        if (indices) {
-            sb_add(mesh->buffers[buffer].indices, num_indices);
-            memcpy(mesh->buffers[buffer].indices, indices, num_indices * sizeof(unsigned short));
-            free(indices);
+        num_indices = lassbin_numindices(&scene->meshes[m]);
+        if (num_indices > 0 && lassbin_getindices(&scene->meshes[m], sb_add(mesh->buffers[buffer].indices, num_indices)) == 0) {
+            lassbin_free(scene);
+            return FALSE;
         }
 
         /* parse material */
         material = &scene->materials[scene->meshes[m].material_index];
         tex_name = lassbin_mattexturename(material, LASSBIN_TEXTURE_DIFFUSE, 0);
+        lightmap_name = lassbin_mattexturename(material, LASSBIN_TEXTURE_LIGHTMAP, 0);
         opacity = lassbin_matopacity(material);
         diffuse = lassbin_matdiffuse(material);
         emissive = lassbin_matemissive(material);
@@ -481,24 +773,12 @@ bool_t _InitAssimpMesh(const Memblock* memblock, Mesh* mesh) {
 
         /* apply texture */
         if (tex_name) {
-            Texture* texture = NULL;
-
-            if (tex_name[0] == '*') {
-                /* create embedded texture */
-                int tex_index;
-                Pixmap* pixmap;
-                tex_index = tex_name[1] - 48; /* convert ascii code to number */
-                pixmap = _CreateEmptyPixmapFromData(scene->textures[tex_index].data, lassbin_texturesize(&scene->textures[tex_index]));
-                if (pixmap) {
-                    texture = wzCreateTexture(pixmap);
-                    wzDeletePixmap(pixmap);
-                }
-            } else {
-                /* load texture */
-                texture = wzLoadTexture(tex_name);
-            }
-            if (texture) RetainTexture(texture); /* automatically loaded textures are reference counted */
-            wzSetMaterialTexture(&mesh->materials[buffer], texture);
+            wzSetMaterialTexture(&mesh->materials[buffer], _GetAssimpTexture(scene, tex_name, FORMAT_RGBA8));
+        }
+
+        /* apply lightmap, which does not need an alpha channel */
+        if (lightmap_name) {
+            wzSetMaterialLightmap(&mesh->materials[buffer], _GetAssimpTexture(scene, lightmap_name, FORMAT_RGB565));
         }
 
         /* apply diffuse */
@@ -542,6 +822,100 @@ bool_t _InitAssimpMesh(const Memblock* memblock, Mesh* mesh) {
     return TRUE;
 }
 
+bool_t _InitGLBMesh(const Memblock* memblock, Mesh* mesh) {
+    lglb_scene_t* scene;
+    Texture** textures;
+    int m, p;
+
+    /* the scene reads accessors straight from the binary chunk in the memblock */
+    scene = lglb_loadmem((const char*)memblock, wzGetMemblockSize(memblock));
+    if (!scene) return FALSE;
+
+    /* make sure that primitives use 16 bits indices */
+    for (m = 0; m < scene->num_meshes; ++m) {
+        for (p = 0; p < scene->meshes[m].num_primitives; ++p) {
+            if (lglb_numvertices(scene, &scene->meshes[m].primitives[p]) > 65536) {
+                lglb_free(scene);
+                return FALSE;
+            }
+        }
+    }
+
+    /* add a buffer per triangle primitive */
+    textures = (Texture**)calloc(scene->num_images + 1, sizeof(Texture*));
+    for (m = 0; m < scene->num_meshes; ++m) {
+        for (p = 0; p < scene->meshes[m].num_primitives; ++p) {
+            const lglb_primitive_t* primitive;
+            const lglb_material_t* material;
+            int buffer;
+            int num_vertices;
+            int num_indices;
+            int v;
+
+            primitive = &scene->meshes[m].primitives[p];
+            if (primitive->mode != LGLB_MODE_TRIANGLES) continue;
+            buffer = AddMeshBuffer(mesh);
+
+            /* add vertices */
+            num_vertices = lglb_numvertices(scene, primitive);
+            if (num_vertices > 0) {
+                lglb_getvertices(scene, primitive, sb_add(mesh->buffers[buffer].vertices, num_vertices));
+            }
+
+            /* add indices */
+            num_indices = lglb_numindices(scene, primitive);
+            if (num_indices > 0 && !lglb_getindices(scene, primitive, sb_add(mesh->buffers[buffer].indices, num_indices))) {
+                free(textures);
+                lglb_free(scene);
+                return FALSE;
+            }
+
+            /* parse material */
+            if (primitive->material < 0) continue;
+            material = &scene->materials[primitive->material];
+
+            /* apply base color texture, which is sampled with the first uv set, so it gets the second one if the material uses it */
+            if (material->base_color_texture >= 0 && material->base_color_texcoord >= 0 && material->base_color_texcoord <= 1) {
+                Texture* texture;
+                if (material->base_color_texcoord == 1) {
+                    for (v = 0; v < num_vertices; ++v) {
+                        mesh->buffers[buffer].vertices[v].tex[0] = mesh->buffers[buffer].vertices[v].tex2[0];
+                        mesh->buffers[buffer].vertices[v].tex[1] = mesh->buffers[buffer].vertices[v].tex2[1];
+                    }
+                }
+                texture = _GetGLBTexture(scene, scene->textures[material->base_color_texture], textures);
+                if (texture) RetainTexture(texture); /* automatically loaded textures are reference counted */
+                wzSetMaterialTexture(&mesh->materials[buffer], texture);
+            }
+
+            /* apply base color and emissive */
+            wzSetMaterialDiffuse(&mesh->materials[buffer], wzGetRGBA(
+                (int)(material->base_color[0] * 255),
+                (int)(material->base_color[1] * 255),
+                (int)(material->base_color[2] * 255),
+                (int)(material->base_color[3] * 255)
+            ));
+            wzSetMaterialEmissive(&mesh->materials[buffer], wzGetRGBA(
+                (int)(material->emissive[0] * 255),
+                (int)(material->emissive[1] * 255),
+                (int)(material->emissive[2] * 255),
+                255
+            ));
+
+            /* apply alpha mode (masked materials rely on the alpha test) and culling */
+            wzSetMaterialBlend(&mesh->materials[buffer], (material->alpha_mode == LGLB_ALPHA_BLEND) ? BLEND_ALPHA : BLEND_SOLID);
+            if (material->double_sided) {
+                wzSetMaterialFlags(&mesh->materials[buffer], wzGetMaterialFlags(&mesh->materials[buffer]) & ~FLAG_CULL);
+            }
+        }
+    }
+
+    free(textures);
+    lglb_free(scene);
+
+    return TRUE;
+}
+
 bool_t _InitMD2Mesh(const Memblock* memblock, Mesh* mesh) {
     lmd2_model_t*    mdl;
     Frame* frame;
@@ -594,3 +968,259 @@ bool_t _InitMD2Mesh(const Memblock* memblock, Mesh* mesh) {
 
     return TRUE;
 }
+
+bool_t _InitWZMMesh(const Memblock* memblock, Mesh* mesh) {
+    const char* data;
+    int size;
+    const WZMHeader* header;
+    const WZMBuffer* buffers;
+    const WZMMaterial* materials;
+    const WZMTexture* textures;
+    Texture** loaded_textures;
+    int b, f, t;
+
+    data = (const char*)memblock;
+    size = wzGetMemblockSize(memblock);
+
+    /* check header and tables */
+    if (!_IsWZMBlockValid(size, 0, 1, sizeof(WZMHeader))) return FALSE;
+    header = (const WZMHeader*)data;
+    if (header->version != WZM_VERSION) return FALSE;
+    if (!_IsWZMBlockValid(size, sizeof(WZMHeader), header->num_buffers, sizeof(WZMBuffer) + sizeof(WZMMaterial))) return FALSE;
+    buffers = (const WZMBuffer*)(data + sizeof(WZMHeader));
+    materials = (const WZMMaterial*)(buffers + header->num_buffers);
+    textures = (const WZMTexture*)(materials + header->num_buffers);
+    if (!_IsWZMBlockValid(size, (const char*)textures - data, header->num_textures, sizeof(WZMTexture))) return FALSE;
+
+    /* check all blocks before creating anything, so a bad file does not leave textures behind */
+    for (t = 0; t < header->num_textures; ++t) {
+        if (textures[t].name_offset != -1) {
+            if (!_IsWZMBlockValid(size, textures[t].name_offset, 1, 1)) return FALSE;
+            if (!memchr(data + textures[t].name_offset, 0, size - textures[t].name_offset)) return FALSE;
+        } else if (textures[t].width <= 0 || textures[t].height <= 0
+            || !_IsWZMBlockValid(size, textures[t].pixels_offset, textures[t].width, (size_t)textures[t].height * 4)) {
+            return FALSE;
+        }
+    }
+    for (b = 0; b < header->num_buffers; ++b) {
+        const WZMFrame* frames;
+
+        if (buffers[b].num_vertices > 65536) return FALSE; /* indices are 16 bits */
+        if (!_IsWZMBlockValid(size, buffers[b].vertices_offset, buffers[b].num_vertices, sizeof(lvert_t))) return FALSE;
+        if (!_IsWZMBlockValid(size, buffers[b].indices_offset, buffers[b].num_indices, sizeof(unsigned short))) return FALSE;
+        if (!_IsWZMBlockValid(size, buffers[b].frames_offset, buffers[b].num_frames, sizeof(WZMFrame))) return FALSE;
+        if (materials[b].texture < -1 || materials[b].texture >= header->num_textures) return FALSE;
+        frames = (const WZMFrame*)(data + buffers[b].frames_offset);
+        for (f = 0; f < buffers[b].num_frames; ++f) {
+            if (!_IsWZMBlockValid(size, frames[f].positions_offset, buffers[b].num_vertices, sizeof(lvec3_t))) return FALSE;
+            if (!_IsWZMBlockValid(size, frames[f].normals_offset, buffers[b].num_vertices, sizeof(lvec3_t))) return FALSE;
+        }
+    }
+
+    /* textures are created when a material uses them, since only materials release them */
+    loaded_textures = (Texture**)calloc(header->num_textures + 1, sizeof(Texture*));
+
+    /* add buffers */
+    for (b = 0; b < header->num_buffers; ++b) {
+        const WZMFrame* frames;
+        Material* material;
+        int buffer;
+
+        buffer = AddMeshBuffer(mesh);
+
+        /* copy vertices and indices */
+        if (buffers[b].num_vertices > 0) {
+            memcpy(
+                sb_add(mesh->buffers[buffer].vertices, buffers[b].num_vertices),
+                data + buffers[b].vertices_offset,
+                buffers[b].num_vertices * sizeof(lvert_t));
+        }
+        if (buffers[b].num_indices > 0) {
+            memcpy(
+                sb_add(mesh->buffers[buffer].indices, buffers[b].num_indices),
+                data + buffers[b].indices_offset,
+                buffers[b].num_indices * sizeof(unsigned short));
+        }
+
+        /* copy frames */
+        frames = (const WZMFrame*)(data + buffers[b].frames_offset);
+        for (f = 0; f < buffers[b].num_frames; ++f) {
+            Frame* frame;
+
+            frame = sb_add(mesh->buffers[buffer].frames, 1);
+            frame->frame = frames[f].frame;
+            frame->positions = NULL;
+            frame->normals = NULL;
+            memcpy(
+                sb_add(frame->positions, buffers[b].num_vertices),
+                data + frames[f].positions_offset,
+                buffers[b].num_vertices * sizeof(lvec3_t));
+            memcpy(
+                sb_add(frame->normals, buffers[b].num_vertices),
+                data + frames[f].normals_offset,
+                buffers[b].num_vertices * sizeof(lvec3_t));
+        }
+
+        /* setup material */
+        material = &mesh->materials[buffer];
+        t = materials[b].texture;
+        if (t != -1 && !loaded_textures[t]) {
+            if (textures[t].name_offset != -1) {
+                loaded_textures[t] = wzLoadTexture(data + textures[t].name_offset);
+            } else {
+                loaded_textures[t] = _CreateTextureFromPixels(textures[t].width, textures[t].height, FORMAT_RGBA8, data + textures[t].pixels_offset);
+            }
+        }
+        if (t != -1 && loaded_textures[t]) {
+            RetainTexture(loaded_textures[t]); /* automatically loaded textures are reference counted */
+            wzSetMaterialTexture(material, loaded_textures[t]);
+        }
+        wzSetMaterialDiffuse(material, materials[b].diffuse);
+        wzSetMaterialEmissive(material, materials[b].emissive);
+        wzSetMaterialSpecular(material, materials[b].specular);
+        wzSetMaterialShininess(material, materials[b].shininess);
+        wzSetMaterialBlend(material, materials[b].blend);
+        wzSetMaterialFlags(material, materials[b].flags);
+    }
+    free(loaded_textures);
+
+    return TRUE;
+}
+
+static int _AddWZMBlock(char** data, const void* block, int size) {
+    int padding;
+    int offset;
+
+    /* blocks start at aligned boundaries */
+    padding = ((sb_count(*data) + WZM_ALIGN - 1) & ~(WZM_ALIGN - 1)) - sb_count(*data);
+    if (padding > 0) memset(sb_add(*data, padding), 0, padding);
+
+    /* copy block (or zero it if no data is given) */
+    offset = sb_count(*data);
+    if (size > 0) {
+        if (block) memcpy(sb_add(*data, size), block, size);
+        else memset(sb_add(*data, size), 0, size);
+    }
+
+    return offset;
+}
+
+static int _FindWZMTexture(const Texture** textures, const Texture* texture) {
+    int i;
+
+    if (!texture) return -1;
+    for (i = 0; i < sb_count(textures); ++i) {
+        if (textures[i] == texture) return i;
+    }
+    return -1;
+}
+
+static void _BuildMeshTree(Mesh* mesh) {
+    Triangle* triangles = NULL;
+    BVHItem* items;
+    int b, i;
+
+    for (b = 0; b < sb_count(mesh->buffers); ++b) {
+        const Buffer* buffer = &mesh->buffers[b];
+        for (i = 0; i < sb_count(buffer->indices) / 3; ++i) {
+            Triangle* triangle = sb_add(triangles, 1);
+            const float* v0 = buffer->vertices[buffer->indices[i*3]].pos;
+            const float* v1 = buffer->vertices[buffer->indices[i*3 + 1]].pos;
+            const float* v2 = buffer->vertices[buffer->indices[i*3 + 2]].pos;
+            triangle->v0 = lvec3(v0[0], v0[1], v0[2]);
+            triangle->v1 = lvec3(v1[0], v1[1], v1[2]);
+            triangle->v2 = lvec3(v2[0], v2[1], v2[2]);
+            triangle->buffer = b;
+            triangle->index = i;
+        }
+    }
+
+    items = _AllocMany(BVHItem, sb_count(triangles));
+    for (i = 0; i < sb_count(triangles); ++i) {
+        const Triangle* triangle = &triangles[i];
+        items[i].min = lvec3(
+            _Min(_Min(triangle->v0.x, triangle->v1.x), triangle->v2.x),
+            _Min(_Min(triangle->v0.y, triangle->v1.y), triangle->v2.y),
+            _Min(_Min(triangle->v0.z, triangle->v1.z), triangle->v2.z));
+        items[i].max = lvec3(
+            _Max(_Max(triangle->v0.x, triangle->v1.x), triangle->v2.x),
+            _Max(_Max(triangle->v0.y, triangle->v1.y), triangle->v2.y),
+            _Max(_Max(triangle->v0.z, triangle->v1.z), triangle->v2.z));
+        items[i].index = i;
+    }
+    BuildBVH(&mesh->nodes, items, sb_count(triangles));
+
+    /* store the triangles in the order of the leaves */
+    if (mesh->triangles) stb__sbn(mesh->triangles) = 0;
+    for (i = 0; i < sb_count(triangles); ++i) sb_push(mesh->triangles, triangles[items[i].index]);
+    sb_free(triangles);
+    free(items);
+    mesh->tree_dirty = FALSE;
+}
+
+/* moller-trumbore intersection, accepting both faces of the triangle */
+static bool_t _RaycastTriangle(const Triangle* triangle, lvec3_t origin, lvec3_t delta, MeshHit* hit) {
+    lvec3_t edge1, edge2, p, s, q;
+    float det, inv_det, u, v, t;
+
+    edge1 = lvec3_sub(triangle->v1, triangle->v0);
+    edge2 = lvec3_sub(triangle->v2, triangle->v0);
+    p = lvec3_cross(delta, edge2);
+    det = lvec3_dot(edge1, p);
+    if (det == 0) return FALSE;
+    inv_det = 1 / det;
+    s = lvec3_sub(origin, triangle->v0);
+    u = lvec3_dot(s, p) * inv_det;
+    if (u < 0 || u > 1) return FALSE;
+    q = lvec3_cross(s, edge1);
+    v = lvec3_dot(delta, q) * inv_det;
+    if (v < 0 || u + v > 1) return FALSE;
+    t = lvec3_dot(edge2, q) * inv_det;
+    if (t < 0 || t >= hit->time) return FALSE;
+    hit->time = t;
+    hit->buffer = triangle->buffer;
+    hit->triangle = triangle->index;
+    hit->u = u;
+    hit->v = v;
+    return TRUE;
+}
+
+static Texture* _GetAssimpTexture(const lassbin_scene_t* scene, const char* name, int format) {
+    Texture* texture = NULL;
+
+    if (name[0] == '*') {
+        /* create embedded texture */
+        int tex_index;
+        tex_index = atoi(&name[1]);
+        texture = (tex_index >= 0 && tex_index < scene->num_textures)
+            ? _CreateTextureFromData(scene->textures[tex_index].data, lassbin_texturesize(&scene->textures[tex_index]), format)
+            : NULL;
+    } else {
+        /* load texture */
+        texture = _LoadTexture(name, format);
+    }
+    if (texture) RetainTexture(texture); /* automatically loaded textures are reference counted */
+    return texture;
+}
+
+static Texture* _GetGLBTexture(const lglb_scene_t* scene, int image, Texture** textures) {
+    if (image < 0) return NULL;
+
+    /* images are shared between materials, so only create each one once */
+    if (!textures[image]) {
+        if (scene->images[image].buffer_view >= 0) {
+            const char* data;
+            size_t size;
+            data = lglb_bufferviewdata(scene, scene->images[image].buffer_view, &size);
+            textures[image] = _CreateTextureFromData((const unsigned char*)data, size, FORMAT_RGBA8);
+        } else if (scene->images[image].uri[0] != 0 && strncmp(scene->images[image].uri, "data:", 5) != 0) {
+            textures[image] = wzLoadTexture(scene->images[image].uri);
+        }
+    }
+
+    return textures[image];
+}
+
+static bool_t _IsWZMBlockValid(int memblock_size, int offset, int count, size_t elem_size) {
+    return offset >= 0 && count >= 0 && offset <= memblock_size && (size_t)count <= (memblock_size - offset) / elem_size;
+}
@@ -1,6 +1,7 @@
 #ifndef MESH_H_INCLUDED
 #define MESH_H_INCLUDED
 
+#include "../lib/litelibs/litemath3d.h"
 #include "types.h"
 
 #ifdef __cplusplus
@@ -9,9 +10,17 @@ extern "C" {
 
 #ifndef SWIG
 
+typedef struct {
+    float time; /* fraction of the segment */
+    int buffer;
+    int triangle;
+    float u, v; /* weights of the second and third vertices of the triangle in the hit point */
+} MeshHit;
+
 Mesh* CreateMesh(const Memblock* memblock);
 void RetainMesh(Mesh* mesh);
 void ReleaseMesh(Mesh* mesh);
+bool_t SaveMesh(const Mesh* mesh, const Material* materials, const char* filename);
 int AddMeshBuffer(Mesh* mesh);
 int GetNumMeshBuffers(Mesh* mesh);
 int AddMeshVertex(Mesh* mesh, int buffer, float x, float y, float z, float nx, float ny, float nz, float u, float v, int color);
@@ -29,6 +38,10 @@ float GetMeshBoxMaxY(const Mesh* mesh);
 float GetMeshBoxMaxZ(const Mesh* mesh);
 int _GetMeshLastFrame(const Mesh* mesh);
 void _AnimateMesh(Mesh* mesh, float frame);
+bool_t _IsMeshUVRangeUnit(const Mesh* mesh, int buffer);
+void _RemapMeshUVs(Mesh* mesh, int buffer, float u0, float v0, float u1, float v1);
+bool_t _RaycastMesh(Mesh* mesh, lvec3_t origin, lvec3_t delta, MeshHit* hit);
+int _GetMeshTriangles(Mesh* mesh, lvec3_t min, lvec3_t max, float** coords); /* appends the nine coordinates of each triangle which may touch the box */
 void _DrawMesh(const Mesh* mesh, const Material* materials);
 Mesh* _CreateSkyboxMesh();
 
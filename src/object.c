@@ -2,6 +2,7 @@
 #include "../lib/litelibs/litegfx.h"
 #include "../lib/litelibs/litemath3d.h"
 #include "../lib/stb/stretchy_buffer.h"
+#include "aabbtree.h"
 #include "colbox.h"
 #include "color.h"
 #include "material.h"
@@ -30,9 +31,47 @@ typedef struct SObject {
     int     animmax;
     Mesh* _mesh;
     Material* _materials;
+    lvec3_t _colnormal; /* normal of the last box face hit when moving */
+    int _proxy; /* -1 if not in the collision tree */
+    bool_t _moved; /* TRUE if the object is pending to be updated in the collision tree */
+    Object* _next_shared; /* next object in the ring of objects sharing the mesh */
 } Object;
 
+typedef struct {
+    int mode;
+    lvec3_t min; /* bounds of the shape */
+    lvec3_t max;
+    lvec3_t center; /* only for spheres */
+    float sq_radius;
+    const Object* object; /* only for meshes */
+} ColShape;
+
+#define OBJECT_TREE_MARGIN 0.1f /* fraction of the object size that boxes in the collision tree are fattened */
+#define OBJECT_SWEEP_SKIN 0.001f /* distance kept from boxes when moving, so rounding does not make the object penetrate them */
+#define OBJECT_SLIDE_STEPS 3
+
 static float _object_animfps = 16;
+static AABBTree* _object_tree = NULL;
+static Object** _moved_objects = NULL;
+static float* _object_triangles = NULL; /* world coordinates of the mesh triangles being tested */
+static MeshHit _raycast_hit = {0, -1, -1, 0, 0}; /* result of the last raycast */
+static lvec3_t _raycast_point = {0, 0, 0};
+static float _raycast_distance = 0;
+
+static void _MarkObjectMoved(Object* object);
+static void _MarkMeshObjectsMoved(Object* object);
+static void _UpdateObjectTree();
+static void _GetObjectColShape(const Object* object, ColShape* shape);
+static void _GetObjectMeshBounds(const Object* object, lvec3_t* min, lvec3_t* max);
+static int _GetObjectTriangles(const Object* object, lvec3_t min, lvec3_t max);
+static lvec3_t _RotateExtents(lquat_t q, lvec3_t extents);
+static bool_t _RaycastObject(const Object* object, lvec3_t origin, lvec3_t delta, MeshHit* hit);
+static void _SetRaycastResult(lvec3_t origin, lvec3_t delta, const MeshHit* hit);
+static bool_t _SweepObject(Object* object, lvec3_t vec, float* moved);
+static void _SweepMeshObjects(const Object* object, const ColShape* shape, lvec3_t vec, float* time, float* normal);
+static bool_t _ColShapesCollide(const ColShape* shape, const ColShape* shape2);
+static bool_t _MeshCollidesShape(const Object* object, const ColShape* shape);
+static int _QueryObjects(const ColShape* shape, Object** out_objects, int max_objects);
 
 void _SetObjectMaterials(Object* object) {
     sb_free(object->_materials);
@@ -70,6 +109,10 @@ EXPORT Object* CALL wzCreateObject(const Memblock* memblock) {
     object->animmax = 0;
     object->_mesh = mesh;
     object->_materials = NULL;
+    object->_colnormal = lvec3(0, 0, 0);
+    object->_proxy = -1;
+    object->_moved = FALSE;
+    object->_next_shared = object;
     wzRebuildObjectMesh(object);
     _SetObjectMaterials(object);
     return object;
@@ -192,6 +235,10 @@ EXPORT Object* CALL wzLoadObject(const char* filename) {
     return object;
 }
 
+EXPORT bool_t CALL wzSaveObject(const Object* object, const char* filename) {
+    return SaveMesh(object->_mesh, object->_materials, filename);
+}
+
 EXPORT Object* CALL wzCloneObject(const Object* object) {
     Object* new_object = wzCreateObject(NULL);
     new_object->x = object->x;
@@ -207,10 +254,26 @@ EXPORT Object* CALL wzCloneObject(const Object* object) {
     sb_add(new_object->_materials, sb_count(object->_materials));
     memcpy(new_object->_materials, object->_materials, sizeof(Material) * sb_count(object->_materials));
     RetainMesh(object->_mesh);
+
+    /* join the ring of objects sharing the mesh */
+    new_object->_next_shared = object->_next_shared;
+    ((Object*)object)->_next_shared = new_object;
     return new_object;
 }
 
 EXPORT void CALL wzDeleteObject(Object* object) {
+    if (object->_moved) {
+        int i;
+        for (i = 0; _moved_objects[i] != object; ++i);
+        _moved_objects[i] = sb_last(_moved_objects);
+        sb_pop(_moved_objects);
+    }
+    if (object->_next_shared != object) {
+        Object* prev;
+        for (prev = object->_next_shared; prev->_next_shared != object; prev = prev->_next_shared);
+        prev->_next_shared = object->_next_shared;
+    }
+    if (object->_proxy != -1) RemoveAABBTreeProxy(_object_tree, object->_proxy);
     ReleaseMesh(object->_mesh);
     free(object);
 }
@@ -225,39 +288,50 @@ EXPORT void CALL wzSetObjectPosition(Object* object, float x, float y, float z)
     object->x = x;
     object->y = y;
     object->z = z;
+    _MarkObjectMoved(object);
 }
 
 EXPORT bool_t CALL wzMoveObject(Object* object, float x, float y, float z) {
     lvec3_t vec;
     bool_t collided = FALSE;
+    int i;
 
     /* transform movement by object's rotation */
     vec = lquat_mulvec3(lquat_fromeuler(lvec3_rad(lvec3(object->pitch, object->yaw, object->roll))), lvec3(x, y, z));
 
-    /* move x and check collision boxes */
-    object->x += vec.x;
-    if (wzObjectCollidesBoxes(object)) {
+    /* move until a collision box is hit, and slide the rest of the movement along its face */
+    object->_colnormal = lvec3(0, 0, 0);
+    for (i = 0; i < OBJECT_SLIDE_STEPS && lvec3_sqlength(vec) > 0; ++i) {
+        float moved;
+        if (!_SweepObject(object, vec, &moved)) break;
         collided = TRUE;
-        object->x -= vec.x;
+        vec = lvec3_mulf(vec, 1 - moved);
+        vec = lvec3_sub(vec, lvec3_mulf(object->_colnormal, lvec3_dot(vec, object->_colnormal)));
     }
 
-    /* move y and check collision boxes */
-    object->y += vec.y;
-    if (wzObjectCollidesBoxes(object)) {
-        collided = TRUE;
-        object->y -= vec.y;
-    }
+    _MarkObjectMoved(object);
+    return collided;
+}
 
-    /* move z and check collision boxes */
-    object->z += vec.z;
-    if (wzObjectCollidesBoxes(object)) {
-        collided = TRUE;
-        object->z -= vec.z;
-    }
+EXPORT float CALL wzSweepObject(Object* object, float x, float y, float z) {
+    lvec3_t vec;
+    float moved;
 
-    return collided;
+    /* transform movement by object's rotation */
+    vec = lquat_mulvec3(lquat_fromeuler(lvec3_rad(lvec3(object->pitch, object->yaw, object->roll))), lvec3(x, y, z));
+
+    object->_colnormal = lvec3(0, 0, 0);
+    _SweepObject(object, vec, &moved);
+    _MarkObjectMoved(object);
+    return moved;
 }
 
+EXPORT float CALL wzGetObjectCollisionNormalX(const Object* object) { return object->_colnormal.x; }
+
+EXPORT float CALL wzGetObjectCollisionNormalY(const Object* object) { return object->_colnormal.y; }
+
+EXPORT float CALL wzGetObjectCollisionNormalZ(const Object* object) { return object->_colnormal.z; }
+
 EXPORT float CALL wzGetObjectPitch(const Object* object) { return object->pitch; }
 
 EXPORT float CALL wzGetObjectYaw(const Object* object) { return object->yaw; }
@@ -268,6 +342,7 @@ EXPORT void CALL wzSetObjectRotation(Object* object, float pitch, float yaw, flo
     object->pitch = pitch;
     object->yaw = yaw;
     object->roll = roll;
+    _MarkObjectMoved(object);
 }
 
 EXPORT void CALL wzTurnObject(Object* object, float pitch, float yaw, float roll) {
@@ -277,6 +352,7 @@ EXPORT void CALL wzTurnObject(Object* object, float pitch, float yaw, float roll
     object->pitch = vec.x;
     object->yaw = vec.y;
     object->roll = vec.z;
+    _MarkObjectMoved(object);
 }
 
 EXPORT void CALL wzObjectLookAt(Object* object, float x, float y, float z) {
@@ -284,6 +360,7 @@ EXPORT void CALL wzObjectLookAt(Object* object, float x, float y, float z) {
     dir = lvec3_norm(lvec3_sub(lvec3(object->x, object->y, object->z), lvec3(x, y, z)));
     object->pitch = lm_rad2deg((float)asin(-dir.y));
     object->yaw = lm_rad2deg((float)atan2(dir.x, dir.z));
+    _MarkObjectMoved(object);
 }
 
 EXPORT float CALL wzGetObjectScaleX(const Object* object) { return object->sx; }
@@ -314,15 +391,22 @@ EXPORT void CALL wzSetObjectScale(Object* object, float sx, float sy, float sz)
     object->sx = sx;
     object->sy = sy;
     object->sz = sz;
+    _MarkObjectMoved(object);
 }
 
 EXPORT int CALL wzGetObjectCollision(const Object* object) { return object->colmode; }
 
-EXPORT void CALL wzSetObjectCollision(Object* object, int mode) { object->colmode = _Clamp(mode, COL_NONE, COL_BOX); }
+EXPORT void CALL wzSetObjectCollision(Object* object, int mode) {
+    object->colmode = _Clamp(mode, COL_NONE, COL_MESH);
+    _MarkObjectMoved(object);
+}
 
 EXPORT float CALL wzGetObjectRadius(const Object* object) { return object->radius; }
 
-EXPORT void CALL wzSetObjectRadius(Object* object, float radius) { object->radius = radius; }
+EXPORT void CALL wzSetObjectRadius(Object* object, float radius) {
+    object->radius = radius;
+    _MarkObjectMoved(object);
+}
 
 EXPORT bool_t CALL wzObjectCollidesBoxes(Object* object) {
     if (object->colmode == COL_SPHERE) {
@@ -332,45 +416,113 @@ EXPORT bool_t CALL wzObjectCollidesBoxes(Object* object) {
             wzGetObjectMinX(object), wzGetObjectMinY(object), wzGetObjectMinZ(object),
             wzGetObjectMaxX(object), wzGetObjectMaxY(object), wzGetObjectMaxZ(object)
         );
+    } else if (object->colmode == COL_MESH) {
+        ColShape shape;
+        _GetObjectColShape(object, &shape);
+        return _CheckBoxCol(shape.min.x, shape.min.y, shape.min.z, shape.max.x, shape.max.y, shape.max.z);
     } else {
         return FALSE;
     }
 }
 
 EXPORT bool_t CALL wzObjectCollidesObject(Object* object, Object* object2) {
-    if (object != object2 && object->colmode != COL_NONE && object2->colmode != COL_NONE) {
-        if (object->colmode == COL_SPHERE && object2->colmode == COL_SPHERE) {
-            return lcol_spheresphere(
-                object->x, object->y, object->z, object->radius * object->radius,
-                object2->x, object2->y, object2->z, object2->radius * object2->radius
-            ) == 1;
-        } else if (object->colmode == COL_SPHERE && object2->colmode == COL_BOX) {
-            return lcol_boxsphere(
-                wzGetObjectMinX(object2), wzGetObjectMinY(object2), wzGetObjectMinZ(object2),
-                wzGetObjectMaxX(object2), wzGetObjectMaxY(object2), wzGetObjectMaxZ(object2),
-                object->x, object->y, object->z, object->radius * object->radius
-            ) == 1;
-        } else if (object->colmode == COL_BOX && object2->colmode == COL_SPHERE) {
-            return lcol_boxsphere(
-                wzGetObjectMinX(object), wzGetObjectMinY(object), wzGetObjectMinZ(object),
-                wzGetObjectMaxX(object), wzGetObjectMaxY(object), wzGetObjectMaxZ(object),
-                object2->x, object2->y, object2->z, object2->radius * object2->radius
-            ) == 1;
-        } else if (object->colmode == COL_BOX && object2->colmode == COL_BOX) {
-            return lcol_boxbox(
-                wzGetObjectMinX(object), wzGetObjectMinY(object), wzGetObjectMinZ(object),
-                wzGetObjectMaxX(object), wzGetObjectMaxY(object), wzGetObjectMaxZ(object),
-                wzGetObjectMinX(object2), wzGetObjectMinY(object2), wzGetObjectMinZ(object2),
-                wzGetObjectMaxX(object2), wzGetObjectMaxY(object2), wzGetObjectMaxZ(object2)
-            ) == 1;
-        } else {
-            return FALSE; /* should not get here */
+    ColShape shape, shape2;
+
+    if (object == object2 || object->colmode == COL_NONE || object2->colmode == COL_NONE) return FALSE;
+    _GetObjectColShape(object, &shape);
+    _GetObjectColShape(object2, &shape2);
+    return _ColShapesCollide(&shape, &shape2);
+}
+
+EXPORT int CALL wzGetCollisionPairs(Object** out_objects, int max_pairs) {
+    void** candidates = NULL;
+    int num_pairs = 0;
+    int i;
+
+    /* check the pairs of objects whose boxes overlap in the collision tree */
+    _UpdateObjectTree();
+    if (_object_tree) QueryAABBTreePairs(_object_tree, &candidates);
+    for (i = 0; i < sb_count(candidates); i += 2) {
+        if (wzObjectCollidesObject((Object*)candidates[i], (Object*)candidates[i+1])) {
+            if (num_pairs < max_pairs) {
+                out_objects[num_pairs*2] = (Object*)candidates[i];
+                out_objects[num_pairs*2 + 1] = (Object*)candidates[i+1];
+            }
+            ++num_pairs;
         }
-    } else {
-        return FALSE;
     }
+    sb_free(candidates);
+    return num_pairs;
+}
+
+EXPORT int CALL wzQueryObjectsInBox(float minx, float miny, float minz, float maxx, float maxy, float maxz, Object** out_objects, int max_objects) {
+    ColShape shape;
+    shape.mode = COL_BOX;
+    shape.min = lvec3(minx, miny, minz);
+    shape.max = lvec3(maxx, maxy, maxz);
+    return _QueryObjects(&shape, out_objects, max_objects);
+}
+
+EXPORT int CALL wzQueryObjectsInSphere(float x, float y, float z, float radius, Object** out_objects, int max_objects) {
+    ColShape shape;
+    shape.mode = COL_SPHERE;
+    shape.center = lvec3(x, y, z);
+    shape.sq_radius = radius * radius;
+    shape.min = lvec3_sub(shape.center, lvec3(radius, radius, radius));
+    shape.max = lvec3_add(shape.center, lvec3(radius, radius, radius));
+    return _QueryObjects(&shape, out_objects, max_objects);
+}
+
+EXPORT Object* CALL wzRaycastObjects(float x0, float y0, float z0, float x1, float y1, float z1) {
+    void** candidates = NULL;
+    Object* object = NULL;
+    lvec3_t origin, delta;
+    MeshHit hit;
+    int i;
+
+    /* test the meshes of the objects whose boxes are crossed by the segment in the collision tree */
+    origin = lvec3(x0, y0, z0);
+    delta = lvec3(x1 - x0, y1 - y0, z1 - z0);
+    hit.time = 1;
+    _UpdateObjectTree();
+    if (_object_tree) QueryAABBTreeSegment(_object_tree, origin, delta, &candidates);
+    for (i = 0; i < sb_count(candidates); ++i) {
+        if (_RaycastObject((Object*)candidates[i], origin, delta, &hit)) object = (Object*)candidates[i];
+    }
+    sb_free(candidates);
+    _SetRaycastResult(origin, delta, object ? &hit : NULL);
+    return object;
 }
 
+EXPORT bool_t CALL wzRaycastObject(Object* object, float x0, float y0, float z0, float x1, float y1, float z1) {
+    lvec3_t origin, delta;
+    MeshHit hit;
+    bool_t found;
+
+    origin = lvec3(x0, y0, z0);
+    delta = lvec3(x1 - x0, y1 - y0, z1 - z0);
+    hit.time = 1;
+    found = _RaycastObject(object, origin, delta, &hit);
+    _SetRaycastResult(origin, delta, found ? &hit : NULL);
+    return found;
+}
+
+EXPORT float CALL wzGetRaycastDistance() { return _raycast_distance; }
+
+EXPORT float CALL wzGetRaycastX() { return _raycast_point.x; }
+
+EXPORT float CALL wzGetRaycastY() { return _raycast_point.y; }
+
+EXPORT float CALL wzGetRaycastZ() { return _raycast_point.z; }
+
+EXPORT int CALL wzGetRaycastSurface() { return _raycast_hit.buffer; }
+
+EXPORT int CALL wzGetRaycastTriangle() { return _raycast_hit.triangle; }
+
+EXPORT float CALL wzGetRaycastU() { return _raycast_hit.u; }
+
+EXPORT float CALL wzGetRaycastV() { return _raycast_hit.v; }
+
 EXPORT int CALL wzGetObjectAnimMode(const Object* object) { return object->animmode; }
 
 EXPORT void CALL wzSetObjectAnimMode(Object* object, int mode) { object->animmode = _Clamp(mode, ANIM_STOP, ANIM_LOOP); }
@@ -410,12 +562,17 @@ EXPORT int CALL wzAddTriangle(Object* object, int buffer, int v0, int v1, int v2
     return AddMeshTriangle(object->_mesh, buffer, v0, v1, v2);
 }
 
-EXPORT void CALL wzRebuildObjectMesh(Object* object) { RebuildMesh(object->_mesh); }
+EXPORT void CALL wzRebuildObjectMesh(Object* object) {
+    RebuildMesh(object->_mesh);
+    _MarkMeshObjectsMoved(object);
+}
 
 EXPORT Material* CALL wzGetObjectMaterial(Object* object, int index) { return &object->_materials[index]; }
 
 EXPORT void CALL wzDrawObject(Object* object) {
     lmat4_t modelview;
+    float screen_size;
+    int i;
 
     /* calculate animation */
     if (object->animmode != ANIM_STOP) {
@@ -431,9 +588,11 @@ EXPORT void CALL wzDrawObject(Object* object) {
         }
         _AnimateMesh(object->_mesh, object->animframe);
         RebuildMesh(object->_mesh);
+        _MarkMeshObjectsMoved(object);
     } else if (object->animframe != 0) {
         _AnimateMesh(object->_mesh, 0);
         RebuildMesh(object->_mesh);
+        _MarkMeshObjectsMoved(object);
         object->animframe = 0;
     }
 
@@ -445,6 +604,15 @@ EXPORT void CALL wzDrawObject(Object* object) {
     modelview = lmat4_mul(*(const lmat4_t*)_GetActiveMatrix(), modelview);
     lgfx_setmodelview(modelview.m);
 
+    /* request texture levels for the size of the object on screen */
+    screen_size = _GetViewerScreenSize(
+        _Max(_Max(GetMeshWidth(object->_mesh) * fabs(object->sx), GetMeshHeight(object->_mesh) * fabs(object->sy)), GetMeshDepth(object->_mesh) * fabs(object->sz)),
+        modelview.m[14]);
+    for (i = 0; i < sb_count(object->_materials); ++i) {
+        _RequestTextureSize(wzGetMaterialTexture(&object->_materials[i]), screen_size);
+        _RequestTextureSize(wzGetMaterialLightmap(&object->_materials[i]), screen_size);
+    }
+
     /* set properties & draw */
     _DrawMesh(object->_mesh, object->_materials);
 }
@@ -452,3 +620,283 @@ EXPORT void CALL wzDrawObject(Object* object) {
 EXPORT float CALL wzGetDefaultAnimFPS() { return _object_animfps; }
 
 EXPORT void CALL wzSetDefaultAnimFPS(float fps) { _object_animfps = fps; }
+
+Mesh* _GetObjectMesh(const Object* object) { return object->_mesh; }
+
+Object* _GetNextSharedObject(const Object* object) { return object->_next_shared; }
+
+static void _MarkObjectMoved(Object* object) {
+    /* the tree is updated the next time it is queried */
+    if (!object->_moved && (object->colmode != COL_NONE || object->_proxy != -1)) {
+        object->_moved = TRUE;
+        sb_push(_moved_objects, object);
+    }
+}
+
+static void _MarkMeshObjectsMoved(Object* object) {
+    /* the bounds of the mesh change for all the objects that share it */
+    Object* shared = object;
+    do {
+        _MarkObjectMoved(shared);
+        shared = shared->_next_shared;
+    } while (shared != object);
+}
+
+static void _UpdateObjectTree() {
+    int i;
+
+    if (sb_count(_moved_objects) > 0 && !_object_tree) _object_tree = CreateAABBTree();
+    for (i = 0; i < sb_count(_moved_objects); ++i) {
+        Object* object = _moved_objects[i];
+        object->_moved = FALSE;
+        if (object->colmode == COL_NONE) {
+            if (object->_proxy != -1) RemoveAABBTreeProxy(_object_tree, object->_proxy);
+            object->_proxy = -1;
+        } else {
+            ColShape shape;
+            lvec3_t min, max;
+            float margin;
+
+            /* boxes in the tree contain both the collision shape and the mesh, so they can be used for raycasts */
+            _GetObjectColShape(object, &shape);
+            _GetObjectMeshBounds(object, &min, &max);
+            shape.min = lvec3(_Min(shape.min.x, min.x), _Min(shape.min.y, min.y), _Min(shape.min.z, min.z));
+            shape.max = lvec3(_Max(shape.max.x, max.x), _Max(shape.max.y, max.y), _Max(shape.max.z, max.z));
+            margin = OBJECT_TREE_MARGIN * _Max(_Max(shape.max.x - shape.min.x, shape.max.y - shape.min.y), shape.max.z - shape.min.z);
+            if (object->_proxy == -1) object->_proxy = InsertAABBTreeProxy(_object_tree, shape.min, shape.max, margin, object);
+            else MoveAABBTreeProxy(_object_tree, object->_proxy, shape.min, shape.max, margin);
+        }
+    }
+    if (_moved_objects) stb__sbn(_moved_objects) = 0;
+}
+
+static bool_t _SweepObject(Object* object, lvec3_t vec, float* moved) {
+    ColShape shape;
+    float normal[3];
+    float time;
+
+    if (object->colmode == COL_NONE) {
+        time = 1;
+    } else {
+        /* meshes are swept as their bounding box */
+        _GetObjectColShape(object, &shape);
+        if (object->colmode == COL_SPHERE) {
+            time = _SweepSphereCol(shape.center.x, shape.center.y, shape.center.z, object->radius, vec.x, vec.y, vec.z, normal);
+        } else {
+            time = _SweepBoxCol(shape.min.x, shape.min.y, shape.min.z, shape.max.x, shape.max.y, shape.max.z, vec.x, vec.y, vec.z, normal);
+        }
+        if (object->colmode != COL_MESH) _SweepMeshObjects(object, &shape, vec, &time, normal);
+    }
+
+    /* stop short of the box along its normal */
+    *moved = 1;
+    if (time < 1) {
+        object->_colnormal = lvec3(normal[0], normal[1], normal[2]);
+        *moved = _Max(0, time - OBJECT_SWEEP_SKIN / (float)fabs(lvec3_dot(vec, object->_colnormal)));
+    }
+    object->x += vec.x * *moved;
+    object->y += vec.y * *moved;
+    object->z += vec.z * *moved;
+    return time < 1;
+}
+
+static void _SweepMeshObjects(const Object* object, const ColShape* shape, lvec3_t vec, float* time, float* normal) {
+    void** candidates = NULL;
+    lvec3_t min, max;
+    int i, j;
+
+    /* test the triangles of the meshes around the whole movement */
+    min = lvec3(_Min(shape->min.x, shape->min.x + vec.x), _Min(shape->min.y, shape->min.y + vec.y), _Min(shape->min.z, shape->min.z + vec.z));
+    max = lvec3(_Max(shape->max.x, shape->max.x + vec.x), _Max(shape->max.y, shape->max.y + vec.y), _Max(shape->max.z, shape->max.z + vec.z));
+    _UpdateObjectTree();
+    if (_object_tree) QueryAABBTree(_object_tree, min, max, &candidates);
+    for (i = 0; i < sb_count(candidates); ++i) {
+        const Object* mesh_object = (const Object*)candidates[i];
+        int count;
+        if (mesh_object == object || mesh_object->colmode != COL_MESH) continue;
+        count = _GetObjectTriangles(mesh_object, min, max);
+        for (j = 0; j < count; ++j) {
+            float tri_normal[3];
+            float tri_time;
+            if (shape->mode == COL_SPHERE) {
+                tri_time = lcol_sweepspheretri(
+                    shape->center.x, shape->center.y, shape->center.z, object->radius,
+                    vec.x, vec.y, vec.z, &_object_triangles[j*9], tri_normal);
+            } else {
+                tri_time = lcol_sweepboxtri(
+                    shape->min.x, shape->min.y, shape->min.z, shape->max.x, shape->max.y, shape->max.z,
+                    vec.x, vec.y, vec.z, &_object_triangles[j*9], tri_normal);
+            }
+            if (tri_time < *time) {
+                *time = tri_time;
+                normal[0] = tri_normal[0];
+                normal[1] = tri_normal[1];
+                normal[2] = tri_normal[2];
+            }
+        }
+    }
+    sb_free(candidates);
+}
+
+static void _GetObjectColShape(const Object* object, ColShape* shape) {
+    shape->mode = object->colmode;
+    if (object->colmode == COL_SPHERE) {
+        shape->center = lvec3(object->x, object->y, object->z);
+        shape->sq_radius = object->radius * object->radius;
+        shape->min = lvec3_sub(shape->center, lvec3(object->radius, object->radius, object->radius));
+        shape->max = lvec3_add(shape->center, lvec3(object->radius, object->radius, object->radius));
+    } else if (object->colmode == COL_MESH) {
+        shape->object = object;
+        _GetObjectMeshBounds(object, &shape->min, &shape->max);
+    } else {
+        shape->min = lvec3(wzGetObjectMinX(object), wzGetObjectMinY(object), wzGetObjectMinZ(object));
+        shape->max = lvec3(wzGetObjectMaxX(object), wzGetObjectMaxY(object), wzGetObjectMaxZ(object));
+    }
+}
+
+/* world bounds of the rotated and scaled mesh */
+static void _GetObjectMeshBounds(const Object* object, lvec3_t* min, lvec3_t* max) {
+    lquat_t q;
+    lvec3_t center, extents;
+
+    q = lquat_fromeuler(lvec3_rad(lvec3(object->pitch, object->yaw, object->roll)));
+    center = lvec3(
+        (GetMeshBoxMinX(object->_mesh) + GetMeshBoxMaxX(object->_mesh)) * 0.5f * object->sx,
+        (GetMeshBoxMinY(object->_mesh) + GetMeshBoxMaxY(object->_mesh)) * 0.5f * object->sy,
+        (GetMeshBoxMinZ(object->_mesh) + GetMeshBoxMaxZ(object->_mesh)) * 0.5f * object->sz);
+    center = lvec3_add(lvec3(object->x, object->y, object->z), lquat_mulvec3(q, center));
+    extents = _RotateExtents(q, lvec3(wzGetObjectWidth(object) * 0.5f, wzGetObjectHeight(object) * 0.5f, wzGetObjectDepth(object) * 0.5f));
+    *min = lvec3_sub(center, extents);
+    *max = lvec3_add(center, extents);
+}
+
+/* stores in _object_triangles the triangles of the mesh which may touch the box, in world coordinates */
+static int _GetObjectTriangles(const Object* object, lvec3_t min, lvec3_t max) {
+    lquat_t q;
+    lvec3_t pos, scale, center, extents;
+    int count, i;
+
+    /* get the bounds of the box in the space of the mesh */
+    q = lquat_fromeuler(lvec3_rad(lvec3(object->pitch, object->yaw, object->roll)));
+    pos = lvec3(object->x, object->y, object->z);
+    scale = lvec3(object->sx, object->sy, object->sz);
+    center = lvec3_mulf(lvec3_add(min, max), 0.5f);
+    center = lvec3_div(lquat_mulvec3(lquat_conj(q), lvec3_sub(center, pos)), scale);
+    extents = _RotateExtents(lquat_conj(q), lvec3_mulf(lvec3_sub(max, min), 0.5f));
+    extents = lvec3_div(extents, lvec3((float)fabs(scale.x), (float)fabs(scale.y), (float)fabs(scale.z)));
+
+    if (_object_triangles) stb__sbn(_object_triangles) = 0;
+    count = _GetMeshTriangles(object->_mesh, lvec3_sub(center, extents), lvec3_add(center, extents), &_object_triangles);
+    for (i = 0; i < count * 3; ++i) {
+        float* v = &_object_triangles[i*3];
+        lvec3_t p = lvec3_add(pos, lquat_mulvec3(q, lvec3_mul(lvec3(v[0], v[1], v[2]), scale)));
+        v[0] = p.x;
+        v[1] = p.y;
+        v[2] = p.z;
+    }
+    return count;
+}
+
+/* half size of the box that contains a box with the given half size after rotating it */
+static lvec3_t _RotateExtents(lquat_t q, lvec3_t extents) {
+    lvec3_t axis_x, axis_y, axis_z;
+
+    axis_x = lquat_mulvec3(q, lvec3(extents.x, 0, 0));
+    axis_y = lquat_mulvec3(q, lvec3(0, extents.y, 0));
+    axis_z = lquat_mulvec3(q, lvec3(0, 0, extents.z));
+    return lvec3(
+        (float)(fabs(axis_x.x) + fabs(axis_y.x) + fabs(axis_z.x)),
+        (float)(fabs(axis_x.y) + fabs(axis_y.y) + fabs(axis_z.y)),
+        (float)(fabs(axis_x.z) + fabs(axis_y.z) + fabs(axis_z.z)));
+}
+
+/* the segment is moved to the space of the mesh. the fraction of the segment where it hits does not change */
+static bool_t _RaycastObject(const Object* object, lvec3_t origin, lvec3_t delta, MeshHit* hit) {
+    lquat_t inv_q;
+    lvec3_t scale;
+
+    inv_q = lquat_conj(lquat_fromeuler(lvec3_rad(lvec3(object->pitch, object->yaw, object->roll))));
+    scale = lvec3(object->sx, object->sy, object->sz);
+    origin = lvec3_div(lquat_mulvec3(inv_q, lvec3_sub(origin, lvec3(object->x, object->y, object->z))), scale);
+    delta = lvec3_div(lquat_mulvec3(inv_q, delta), scale);
+    return _RaycastMesh(object->_mesh, origin, delta, hit);
+}
+
+static void _SetRaycastResult(lvec3_t origin, lvec3_t delta, const MeshHit* hit) {
+    if (hit) {
+        _raycast_hit = *hit;
+        _raycast_point = lvec3_add(origin, lvec3_mulf(delta, hit->time));
+        _raycast_distance = hit->time * lvec3_length(delta);
+    } else {
+        _raycast_hit.time = 0;
+        _raycast_hit.buffer = -1;
+        _raycast_hit.triangle = -1;
+        _raycast_hit.u = _raycast_hit.v = 0;
+        _raycast_point = lvec3(0, 0, 0);
+        _raycast_distance = 0;
+    }
+}
+
+static bool_t _ColShapesCollide(const ColShape* shape, const ColShape* shape2) {
+    if (shape->mode == COL_SPHERE && shape2->mode == COL_SPHERE) {
+        return lcol_spheresphere(
+            shape->center.x, shape->center.y, shape->center.z, shape->sq_radius,
+            shape2->center.x, shape2->center.y, shape2->center.z, shape2->sq_radius
+        ) == 1;
+    } else if (shape->mode == COL_SPHERE && shape2->mode == COL_BOX) {
+        return lcol_boxsphere(
+            shape2->min.x, shape2->min.y, shape2->min.z, shape2->max.x, shape2->max.y, shape2->max.z,
+            shape->center.x, shape->center.y, shape->center.z, shape->sq_radius
+        ) == 1;
+    } else if (shape->mode == COL_BOX && shape2->mode == COL_SPHERE) {
+        return lcol_boxsphere(
+            shape->min.x, shape->min.y, shape->min.z, shape->max.x, shape->max.y, shape->max.z,
+            shape2->center.x, shape2->center.y, shape2->center.z, shape2->sq_radius
+        ) == 1;
+    } else if (shape->mode == COL_BOX && shape2->mode == COL_BOX) {
+        return lcol_boxbox(
+            shape->min.x, shape->min.y, shape->min.z, shape->max.x, shape->max.y, shape->max.z,
+            shape2->min.x, shape2->min.y, shape2->min.z, shape2->max.x, shape2->max.y, shape2->max.z
+        ) == 1;
+    } else if (shape->mode == COL_MESH && shape2->mode != COL_MESH) {
+        return _MeshCollidesShape(shape->object, shape2);
+    } else if (shape->mode != COL_MESH && shape2->mode == COL_MESH) {
+        return _MeshCollidesShape(shape2->object, shape);
+    } else {
+        return FALSE; /* meshes do not collide with each other */
+    }
+}
+
+static bool_t _MeshCollidesShape(const Object* object, const ColShape* shape) {
+    int count, i;
+
+    count = _GetObjectTriangles(object, shape->min, shape->max);
+    for (i = 0; i < count; ++i) {
+        const float* tri = &_object_triangles[i*9];
+        if (shape->mode == COL_SPHERE) {
+            if (lcol_spheretri(shape->center.x, shape->center.y, shape->center.z, shape->sq_radius, tri)) return TRUE;
+        } else {
+            if (lcol_boxtri(shape->min.x, shape->min.y, shape->min.z, shape->max.x, shape->max.y, shape->max.z, tri)) return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static int _QueryObjects(const ColShape* shape, Object** out_objects, int max_objects) {
+    void** candidates = NULL;
+    int num_objects = 0;
+    int i;
+
+    _UpdateObjectTree();
+    if (_object_tree) QueryAABBTree(_object_tree, shape->min, shape->max, &candidates);
+    for (i = 0; i < sb_count(candidates); ++i) {
+        ColShape object_shape;
+        _GetObjectColShape((Object*)candidates[i], &object_shape);
+        if (_ColShapesCollide(shape, &object_shape)) {
+            if (num_objects < max_objects) out_objects[num_objects] = (Object*)candidates[i];
+            ++num_objects;
+        }
+    }
+    sb_free(candidates);
+    return num_objects;
+}
@@ -10,6 +10,7 @@
 #define COL_NONE 0
 #define COL_SPHERE 1
 #define COL_BOX 2
+#define COL_MESH 3
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,6 +21,7 @@ EXPORT Object* CALL wzCreateCube();
 EXPORT Object* CALL wzCreateQuad();
 EXPORT Object* CALL wzCreateTriangle();
 EXPORT Object* CALL wzLoadObject(const char* filename);
+EXPORT bool_t CALL wzSaveObject(const Object* object, const char* filename);
 EXPORT Object* CALL wzCloneObject(const Object* object);
 EXPORT void CALL wzDeleteObject(Object* object);
 EXPORT float CALL wzGetObjectX(const Object* object);
@@ -27,6 +29,10 @@ EXPORT float CALL wzGetObjectY(const Object* object);
 EXPORT float CALL wzGetObjectZ(const Object* object);
 EXPORT void CALL wzSetObjectPosition(Object* object, float x, float y, float z);
 EXPORT bool_t CALL wzMoveObject(Object* object, float x, float y, float z);
+EXPORT float CALL wzSweepObject(Object* object, float x, float y, float z);
+EXPORT float CALL wzGetObjectCollisionNormalX(const Object* object);
+EXPORT float CALL wzGetObjectCollisionNormalY(const Object* object);
+EXPORT float CALL wzGetObjectCollisionNormalZ(const Object* object);
 EXPORT float CALL wzGetObjectPitch(const Object* object);
 EXPORT float CALL wzGetObjectYaw(const Object* object);
 EXPORT float CALL wzGetObjectRoll(const Object* object);
@@ -52,6 +58,19 @@ EXPORT float CALL wzGetObjectRadius(const Object* object);
 EXPORT void CALL wzSetObjectRadius(Object* object, float radius);
 EXPORT bool_t CALL wzObjectCollidesBoxes(Object* object);
 EXPORT bool_t CALL wzObjectCollidesObject(Object* object, Object* object2);
+EXPORT int CALL wzGetCollisionPairs(Object** out_objects, int max_pairs);
+EXPORT int CALL wzQueryObjectsInBox(float minx, float miny, float minz, float maxx, float maxy, float maxz, Object** out_objects, int max_objects);
+EXPORT int CALL wzQueryObjectsInSphere(float x, float y, float z, float radius, Object** out_objects, int max_objects);
+EXPORT Object* CALL wzRaycastObjects(float x0, float y0, float z0, float x1, float y1, float z1);
+EXPORT bool_t CALL wzRaycastObject(Object* object, float x0, float y0, float z0, float x1, float y1, float z1);
+EXPORT float CALL wzGetRaycastDistance();
+EXPORT float CALL wzGetRaycastX();
+EXPORT float CALL wzGetRaycastY();
+EXPORT float CALL wzGetRaycastZ();
+EXPORT int CALL wzGetRaycastSurface();
+EXPORT int CALL wzGetRaycastTriangle();
+EXPORT float CALL wzGetRaycastU();
+EXPORT float CALL wzGetRaycastV();
 EXPORT int CALL wzGetObjectAnimMode(const Object* object);
 EXPORT void CALL wzSetObjectAnimMode(Object* object, int mode);
 EXPORT float CALL wzGetObjectAnimSpeed(const Object* object);
@@ -73,6 +92,11 @@ EXPORT void CALL wzDrawObject(Object* object);
 EXPORT float CALL wzGetDefaultAnimFPS();
 EXPORT void CALL wzSetDefaultAnimFPS(float fps);
 
+#ifndef SWIG
+Mesh* _GetObjectMesh(const Object* object);
+Object* _GetNextSharedObject(const Object* object);
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -1,14 +1,50 @@
+#include "../lib/litelibs/litegfx.h"
+#include "../lib/litelibs/litetexfile.h"
 #include "../lib/stb/stb_image.h"
+#include "../lib/stb/stb_image_resize.h"
+#include "material.h"
 #include "memblock.h"
 #include "pixmap.h"
 #include "util.h"
+#include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PIXMAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#define PARALLEL_MINPIXELS 65536 /* bulk operations on fewer pixels run on the calling thread */
+#define DIV255(X) (((X) + 128 + (((X) + 128) >> 8)) >> 8) /* exact rounded division of a product of two bytes */
 
 typedef struct SPixmap {
     int* pixels;
     int width;
     int height;
+    int dirty_x0, dirty_y0, dirty_x1, dirty_y1; /* region modified since last texture update */
 } Pixmap;
 
+typedef struct {
+    Pixmap* pixmap;
+    const Pixmap* src;
+    int x, y; /* top left corner of the rect in the pixmap */
+    int src_x, src_y; /* top left corner of the rect in the source pixmap */
+    int width; /* width of the rect, rows are the items of the job */
+    int mode; /* blend mode or texture format */
+    int color;
+} PixmapJob;
+
+static void _SetPixmapDirty(Pixmap* pixmap);
+static void _ExpandPixmapDirty(Pixmap* pixmap, int x, int y, int width, int height);
+static bool_t _ClipRect(int max_width, int max_height, int* x, int* y, int* width, int* height, int* other_x, int* other_y);
+static void _RunPixmapJob(ParallelJob func, PixmapJob* job, int width, int height);
+static void _FillPixmapRows(void* data, int begin, int end);
+static void _BlitPixmapRows(void* data, int begin, int end);
+static void _MaskPixmapRows(void* data, int begin, int end);
+static void _PremultiplyPixmapRows(void* data, int begin, int end);
+static void _ConvertPixmapRows(void* data, int begin, int end);
+static void _ResizePixmapRows(void* data, int begin, int end);
+static void _BlendPixels(unsigned char* dst, const unsigned char* src, int count, int mode);
+static void _PremultiplyPixels(unsigned char* pixels, int count);
+
 EXPORT Pixmap* CALL wzCreatePixmap(const Memblock* memblock) {
     return _CreateEmptyPixmapFromData((const unsigned char*)memblock, wzGetMemblockSize(memblock));
 }
@@ -18,6 +54,7 @@ EXPORT Pixmap* CALL wzCreateEmptyPixmap(int width, int height) {
     pixmap->pixels = _AllocMany(int, width * height);
     pixmap->width = width;
     pixmap->height = height;
+    _SetPixmapDirty(pixmap);
     return pixmap;
 }
 
@@ -53,13 +90,149 @@ EXPORT int CALL wzGetPixmapColor(const Pixmap* pixmap, int x, int y) {
 
 EXPORT void CALL wzSetPixmapColor(Pixmap* pixmap, int x, int y, int color) {
     pixmap->pixels[y*pixmap->width + x] = color;
+    _ExpandPixmapDirty(pixmap, x, y, 1, 1);
+}
+
+EXPORT void CALL wzFillPixmap(Pixmap* pixmap, int x, int y, int width, int height, int color) {
+    PixmapJob job;
+
+    if (!_ClipRect(pixmap->width, pixmap->height, &x, &y, &width, &height, NULL, NULL)) return;
+    job.pixmap = pixmap;
+    job.x = x;
+    job.y = y;
+    job.width = width;
+    job.color = color;
+    _RunPixmapJob(_FillPixmapRows, &job, width, height);
+    _ExpandPixmapDirty(pixmap, x, y, width, height);
+}
+
+EXPORT void CALL wzBlitPixmap(Pixmap* pixmap, const Pixmap* src, int x, int y, int src_x, int src_y, int width, int height, int blend) {
+    Pixmap copy;
+    PixmapJob job;
+    int row;
+
+    /* clip to both pixmaps */
+    if (!_ClipRect(src->width, src->height, &src_x, &src_y, &width, &height, &x, &y)) return;
+    if (!_ClipRect(pixmap->width, pixmap->height, &x, &y, &width, &height, &src_x, &src_y)) return;
+
+    /* rows are processed in any order, so blitting within the same pixmap reads from a copy */
+    copy.pixels = NULL;
+    if (src == pixmap) {
+        copy.pixels = _AllocMany(int, width * height);
+        copy.width = width;
+        copy.height = height;
+        for (row = 0; row < height; ++row) {
+            memcpy(&copy.pixels[row * width], &src->pixels[(src_y + row) * src->width + src_x], width * sizeof(int));
+        }
+        src = &copy;
+        src_x = 0;
+        src_y = 0;
+    }
+
+    job.pixmap = pixmap;
+    job.src = src;
+    job.x = x;
+    job.y = y;
+    job.src_x = src_x;
+    job.src_y = src_y;
+    job.width = width;
+    job.mode = blend;
+    _RunPixmapJob(_BlitPixmapRows, &job, width, height);
+    _ExpandPixmapDirty(pixmap, x, y, width, height);
+
+    free(copy.pixels);
+}
+
+EXPORT void CALL wzMaskPixmap(Pixmap* pixmap, int color) {
+    PixmapJob job;
+
+    job.pixmap = pixmap;
+    job.color = color;
+    _RunPixmapJob(_MaskPixmapRows, &job, pixmap->width, pixmap->height);
+    _SetPixmapDirty(pixmap);
+}
+
+EXPORT void CALL wzPremultiplyPixmap(Pixmap* pixmap) {
+    PixmapJob job;
+
+    job.pixmap = pixmap;
+    _RunPixmapJob(_PremultiplyPixmapRows, &job, pixmap->width, pixmap->height);
+    _SetPixmapDirty(pixmap);
+}
+
+EXPORT void CALL wzConvertPixmap(Pixmap* pixmap, int format) {
+    PixmapJob job;
+
+    job.pixmap = pixmap;
+    job.width = pixmap->width;
+    job.mode = format;
+    _RunPixmapJob(_ConvertPixmapRows, &job, pixmap->width, pixmap->height);
+    _SetPixmapDirty(pixmap);
+}
+
+EXPORT void CALL wzResizePixmap(Pixmap* pixmap, int width, int height) {
+    Pixmap resized;
+    PixmapJob job;
+
+    if (width <= 0 || height <= 0 || (width == pixmap->width && height == pixmap->height)) return;
+
+    /* each thread resizes the region of the source that maps to its rows */
+    resized.pixels = _AllocMany(int, width * height);
+    resized.width = width;
+    resized.height = height;
+    job.pixmap = &resized;
+    job.src = pixmap;
+    _RunPixmapJob(_ResizePixmapRows, &job, width, height);
+
+    free(pixmap->pixels);
+    pixmap->pixels = resized.pixels;
+    pixmap->width = width;
+    pixmap->height = height;
+    _SetPixmapDirty(pixmap);
+}
+
+EXPORT void CALL wzFlipPixmap(Pixmap* pixmap, bool_t horizontal, bool_t vertical) {
+    int* row;
+    int* other;
+    int x, y, tmp;
+
+    if (horizontal) {
+        for (y = 0; y < pixmap->height; ++y) {
+            row = &pixmap->pixels[y * pixmap->width];
+            for (x = 0; x < pixmap->width / 2; ++x) {
+                tmp = row[x];
+                row[x] = row[pixmap->width - 1 - x];
+                row[pixmap->width - 1 - x] = tmp;
+            }
+        }
+    }
+    if (vertical) {
+        for (y = 0; y < pixmap->height / 2; ++y) {
+            row = &pixmap->pixels[y * pixmap->width];
+            other = &pixmap->pixels[(pixmap->height - 1 - y) * pixmap->width];
+            for (x = 0; x < pixmap->width; ++x) {
+                tmp = row[x];
+                row[x] = other[x];
+                other[x] = tmp;
+            }
+        }
+    }
+    _SetPixmapDirty(pixmap);
 }
 
 Pixmap* _CreateEmptyPixmapFromData(const unsigned char* data, size_t len) {
+    ltexfile_t file;
     unsigned char* buffer;
     int w, h;
     Pixmap* pixmap;
 
+    /* dds and ktx files are decoded from their first level */
+    if (ltexfile_loadmem(data, len, &file)) {
+        pixmap = wzCreateEmptyPixmap(file.levels[0].width, file.levels[0].height);
+        ltexfile_decompress(&file, 0, (unsigned char*)pixmap->pixels);
+        return pixmap;
+    }
+
     /* load buffer */
     buffer = stbi_load_from_memory(data, len, &w, &h, NULL, 4);
     if (!buffer) return NULL;
@@ -69,6 +242,7 @@ Pixmap* _CreateEmptyPixmapFromData(const unsigned char* data, size_t len) {
     pixmap->pixels = (int*)buffer;
     pixmap->width = w;
     pixmap->height = h;
+    _SetPixmapDirty(pixmap);
 
     return pixmap;
 }
@@ -76,3 +250,216 @@ Pixmap* _CreateEmptyPixmapFromData(const unsigned char* data, size_t len) {
 const void* _GetPixmapPtr(const Pixmap* pixmap) {
     return pixmap->pixels;
 }
+
+bool_t _GetPixmapDirtyRect(const Pixmap* pixmap, int* x, int* y, int* width, int* height) {
+    *x = pixmap->dirty_x0;
+    *y = pixmap->dirty_y0;
+    *width = pixmap->dirty_x1 - pixmap->dirty_x0;
+    *height = pixmap->dirty_y1 - pixmap->dirty_y0;
+    return *width > 0 && *height > 0;
+}
+
+static void _SetPixmapDirty(Pixmap* pixmap) {
+    pixmap->dirty_x0 = 0;
+    pixmap->dirty_y0 = 0;
+    pixmap->dirty_x1 = pixmap->width;
+    pixmap->dirty_y1 = pixmap->height;
+}
+
+void _ClearPixmapDirty(Pixmap* pixmap) {
+    pixmap->dirty_x0 = pixmap->width;
+    pixmap->dirty_y0 = pixmap->height;
+    pixmap->dirty_x1 = 0;
+    pixmap->dirty_y1 = 0;
+}
+
+static void _ExpandPixmapDirty(Pixmap* pixmap, int x, int y, int width, int height) {
+    if (x < pixmap->dirty_x0) pixmap->dirty_x0 = x;
+    if (y < pixmap->dirty_y0) pixmap->dirty_y0 = y;
+    if (x + width > pixmap->dirty_x1) pixmap->dirty_x1 = x + width;
+    if (y + height > pixmap->dirty_y1) pixmap->dirty_y1 = y + height;
+}
+
+static bool_t _ClipRect(int max_width, int max_height, int* x, int* y, int* width, int* height, int* other_x, int* other_y) {
+    /* the corner of the other rect moves along with this one */
+    if (*x < 0) {
+        *width += *x;
+        if (other_x) *other_x -= *x;
+        *x = 0;
+    }
+    if (*y < 0) {
+        *height += *y;
+        if (other_y) *other_y -= *y;
+        *y = 0;
+    }
+    *width = _Min(*width, max_width - *x);
+    *height = _Min(*height, max_height - *y);
+    return *width > 0 && *height > 0;
+}
+
+static void _RunPixmapJob(ParallelJob func, PixmapJob* job, int width, int height) {
+    RunParallel(func, job, height, _Max(PARALLEL_MINPIXELS / _Max(width, 1), 1));
+}
+
+static void _FillPixmapRows(void* data, int begin, int end) {
+    const PixmapJob* job = (const PixmapJob*)data;
+    int* row;
+    int x, y;
+
+    for (y = begin; y < end; ++y) {
+        row = &job->pixmap->pixels[(job->y + y) * job->pixmap->width + job->x];
+        for (x = 0; x < job->width; ++x) row[x] = job->color;
+    }
+}
+
+static void _BlitPixmapRows(void* data, int begin, int end) {
+    const PixmapJob* job = (const PixmapJob*)data;
+    int* row;
+    const int* src_row;
+    int y;
+
+    for (y = begin; y < end; ++y) {
+        row = &job->pixmap->pixels[(job->y + y) * job->pixmap->width + job->x];
+        src_row = &job->src->pixels[(job->src_y + y) * job->src->width + job->src_x];
+        if (job->mode == BLEND_ALPHA || job->mode == BLEND_ADD || job->mode == BLEND_MUL) {
+            _BlendPixels((unsigned char*)row, (const unsigned char*)src_row, job->width, job->mode);
+        } else {
+            memcpy(row, src_row, job->width * sizeof(int));
+        }
+    }
+}
+
+static void _MaskPixmapRows(void* data, int begin, int end) {
+    const PixmapJob* job = (const PixmapJob*)data;
+    unsigned int* pixels;
+    unsigned int key;
+    int i, count;
+
+    /* pixels with the rgb of the color become fully transparent */
+    pixels = (unsigned int*)&job->pixmap->pixels[begin * job->pixmap->width];
+    count = (end - begin) * job->pixmap->width;
+    key = (unsigned int)job->color & 0x00ffffff;
+    for (i = 0; i < count; ++i) {
+        if ((pixels[i] & 0x00ffffff) == key) pixels[i] &= 0x00ffffff;
+    }
+}
+
+static void _PremultiplyPixmapRows(void* data, int begin, int end) {
+    const PixmapJob* job = (const PixmapJob*)data;
+    _PremultiplyPixels((unsigned char*)&job->pixmap->pixels[begin * job->pixmap->width], (end - begin) * job->pixmap->width);
+}
+
+static void _ConvertPixmapRows(void* data, int begin, int end) {
+    const PixmapJob* job = (const PixmapJob*)data;
+    unsigned char* buffer;
+    unsigned char* row;
+    int y;
+
+    buffer = _AllocMany(unsigned char, job->width * 4);
+    for (y = begin; y < end; ++y) {
+        row = (unsigned char*)&job->pixmap->pixels[y * job->pixmap->width];
+        ltex_fromrgba(job->mode, row, job->width, buffer);
+        ltex_torgba(job->mode, buffer, job->width, row);
+    }
+    free(buffer);
+}
+
+static void _ResizePixmapRows(void* data, int begin, int end) {
+    const PixmapJob* job = (const PixmapJob*)data;
+
+    stbir_resize_region(
+        job->src->pixels, job->src->width, job->src->height, 0,
+        &job->pixmap->pixels[begin * job->pixmap->width], job->pixmap->width, end - begin, 0,
+        STBIR_TYPE_UINT8, 4, 3, 0,
+        STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP,
+        STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT,
+        STBIR_COLORSPACE_SRGB, NULL,
+        0, begin / (float)job->pixmap->height, 1, end / (float)job->pixmap->height);
+}
+
+#ifdef PIXMAP_SSE2
+/* DIV255(x * y) for each byte of four pixels */
+static __m128i _MulPixels(__m128i x, __m128i y) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi16(128);
+    __m128i lo, hi;
+
+    lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(x, zero), _mm_unpacklo_epi8(y, zero)), half);
+    hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(x, zero), _mm_unpackhi_epi8(y, zero)), half);
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+    return _mm_packus_epi16(lo, hi);
+}
+
+/* copies the alpha of each pixel to all its bytes */
+static __m128i _SplatAlpha(__m128i pixels) {
+    __m128i alpha = _mm_srli_epi32(pixels, 24);
+    alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+    return _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+}
+#endif
+
+static void _BlendPixels(unsigned char* dst, const unsigned char* src, int count, int mode) {
+    unsigned char* d;
+    const unsigned char* s;
+    int i = 0;
+    int a, c;
+
+    /* the vector and scalar paths compute exactly the same values */
+#ifdef PIXMAP_SSE2
+    const __m128i alpha_mask = _mm_set1_epi32((int)0xff000000);
+    const __m128i ones = _mm_set1_epi32(-1);
+    for (; i + 4 <= count; i += 4) {
+        __m128i vs = _mm_loadu_si128((const __m128i*)&src[i*4]);
+        __m128i vd = _mm_loadu_si128((const __m128i*)&dst[i*4]);
+        __m128i va = _SplatAlpha(vs);
+        switch (mode) {
+            case BLEND_ALPHA:
+                vd = _mm_adds_epu8(_MulPixels(_mm_or_si128(vs, alpha_mask), va), _MulPixels(vd, _mm_xor_si128(va, ones)));
+                break;
+            case BLEND_ADD:
+                vd = _mm_adds_epu8(vd, _MulPixels(vs, _mm_andnot_si128(alpha_mask, va)));
+                break;
+            case BLEND_MUL:
+                vd = _MulPixels(vd, _mm_or_si128(vs, alpha_mask));
+                break;
+        }
+        _mm_storeu_si128((__m128i*)&dst[i*4], vd);
+    }
+#endif
+    for (; i < count; ++i) {
+        d = &dst[i*4];
+        s = &src[i*4];
+        a = s[3];
+        switch (mode) {
+            case BLEND_ALPHA:
+                for (c = 0; c < 3; ++c) d[c] = (unsigned char)(DIV255(s[c] * a) + DIV255(d[c] * (255 - a)));
+                d[3] = (unsigned char)(a + DIV255(d[3] * (255 - a)));
+                break;
+            case BLEND_ADD:
+                for (c = 0; c < 3; ++c) d[c] = (unsigned char)_Min(d[c] + DIV255(s[c] * a), 255);
+                break;
+            case BLEND_MUL:
+                for (c = 0; c < 3; ++c) d[c] = (unsigned char)DIV255(d[c] * s[c]);
+                break;
+        }
+    }
+}
+
+static void _PremultiplyPixels(unsigned char* pixels, int count) {
+    unsigned char* p;
+    int i = 0;
+    int c;
+
+#ifdef PIXMAP_SSE2
+    const __m128i alpha_mask = _mm_set1_epi32((int)0xff000000);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&pixels[i*4]);
+        _mm_storeu_si128((__m128i*)&pixels[i*4], _MulPixels(v, _mm_or_si128(_SplatAlpha(v), alpha_mask)));
+    }
+#endif
+    for (; i < count; ++i) {
+        p = &pixels[i*4];
+        for (c = 0; c < 3; ++c) p[c] = (unsigned char)DIV255(p[c] * p[3]);
+    }
+}
@@ -15,10 +15,19 @@ EXPORT int CALL wzGetPixmapWidth(const Pixmap* pixmap);
 EXPORT int CALL wzGetPixmapHeight(const Pixmap* pixmap);
 EXPORT int CALL wzGetPixmapColor(const Pixmap* pixmap, int x, int y);
 EXPORT void CALL wzSetPixmapColor(Pixmap* pixmap, int x, int y, int color);
+EXPORT void CALL wzFillPixmap(Pixmap* pixmap, int x, int y, int width, int height, int color);
+EXPORT void CALL wzBlitPixmap(Pixmap* pixmap, const Pixmap* src, int x, int y, int src_x, int src_y, int width, int height, int blend);
+EXPORT void CALL wzMaskPixmap(Pixmap* pixmap, int color);
+EXPORT void CALL wzPremultiplyPixmap(Pixmap* pixmap);
+EXPORT void CALL wzConvertPixmap(Pixmap* pixmap, int format);
+EXPORT void CALL wzResizePixmap(Pixmap* pixmap, int width, int height);
+EXPORT void CALL wzFlipPixmap(Pixmap* pixmap, bool_t horizontal, bool_t vertical);
 
 #ifndef SWIG
 Pixmap* _CreateEmptyPixmapFromData(const unsigned char* data, size_t len);
 const void* _GetPixmapPtr(const Pixmap* pixmap);
+bool_t _GetPixmapDirtyRect(const Pixmap* pixmap, int* x, int* y, int* width, int* height);
+void _ClearPixmapDirty(Pixmap* pixmap);
 #endif
 
 #ifdef __cplusplus
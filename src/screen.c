@@ -6,12 +6,15 @@
 #include "draw.h"
 #include "platform.h"
 #include "screen.h"
+#include "texture.h"
 #include "time.h"
 
 static void* _screen_ptr = NULL;
 static int _screen_fps = 0;
 static int _screen_fpscounter = 0;
 static float _screen_fpstime = 0;
+static int _screen_uploadbytes = 0;
+static float _screen_uploadstall = 0;
 
 EXPORT void CALL wzSetScreen(int width, int height, bool_t fullscreen, bool_t resizable) {
     _UnloadFonts();
@@ -22,9 +25,22 @@ EXPORT void CALL wzSetScreen(int width, int height, bool_t fullscreen, bool_t re
 }
 
 EXPORT void CALL wzRefreshScreen() {
+    size_t upload_bytes;
+    double upload_stall;
+
+    _FlushDraw2D();
     p_RefreshScreen(_screen_ptr);
     wzUpdateTimer();
 
+    /* Update texture upload stats */
+    lgfx_getuploadstats(&upload_bytes, &upload_stall);
+    lgfx_resetuploadstats();
+    _screen_uploadbytes = (int)upload_bytes;
+    _screen_uploadstall = (float)upload_stall;
+
+    /* Stream texture levels requested on this frame */
+    _UpdateTextureStreaming();
+
     /* Update FPS */
     ++_screen_fpscounter;
     _screen_fpstime += wzGetDeltaTime();
@@ -51,6 +67,14 @@ EXPORT int CALL wzGetScreenFPS() {
     return _screen_fps;
 }
 
+EXPORT int CALL wzGetScreenUploadBytes() {
+    return _screen_uploadbytes;
+}
+
+EXPORT float CALL wzGetScreenUploadStall() {
+    return _screen_uploadstall;
+}
+
 EXPORT bool_t CALL wzIsScreenOpened() {
     return p_IsScreenOpened(_screen_ptr);
 }
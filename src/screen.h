@@ -16,6 +16,8 @@ EXPORT void CALL wzSetScreenTitle(const char* title);
 EXPORT int CALL wzGetScreenWidth();
 EXPORT int CALL wzGetScreenHeight();
 EXPORT int CALL wzGetScreenFPS();
+EXPORT int CALL wzGetScreenUploadBytes();
+EXPORT float CALL wzGetScreenUploadStall();
 EXPORT bool_t CALL wzIsScreenOpened();
 
 EXPORT int CALL wzGetDesktopWidth();
@@ -1,46 +1,165 @@
 #include "../lib/litelibs/litegfx.h"
+#include "../lib/litelibs/litetexfile.h"
+#include "../lib/stb/stb_dxt.h"
+#include "../lib/stb/stretchy_buffer.h"
+#include "draw.h"
+#include "memblock.h"
 #include "pixmap.h"
 #include "texture.h"
 #include "util.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DDS_HEADER_SIZE 128
+#define STREAM_MINSIZE 64 /* levels up to this size are uploaded when the texture is created */
+#define STREAM_FRAMEBYTES (1024*1024) /* maximum bytes streamed in per frame */
+
+typedef struct {
+    int width;
+    int height;
+    const unsigned char* data;
+    int size;
+} StreamLevel;
+
+typedef struct {
+    unsigned char* data; /* all levels, kept in memory so evicted levels can be uploaded again */
+    StreamLevel levels[LTEXFILE_MAX_LEVELS];
+    int num_levels;
+    int compression; /* -1 if levels are in the format of the texture */
+    int min_level; /* coarsest streamed level, which is always resident */
+    int resident_level; /* finest level in video memory */
+    int wanted_level; /* finest level requested on the frame the texture was last drawn */
+    int last_used; /* frame the texture was last drawn */
+} TextureStream;
 
 static int _texture_filter = FILTER_MIPMAP;
+static bool_t _texture_compression = FALSE;
+static char _texture_cachedir[FILENAME_MAX] = "";
+static bool_t _texture_streaming = FALSE;
+static int _texture_budget = 0; /* in kilobytes, 0 for no limit */
+static size_t _texture_streammem = 0;
+static int _texture_frame = 0;
+static Texture** _texture_streams = NULL;
 
 typedef struct STexture {
     int refcount; /* use int instead of size_t because non counted textures can have negative values here */
     ltex_t* ptr;
+    char* filename; /* only set for textures loaded from disk */
+    Texture* atlas; /* atlas page the texture has been packed into, if any */
+    float u0, v0, u1, v1; /* region of the texture in the atlas page */
+    int atlas_padding; /* pixels around the region with the edges of the texture extended */
+    bool_t dirty_mipmaps; /* regions have been updated since mipmaps were generated */
+    bool_t compressed; /* levels were uploaded compressed, so regions cannot be updated */
+    TextureStream* stream; /* levels streamed in as the texture is drawn larger, if any */
 } Texture;
 
+typedef struct {
+    const unsigned char* pixels;
+    int width;
+    int height;
+    bool_t alpha;
+    unsigned char* out;
+} CompressJob;
+
+typedef struct {
+    const char* filename;
+    Memblock* memblock; /* file data, if it is not decoded to a pixmap */
+    Pixmap* pixmap;
+    bool_t decode;
+} LoadJob;
+
+static Texture* _AllocTexture(int width, int height, int format);
+static void _SetTextureRGBA(Texture* texture, const unsigned char* rgba);
+static Texture* _CreateTextureFromFile(const ltexfile_t* file);
+static Texture* _CreateCompressedTexture(const unsigned char* data, size_t len);
+static unsigned char* _CompressPixels(const unsigned char* pixels, int width, int height, size_t* out_size);
+static void _CompressBlockRows(void* data, int begin, int end);
+static unsigned char* _DownsamplePixels(const unsigned char* pixels, int width, int height);
+static void _GetTextureCacheFilename(const unsigned char* data, size_t len, char* out, size_t out_len);
+static void _SetTextureLevels(Texture* texture, const ltexfile_t* file);
+static Texture* _CreateTextureFromPixmap(const Pixmap* pixmap, int format);
+static void _SetTextureFilename(Texture* texture, const char* filename);
+static void _LoadTextureFiles(void* data, int begin, int end);
+static bool_t _CanStreamTexture(int width, int height);
+static TextureStream* _CreateStreamFromPixels(int width, int height, int format, const unsigned char* rgba);
+static TextureStream* _CreateStreamFromFile(const ltexfile_t* file);
+static void _StartTextureStreaming(Texture* texture, TextureStream* stream);
+static void _EndTextureStreaming(Texture* texture);
+static void _SetStreamResidentLevel(const Texture* texture, int level);
+static Texture* _GetTextureToStream();
+static Texture* _GetTextureToEvict(bool_t needed);
+static void _SetAtlasRegion(const Texture* texture, const unsigned char* rgba, int x, int y, int width, int height);
+
 EXPORT Texture* CALL wzCreateTexture(const Pixmap* pixmap) {
-    Texture* tex;
-    tex = wzCreateEmptyTexture(wzGetPixmapWidth(pixmap), wzGetPixmapHeight(pixmap));
-    if (tex) wzSetTexturePixels(tex, pixmap);
-    return tex;
+    return _CreateTextureFromPixels(wzGetPixmapWidth(pixmap), wzGetPixmapHeight(pixmap), FORMAT_RGBA8, _GetPixmapPtr(pixmap));
 }
 
-EXPORT Texture* CALL wzCreateEmptyTexture(int width, int height) {
-    Texture* tex = _Alloc(Texture);
-    tex->refcount = 0;
-    tex->ptr = ltex_alloc(width, height, _texture_filter);
-    return tex;
+EXPORT Texture* CALL wzCreateEmptyTexture(int width, int height, int format) {
+    /* allocate storage so regions can be updated */
+    return _CreateTextureFromPixels(width, height, format, NULL);
 }
 
 EXPORT Texture* CALL wzLoadTexture(const char* filename) {
-    Pixmap* pixmap;
+    return _LoadTexture(filename, FORMAT_RGBA8);
+}
+
+Texture* _LoadTexture(const char* filename, int format) {
+    Memblock* memblock;
     Texture* tex;
 
-    /* load pixmap */
-    pixmap = wzLoadPixmap(filename);
-    if (!pixmap) return NULL;
+    /* load file */
+    memblock = wzLoadMemblock(filename);
+    if (!memblock) return NULL;
 
     /* create texture */
-    tex = wzCreateTexture(pixmap);
+    tex = _CreateTextureFromData((const unsigned char*)memblock, wzGetMemblockSize(memblock), format);
 
-    /* delete pixmap */
-    wzDeletePixmap(pixmap);
+    /* delete file data */
+    wzDeleteMemblock(memblock);
 
+    if (tex) _SetTextureFilename(tex, filename);
     return tex;
 }
 
+EXPORT int CALL wzLoadTextures(const char** filenames, int count, Texture** out_textures) {
+    LoadJob* jobs;
+    int num_loaded = 0;
+    int i;
+
+    if (count <= 0) return 0;
+
+    /* read and decode all files in parallel. dds and ktx files, and images that are going
+       to be compressed, are decoded when created, since they are not decoded to a pixmap */
+    jobs = _AllocMany(LoadJob, count);
+    for (i = 0; i < count; ++i) {
+        jobs[i].filename = filenames[i];
+        jobs[i].memblock = NULL;
+        jobs[i].pixmap = NULL;
+        jobs[i].decode = !_texture_compression || !lgfx_compression_supported();
+    }
+    RunParallel(_LoadTextureFiles, jobs, count, 1);
+
+    /* create textures in order on this thread, which owns the context */
+    for (i = 0; i < count; ++i) {
+        if (jobs[i].pixmap) {
+            out_textures[i] = _CreateTextureFromPixmap(jobs[i].pixmap, FORMAT_RGBA8);
+            wzDeletePixmap(jobs[i].pixmap);
+        } else if (jobs[i].memblock) {
+            out_textures[i] = _CreateTextureFromData((const unsigned char*)jobs[i].memblock, wzGetMemblockSize(jobs[i].memblock), FORMAT_RGBA8);
+            wzDeleteMemblock(jobs[i].memblock);
+        } else {
+            out_textures[i] = NULL;
+        }
+        if (out_textures[i]) {
+            _SetTextureFilename(out_textures[i], filenames[i]);
+            ++num_loaded;
+        }
+    }
+
+    free(jobs);
+    return num_loaded;
+}
+
 void RetainTexture(Texture* texture) {
     ++texture->refcount;
 }
@@ -52,7 +171,11 @@ void ReleaseTexture(Texture* texture) {
 }
 
 EXPORT void CALL wzDeleteTexture(Texture* texture) {
+    _FlushDraw2D();
+    if (texture->stream) _EndTextureStreaming(texture);
+    if (texture->atlas) ReleaseTexture(texture->atlas);
     ltex_free(texture->ptr);
+    free(texture->filename);
     free(texture);
 }
 
@@ -64,9 +187,81 @@ EXPORT int CALL wzGetTextureHeight(const Texture* texture) {
     return texture->ptr->height;
 }
 
+EXPORT int CALL wzGetTextureFormat(const Texture* texture) {
+    return texture->ptr->format;
+}
+
 EXPORT void CALL wzSetTexturePixels(Texture* texture, const Pixmap* pixmap) {
+    _FlushDraw2D();
     if (texture->ptr->width == wzGetPixmapWidth(pixmap) && texture->ptr->height == wzGetPixmapHeight(pixmap)) {
-        ltex_setpixels(texture->ptr, _GetPixmapPtr(pixmap));
+        /* all levels are replaced, so the ones that are not resident do not need to be uploaded */
+        if (texture->stream) {
+            _EndTextureStreaming(texture);
+            ltex_setbaselevel(texture->ptr, 0);
+        }
+        if (texture->atlas) _SetAtlasRegion(texture, (const unsigned char*)_GetPixmapPtr(pixmap), 0, 0, texture->ptr->width, texture->ptr->height);
+        _SetTextureRGBA(texture, (const unsigned char*)_GetPixmapPtr(pixmap));
+        texture->dirty_mipmaps = FALSE;
+        texture->compressed = FALSE;
+    }
+}
+
+EXPORT void CALL wzSetTextureRegion(Texture* texture, const Pixmap* pixmap, int x, int y, int width, int height) {
+    const unsigned char* rgba;
+    unsigned char* pixels;
+    int pixel_size;
+    int row;
+
+    if (texture->ptr->width != wzGetPixmapWidth(pixmap) || texture->ptr->height != wzGetPixmapHeight(pixmap)) return;
+    if (texture->compressed) return;
+    _FlushDraw2D();
+
+    /* clip region */
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    width = _Min(width, texture->ptr->width - x);
+    height = _Min(height, texture->ptr->height - y);
+    if (width <= 0 || height <= 0) return;
+
+    /* packed textures are drawn from the atlas page, so it gets the region too */
+    if (texture->atlas) _SetAtlasRegion(texture, (const unsigned char*)_GetPixmapPtr(pixmap), x, y, width, height);
+
+    /* if the top level is not resident, the whole pixmap is uploaded instead of the region */
+    if (texture->stream) {
+        bool_t resident = texture->stream->resident_level == 0;
+        _EndTextureStreaming(texture);
+        if (!resident) {
+            ltex_setbaselevel(texture->ptr, 0);
+            _SetTextureRGBA(texture, (const unsigned char*)_GetPixmapPtr(pixmap));
+            texture->dirty_mipmaps = FALSE;
+            return;
+        }
+    }
+
+    /* rgba textures read the region from the pixmap, other formats convert it first */
+    rgba = (const unsigned char*)_GetPixmapPtr(pixmap) + (y * texture->ptr->width + x) * 4;
+    if (texture->ptr->format == FORMAT_RGBA8) {
+        ltex_setregion(texture->ptr, x, y, width, height, rgba, texture->ptr->width);
+    } else {
+        pixel_size = ltex_pixelsize(texture->ptr->format);
+        pixels = _AllocMany(unsigned char, width * height * pixel_size);
+        for (row = 0; row < height; ++row) {
+            ltex_fromrgba(texture->ptr->format, rgba + row * texture->ptr->width * 4, width, pixels + row * width * pixel_size);
+        }
+        ltex_setregion(texture->ptr, x, y, width, height, pixels, width);
+        free(pixels);
+    }
+
+    /* mipmaps are generated next time the texture is drawn, so several updates only generate them once */
+    texture->dirty_mipmaps = TRUE;
+}
+
+EXPORT void CALL wzUpdateTexturePixels(Texture* texture, Pixmap* pixmap) {
+    int x, y, width, height;
+
+    if (_GetPixmapDirtyRect(pixmap, &x, &y, &width, &height)) {
+        wzSetTextureRegion(texture, pixmap, x, y, width, height);
+        _ClearPixmapDirty(pixmap);
     }
 }
 
@@ -78,6 +273,675 @@ EXPORT void CALL wzSetTextureFilter(int filter) {
     _texture_filter = filter;
 }
 
+EXPORT bool_t CALL wzGetTextureCompression() {
+    return _texture_compression;
+}
+
+EXPORT void CALL wzSetTextureCompression(bool_t enable) {
+    _texture_compression = enable;
+}
+
+EXPORT void CALL wzSetTextureCacheDir(const char* dir) {
+    strncpy(_texture_cachedir, dir ? dir : "", sizeof(_texture_cachedir));
+    _texture_cachedir[sizeof(_texture_cachedir) - 1] = 0;
+}
+
+EXPORT bool_t CALL wzGetTextureStreaming() {
+    return _texture_streaming;
+}
+
+EXPORT void CALL wzSetTextureStreaming(bool_t enable) {
+    _texture_streaming = enable;
+}
+
+EXPORT int CALL wzGetTextureBudget() {
+    return _texture_budget;
+}
+
+EXPORT void CALL wzSetTextureBudget(int kilobytes) {
+    _texture_budget = _Max(kilobytes, 0);
+}
+
+EXPORT int CALL wzGetTextureMemory() {
+    return (int)(_texture_streammem / 1024);
+}
+
+Texture* _CreateTextureFromData(const unsigned char* data, size_t len, int format) {
+    ltexfile_t file;
+    Pixmap* pixmap;
+    Texture* tex;
+
+    /* dds and ktx files are uploaded with their stored mipmaps, without decoding them */
+    if (ltexfile_loadmem(data, len, &file)) {
+        return _CreateTextureFromFile(&file);
+    }
+
+    /* other formats are decoded, and compressed if enabled */
+    if (_texture_compression && lgfx_compression_supported()) {
+        return _CreateCompressedTexture(data, len);
+    }
+    pixmap = _CreateEmptyPixmapFromData(data, len);
+    if (!pixmap) return NULL;
+    tex = _CreateTextureFromPixmap(pixmap, format);
+    wzDeletePixmap(pixmap);
+    return tex;
+}
+
+Texture* _CreateTextureFromPixels(int width, int height, int format, const void* pixels) {
+    Texture* tex;
+    tex = _AllocTexture(width, height, format);
+    _SetTextureRGBA(tex, (const unsigned char*)pixels);
+    return tex;
+}
+
 const void* _GetTexturePtr(const Texture* texture) {
     return texture ? texture->ptr : NULL;
 }
+
+void _GetTexturePixels(const Texture* texture, unsigned char* out_pixels) {
+    /* streamed textures may not have the top level resident */
+    if (texture->stream) _SetStreamResidentLevel(texture, 0);
+    ltex_getpixels(texture->ptr, out_pixels);
+}
+
+void _UpdateTextureMipmaps(const Texture* texture) {
+    if (texture && texture->dirty_mipmaps) {
+        ltex_genmipmaps(texture->ptr);
+        ((Texture*)texture)->dirty_mipmaps = FALSE; /* mipmaps are derived data, so they can be updated on const textures */
+    }
+}
+
+const char* _GetTextureFilename(const Texture* texture) {
+    return texture ? texture->filename : NULL;
+}
+
+Texture* _GetTextureAtlas(const Texture* texture, float* u0, float* v0, float* u1, float* v1) {
+    *u0 = texture->u0;
+    *v0 = texture->v0;
+    *u1 = texture->u1;
+    *v1 = texture->v1;
+    return texture->atlas;
+}
+
+void _SetTextureAtlas(Texture* texture, Texture* atlas, float u0, float v0, float u1, float v1, int padding) {
+    RetainTexture(atlas);
+    if (texture->atlas) ReleaseTexture(texture->atlas);
+    texture->atlas = atlas;
+    texture->u0 = u0;
+    texture->v0 = v0;
+    texture->u1 = u1;
+    texture->v1 = v1;
+    texture->atlas_padding = padding;
+}
+
+static Texture* _AllocTexture(int width, int height, int format) {
+    Texture* tex = _Alloc(Texture);
+    tex->refcount = 0;
+    tex->ptr = ltex_alloc(width, height, _texture_filter, format);
+    tex->filename = NULL;
+    tex->atlas = NULL;
+    tex->u0 = 0;
+    tex->v0 = 0;
+    tex->u1 = 1;
+    tex->v1 = 1;
+    tex->atlas_padding = 0;
+    tex->dirty_mipmaps = FALSE;
+    tex->compressed = FALSE;
+    tex->stream = NULL;
+    return tex;
+}
+
+static void _SetTextureRGBA(Texture* texture, const unsigned char* rgba) {
+    unsigned char* pixels;
+
+    if (!rgba || texture->ptr->format == FORMAT_RGBA8) {
+        ltex_setpixels(texture->ptr, rgba);
+    } else {
+        pixels = _AllocMany(unsigned char, texture->ptr->width * texture->ptr->height * ltex_pixelsize(texture->ptr->format));
+        ltex_fromrgba(texture->ptr->format, rgba, texture->ptr->width * texture->ptr->height, pixels);
+        ltex_setpixels(texture->ptr, pixels);
+        free(pixels);
+    }
+}
+
+static Texture* _CreateTextureFromFile(const ltexfile_t* file) {
+    TextureStream* stream;
+    Texture* tex;
+    tex = _AllocTexture(file->levels[0].width, file->levels[0].height, FORMAT_RGBA8);
+    stream = _CanStreamTexture(file->levels[0].width, file->levels[0].height) ? _CreateStreamFromFile(file) : NULL;
+    if (stream) {
+        _StartTextureStreaming(tex, stream);
+    } else {
+        _SetTextureLevels(tex, file);
+    }
+    return tex;
+}
+
+static Texture* _CreateCompressedTexture(const unsigned char* data, size_t len) {
+    char cache_filename[FILENAME_MAX];
+    Memblock* cached;
+    Pixmap* pixmap;
+    unsigned char* dds;
+    size_t dds_size;
+    ltexfile_t file;
+    Texture* tex;
+
+    /* use the compressed data in the cache if this source was compressed before */
+    cache_filename[0] = 0;
+    if (_texture_cachedir[0] != 0) {
+        _GetTextureCacheFilename(data, len, cache_filename, sizeof(cache_filename));
+        cached = wzLoadMemblock(cache_filename);
+        if (cached) {
+            tex = ltexfile_loadmem((const unsigned char*)cached, wzGetMemblockSize(cached), &file)
+                ? _CreateTextureFromFile(&file)
+                : NULL;
+            wzDeleteMemblock(cached);
+            if (tex) return tex;
+        }
+    }
+
+    /* decode and compress */
+    pixmap = _CreateEmptyPixmapFromData(data, len);
+    if (!pixmap) return NULL;
+    dds = _CompressPixels((const unsigned char*)_GetPixmapPtr(pixmap), wzGetPixmapWidth(pixmap), wzGetPixmapHeight(pixmap), &dds_size);
+    wzDeletePixmap(pixmap);
+
+    /* store in cache, writing to a temporary file first so other processes never read it half written */
+    if (cache_filename[0] != 0) {
+        char tmp_filename[FILENAME_MAX];
+        FILE* f = NULL;
+        if (snprintf(tmp_filename, sizeof(tmp_filename), "%s.%p.tmp", cache_filename, (void*)dds) < (int)sizeof(tmp_filename)) {
+            f = fopen(tmp_filename, "wb");
+        }
+        if (f) {
+            bool_t written = fwrite(dds, 1, dds_size, f) == dds_size;
+            if (fclose(f) != 0) written = FALSE;
+
+            /* rename does not replace existing files on every platform */
+            if (written) remove(cache_filename);
+            if (!written || rename(tmp_filename, cache_filename) != 0) remove(tmp_filename);
+        }
+    }
+
+    /* upload */
+    ltexfile_loadmem(dds, dds_size, &file);
+    tex = _CreateTextureFromFile(&file);
+    free(dds);
+    return tex;
+}
+
+static unsigned char* _CompressPixels(const unsigned char* pixels, int width, int height, size_t* out_size) {
+    CompressJob job;
+    int format;
+    int num_levels;
+    int w, h;
+    int i;
+    unsigned char* dds;
+    unsigned char* offset;
+    unsigned char* level;
+    unsigned char dummy[64];
+
+    /* bc1 is used unless there are translucent pixels */
+    job.alpha = FALSE;
+    for (i = 0; i < width * height && !job.alpha; ++i) {
+        if (pixels[i*4 + 3] != 255) job.alpha = TRUE;
+    }
+    format = job.alpha ? LTEXFILE_BC3 : LTEXFILE_BC1;
+
+    /* get size of the full mipmap chain */
+    *out_size = DDS_HEADER_SIZE + ltexfile_levelsize(format, width, height);
+    num_levels = 1;
+    for (w = width, h = height; (w > 1 || h > 1) && num_levels < LTEXFILE_MAX_LEVELS; ++num_levels) {
+        w = _Max(w / 2, 1);
+        h = _Max(h / 2, 1);
+        *out_size += ltexfile_levelsize(format, w, h);
+    }
+    dds = _AllocMany(unsigned char, *out_size);
+    ltexfile_ddsheader(format, width, height, num_levels, dds);
+
+    /* stb_dxt builds its tables on first use, so do it before starting threads */
+    memset(dummy, 0, sizeof(dummy));
+    stb_compress_dxt_block(dummy, dummy, 0, STB_DXT_NORMAL);
+
+    /* compress each level, generating the next one from it */
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    offset = dds + DDS_HEADER_SIZE;
+    level = NULL;
+    for (i = 0; i < num_levels; ++i) {
+        job.out = offset;
+        RunParallel(_CompressBlockRows, &job, (job.height + 3) / 4, 4);
+        offset += ltexfile_levelsize(format, job.width, job.height);
+        if (i + 1 < num_levels) {
+            unsigned char* next = _DownsamplePixels(job.pixels, job.width, job.height);
+            free(level);
+            level = next;
+            job.pixels = level;
+            job.width = _Max(job.width / 2, 1);
+            job.height = _Max(job.height / 2, 1);
+        }
+    }
+    free(level);
+
+    return dds;
+}
+
+static void _CompressBlockRows(void* data, int begin, int end) {
+    const CompressJob* job;
+    unsigned char block[64];
+    int blocks_x;
+    int block_size;
+    int bx, by, x, y;
+
+    job = (const CompressJob*)data;
+    blocks_x = (job->width + 3) / 4;
+    block_size = job->alpha ? 16 : 8;
+    for (by = begin; by < end; ++by) {
+        for (bx = 0; bx < blocks_x; ++bx) {
+            /* copy block, repeating the last row and column on the edges */
+            for (y = 0; y < 4; ++y) {
+                for (x = 0; x < 4; ++x) {
+                    int sx = _Min(bx*4 + x, job->width - 1);
+                    int sy = _Min(by*4 + y, job->height - 1);
+                    memcpy(&block[(y*4 + x) * 4], &job->pixels[(sy*job->width + sx) * 4], 4);
+                }
+            }
+            stb_compress_dxt_block(&job->out[(by*blocks_x + bx) * block_size], block, job->alpha, STB_DXT_NORMAL);
+        }
+    }
+}
+
+static unsigned char* _DownsamplePixels(const unsigned char* pixels, int width, int height) {
+    unsigned char* out;
+    int out_width, out_height;
+    int x, y, c;
+
+    /* box filter, clamping odd sizes */
+    out_width = _Max(width / 2, 1);
+    out_height = _Max(height / 2, 1);
+    out = _AllocMany(unsigned char, out_width * out_height * 4);
+    for (y = 0; y < out_height; ++y) {
+        int y0 = _Min(y*2, height - 1);
+        int y1 = _Min(y*2 + 1, height - 1);
+        for (x = 0; x < out_width; ++x) {
+            int x0 = _Min(x*2, width - 1);
+            int x1 = _Min(x*2 + 1, width - 1);
+            for (c = 0; c < 4; ++c) {
+                out[(y*out_width + x) * 4 + c] = (unsigned char)((
+                    pixels[(y0*width + x0) * 4 + c] +
+                    pixels[(y0*width + x1) * 4 + c] +
+                    pixels[(y1*width + x0) * 4 + c] +
+                    pixels[(y1*width + x1) * 4 + c] + 2) / 4);
+            }
+        }
+    }
+
+    return out;
+}
+
+static void _GetTextureCacheFilename(const unsigned char* data, size_t len, char* out, size_t out_len) {
+    unsigned int fnv, djb;
+    size_t i;
+
+    /* key by two different hashes of the source data */
+    fnv = 2166136261u;
+    djb = 5381;
+    for (i = 0; i < len; ++i) {
+        fnv = (fnv ^ data[i]) * 16777619u;
+        djb = djb * 33 + data[i];
+    }
+    snprintf(out, out_len, "%s/%08x%08x.dds", _texture_cachedir, fnv, djb);
+}
+
+static void _SetTextureLevels(Texture* texture, const ltexfile_t* file) {
+    int num_levels;
+    unsigned char* buffer;
+    int i;
+
+    /* only mipmapped textures use the stored mipmaps */
+    num_levels = (texture->ptr->filter == F_MIPMAP) ? file->num_levels : 1;
+
+    /* upload compressed levels as they are */
+    if (ltexfile_iscompressed(file) && lgfx_compression_supported()) {
+        for (i = 0; i < num_levels; ++i) {
+            ltex_setcompressedlevel(
+                texture->ptr,
+                i,
+                C_BC1 + file->format - LTEXFILE_BC1,
+                file->levels[i].width,
+                file->levels[i].height,
+                file->levels[i].data,
+                (int)file->levels[i].size);
+        }
+        ltex_setnumlevels(texture->ptr, num_levels);
+        texture->compressed = TRUE;
+        return;
+    }
+
+    /* otherwise, upload rgba levels, decompressing them on the cpu if needed.
+       if the file has a single level, mipmaps are generated as usual */
+    buffer = (file->format != LTEXFILE_RGBA8) ? _AllocMany(unsigned char, file->levels[0].width * file->levels[0].height * 4) : NULL;
+    for (i = 0; i < num_levels; ++i) {
+        const unsigned char* pixels = file->levels[i].data;
+        if (buffer) {
+            ltexfile_decompress(file, i, buffer);
+            pixels = buffer;
+        }
+        if (num_levels == 1) {
+            ltex_setpixels(texture->ptr, pixels);
+        } else {
+            ltex_setlevel(texture->ptr, i, file->levels[i].width, file->levels[i].height, pixels);
+        }
+    }
+    if (num_levels > 1) ltex_setnumlevels(texture->ptr, num_levels);
+    free(buffer);
+}
+
+static Texture* _CreateTextureFromPixmap(const Pixmap* pixmap, int format) {
+    Texture* tex;
+
+    if (_CanStreamTexture(wzGetPixmapWidth(pixmap), wzGetPixmapHeight(pixmap))) {
+        tex = _AllocTexture(wzGetPixmapWidth(pixmap), wzGetPixmapHeight(pixmap), format);
+        _StartTextureStreaming(tex, _CreateStreamFromPixels(
+            wzGetPixmapWidth(pixmap),
+            wzGetPixmapHeight(pixmap),
+            format,
+            (const unsigned char*)_GetPixmapPtr(pixmap)));
+    } else {
+        tex = _CreateTextureFromPixels(wzGetPixmapWidth(pixmap), wzGetPixmapHeight(pixmap), format, _GetPixmapPtr(pixmap));
+    }
+    return tex;
+}
+
+static void _SetTextureFilename(Texture* texture, const char* filename) {
+    /* keep filename so meshes that use the texture can be saved */
+    texture->filename = _AllocMany(char, strlen(filename) + 1);
+    strcpy(texture->filename, filename);
+}
+
+static void _LoadTextureFiles(void* data, int begin, int end) {
+    LoadJob* jobs = (LoadJob*)data;
+    ltexfile_t file;
+    int i;
+
+    for (i = begin; i < end; ++i) {
+        jobs[i].memblock = wzLoadMemblock(jobs[i].filename);
+        if (!jobs[i].memblock || !jobs[i].decode) continue;
+        if (ltexfile_loadmem((const unsigned char*)jobs[i].memblock, wzGetMemblockSize(jobs[i].memblock), &file)) continue;
+        jobs[i].pixmap = _CreateEmptyPixmapFromData((const unsigned char*)jobs[i].memblock, wzGetMemblockSize(jobs[i].memblock));
+        wzDeleteMemblock(jobs[i].memblock);
+        jobs[i].memblock = NULL;
+    }
+}
+
+static bool_t _CanStreamTexture(int width, int height) {
+    return _texture_streaming
+        && _texture_filter == FILTER_MIPMAP
+        && lgfx_mipmapping_supported()
+        && _Max(width, height) > STREAM_MINSIZE;
+}
+
+static TextureStream* _CreateStreamFromPixels(int width, int height, int format, const unsigned char* rgba) {
+    TextureStream* stream;
+    unsigned char* level_rgba;
+    unsigned char* data;
+    size_t size;
+    int pixel_size;
+    int w, h, i;
+
+    /* get size of the full mipmap chain */
+    pixel_size = ltex_pixelsize(format);
+    stream = _Alloc(TextureStream);
+    stream->num_levels = 0;
+    size = 0;
+    w = width;
+    h = height;
+    for (;;) {
+        stream->levels[stream->num_levels].width = w;
+        stream->levels[stream->num_levels].height = h;
+        stream->levels[stream->num_levels].size = w * h * pixel_size;
+        size += w * h * pixel_size;
+        ++stream->num_levels;
+        if ((w == 1 && h == 1) || stream->num_levels == LTEXFILE_MAX_LEVELS) break;
+        w = _Max(w / 2, 1);
+        h = _Max(h / 2, 1);
+    }
+
+    /* downsample each level from the previous one and store it in the texture format */
+    stream->data = _AllocMany(unsigned char, size);
+    data = stream->data;
+    level_rgba = (unsigned char*)rgba;
+    for (i = 0; i < stream->num_levels; ++i) {
+        unsigned char* next_rgba;
+        ltex_fromrgba(format, level_rgba, stream->levels[i].width * stream->levels[i].height, data);
+        stream->levels[i].data = data;
+        data += stream->levels[i].size;
+        next_rgba = (i < stream->num_levels - 1)
+            ? _DownsamplePixels(level_rgba, stream->levels[i].width, stream->levels[i].height)
+            : NULL;
+        if (level_rgba != rgba) free(level_rgba);
+        level_rgba = next_rgba;
+    }
+    stream->compression = -1;
+
+    return stream;
+}
+
+static TextureStream* _CreateStreamFromFile(const ltexfile_t* file) {
+    TextureStream* stream;
+    unsigned char* data;
+    bool_t compressed;
+    size_t size;
+    int i;
+
+    /* the chain must reach the size uploaded on creation */
+    if (_Max(file->levels[file->num_levels - 1].width, file->levels[file->num_levels - 1].height) > STREAM_MINSIZE) return NULL;
+
+    /* levels are stored compressed if they can be uploaded that way, otherwise as rgba */
+    compressed = ltexfile_iscompressed(file) && lgfx_compression_supported();
+    stream = _Alloc(TextureStream);
+    stream->num_levels = file->num_levels;
+    size = 0;
+    for (i = 0; i < stream->num_levels; ++i) {
+        stream->levels[i].width = file->levels[i].width;
+        stream->levels[i].height = file->levels[i].height;
+        stream->levels[i].size = compressed ? (int)file->levels[i].size : file->levels[i].width * file->levels[i].height * 4;
+        size += stream->levels[i].size;
+    }
+    stream->data = _AllocMany(unsigned char, size);
+    data = stream->data;
+    for (i = 0; i < stream->num_levels; ++i) {
+        if (compressed || file->format == LTEXFILE_RGBA8) {
+            memcpy(data, file->levels[i].data, stream->levels[i].size);
+        } else {
+            ltexfile_decompress(file, i, data);
+        }
+        stream->levels[i].data = data;
+        data += stream->levels[i].size;
+    }
+    stream->compression = compressed ? (int)(C_BC1 + file->format - LTEXFILE_BC1) : -1;
+
+    return stream;
+}
+
+static void _StartTextureStreaming(Texture* texture, TextureStream* stream) {
+    /* upload the small levels, so the texture can be drawn right away */
+    stream->min_level = 0;
+    while (_Max(stream->levels[stream->min_level].width, stream->levels[stream->min_level].height) > STREAM_MINSIZE) {
+        ++stream->min_level;
+    }
+    stream->resident_level = stream->num_levels;
+    stream->wanted_level = stream->min_level;
+    stream->last_used = _texture_frame;
+    texture->stream = stream;
+    texture->compressed = stream->compression != -1;
+    ltex_setnumlevels(texture->ptr, stream->num_levels);
+    _SetStreamResidentLevel(texture, stream->min_level);
+    sb_push(_texture_streams, texture);
+}
+
+/* called when the texture is deleted or overwritten, so levels that are not resident are not uploaded */
+static void _EndTextureStreaming(Texture* texture) {
+    int i;
+
+    /* resident levels are no longer accounted in the budget */
+    for (i = texture->stream->resident_level; i < texture->stream->num_levels; ++i) {
+        _texture_streammem -= texture->stream->levels[i].size;
+    }
+
+    /* remove from the list of streamed textures */
+    for (i = 0; i < sb_count(_texture_streams); ++i) {
+        if (_texture_streams[i] == texture) {
+            _texture_streams[i] = sb_last(_texture_streams);
+            sb_pop(_texture_streams);
+            break;
+        }
+    }
+
+    free(texture->stream->data);
+    free(texture->stream);
+    texture->stream = NULL;
+}
+
+static void _SetStreamResidentLevel(const Texture* texture, int level) {
+    TextureStream* stream = texture->stream;
+    const StreamLevel* lvl;
+
+    /* upload finer levels */
+    while (stream->resident_level > level) {
+        --stream->resident_level;
+        lvl = &stream->levels[stream->resident_level];
+        if (stream->compression != -1) {
+            ltex_setcompressedlevel(texture->ptr, stream->resident_level, stream->compression, lvl->width, lvl->height, lvl->data, lvl->size);
+        } else {
+            ltex_setlevel(texture->ptr, stream->resident_level, lvl->width, lvl->height, lvl->data);
+        }
+        _texture_streammem += lvl->size;
+    }
+
+    /* free levels which are no longer needed */
+    ltex_setbaselevel(texture->ptr, level);
+    while (stream->resident_level < level) {
+        ltex_freelevel(texture->ptr, stream->resident_level);
+        _texture_streammem -= stream->levels[stream->resident_level].size;
+        ++stream->resident_level;
+    }
+}
+
+void _RequestTextureSize(const Texture* texture, float screen_size) {
+    TextureStream* stream;
+    int size, level;
+
+    if (!texture || !texture->stream) return;
+    stream = texture->stream;
+
+    /* find coarsest level which is at least as large as the texture on screen */
+    size = _Max(texture->ptr->width, texture->ptr->height);
+    level = 0;
+    while (level < stream->min_level && (size >> (level + 1)) >= screen_size) ++level;
+
+    /* keep the finest level requested on this frame */
+    if (stream->last_used != _texture_frame) {
+        stream->wanted_level = level;
+        stream->last_used = _texture_frame;
+    } else {
+        stream->wanted_level = _Min(stream->wanted_level, level);
+    }
+}
+
+void _UpdateTextureStreaming() {
+    Texture* texture;
+    size_t budget;
+    size_t streamed;
+    size_t size;
+
+    budget = (_texture_budget > 0) ? (size_t)_texture_budget * 1024 : (size_t)-1;
+
+    /* evict levels if the budget has been exceeded, first those which are not needed */
+    while (_texture_streammem > budget) {
+        texture = _GetTextureToEvict(FALSE);
+        if (!texture) texture = _GetTextureToEvict(TRUE);
+        if (!texture) break;
+        _SetStreamResidentLevel(texture, texture->stream->resident_level + 1);
+    }
+
+    /* stream in one level at a time for the textures that are further from their requested level,
+       making room only with levels that are not needed */
+    streamed = 0;
+    while (streamed < STREAM_FRAMEBYTES && (texture = _GetTextureToStream()) != NULL) {
+        Texture* evicted;
+        size = texture->stream->levels[texture->stream->resident_level - 1].size;
+        while (_texture_streammem + size > budget && (evicted = _GetTextureToEvict(FALSE)) != NULL) {
+            _SetStreamResidentLevel(evicted, evicted->stream->resident_level + 1);
+        }
+        if (_texture_streammem + size > budget) break;
+        _SetStreamResidentLevel(texture, texture->stream->resident_level - 1);
+        streamed += size;
+    }
+
+    ++_texture_frame;
+}
+
+static Texture* _GetTextureToStream() {
+    Texture* best = NULL;
+    int best_distance = 0;
+    int i;
+
+    for (i = 0; i < sb_count(_texture_streams); ++i) {
+        const TextureStream* stream = _texture_streams[i]->stream;
+        int distance = stream->resident_level - stream->wanted_level;
+        if (stream->last_used == _texture_frame && distance > best_distance) {
+            best = _texture_streams[i];
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+static Texture* _GetTextureToEvict(bool_t needed) {
+    Texture* best = NULL;
+    int i;
+
+    /* least recently used first, and finest levels first among textures used on the same frame */
+    for (i = 0; i < sb_count(_texture_streams); ++i) {
+        const TextureStream* stream = _texture_streams[i]->stream;
+        if (stream->resident_level >= stream->min_level) continue;
+        if (!needed && stream->last_used == _texture_frame && stream->resident_level >= stream->wanted_level) continue;
+        if (!best
+                || stream->last_used < best->stream->last_used
+                || (stream->last_used == best->stream->last_used && stream->resident_level < best->stream->resident_level)) {
+            best = _texture_streams[i];
+        }
+    }
+    return best;
+}
+
+static void _SetAtlasRegion(const Texture* texture, const unsigned char* rgba, int x, int y, int width, int height) {
+    Texture* page = texture->atlas;
+    unsigned char* pixels;
+    int page_x, page_y;
+    int x0, y0, x1, y1;
+    int px, py;
+
+    /* regions touching the edges of the texture also update the padding, extending the edges over it */
+    x0 = (x == 0) ? -texture->atlas_padding : x;
+    y0 = (y == 0) ? -texture->atlas_padding : y;
+    x1 = (x + width == texture->ptr->width) ? x + width + texture->atlas_padding : x + width;
+    y1 = (y + height == texture->ptr->height) ? y + height + texture->atlas_padding : y + height;
+    pixels = _AllocMany(unsigned char, (x1 - x0) * (y1 - y0) * 4);
+    for (py = y0; py < y1; ++py) {
+        int src_y = _Clamp(py, 0, texture->ptr->height - 1);
+        for (px = x0; px < x1; ++px) {
+            int src_x = _Clamp(px, 0, texture->ptr->width - 1);
+            memcpy(&pixels[((py - y0) * (x1 - x0) + px - x0) * 4], &rgba[(src_y * texture->ptr->width + src_x) * 4], 4);
+        }
+    }
+
+    /* pages are always rgba */
+    page_x = (int)(texture->u0 * page->ptr->width + 0.5f);
+    page_y = (int)(texture->v0 * page->ptr->height + 0.5f);
+    ltex_setregion(page->ptr, page_x + x0, page_y + y0, x1 - x0, y1 - y0, pixels, x1 - x0);
+    page->dirty_mipmaps = TRUE;
+    free(pixels);
+}
@@ -7,13 +7,21 @@
 #define FILTER_LINEAR 1
 #define FILTER_MIPMAP 2
 
+#define FORMAT_RGBA8 0
+#define FORMAT_A8 1
+#define FORMAT_L8 2
+#define FORMAT_LA8 3
+#define FORMAT_RGB565 4
+#define FORMAT_RGBA4444 5
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 EXPORT Texture* CALL wzCreateTexture(const Pixmap* pixmap);
-EXPORT Texture* CALL wzCreateEmptyTexture(int width, int height);
+EXPORT Texture* CALL wzCreateEmptyTexture(int width, int height, int format);
 EXPORT Texture* CALL wzLoadTexture(const char* filename);
+EXPORT int CALL wzLoadTextures(const char** filenames, int count, Texture** out_textures);
 #ifndef SWIG
 void RetainTexture(Texture* texture);
 void ReleaseTexture(Texture* texture);
@@ -21,13 +29,34 @@ void ReleaseTexture(Texture* texture);
 EXPORT void CALL wzDeleteTexture(Texture* texture);
 EXPORT int CALL wzGetTextureWidth(const Texture* texture);
 EXPORT int CALL wzGetTextureHeight(const Texture* texture);
+EXPORT int CALL wzGetTextureFormat(const Texture* texture);
 EXPORT void CALL wzSetTexturePixels(Texture* texture, const Pixmap* pixmap);
+EXPORT void CALL wzSetTextureRegion(Texture* texture, const Pixmap* pixmap, int x, int y, int width, int height);
+EXPORT void CALL wzUpdateTexturePixels(Texture* texture, Pixmap* pixmap);
 
 EXPORT int CALL wzGetTextureFilter();
 EXPORT void CALL wzSetTextureFilter(int filter);
+EXPORT bool_t CALL wzGetTextureCompression();
+EXPORT void CALL wzSetTextureCompression(bool_t enable);
+EXPORT void CALL wzSetTextureCacheDir(const char* dir);
+EXPORT bool_t CALL wzGetTextureStreaming();
+EXPORT void CALL wzSetTextureStreaming(bool_t enable);
+EXPORT int CALL wzGetTextureBudget();
+EXPORT void CALL wzSetTextureBudget(int kilobytes);
+EXPORT int CALL wzGetTextureMemory();
 
 #ifndef SWIG
+Texture* _LoadTexture(const char* filename, int format);
+Texture* _CreateTextureFromData(const unsigned char* data, size_t len, int format);
+Texture* _CreateTextureFromPixels(int width, int height, int format, const void* pixels);
 const void* _GetTexturePtr(const Texture* texture);
+void _GetTexturePixels(const Texture* texture, unsigned char* out_pixels);
+void _UpdateTextureMipmaps(const Texture* texture);
+const char* _GetTextureFilename(const Texture* texture);
+Texture* _GetTextureAtlas(const Texture* texture, float* u0, float* v0, float* u1, float* v1);
+void _SetTextureAtlas(Texture* texture, Texture* atlas, float u0, float v0, float u1, float v1, int padding);
+void _RequestTextureSize(const Texture* texture, float screen_size);
+void _UpdateTextureStreaming();
 #endif
 
 #ifdef __cplusplus
@@ -28,6 +28,7 @@ struct SMesh;
 struct SObject;
 struct SPixmap;
 struct STexture;
+struct SText;
 struct SViewer;
 typedef struct SFont Font;
 typedef struct SLight Light;
@@ -37,6 +38,7 @@ typedef struct SMesh Mesh;
 typedef struct SObject Object;
 typedef struct SPixmap Pixmap;
 typedef struct STexture Texture;
+typedef struct SText Text;
 typedef struct SViewer Viewer;
 
 #include <stdlib.h>
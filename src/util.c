@@ -3,6 +3,22 @@
 #include <string.h>
 #include <ctype.h>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define MAX_THREADS 16
+
+typedef struct {
+    ParallelJob job;
+    void* data;
+    int begin;
+    int end;
+} ParallelRange;
+
 #ifndef _MSC_VER
 #include <dirent.h>
 #include <unistd.h>
@@ -166,3 +182,76 @@ void WriteString(const char* str, const char* filename, bool_t append) {
     /* close file */
     fclose(f);
 }
+
+int GetNumCores() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (int)count : 1;
+#else
+    return 1;
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI _RunParallelRange(LPVOID param) {
+#else
+static void* _RunParallelRange(void* param) {
+#endif
+    ParallelRange* range = (ParallelRange*)param;
+    range->job(range->data, range->begin, range->end);
+    return 0;
+}
+
+void RunParallel(ParallelJob job, void* data, int count, int min_chunk) {
+    ParallelRange ranges[MAX_THREADS];
+#ifdef _WIN32
+    HANDLE threads[MAX_THREADS];
+#else
+    pthread_t threads[MAX_THREADS];
+#endif
+    bool_t started[MAX_THREADS];
+    int num_threads;
+    int i;
+
+    /* use one thread per core, as long as each one gets at least min_chunk items */
+    num_threads = _Min(GetNumCores(), MAX_THREADS);
+    if (min_chunk > 0) num_threads = _Min(num_threads, count / min_chunk);
+    if (num_threads <= 1) {
+        if (count > 0) job(data, 0, count);
+        return;
+    }
+
+    /* split range, and run the first chunk in the calling thread */
+    for (i = 0; i < num_threads; ++i) {
+        ranges[i].job = job;
+        ranges[i].data = data;
+        ranges[i].begin = (int)((long)count * i / num_threads);
+        ranges[i].end = (int)((long)count * (i + 1) / num_threads);
+    }
+    for (i = 1; i < num_threads; ++i) {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, _RunParallelRange, &ranges[i], 0, NULL);
+        started[i] = threads[i] != NULL;
+#else
+        started[i] = pthread_create(&threads[i], NULL, _RunParallelRange, &ranges[i]) == 0;
+#endif
+        /* if the thread could not be created, run its chunk here */
+        if (!started[i]) _RunParallelRange(&ranges[i]);
+    }
+    _RunParallelRange(&ranges[0]);
+
+    /* wait for all threads */
+    for (i = 1; i < num_threads; ++i) {
+        if (!started[i]) continue;
+#ifdef _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+}
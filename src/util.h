@@ -13,6 +13,9 @@ extern "C" {
 #define _Alloc(T)                ((T*)malloc(sizeof(T)))
 #define _AllocMany(T,N)     ((T*)malloc(N*sizeof(T)))
 
+/* job that processes the items in range [begin, end) */
+typedef void (* ParallelJob)(void* data, int begin, int end);
+
 void StripExt(const char* filename, char* out, size_t len);
 void ExtractExt(const char* filename, char* out, size_t len);
 void StripDir(const char* filename, char* out, size_t len);
@@ -22,6 +25,8 @@ void GetCurrentDir(char* out, size_t len);
 bool_t ChangeDir(const char* path);
 int StringCompareLower(char const *a, char const *b);
 void WriteString(const char* str, const char* filename, bool_t append);
+int GetNumCores();
+void RunParallel(ParallelJob job, void* data, int count, int min_chunk);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -2,6 +2,7 @@
 #include "../lib/litelibs/litemath3d.h"
 #include "viewer.h"
 #include "color.h"
+#include "draw.h"
 #include "light.h"
 #include "material.h"
 #include "mesh.h"
@@ -32,9 +33,13 @@ typedef struct SViewer {
 
 static const Viewer* _view_active_viewer = NULL;
 static lmat4_t _view_matrix;
+static float _view_pixelscale = 1; /* pixels per unit at distance 1, or at any distance in ortho mode */
+static float _view_rect[4] = {0, 0, 1, 1}; /* viewport from the top left corner of the screen */
+static float _view_extents[2] = {1, 1}; /* half size of the view at distance 1, or at any distance in ortho mode */
 static Mesh* _viewer_skybox = NULL;
 
 static Mesh* _SetupViewerSkyboxMesh(Texture* texture);
+static lvec3_t _Unproject(float x, float y, float depth);
 
 EXPORT Viewer* CALL wzCreateViewer() {
     Viewer* viewer = _Alloc(Viewer);
@@ -179,12 +184,16 @@ EXPORT void CALL wzSetViewerFogDistance(Viewer* viewer, float min, float max) {
 EXPORT void CALL wzPrepareViewer(const Viewer* viewer) {
     int vp_w;
     int vp_h;
+    int screen_h;
     float ratio;
     float halfrange;
     lmat4_t proj;
     lmat4_t modelview;
     lquat_t q;
 
+    /* draw pending 2D primitives before changing the render state */
+    _FlushDraw2D();
+
     /* set active viewer */
     _view_active_viewer = viewer;
 
@@ -192,14 +201,20 @@ EXPORT void CALL wzPrepareViewer(const Viewer* viewer) {
 #ifndef PLATFORM_NULL
     vp_w = (viewer->vw != -1) ? viewer->vw : wzGetScreenWidth() - viewer->vx;
     vp_h = (viewer->vh != -1) ? viewer->vh : wzGetScreenHeight() - viewer->vy;
+    screen_h = wzGetScreenHeight();
 #else
     vp_w = viewer->vw;
     vp_h = viewer->vh;
+    screen_h = viewer->vy + vp_h;
 #endif
 
     /* set viewport (must be done before setting projection) */
     lgfx_setup3d(0, 0);
     lgfx_setviewport(viewer->vx, viewer->vy, vp_w, vp_h);
+    _view_rect[0] = (float)viewer->vx;
+    _view_rect[1] = (float)(screen_h - viewer->vy - vp_h);
+    _view_rect[2] = (float)vp_w;
+    _view_rect[3] = (float)vp_h;
 
     /* prepare projection */
     ratio = vp_w / (float)vp_h;
@@ -208,8 +223,14 @@ EXPORT void CALL wzPrepareViewer(const Viewer* viewer) {
         height = viewer->min * tan(lm_deg2rad(viewer->fov)) * 2;
         width = height * ratio;
         proj = lmat4_ortholh(-width, width, -height, height, viewer->min, viewer->max);
+        _view_pixelscale = vp_h / (height * 2);
+        _view_extents[0] = width;
+        _view_extents[1] = height;
     } else {
         proj = lmat4_perspectivelh(lm_deg2rad(viewer->fov), ratio, viewer->min, viewer->max);
+        _view_pixelscale = vp_h / (float)(tan(lm_deg2rad(viewer->fov) / 2) * 2);
+        _view_extents[1] = (float)tan(lm_deg2rad(viewer->fov) / 2);
+        _view_extents[0] = _view_extents[1] * ratio;
     }
     lgfx_setprojection(proj.m);
 
@@ -244,12 +265,19 @@ EXPORT void CALL wzPrepareViewer(const Viewer* viewer) {
             lgfx_setmodelview(modelview.m);
 
             /* draw skybox */
+            _RequestTextureSize(viewer->skybox, (float)_Max(vp_w, vp_h));
             _DrawMesh(_SetupViewerSkyboxMesh(viewer->skybox), NULL);
 
             break;
     }
 }
 
+EXPORT float CALL wzUnprojectX(float x, float y, float depth) { return _Unproject(x, y, depth).x; }
+
+EXPORT float CALL wzUnprojectY(float x, float y, float depth) { return _Unproject(x, y, depth).y; }
+
+EXPORT float CALL wzUnprojectZ(float x, float y, float depth) { return _Unproject(x, y, depth).z; }
+
 const Viewer* _GetActiveViewer() {
     return _view_active_viewer;
 }
@@ -258,6 +286,31 @@ const void* _GetActiveMatrix() {
     return &_view_matrix;
 }
 
+float _GetViewerScreenSize(float size, float depth) {
+    if (_view_active_viewer && _view_active_viewer->ortho) return size * _view_pixelscale;
+    if (depth < 0.0001f) depth = 0.0001f;
+    return size * _view_pixelscale / depth;
+}
+
+static lvec3_t _Unproject(float x, float y, float depth) {
+    const float* m = _view_matrix.m;
+    float nx, ny;
+    lvec3_t v;
+
+    /* get the point in view space */
+    nx = (x - _view_rect[0]) / _view_rect[2] * 2 - 1;
+    ny = 1 - (y - _view_rect[1]) / _view_rect[3] * 2;
+    if (_view_active_viewer && _view_active_viewer->ortho) v = lvec3(nx * _view_extents[0], ny * _view_extents[1], depth);
+    else v = lvec3(nx * _view_extents[0] * depth, ny * _view_extents[1] * depth, depth);
+
+    /* the view matrix only rotates and translates, so its inverse rotation is the transpose */
+    v = lvec3_sub(v, lvec3(m[12], m[13], m[14]));
+    return lvec3(
+        m[0]*v.x + m[1]*v.y + m[2]*v.z,
+        m[4]*v.x + m[5]*v.y + m[6]*v.z,
+        m[8]*v.x + m[9]*v.y + m[10]*v.z);
+}
+
 static Mesh* _SetupViewerSkyboxMesh(Texture* texture) {
     if (!_viewer_skybox) _viewer_skybox = _CreateSkyboxMesh();
     wzSetMaterialTexture(GetMeshMaterial(_viewer_skybox, 0), texture);
@@ -50,10 +50,14 @@ EXPORT float CALL wzGetViewerFogDistanceMin(const Viewer* viewer);
 EXPORT float CALL wzGetViewerFogDistanceMax(const Viewer* viewer);
 EXPORT void CALL wzSetViewerFogDistance(Viewer* viewer, float min, float max);
 EXPORT void CALL wzPrepareViewer(const Viewer* viewer);
+EXPORT float CALL wzUnprojectX(float x, float y, float depth);
+EXPORT float CALL wzUnprojectY(float x, float y, float depth);
+EXPORT float CALL wzUnprojectZ(float x, float y, float depth);
 
 #ifndef SWIG
 const Viewer* _GetActiveViewer();
 const void* _GetActiveMatrix();
+float _GetViewerScreenSize(float size, float depth); /* size in pixels of a length at the given depth in view space */
 #endif
 
 #ifdef __cplusplus
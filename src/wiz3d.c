@@ -3,10 +3,18 @@
 #include "draw.h"
 #include "platform.h"
 #define LITE_ASSBIN_USE_GFX
+#define LITE_ASSBIN_USE_STBI
 #define LITE_MD2_USE_GFX
+#define LITE_GLB_USE_GFX
 #define LITE_ASSBIN_IMPLEMENTATION
 #include "../lib/litelibs/liteassbin.h"
 #undef LITE_ASSBIN_IMPLEMENTATION
+#define LITE_GLB_IMPLEMENTATION
+#include "../lib/litelibs/liteglb.h"
+#undef LITE_GLB_IMPLEMENTATION
+#define LITE_TEXFILE_IMPLEMENTATION
+#include "../lib/litelibs/litetexfile.h"
+#undef LITE_TEXFILE_IMPLEMENTATION
 #define LITE_COL_IMPLEMENTATION
 #include "../lib/litelibs/litecol.h"
 #undef LITE_COL_IMPLEMENTATION
@@ -22,6 +30,15 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include "../lib/stb/stb_image.h"
 #undef STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_RESIZE_IMPLEMENTATION
+#include "../lib/stb/stb_image_resize.h"
+#undef STB_IMAGE_RESIZE_IMPLEMENTATION
+#define STB_DXT_IMPLEMENTATION
+#include "../lib/stb/stb_dxt.h"
+#undef STB_DXT_IMPLEMENTATION
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "../lib/stb/stb_rect_pack.h"
+#undef STB_RECT_PACK_IMPLEMENTATION
 #define STB_TRUETYPE_IMPLEMENTATION
 #include "../lib/stb/stb_truetype.h"
 #undef STB_TRUETYPE_IMPLEMENTATION
@@ -46,6 +63,7 @@ EXPORT void CALL wzShutdownWiz3D() {
     if (_GetScreenPtr()) p_CloseScreen(_GetScreenPtr());
 #endif
     p_Shutdown();
+    lassbin_freepool();
 }
 
 EXPORT bool_t CALL wzIsMultitexturingSupported() {
@@ -55,3 +73,7 @@ EXPORT bool_t CALL wzIsMultitexturingSupported() {
 EXPORT bool_t CALL wzIsMipmappingSupported() {
     return lgfx_mipmapping_supported();
 }
+
+EXPORT bool_t CALL wzIsTextureCompressionSupported() {
+    return lgfx_compression_supported();
+}
@@ -1,6 +1,7 @@
 #ifndef WIZ3D_H_INCLUDED
 #define WIZ3D_H_INCLUDED
 
+#include "atlas.h"
 #include "audio.h"
 #include "colbox.h"
 #include "color.h"
@@ -26,6 +27,7 @@ EXPORT bool_t CALL wzInitWiz3D();
 EXPORT void CALL wzShutdownWiz3D();
 EXPORT bool_t CALL wzIsMultitexturingSupported();
 EXPORT bool_t CALL wzIsMipmappingSupported();
+EXPORT bool_t CALL wzIsTextureCompressionSupported();
 
 #ifdef __cplusplus
 } /* extern "C" */
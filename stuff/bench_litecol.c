@@ -0,0 +1,80 @@
+/* Measures the box tests per second of the scalar and batch litecol functions */
+#define LITE_COL_IMPLEMENTATION
+#include "../lib/litelibs/litecol.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NUM_BOXES 20000
+#define NUM_QUERIES 2000
+
+static float minx[NUM_BOXES], miny[NUM_BOXES], minz[NUM_BOXES];
+static float maxx[NUM_BOXES], maxy[NUM_BOXES], maxz[NUM_BOXES];
+static float queries[NUM_QUERIES][3];
+
+static float Rand(float max) { return rand() / (float)RAND_MAX * max; }
+
+static void Report(const char* name, clock_t begin, int hits) {
+    double seconds = (double)(clock() - begin) / CLOCKS_PER_SEC;
+    printf("%-16s %8.1f M tests/s (%d hits)\n", name, (double)NUM_BOXES * NUM_QUERIES / seconds / 1000000.0, hits);
+}
+
+int main() {
+    clock_t begin;
+    int hits, q, i;
+
+    /* queries are placed below the boxes, so every box is tested */
+    for (i = 0; i < NUM_BOXES; ++i) {
+        minx[i] = Rand(1000);
+        miny[i] = Rand(50);
+        minz[i] = Rand(1000);
+        maxx[i] = minx[i] + 1 + Rand(10);
+        maxy[i] = miny[i] + 1 + Rand(5);
+        maxz[i] = minz[i] + 1 + Rand(10);
+    }
+    for (q = 0; q < NUM_QUERIES; ++q) {
+        queries[q][0] = Rand(1000);
+        queries[q][1] = -10 + Rand(5);
+        queries[q][2] = Rand(1000);
+    }
+
+    begin = clock();
+    hits = 0;
+    for (q = 0; q < NUM_QUERIES; ++q) {
+        for (i = 0; i < NUM_BOXES; ++i) {
+            if (lcol_boxbox(minx[i], miny[i], minz[i], maxx[i], maxy[i], maxz[i], queries[q][0], queries[q][1], queries[q][2], queries[q][0] + 2, queries[q][1] + 2, queries[q][2] + 2)) {
+                ++hits;
+                break;
+            }
+        }
+    }
+    Report("boxbox", begin, hits);
+
+    begin = clock();
+    hits = 0;
+    for (q = 0; q < NUM_QUERIES; ++q) {
+        if (lcol_boxbox_soa(minx, miny, minz, maxx, maxy, maxz, NUM_BOXES, queries[q][0], queries[q][1], queries[q][2], queries[q][0] + 2, queries[q][1] + 2, queries[q][2] + 2) != -1) ++hits;
+    }
+    Report("boxbox_soa", begin, hits);
+
+    begin = clock();
+    hits = 0;
+    for (q = 0; q < NUM_QUERIES; ++q) {
+        for (i = 0; i < NUM_BOXES; ++i) {
+            if (lcol_boxsphere(minx[i], miny[i], minz[i], maxx[i], maxy[i], maxz[i], queries[q][0], queries[q][1], queries[q][2], 4)) {
+                ++hits;
+                break;
+            }
+        }
+    }
+    Report("boxsphere", begin, hits);
+
+    begin = clock();
+    hits = 0;
+    for (q = 0; q < NUM_QUERIES; ++q) {
+        if (lcol_boxsphere_soa(minx, miny, minz, maxx, maxy, maxz, NUM_BOXES, queries[q][0], queries[q][1], queries[q][2], 4) != -1) ++hits;
+    }
+    Report("boxsphere_soa", begin, hits);
+
+    return 0;
+}
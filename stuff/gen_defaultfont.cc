@@ -1,8 +1,42 @@
 #include "../lib/base64/base64.h"
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "../lib/stb/stb_truetype.h"
 #include <fstream>
 #include <string>
 #include <vector>
 
+// bakes the font the same way as CreateFontFromMemblock, and writes the atlas and glyphs
+static void write_baked_font(std::ofstream& fs, const std::vector<unsigned char>& data, float height) {
+  stbtt_bakedchar glyphs[94];
+  int w = 256, h = 256, rows;
+  std::vector<unsigned char> atlas(w * h);
+  while ( (rows = stbtt_BakeFontBitmap(&data[0], 0, height, &atlas[0], w, h, 32, 94, glyphs)) <= 0 ) {
+    if ( w == h ) w *= 2;
+    else h *= 2;
+    atlas.resize(w * h);
+  }
+
+  // only keep the rows in use
+  int atlas_height = 1;
+  while ( atlas_height < rows ) atlas_height *= 2;
+
+  fs << "#define DEFAULT_FONT_HEIGHT " << height << "\n";
+  fs << "#define DEFAULT_FONT_ATLAS_WIDTH " << w << "\n";
+  fs << "#define DEFAULT_FONT_ATLAS_HEIGHT " << atlas_height << "\n";
+  fs << "static const unsigned char DEFAULT_FONT_ATLAS[] = {";
+  for ( int i = 0; i < w * atlas_height; ++i ) {
+    if ( i % 32 == 0 ) fs << "\n  ";
+    fs << int(atlas[i]) << ",";
+  }
+  fs << "\n};\n";
+  fs << "static const float DEFAULT_FONT_GLYPHS[] = { /* x0, y0, x1, y1, xoff, yoff, xadvance */";
+  for ( int i = 0; i < 94; ++i ) {
+    fs << "\n  " << glyphs[i].x0 << "," << glyphs[i].y0 << "," << glyphs[i].x1 << "," << glyphs[i].y1 << ",";
+    fs << glyphs[i].xoff << "," << glyphs[i].yoff << "," << glyphs[i].xadvance << ",";
+  }
+  fs << "\n};\n";
+}
+
 int main(int, char**) {
   // read font file
   std::ifstream ifs("LiberationMono-Regular.ttf", std::ios_base::ate | std::ios_base::binary);
@@ -17,11 +51,17 @@ int main(int, char**) {
   char* encoded = new char[encoded_size + 1];
   encoded[encoded_size] = 0;
   base64_encode(&data[0], data.size(), encoded);
-  
-  // write output
+
+  // write output. the font file is still needed to rasterize glyphs out of the baked range
   std::ofstream fs("../src/default_font.h", std::ios_base::binary | std::ios_base::trunc);
+  fs.precision(9);
   fs << "#define DEFAULT_FONT \"" << encoded << "\"\n";
   fs << "#define DEFAULT_FONT_BLOCKSIZE " << encoded_size << "\n";
+  fs << "#ifdef USE_RETINA\n";
+  write_baked_font(fs, data, 28);
+  fs << "#else\n";
+  write_baked_font(fs, data, 14);
+  fs << "#endif\n";
   fs.close();
 
   delete[] encoded;
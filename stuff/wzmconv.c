@@ -0,0 +1,35 @@
+/* Converts any model that wiz3d can load into the baked .wzm format */
+#include "../src/wiz3d.h"
+#include <stdio.h>
+
+int main(int argc, char* argv[]) {
+    Object* object;
+    bool_t ok;
+
+    if (argc != 3) {
+        printf("usage: wzmconv <input model> <output.wzm>\n");
+        return -1;
+    }
+
+    if (!wzInitWiz3D()) return -1;
+#ifndef PLATFORM_NULL
+    /* textures live in video memory, so a context is required to load the model */
+    wzSetScreen(64, 64, FALSE, FALSE);
+#endif
+
+    /* load model */
+    object = wzLoadObject(argv[1]);
+    if (!object) {
+        printf("could not load '%s'\n", argv[1]);
+        wzShutdownWiz3D();
+        return -1;
+    }
+
+    /* save baked model */
+    ok = wzSaveObject(object, argv[2]);
+    if (!ok) printf("could not write '%s'\n", argv[2]);
+    wzDeleteObject(object);
+
+    wzShutdownWiz3D();
+    return ok ? 0 : -1;
+}